@@ -32,7 +32,7 @@ wxString ftsKeywords = wxT(" gettoken lextypes headline init lexize");
 
 // Additional pgScript keywords we should highlight
 wxString pgscriptKeywords = wxT(" assert break columns continue date datetime file go lines ")
-                            wxT(" log print record reference regexrmline string waitfor while");
+                            wxT(" log parallel print record reference regexrmline string waitfor while");
 
 BEGIN_EVENT_TABLE(ctlSQLBox, wxStyledTextCtrl)
 	EVT_KEY_DOWN(ctlSQLBox::OnKeyDown)
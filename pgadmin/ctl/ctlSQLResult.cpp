@@ -28,6 +28,8 @@ ctlSQLResult::ctlSQLResult(wxWindow *parent, pgConn *_conn, wxWindowID id, const
 {
 	conn = _conn;
 	thread = NULL;
+	streamChunkRows = 0;
+	streamMaxRows = 0;
 
 	SetTable(new sqlResultTable(), true);
 
@@ -134,6 +136,9 @@ int ctlSQLResult::Execute(const wxString &query, int resultToRetrieve, wxWindow
 
 	((sqlResultTable *)GetTable())->SetThread(thread);
 
+	if (streamChunkRows > 0)
+		thread->SetStreaming(streamChunkRows, streamMaxRows);
+
 	thread->Run();
 	return RunStatus();
 }
@@ -164,12 +169,20 @@ void ctlSQLResult::DisplayData(bool single)
 	if (!thread || !thread->DataValid())
 		return;
 
-	if (thread->ReturnCode() != PGRES_TUPLES_OK)
+	// While a streamed result is still arriving, the return code is not
+	// known yet
+	bool interim = thread->IsRunning();
+	if (thread->ReturnCode() != PGRES_TUPLES_OK && !interim)
 		return;
 
 	rowcountSuppressed = single;
 	Freeze();
 
+	// The grid asks for the same cells over and over while scrolling, so
+	// decode each column once rather than on every repaint. Streamed
+	// results keep only some of their rows in memory, and aren't cached.
+	thread->DataSet()->EnableColumnCache();
+
 	/*
 	 * Resize and repopulate by informing it to delete all the rows and
 	 * columns, then append the correct number of them. Probably is a
@@ -207,6 +220,16 @@ void ctlSQLResult::DisplayData(bool single)
 		for (col = 0 ; col < nCols ; col++)
 		{
 			colNames.Add(thread->DataSet()->ColName(col));
+
+			// The connection is busy with the transfer, so the type details
+			// can only be looked up once it is complete
+			if (interim)
+			{
+				colTypes.Add(wxT(""));
+				colTypClasses.Add(0L);
+				continue;
+			}
+
 			colTypes.Add(thread->DataSet()->ColFullType(col));
 			colTypClasses.Add(thread->DataSet()->ColTypClass(col));
 
@@ -226,6 +249,50 @@ void ctlSQLResult::DisplayData(bool single)
 
 
 
+long ctlSQLResult::FetchStreamedRows()
+{
+	if (!IsStreaming())
+		return 0;
+
+	return thread->FetchStreamedRows();
+}
+
+
+// Show the rows of a streamed result which have arrived since the last call
+void ctlSQLResult::DisplayStreamedRows()
+{
+	if (!IsStreaming())
+		return;
+
+	long oldRows = GetNumberRows();
+	long newRows = FetchStreamedRows();
+
+	if (newRows <= oldRows)
+		return;
+
+	if (!GetNumberCols())
+	{
+		DisplayData();
+		return;
+	}
+
+	wxGridTableMessage msg(GetTable(), wxGRIDTABLE_NOTIFY_ROWS_APPENDED, newRows - oldRows);
+	ProcessTableMessage(msg);
+}
+
+
+// Stop a streamed transfer, keeping the rows received so far. Returns false
+// if there is nothing to keep, and the query should be aborted instead.
+bool ctlSQLResult::StopStreaming()
+{
+	if (!IsStreaming() || !thread->IsRunning() || !thread->StreamedRows())
+		return false;
+
+	thread->StopStreaming();
+	return true;
+}
+
+
 wxString ctlSQLResult::GetMessagesAndClear()
 {
 	if (thread)
@@ -326,16 +393,17 @@ wxString sqlResultTable::GetValue(int row, int col)
 
 				wxString decimalMark = wxT(".");
 				wxString s = thread->DataSet()->GetVal(col);
+				// No type lookups while a streamed result is still arriving
+				bool isNumeric = !thread->IsRunning() &&
+				                 thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC;
 
-				if(thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC &&
-				        settings->GetDecimalMark().Length() > 0)
+				if(isNumeric && settings->GetDecimalMark().Length() > 0)
 				{
 					decimalMark = settings->GetDecimalMark();
 					s.Replace(wxT("."), decimalMark);
 
 				}
-				if (thread->DataSet()->ColTypClass(col) == PGTYPCLASS_NUMERIC &&
-				        settings->GetThousandsSeparator().Length() > 0)
+				if (isNumeric && settings->GetThousandsSeparator().Length() > 0)
 				{
 					/* Add thousands separator */
 					size_t pos = s.find(decimalMark);
@@ -351,12 +419,10 @@ wxString sqlResultTable::GetValue(int row, int col)
 				}
 				else
 				{
-					wxString data = thread->DataSet()->GetVal(col);
-
-					if (data.Length() > (size_t)settings->GetMaxColSize())
-						return thread->DataSet()->GetVal(col).Left(settings->GetMaxColSize()) + wxT(" (...)");
+					if (s.Length() > (size_t)settings->GetMaxColSize())
+						return s.Left(settings->GetMaxColSize()) + wxT(" (...)");
 					else
-						return thread->DataSet()->GetVal(col);
+						return s;
 				}
 			}
 		}
@@ -382,8 +448,13 @@ int sqlResultTable::GetNumberRows()
 wxString sqlResultTable::GetColLabelValue(int col)
 {
 	if (thread && thread->DataValid())
+	{
+		if (thread->IsRunning())
+			return thread->DataSet()->ColName(col);
+
 		return thread->DataSet()->ColName(col) + wxT("\n") +
 		       thread->DataSet()->ColFullType(col);
+	}
 	return wxEmptyString;
 }
 
@@ -19,18 +19,26 @@
 #include "ctl/explainCanvas.h"
 
 
-BEGIN_EVENT_TABLE(ExplainCanvas, wxShapeCanvas)
+BEGIN_EVENT_TABLE(ExplainCanvas, wxScrolledWindow)
+	EVT_PAINT(ExplainCanvas::OnPaint)
 	EVT_MOTION(ExplainCanvas::OnMouseMotion)
+	EVT_LEFT_DOWN(ExplainCanvas::OnLeftDown)
 END_EVENT_TABLE()
 
 
+#define PIXPERUNIT  20
+
 ExplainCanvas::ExplainCanvas(wxWindow *parent)
-	: wxShapeCanvas(parent), rootShape(NULL)
+	: wxScrolledWindow(parent)
 {
-	SetDiagram(new wxDiagram);
-	GetDiagram()->SetCanvas(this);
 	SetBackgroundColour(*wxWHITE);
 	popup = NULL;
+
+	wxSize size = ExplainShape::GetSize();
+	x0 = size.GetWidth() * 3;
+	y0 = size.GetHeight() * 3 / 2;
+	xoffs = size.GetWidth() * 3;
+	yoffs = size.GetHeight() * 5 / 4;
 }
 
 
@@ -41,8 +49,9 @@ ExplainCanvas::~ExplainCanvas()
 
 void ExplainCanvas::Clear()
 {
-	GetDiagram()->DeleteAllShapes();
-	rootShape = NULL;
+	plan.Clear();
+	SetVirtualPlanSize();
+	Refresh();
 }
 
 
@@ -50,131 +59,162 @@ void ExplainCanvas::SetExplainString(const wxString &str)
 {
 	Clear();
 
-	// We can have multiple plans in a single explain string
-	// Add a empty root shape, which will never get drawn, but it will help us
-	// to keep track of all these plans
-	rootShape = ExplainShape::Create(0, NULL, wxEmptyString);
-	AddShape(rootShape);
+	const wxChar *cp = str.c_str();
+	while (wxIsspace(*cp))
+		cp++;
 
-	ExplainShape *last = rootShape;
-	int maxLevel = 0;
+	if (*cp == '[')
+	{
+		if (!plan.ParseJson(str))
+			wxLogError(_("Could not read the plan returned by the server."));
+	}
+	else
+		plan.ParseText(str);
 
-	wxStringTokenizer lines(str, wxT("\n"));
+	SetVirtualPlanSize();
+	Refresh();
+}
 
-	while (lines.HasMoreTokens())
-	{
-		wxString tmp = lines.GetNextToken();
-		wxString line = tmp.Strip(wxString::both);
 
-		int braceCount = 0;
-		do
-		{
-			const wxChar *cp = line.c_str();
-			while (*cp)
-			{
-				if (*cp == '(')
-					braceCount++;
-				else if (*cp == ')')
-					braceCount--;
-				cp++;
-			}
-			if (braceCount > 0)
-			{
-				wxString tmp = lines.GetNextToken();
-				line += wxT(" ") + tmp.Strip(wxString::both);
-				braceCount = 0;
-			}
-			else
-				break;
-		}
-		while (lines.HasMoreTokens());
+void ExplainCanvas::ToggleNode(int pos)
+{
+	plan.Toggle(pos);
+
+	// Keep showing the same part of the plan
+	int x, y;
+	GetViewStart(&x, &y);
+	SetVirtualPlanSize();
+	Scroll(x, y);
+	Refresh();
+}
 
-		long level = ((tmp.Length() - line.Length() + 4) / 6) + 1;
 
-		if (last)
-		{
-			if (level != 1)
-			{
-				if (line.Left(4) == wxT("->  "))
-					line = line.Mid(4);
-				else
-				{
-					last->SetCondition(line);
-					continue;
-				}
-			}
-
-			while (last != rootShape && level <= last->GetLevel())
-				last = last->GetUpper();
-		}
+void ExplainCanvas::SetVirtualPlanSize()
+{
+	int x, y;
+	GetViewStart(&x, &y);
 
+	int w = (plan.GetMaxLevel() * xoffs + x0 * 2 + PIXPERUNIT - 1) / PIXPERUNIT;
+	int h = (plan.GetRowCount() * yoffs + y0 * 2 + PIXPERUNIT - 1) / PIXPERUNIT;
 
-		ExplainShape *s = ExplainShape::Create(level, last, line);
-		if (!s)
-			continue;
-		s->SetCanvas(this);
-		InsertShape(s);
-		s->Show(true);
+	SetScrollbars(PIXPERUNIT, PIXPERUNIT, w, h, x, y);
+}
 
-		if (level > maxLevel)
-			maxLevel = level;
 
-		last = s;
-	}
+void ExplainCanvas::GetNodePosition(ExplainNode *node, int &x, int &y)
+{
+	x = y0 + (plan.GetMaxLevel() - node->level) * xoffs;
+	y = y0 + node->row * yoffs;
+}
 
 
-	int x0 = (int)(rootShape->GetWidth() * 3);
-	int y0 = (int)(rootShape->GetHeight() * 3 / 2);
-	int xoffs = (int)(rootShape->GetWidth() * 3);
-	int yoffs = (int)(rootShape->GetHeight() * 5 / 4);
+// Returns the position in the plan of the node shown at x, y, or -1
+int ExplainCanvas::FindNode(int x, int y)
+{
+	if (plan.IsEmpty() || x < y0 - xoffs / 2 || y < y0 - yoffs / 2)
+		return -1;
+
+	int level = plan.GetMaxLevel() - (x - y0 + xoffs / 2) / xoffs;
+	int row = (y - y0 + yoffs / 2) / yoffs;
+	if (level < 1)
+		return -1;
+
+	int pos = plan.FindNode(row, level);
+	if (pos < 0)
+		return -1;
+
+	int nx, ny;
+	wxSize size = ExplainShape::GetSize();
+	GetNodePosition(plan.GetNode(pos), nx, ny);
+	if (abs(x - nx) > size.GetWidth() / 2 || abs(y - ny) > size.GetHeight() / 2)
+		return -1;
+
+	return pos;
+}
+
+
+void ExplainCanvas::OnPaint(wxPaintEvent &ev)
+{
+	wxPaintDC dc(this);
+	PrepareDC(dc);
+
+	// Only what is in the damaged part of the window is drawn
+	wxRect rect = GetUpdateRegion().GetBox();
+	CalcUnscrolledPosition(rect.x, rect.y, &rect.x, &rect.y);
+
+	Draw(dc, rect);
+}
+
+
+void ExplainCanvas::Draw(wxDC &dc, const wxRect &rect)
+{
+	if (plan.IsEmpty())
+		return;
+
+	dc.SetFont(GetFont());
 
-	wxNode *current = GetDiagram()->GetShapeList()->GetFirst();
-	while (current)
+	// The rows with a node in rect; the first node of a row is found by a
+	// binary search, as rows follow the order of the nodes
+	wxSize size = ExplainShape::GetSize();
+	int firstRow = (rect.y - y0 - size.GetHeight()) / yoffs;
+	int lastRow = (rect.GetBottom() - y0 + size.GetHeight()) / yoffs + 1;
+
+	const wxArrayInt &shown = plan.GetShown();
+	size_t first = plan.FindShown(firstRow), last, i;
+	for (last = first ; last < shown.GetCount() && plan.GetNode(shown.Item(last))->row <= lastRow ; last++)
+		;
+
+	// The arrows of the nodes in these rows, and the ones of nodes further
+	// down pointing to a node in these rows or to one of the nodes above
+	// the first of them
+	wxArrayInt uppers;
+	if (first < shown.GetCount())
+	{
+		int pos;
+		for (pos = plan.GetNode(shown.Item(first))->upper ; pos > 0 ; pos = plan.GetNode(pos)->upper)
+			uppers.Add(pos);
+	}
+	for (i = first ; i < last ; i++)
+	{
+		ExplainNode *node = plan.GetNode(shown.Item(i));
+		if (node->upper > 0)
+			DrawLine(dc, rect, node, plan.GetNode(node->upper));
+		uppers.Add(shown.Item(i));
+	}
+	for (i = 0 ; i < uppers.GetCount() ; i++)
 	{
-		ExplainShape *s = (ExplainShape *)current->GetData();
+		ExplainNode *upper = plan.GetNode(uppers.Item(i));
+		if (upper->collapsed)
+			continue;
 
-		if (!s->totalShapes)
-			s->totalShapes = 1;
-		if (s->GetUpper())
-			s->GetUpper()->totalShapes += s->totalShapes;
-		current = current->GetNext();
+		int kid;
+		for (kid = upper->lastKid ; kid >= 0 && plan.GetNode(kid)->row > lastRow ; kid = plan.GetNode(kid)->prevKid)
+			DrawLine(dc, rect, plan.GetNode(kid), upper);
 	}
 
-	current = GetDiagram()->GetShapeList()->GetLast();
-	while (current)
+	for (i = first ; i < last ; i++)
 	{
-		ExplainShape *s = (ExplainShape *)current->GetData();
+		ExplainNode *node = plan.GetNode(shown.Item(i));
 
-		s->SetX(y0 + (maxLevel - s->GetLevel()) * xoffs);
-		ExplainShape *upper = s->GetUpper();
+		int x, y;
+		GetNodePosition(node, x, y);
+		if (x + xoffs / 2 >= rect.x && x - xoffs / 2 <= rect.GetRight())
+			ExplainShape::Draw(dc, node, x, y);
+	}
+}
 
-		if (upper)
-		{
-			s->SetY(upper->GetY() + upper->usedShapes * yoffs);
-			upper->usedShapes += s->totalShapes;
-
-			// We don't require to draw a line from the root shape to its
-			// childrens
-			if (upper != rootShape)
-			{
-				wxLineShape *l = new ExplainLine(s, upper);
-				l->Show(true);
-				AddShape(l);
-			}
-		}
-		else
-		{
-			s->SetY(y0);
-		}
 
-		current = current->GetPrevious();
-	}
+void ExplainCanvas::DrawLine(wxDC &dc, const wxRect &rect, ExplainNode *from, ExplainNode *to)
+{
+	int fx, fy, tx, ty;
+	GetNodePosition(from, fx, fy);
+	GetNodePosition(to, tx, ty);
 
-#define PIXPERUNIT  20
-	int w = (maxLevel * xoffs + x0 * 2 + PIXPERUNIT - 1) / PIXPERUNIT;
-	int h = (rootShape->totalShapes * yoffs + y0 * 2 + PIXPERUNIT - 1) / PIXPERUNIT;
+	if (fx > rect.GetRight() || tx < rect.x)
+		return;
 
-	SetScrollbars(PIXPERUNIT, PIXPERUNIT, w, h);
+	ExplainShape::DrawLine(dc, from, ExplainShape::GetStartPoint(from, fx, fy),
+	                       ExplainShape::GetEndPoint(to, tx, ty, from->kidNo));
 }
 
 
@@ -185,39 +225,47 @@ void ExplainCanvas::OnMouseMotion(wxMouseEvent &ev)
 	if (ev.Dragging())
 		return;
 
-	wxClientDC dc(this);
-	PrepareDC(dc);
-
-	wxPoint logPos(ev.GetLogicalPosition(dc));
-
-	double x, y;
-	x = (double) logPos.x;
-	y = (double) logPos.y;
+	int x, y;
+	CalcUnscrolledPosition(ev.GetX(), ev.GetY(), &x, &y);
 
 	// Find the nearest object
-	int attachment = 0;
-	ExplainShape *nearestObj = dynamic_cast<ExplainShape *>(FindShape(x, y, &attachment));
-
-	if (nearestObj)
+	int pos = FindNode(x, y);
+	if (pos >= 0)
 	{
-		ShowPopup(nearestObj);
+		ShowPopup(pos);
 	}
 }
 
 
-void ExplainCanvas::ShowPopup(ExplainShape *s)
+void ExplainCanvas::OnLeftDown(wxMouseEvent &ev)
+{
+	ev.Skip(true);
+
+	int x, y;
+	CalcUnscrolledPosition(ev.GetX(), ev.GetY(), &x, &y);
+
+	int pos = FindNode(x, y);
+	if (pos >= 0)
+		ToggleNode(pos);
+}
+
+
+void ExplainCanvas::ShowPopup(int pos)
 {
-	if (popup || s == NULL)
+	if (popup || pos < 0)
 		return;
 
-	popup = new ExplainPopup(this, s, &popup);
+	wxSize size = ExplainShape::GetSize();
+	int x, y;
+	GetNodePosition(plan.GetNode(pos), x, y);
 
+	popup = new ExplainPopup(this, pos, wxRect(x - size.GetWidth() / 2, y - size.GetHeight() / 2, size.GetWidth(), size.GetHeight()), &popup);
 }
 
 
 void ExplainCanvas::SaveAsImage(const wxString &fileName, wxBitmapType imageType)
 {
-	if (GetDiagram()->GetCount() == 0)
+	if (plan.IsEmpty())
 	{
 		wxMessageBox(_("Nothing to be saved!"), _("Save As an image"), wxOK | wxICON_INFORMATION);
 		return;
@@ -233,10 +281,11 @@ void ExplainCanvas::SaveAsImage(const wxString &fileName, wxBitmapType imageType
 	wxBitmap tempBitmap(width, height);
 
 	memDC.SelectObject(tempBitmap);
+	memDC.SetBackground(*wxWHITE_BRUSH);
 	memDC.Clear();
 
-	// Draw the diagram on the bitmap (Memory Device Context)
-	GetDiagram()->Redraw(memDC);
+	// Draw the whole plan on the bitmap (Memory Device Context)
+	Draw(memDC, wxRect(0, 0, width, height));
 
 	memDC.SelectObject(wxNullBitmap);
 
@@ -249,7 +298,7 @@ void ExplainCanvas::SaveAsImage(const wxString &fileName, wxBitmapType imageType
 class ExplainText : public wxWindow
 {
 public:
-	ExplainText(ExplainPopup *parent, ExplainShape *s);
+	ExplainText(ExplainPopup *parent, ExplainNode *node, int hidden);
 
 protected:
 	void OnMouseMove(wxMouseEvent &ev);
@@ -261,7 +310,7 @@ private:
 	ExplainPopup *popup;
 	void OnPaint(wxPaintEvent &ev);
 
-	wxString m_desc, m_detail, m_condition, m_cost, m_actual;
+	wxString m_desc, m_detail, m_condition, m_cost, m_actual, m_share;
 
 	DECLARE_EVENT_TABLE()
 };
@@ -274,7 +323,7 @@ BEGIN_EVENT_TABLE(ExplainText, wxWindow)
 #endif
 END_EVENT_TABLE()
 
-ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(parent, -1)
+ExplainText::ExplainText(ExplainPopup *parent, ExplainNode *node, int hidden) : wxWindow(parent, -1)
 {
 	SetBackgroundColour(wxColour(255, 255, 224));
 
@@ -283,11 +332,18 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 	wxWindowDC dc(this);
 	dc.SetFont(settings->GetSystemFont());
 
-	m_desc = s->description;
-	m_detail = s->detail;
-	m_condition = s->condition;
-	m_cost = s->cost;
-	m_actual = s->actual;
+	m_desc = node->description;
+	m_detail = node->detail;
+	m_condition = node->condition;
+	m_cost = node->GetCostText();
+	m_actual = node->GetActualText();
+
+	if (hidden)
+		m_share = wxString::Format(_("%d nodes hidden, click to show them"), hidden);
+	else if (node->share >= EXPLAIN_HOT_SHARE && node->hasTiming)
+		m_share = wxString::Format(_("%.1f%% of the execution time"), node->share * 100);
+	else if (node->share >= EXPLAIN_HOT_SHARE)
+		m_share = wxString::Format(_("%.1f%% of the total cost"), node->share * 100);
 
 	int w1, w2, h;
 	dc.GetTextExtent(m_desc, &w1, &h);
@@ -300,6 +356,8 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 	if (w1 < w2)    w1 = w2;
 	dc.GetTextExtent(m_actual, &w2, &h);
 	if (w1 < w2)    w1 = w2;
+	dc.GetTextExtent(m_share, &w2, &h);
+	if (w1 < w2)    w1 = w2;
 
 	int n = 2;
 	if (!m_detail.IsEmpty())
@@ -310,6 +368,8 @@ ExplainText::ExplainText(ExplainPopup *parent, ExplainShape *s) : wxWindow(paren
 		n++;
 	if (!m_actual.IsEmpty())
 		n++;
+	if (!m_share.IsEmpty())
+		n++;
 
 	if (!h)
 		h = GetCharHeight();
@@ -379,6 +439,11 @@ void ExplainText::OnPaint(wxPaintEvent &ev)
 		y += yoffs;
 		dc.DrawText(m_actual, x, y);
 	}
+	if (!m_share.IsEmpty())
+	{
+		y += yoffs;
+		dc.DrawText(m_share, x, y);
+	}
 
 #if wxUSE_POPUPWIN
 
@@ -433,7 +498,7 @@ BEGIN_EVENT_TABLE(ExplainPopup, pgTipWindowBase)
 #endif // !wxUSE_POPUPWIN
 END_EVENT_TABLE()
 
-ExplainPopup::ExplainPopup(ExplainCanvas *parent, ExplainShape *shape, ExplainPopup **popup)
+ExplainPopup::ExplainPopup(ExplainCanvas *parent, int pos, const wxRect &rect, ExplainPopup **popup)
 #if wxUSE_POPUPWIN
 	: wxPopupTransientWindow(parent, wxNO_BORDER)
 #else
@@ -443,28 +508,28 @@ ExplainPopup::ExplainPopup(ExplainCanvas *parent, ExplainShape *shape, ExplainPo
 #endif
 {
 	wxASSERT(parent != NULL);
-	wxASSERT(shape != NULL);
+	wxASSERT(pos >= 0);
 
 	if (popup)
 		m_ptr = popup;
 	else
 		m_ptr = NULL;
 
-	m_explainText = new ExplainText(this, shape);
+	m_canvas = parent;
+	m_node = pos;
+
+	ExplainNode *node = parent->GetNode(pos);
+	m_explainText = new ExplainText(this, node, node->collapsed ? node->end - pos - 1 : 0);
 #if !wxUSE_POPUPWIN
 	m_creationTime = wxGetLocalTime();
 #endif
-	double width = 0.0, height = 0.0;
-
-	shape->GetBoundingBoxMin(&width, &height);
-	if (fabs(width) < 4.0) width = 4.0;
-	if (fabs(height) < 4.0) height = 4.0;
+	double width = rect.width, height = rect.height;
 
 	width += (double)4.0;
 	height += (double)4.0; // Allowance for inaccurate mousing
 
-	int x = (int)(shape->GetX() - (width / 2.0));
-	int y = (int)(shape->GetY() - (height / 2.0));
+	int x = rect.x - 2;
+	int y = rect.y - 2;
 
 	int sx, sy;
 	parent->CalcScrolledPosition(x, y, &sx, &sy);
@@ -522,7 +587,14 @@ void ExplainPopup::OnMouseMove(wxMouseEvent &ev)
 
 void ExplainPopup::OnMouseClick(wxMouseEvent &ev)
 {
+	ExplainCanvas *canvas = m_canvas;
+	int node = m_node;
+
 	Close();
+
+	// The popup is over the node, clicking it collapses or expands it
+	if (ev.LeftDown())
+		canvas->ToggleNode(node);
 }
 
 
@@ -0,0 +1,830 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// explainPlan.cpp - Plan tree shown by the Explain canvas
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/tokenzr.h>
+
+// App headers
+#include "ctl/explainCanvas.h"
+
+
+ExplainNode::ExplainNode(int lvl, int up)
+{
+	bitmap = NULL;
+	hasCost = hasActual = hasTiming = false;
+	costLow = costHigh = rows = 0;
+	width = 0;
+	actualLow = actualHigh = actualRows = loops = 0;
+	share = subtreeShare = 0;
+	level = lvl;
+	upper = up;
+	lastKid = prevKid = -1;
+	end = 0;
+	kidCount = kidNo = 0;
+	collapsed = false;
+	row = totalRows = usedRows = 0;
+}
+
+
+void ExplainNode::SetLabel(const wxString &str, int tokenNo, int detailNo)
+{
+	if (tokenNo < 0)
+	{
+		description = str;
+		label = str;
+	}
+	else
+	{
+		wxStringTokenizer tokens(str, wxT(" "));
+
+		while (tokenNo-- >= 0)
+		{
+			label = tokens.GetNextToken();
+
+			if (detailNo <= 0)
+			{
+				if (!description.IsEmpty())
+					description.Append(wxT(" "));
+
+				description.Append(label);
+			}
+		}
+		if (detailNo > 0)
+		{
+			tokens.SetString(str, wxT(" "));
+
+			while (detailNo--)
+			{
+				if (!description.IsEmpty())
+					description.Append(wxT(" "));
+
+				description.Append(tokens.GetNextToken());
+			}
+			detail = tokens.GetString();
+		}
+	}
+}
+
+
+wxString ExplainNode::GetCostText()
+{
+	if (!hasCost)
+		return wxEmptyString;
+
+	return wxString::Format(wxT("(cost=%.2f..%.2f rows=%.0f width=%ld)"), costLow, costHigh, rows, width);
+}
+
+
+wxString ExplainNode::GetActualText()
+{
+	if (!hasActual)
+		return wxEmptyString;
+	if (loops == 0)
+		return wxT("(never executed)");
+	if (hasTiming)
+		return wxString::Format(wxT("(actual time=%.3f..%.3f rows=%.0f loops=%.0f)"), actualLow, actualHigh, actualRows, loops);
+
+	return wxString::Format(wxT("(actual rows=%.0f loops=%.0f)"), actualRows, loops);
+}
+
+
+// Reads EXPLAIN (FORMAT JSON) output into a plan, in a single pass over the
+// text. Only the members of the plan nodes are looked at; everything else
+// is skipped.
+class ExplainJsonReader
+{
+public:
+	ExplainJsonReader(ExplainPlan *p, const wxString &str)
+	{
+		plan = p;
+		cp = str.c_str();
+	}
+
+	bool Read();
+
+private:
+	bool ReadPlans();
+	bool ReadPlan(int level, int upper);
+	bool ReadString(wxString &str);
+	bool ReadScalar(wxString &value);
+	bool ReadList(wxString &value);
+	bool SkipValue();
+
+	wxChar Peek()
+	{
+		while (wxIsspace(*cp))
+			cp++;
+		return *cp;
+	}
+	bool Expect(wxChar c)
+	{
+		if (Peek() != c)
+			return false;
+		cp++;
+		return true;
+	}
+
+	ExplainPlan *plan;
+	const wxChar *cp;
+};
+
+
+bool ExplainJsonReader::Read()
+{
+	// One document for each row of the result
+	while (Peek() == '[')
+	{
+		if (!ReadPlans())
+			return false;
+	}
+	return Peek() == 0;
+}
+
+
+bool ExplainJsonReader::ReadPlans()
+{
+	if (!Expect('['))
+		return false;
+
+	if (Peek() != ']')
+	{
+		do
+		{
+			if (!Expect('{'))
+				return false;
+
+			if (Peek() != '}')
+			{
+				do
+				{
+					wxString key;
+					if (!ReadString(key) || !Expect(':'))
+						return false;
+
+					if (key == wxT("Plan"))
+					{
+						if (!ReadPlan(1, 0))
+							return false;
+					}
+					else if (!SkipValue())
+						return false;
+				}
+				while (Expect(','));
+			}
+			if (!Expect('}'))
+				return false;
+		}
+		while (Expect(','));
+	}
+
+	return Expect(']');
+}
+
+
+bool ExplainJsonReader::ReadPlan(int level, int upper)
+{
+	if (!Expect('{'))
+		return false;
+
+	int pos = plan->AddNode(level, upper);
+	ExplainNode *node = plan->GetNode(pos);
+
+	wxString nodeType, strategy, joinType, operation, command, direction;
+	wxString relation, schema, alias, index, function, cte;
+
+	if (Peek() != '}')
+	{
+		do
+		{
+			wxString key, value;
+			if (!ReadString(key) || !Expect(':'))
+				return false;
+
+			if (key == wxT("Plans"))
+			{
+				if (!Expect('['))
+					return false;
+				if (Peek() != ']')
+				{
+					do
+					{
+						if (!ReadPlan(level + 1, pos))
+							return false;
+					}
+					while (Expect(','));
+				}
+				if (!Expect(']'))
+					return false;
+				continue;
+			}
+
+			if (Peek() == '{')
+			{
+				if (!SkipValue())
+					return false;
+				continue;
+			}
+			if (Peek() == '[')
+			{
+				if (!ReadList(value))
+					return false;
+				if (value.IsEmpty())
+					continue;
+			}
+			else if (!ReadScalar(value))
+				return false;
+
+			if (key == wxT("Node Type"))
+				nodeType = value;
+			else if (key == wxT("Strategy"))
+				strategy = value;
+			else if (key == wxT("Join Type"))
+				joinType = value;
+			else if (key == wxT("Operation"))
+				operation = value;
+			else if (key == wxT("Command"))
+				command = value;
+			else if (key == wxT("Scan Direction"))
+				direction = value;
+			else if (key == wxT("Relation Name"))
+				relation = value;
+			else if (key == wxT("Schema"))
+				schema = value;
+			else if (key == wxT("Alias"))
+				alias = value;
+			else if (key == wxT("Index Name"))
+				index = value;
+			else if (key == wxT("Function Name"))
+				function = value;
+			else if (key == wxT("CTE Name"))
+				cte = value;
+			else if (key == wxT("Startup Cost"))
+			{
+				node->hasCost = true;
+				node->costLow = StrToDouble(value);
+			}
+			else if (key == wxT("Total Cost"))
+				node->costHigh = StrToDouble(value);
+			else if (key == wxT("Plan Rows"))
+				node->rows = StrToDouble(value);
+			else if (key == wxT("Plan Width"))
+				node->width = StrToLong(value);
+			else if (key == wxT("Actual Startup Time"))
+			{
+				node->hasTiming = true;
+				node->actualLow = StrToDouble(value);
+			}
+			else if (key == wxT("Actual Total Time"))
+				node->actualHigh = StrToDouble(value);
+			else if (key == wxT("Actual Rows"))
+				node->actualRows = StrToDouble(value);
+			else if (key == wxT("Actual Loops"))
+			{
+				node->hasActual = true;
+				node->loops = StrToDouble(value);
+			}
+			else if (key == wxT("Subplan Name"))
+				node->SetCondition(value);
+			else if (key != wxT("Parent Relationship"))
+				node->SetCondition(key + wxT(": ") + value);
+		}
+		while (Expect(','));
+	}
+	if (!Expect('}'))
+		return false;
+
+	// Give the node the name it has in the text format, so that it gets
+	// the same image and label
+	wxString descr;
+	if (nodeType == wxT("ModifyTable"))
+		descr = operation;
+	else if (nodeType == wxT("Aggregate") && strategy == wxT("Sorted"))
+		descr = wxT("GroupAggregate");
+	else if (nodeType == wxT("Aggregate") && strategy == wxT("Hashed"))
+		descr = wxT("HashAggregate");
+	else if (nodeType == wxT("SetOp"))
+	{
+		descr = strategy == wxT("Hashed") ? wxT("HashSetOp") : wxT("SetOp");
+		if (!command.IsEmpty())
+			descr += wxT(" ") + command;
+	}
+	else if (!joinType.IsEmpty() && joinType != wxT("Inner"))
+	{
+		descr = nodeType;
+		if (descr.EndsWith(wxT(" Join")))
+			descr = descr.Left(descr.Length() - 5);
+		descr += wxT(" ") + joinType + wxT(" Join");
+	}
+	else
+		descr = nodeType;
+
+	if (nodeType == wxT("Index Scan") || nodeType == wxT("Index Only Scan"))
+	{
+		if (direction == wxT("Backward"))
+			descr += wxT(" Backward");
+		descr += wxT(" using ") + index;
+	}
+	else if (nodeType == wxT("Bitmap Index Scan"))
+		descr += wxT(" on ") + index;
+
+	wxString target = relation;
+	if (target.IsEmpty())
+		target = function;
+	if (target.IsEmpty())
+		target = cte;
+
+	if (!target.IsEmpty())
+	{
+		if (!schema.IsEmpty())
+			descr += wxT(" on ") + schema + wxT(".") + target;
+		else
+			descr += wxT(" on ") + target;
+		if (!alias.IsEmpty() && alias != target)
+			descr += wxT(" ") + alias;
+	}
+	else if (!alias.IsEmpty())
+		descr += wxT(" on ") + alias;
+
+	int tokenNo, detailNo;
+	node->bitmap = ExplainShape::GetBitmap(descr, tokenNo, detailNo);
+	if (!node->bitmap)
+		node->bitmap = ExplainShape::GetBitmap(wxEmptyString, tokenNo, detailNo);
+	node->SetLabel(descr, tokenNo, detailNo);
+
+	return true;
+}
+
+
+bool ExplainJsonReader::ReadString(wxString &str)
+{
+	if (!Expect('"'))
+		return false;
+
+	str.Empty();
+	while (*cp != '"')
+	{
+		const wxChar *start = cp;
+		while (*cp && *cp != '"' && *cp != '\\')
+			cp++;
+		if (cp > start)
+			str.Append(start, cp - start);
+
+		if (*cp == '\\')
+		{
+			cp++;
+			switch (*cp)
+			{
+				case 'n':
+					str.Append(wxT('\n'));
+					break;
+				case 'r':
+					str.Append(wxT('\r'));
+					break;
+				case 't':
+					str.Append(wxT('\t'));
+					break;
+				case 'b':
+					str.Append(wxT('\b'));
+					break;
+				case 'f':
+					str.Append(wxT('\f'));
+					break;
+				case 'u':
+				{
+					unsigned long code;
+					if (!cp[1] || !cp[2] || !cp[3] || !cp[4] || !wxString(cp + 1, 4).ToULong(&code, 16))
+						return false;
+					str.Append((wxChar)code);
+					cp += 4;
+					break;
+				}
+				case 0:
+					return false;
+				default:
+					str.Append(*cp);
+					break;
+			}
+			cp++;
+		}
+		else if (!*cp)
+			return false;
+	}
+	cp++;
+
+	return true;
+}
+
+
+bool ExplainJsonReader::ReadScalar(wxString &value)
+{
+	if (Peek() == '"')
+		return ReadString(value);
+
+	// Numbers, true, false and null
+	const wxChar *start = cp;
+	while (*cp && *cp != ',' && *cp != '}' && *cp != ']' && !wxIsspace(*cp))
+		cp++;
+	if (cp == start)
+		return false;
+
+	value = wxString(start, cp - start);
+	return true;
+}
+
+
+bool ExplainJsonReader::ReadList(wxString &value)
+{
+	if (!Expect('['))
+		return false;
+
+	// Lists of expressions (Output, Sort Key...) are shown as in the text
+	// format, lists of objects are skipped
+	value.Empty();
+	if (Peek() != ']')
+	{
+		do
+		{
+			if (Peek() == '{' || Peek() == '[')
+			{
+				if (!SkipValue())
+					return false;
+			}
+			else
+			{
+				wxString item;
+				if (!ReadScalar(item))
+					return false;
+				if (!value.IsEmpty())
+					value += wxT(", ");
+				value += item;
+			}
+		}
+		while (Expect(','));
+	}
+
+	return Expect(']');
+}
+
+
+bool ExplainJsonReader::SkipValue()
+{
+	wxString str;
+
+	if (Expect('{'))
+	{
+		if (Peek() != '}')
+		{
+			do
+			{
+				if (!ReadString(str) || !Expect(':') || !SkipValue())
+					return false;
+			}
+			while (Expect(','));
+		}
+		return Expect('}');
+	}
+	if (Expect('['))
+	{
+		if (Peek() != ']')
+		{
+			do
+			{
+				if (!SkipValue())
+					return false;
+			}
+			while (Expect(','));
+		}
+		return Expect(']');
+	}
+
+	return ReadScalar(str);
+}
+
+
+ExplainPlan::ExplainPlan()
+{
+	maxLevel = 0;
+}
+
+
+ExplainPlan::~ExplainPlan()
+{
+	Clear();
+}
+
+
+void ExplainPlan::Clear()
+{
+	size_t i;
+	for (i = 0 ; i < nodes.GetCount() ; i++)
+		delete GetNode(i);
+
+	nodes.Empty();
+	shown.Empty();
+	maxLevel = 0;
+}
+
+
+int ExplainPlan::AddNode(int level, int upper)
+{
+	int pos = nodes.GetCount();
+	ExplainNode *node = new ExplainNode(level, upper);
+	nodes.Add(node);
+
+	if (upper >= 0)
+	{
+		ExplainNode *up = GetNode(upper);
+		node->kidNo = up->kidCount++;
+		node->prevKid = up->lastKid;
+		up->lastKid = pos;
+	}
+	if (level > maxLevel)
+		maxLevel = level;
+
+	return pos;
+}
+
+
+bool ExplainPlan::ParseJson(const wxString &str)
+{
+	Clear();
+
+	// We can have multiple plans, the root node keeps track of them
+	AddNode(0, -1);
+
+	ExplainJsonReader reader(this, str);
+	if (!reader.Read())
+	{
+		Clear();
+		return false;
+	}
+
+	Finish();
+	return true;
+}
+
+
+// Reads the number following key in str
+static bool ReadTextValue(const wxString &str, const wxChar *key, double &value)
+{
+	int pos = str.Find(key);
+	if (pos < 0)
+		return false;
+
+	value = StrToDouble(str.Mid(pos + wxStrlen(key)));
+	return true;
+}
+
+
+void ExplainPlan::ParseText(const wxString &str)
+{
+	Clear();
+
+	// We can have multiple plans in a single explain string, the root node
+	// keeps track of them
+	int last = AddNode(0, -1);
+
+	wxStringTokenizer lines(str, wxT("\n"));
+
+	while (lines.HasMoreTokens())
+	{
+		wxString tmp = lines.GetNextToken();
+		wxString line = tmp.Strip(wxString::both);
+
+		int braceCount = 0;
+		do
+		{
+			const wxChar *cp = line.c_str();
+			while (*cp)
+			{
+				if (*cp == '(')
+					braceCount++;
+				else if (*cp == ')')
+					braceCount--;
+				cp++;
+			}
+			if (braceCount > 0)
+			{
+				wxString tmp = lines.GetNextToken();
+				line += wxT(" ") + tmp.Strip(wxString::both);
+				braceCount = 0;
+			}
+			else
+				break;
+		}
+		while (lines.HasMoreTokens());
+
+		long level = ((tmp.Length() - line.Length() + 4) / 6) + 1;
+
+		if (level != 1)
+		{
+			if (line.Left(4) == wxT("->  "))
+				line = line.Mid(4);
+			else
+			{
+				GetNode(last)->SetCondition(line);
+				continue;
+			}
+		}
+
+		while (last != 0 && level <= GetNode(last)->level)
+			last = GetNode(last)->upper;
+
+		int costPos = line.Find(wxT("(cost="));
+		int actPos = line.Find(wxT("(actual"));
+		if (actPos < 0)
+			actPos = line.Find(wxT("(never executed)"));
+
+		wxString descr;
+		if (costPos > 0)
+			descr = line.Left(costPos);
+		else if (actPos > 0)
+			descr = line.Left(actPos);
+		else
+			descr = line;
+
+		int tokenNo, detailNo;
+		wxBitmap *bmp = ExplainShape::GetBitmap(descr, tokenNo, detailNo);
+		if (!bmp)
+			continue;
+
+		int pos = AddNode(level, last);
+		ExplainNode *node = GetNode(pos);
+		node->bitmap = bmp;
+		node->SetLabel(descr, tokenNo, detailNo);
+
+		if (costPos > 0)
+		{
+			wxString cost = actPos > costPos ? line.Mid(costPos, actPos - costPos) : line.Mid(costPos);
+
+			node->hasCost = ReadTextValue(cost, wxT("cost="), node->costLow);
+			ReadTextValue(cost, wxT(".."), node->costHigh);
+			ReadTextValue(cost, wxT("rows="), node->rows);
+
+			double width;
+			if (ReadTextValue(cost, wxT("width="), width))
+				node->width = (long)width;
+		}
+		if (actPos > 0)
+		{
+			wxString actual = line.Mid(actPos);
+
+			node->hasActual = true;
+			node->hasTiming = ReadTextValue(actual, wxT("time="), node->actualLow);
+			ReadTextValue(actual, wxT(".."), node->actualHigh);
+			ReadTextValue(actual, wxT("rows="), node->actualRows);
+			ReadTextValue(actual, wxT("loops="), node->loops);
+		}
+
+		last = pos;
+	}
+
+	Finish();
+}
+
+
+// Finds where each subtree ends, and how much of the plan each node takes
+void ExplainPlan::Finish()
+{
+	size_t i, count = nodes.GetCount();
+	if (!count)
+		return;
+
+	// Measure the time if the plan was analyzed, otherwise the cost
+	bool timing = false;
+	for (i = 1 ; i < count && !timing ; i++)
+		timing = GetNode(i)->hasTiming;
+
+	wxArrayDouble value, kidsValue;
+	double planValue = 0;
+	for (i = 0 ; i < count ; i++)
+	{
+		ExplainNode *node = GetNode(i);
+		value.Add(timing ? node->actualHigh * node->loops : node->costHigh);
+		kidsValue.Add(0);
+		if (node->level == 1)
+			planValue += value.Item(i);
+	}
+
+	// Nodes below another one come after it, so going backwards the whole
+	// subtree of a node has been seen when we get to it
+	for (i = count ; i-- > 0 ; )
+	{
+		ExplainNode *node = GetNode(i);
+
+		node->end = node->lastKid >= 0 ? GetNode(node->lastKid)->end : i + 1;
+
+		double self = value.Item(i) - kidsValue.Item(i);
+		if (i > 0 && self > 0 && planValue > 0)
+			node->share = self / planValue;
+		if (node->share > node->subtreeShare)
+			node->subtreeShare = node->share;
+
+		if (node->upper >= 0)
+		{
+			ExplainNode *up = GetNode(node->upper);
+			kidsValue[node->upper] += value.Item(i);
+			if (node->subtreeShare > up->subtreeShare)
+				up->subtreeShare = node->subtreeShare;
+		}
+	}
+
+	Layout();
+}
+
+
+void ExplainPlan::Layout()
+{
+	size_t i, count = nodes.GetCount();
+
+	shown.Empty();
+	if (!count)
+		return;
+
+	// Rows taken by each subtree, backwards as in Finish()
+	for (i = count ; i-- > 0 ; )
+	{
+		ExplainNode *node = GetNode(i);
+
+		int rows = 0;
+		if (!node->collapsed)
+		{
+			int kid;
+			for (kid = node->lastKid ; kid >= 0 ; kid = GetNode(kid)->prevKid)
+				rows += GetNode(kid)->totalRows;
+		}
+		node->totalRows = rows ? rows : 1;
+		node->usedRows = 0;
+	}
+
+	// Each node gets the next free row of its upper, the nodes of a
+	// collapsed subtree are skipped
+	GetNode(0)->row = 0;
+	i = 1;
+	while (i < count)
+	{
+		ExplainNode *node = GetNode(i);
+		ExplainNode *up = GetNode(node->upper);
+
+		node->row = up->row + up->usedRows;
+		up->usedRows += node->totalRows;
+		shown.Add(i);
+
+		if (node->collapsed)
+			i = node->end;
+		else
+			i++;
+	}
+}
+
+
+void ExplainPlan::Toggle(int pos)
+{
+	ExplainNode *node = GetNode(pos);
+	if (!node->kidCount)
+		return;
+
+	node->collapsed = !node->collapsed;
+	Layout();
+}
+
+
+size_t ExplainPlan::FindShown(int row)
+{
+	size_t low = 0, high = shown.GetCount();
+	while (low < high)
+	{
+		size_t mid = (low + high) / 2;
+		if (GetNode(shown.Item(mid))->row < row)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+	return low;
+}
+
+
+int ExplainPlan::FindNode(int row, int level)
+{
+	size_t i;
+	for (i = FindShown(row) ; i < shown.GetCount() ; i++)
+	{
+		ExplainNode *node = GetNode(shown.Item(i));
+		if (node->row != row)
+			break;
+		if (node->level == level)
+			return shown.Item(i);
+	}
+	return -1;
+}
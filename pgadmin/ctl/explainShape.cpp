@@ -13,13 +13,12 @@
 
 // wxWindows headers
 #include <wx/wx.h>
+#include <wx/tokenzr.h>
 
 // App headers
 #include "pgAdmin3.h"
 #include "ctl/explainCanvas.h"
 
-#include <wx/docview.h>
-
 #include "images/ex_aggregate.pngc"
 #include "images/ex_append.pngc"
 #include "images/ex_bmp_and.pngc"
@@ -73,112 +72,98 @@
 #include "images/ex_gather_motion.pngc"
 
 #define BMP_BORDER 3
+#define LABEL_HEIGHT 20
+#define ARROWMARGIN 5
+#define ARROWWIDTH  4
 
-ExplainShape::ExplainShape(const wxImage &bmp, const wxString &description, long tokenNo, long detailNo)
+
+// Sets the tokens of the description used for the label, and returns the
+// image
+static wxBitmap *Shape(wxBitmap *bmp, int &tokenNo, int &detailNo, int tok = -1, int det = -1)
 {
-	SetBitmap(wxBitmap(bmp));
-	SetLabel(description, tokenNo, detailNo);
-	kidCount = 0;
-	totalShapes = 0;
-	usedShapes = 0;
-	m_rootShape = false;
+	tokenNo = tok;
+	detailNo = det;
+	return bmp;
 }
 
 
-void ExplainShape::SetLabel(const wxString &str, int tokenNo, int detailNo)
+wxSize ExplainShape::GetSize()
 {
-	if (tokenNo < 0)
-	{
-		description = str;
-		label = str;
-	}
-	else
-	{
-		wxStringTokenizer tokens(str, wxT(" "));
-
-		while (tokenNo-- >= 0)
-		{
-			label = tokens.GetNextToken();
-
-			if (detailNo <= 0)
-			{
-				if (!description.IsEmpty())
-					description.Append(wxT(" "));
-
-				description.Append(label);
-			}
-		}
-		if (detailNo > 0)
-		{
-			tokens.SetString(str, wxT(" "));
+	wxBitmap *bmp = ex_unknown_png_bmp;
 
-			while (detailNo--)
-			{
-				if (!description.IsEmpty())
-					description.Append(wxT(" "));
+	int w = 50;
+	if (w < bmp->GetWidth())
+		w = bmp->GetWidth();
 
-				description.Append(tokens.GetNextToken());
-			}
-			detail = tokens.GetString();
-		}
-	}
+	return wxSize(w, bmp->GetHeight() + BMP_BORDER + LABEL_HEIGHT);
 }
 
-void ExplainShape::OnDraw(wxDC &dc)
-{
-	wxBitmap &bmp = GetBitmap();
-	if (!bmp.Ok())
-		return;
 
-	// We do not draw the root shape
-	if (m_rootShape)
+void ExplainShape::Draw(wxDC &dc, ExplainNode *node, int xpos, int ypos)
+{
+	wxBitmap *bmp = node->bitmap;
+	if (!bmp || !bmp->Ok())
 		return;
 
 	int x, y;
-	x = WXROUND(m_xpos - bmp.GetWidth() / 2.0);
-	y = WXROUND(m_ypos - GetHeight() / 2.0);
+	x = WXROUND(xpos - bmp->GetWidth() / 2.0);
+	y = WXROUND(ypos - (bmp->GetHeight() + BMP_BORDER + LABEL_HEIGHT) / 2.0);
 
-	dc.DrawBitmap(bmp, x, y, true);
+	// Nodes taking much of the time (or cost) of the plan stand out. A
+	// collapsed node stands for the hottest of the nodes it hides.
+	double share = node->collapsed ? node->subtreeShare : node->share;
+	if (share >= EXPLAIN_HOT_SHARE)
+	{
+		int c = 230 - (int)(share * 175);
+		dc.SetPen(*wxTRANSPARENT_PEN);
+		dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(wxColour(255, c, c), wxSOLID));
+		dc.DrawRoundedRectangle(x - BMP_BORDER, y - BMP_BORDER,
+		                        bmp->GetWidth() + BMP_BORDER * 2, bmp->GetHeight() + BMP_BORDER * 2, BMP_BORDER);
+	}
 
-	int w, h;
-	dc.SetFont(GetCanvas()->GetFont());
-	dc.GetTextExtent(label, &w, &h);
+	dc.DrawBitmap(*bmp, x, y, true);
 
-	x = WXROUND(m_xpos - w / 2.0);
-	y += bmp.GetHeight() + BMP_BORDER;
+	// Where the arrows of the nodes below would come in
+	if (node->collapsed)
+	{
+		wxRealPoint end = GetEndPoint(node, xpos, ypos, 0);
+		int bx = WXROUND(end.x) - 8, by = WXROUND(end.y) - 4;
+
+		dc.SetPen(*wxBLACK_PEN);
+		dc.SetBrush(*wxWHITE_BRUSH);
+		dc.DrawRectangle(bx, by, 9, 9);
+		dc.DrawLine(bx + 2, by + 4, bx + 7, by + 4);
+		dc.DrawLine(bx + 4, by + 2, bx + 4, by + 7);
+	}
 
-	dc.DrawText(label, x, y);
-}
+	int w, h;
+	dc.GetTextExtent(node->label, &w, &h);
 
+	x = WXROUND(xpos - w / 2.0);
+	y += bmp->GetHeight() + BMP_BORDER;
 
-void ExplainShape::OnLeftClick(double x, double y, int keys, int attachment)
-{
-	((ExplainCanvas *)GetCanvas())->ShowPopup(this);
+	dc.DrawText(node->label, x, y);
 }
 
 
-#define ARROWMARGIN 5
-wxRealPoint ExplainShape::GetStartPoint()
+wxRealPoint ExplainShape::GetStartPoint(ExplainNode *node, int x, int y)
 {
-	wxRealPoint rp(GetX() + GetBitmap().GetWidth() / 2.0 + ARROWMARGIN, GetY() - (GetHeight() - GetBitmap().GetHeight()) / 2.);
+	wxRealPoint rp(x + node->bitmap->GetWidth() / 2.0 + ARROWMARGIN, y - (BMP_BORDER + LABEL_HEIGHT) / 2.);
 	return rp;
 }
 
 
-wxRealPoint ExplainShape::GetEndPoint(int kidNo)
+wxRealPoint ExplainShape::GetEndPoint(ExplainNode *node, int x, int y, int kidNo)
 {
-	wxRealPoint rp(GetX() - GetBitmap().GetWidth() / 2.0 - ARROWMARGIN, GetY() - (GetHeight() - GetBitmap().GetHeight()) / 2. + (kidCount > 1 ? GetBitmap().GetHeight() * 2. / 3. * kidNo / (2 * kidCount - 2) : 0 ));
+	int kidCount = node->kidCount;
+	wxRealPoint rp(x - node->bitmap->GetWidth() / 2.0 - ARROWMARGIN, y - (BMP_BORDER + LABEL_HEIGHT) / 2. + (kidCount > 1 ? node->bitmap->GetHeight() * 2. / 3. * kidNo / (2 * kidCount - 2) : 0 ));
 	return rp;
 }
 
 
-
-ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxString &str)
+wxBitmap *ExplainShape::GetBitmap(const wxString &str, int &tokenNo, int &detailNo)
 {
-	ExplainShape *s = 0;
-
-	int costPos = str.Find(wxT("(cost="));
-	int actPos = str.Find(wxT("(actual"));
+	wxBitmap *s = 0;
 
 	wxStringTokenizer tokens(str, wxT(" "));
 	wxString token = tokens.GetNextToken();
@@ -187,46 +172,16 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 	wxString token4;
 	if (tokens.HasMoreTokens())
 		token4 = tokens.GetNextToken();
-	wxString descr;
-	if (costPos > 0)
-		descr = str.Left(costPos);
-	else if (actPos > 0)
-		descr = str.Left(actPos);
-	else
-		descr = str;
-
-	// Requested an empty shape, which can be treated as a root shape
-	if (level == 0)
-	{
-		s = new ExplainShape(*ex_unknown_png_img, wxEmptyString);
-		s->SetDraggable(false);
-		s->m_rootShape = true;
-		s->level = level;
-		int w = 50, h = 20;
-
-		wxBitmap &bmp = s->GetBitmap();
-		if (w < bmp.GetWidth())
-			w = bmp.GetWidth();
-
-		s->SetHeight(bmp.GetHeight() + BMP_BORDER + h);
-		s->SetWidth(w);
-
-		s->upperShape = NULL;
-		s->kidNo = 0;
-
-		return s;
-	}
-
 
 	// possible keywords can be found in postgresql/src/backend/commands/explain.c
 
-	if (token == wxT("Total"))              return 0;
-	else if (token == wxT("Trigger"))       return 0;
-	else if (token == wxT("Settings:"))		return 0;		/* Greenplum */
-	else if (token == wxT("Slice"))			return 0;		/* Greenplum */
-	else if (token.Mid(0, 6) == wxT("(slice"))	return 0;	/* Greenplum */
-	else if (token == wxT("Result"))        s = new ExplainShape(*ex_result_png_img, descr);
-	else if (token == wxT("Append"))        s = new ExplainShape(*ex_append_png_img, descr);
+	if (token == wxT("Total"))              return NULL;
+	else if (token == wxT("Trigger"))       return NULL;
+	else if (token == wxT("Settings:"))		return NULL;		/* Greenplum */
+	else if (token == wxT("Slice"))			return NULL;		/* Greenplum */
+	else if (token.Mid(0, 6) == wxT("(slice"))	return NULL;	/* Greenplum */
+	else if (token == wxT("Result"))        s = Shape(ex_result_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("Append"))        s = Shape(ex_append_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("Nested"))
 	{
 		if (token2 == wxT("Loop") && token4 == wxT("Join"))
@@ -234,16 +189,16 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 			// Nested Loop Anti Join
 			if (token3 == wxT("Anti"))
 			{
-				s = new ExplainShape(*ex_nested_loop_anti_join_png_img, descr);
+				s = Shape(ex_nested_loop_anti_join_png_bmp, tokenNo, detailNo);
 			}
 			// Nested Loop Semi Join
 			else
 			{
-				s = new ExplainShape(*ex_nested_loop_semi_join_png_img, descr);
+				s = Shape(ex_nested_loop_semi_join_png_bmp, tokenNo, detailNo);
 			}
 		}
 		if (!s)
-			s = new ExplainShape(*ex_nested_png_img, descr);
+			s = Shape(ex_nested_png_bmp, tokenNo, detailNo);
 	}
 	else if (token == wxT("Merge"))
 	{
@@ -252,29 +207,29 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 			// Merge Anti Join
 			if (token2 == wxT("Anti"))
 			{
-				s = new ExplainShape(*ex_merge_anti_join_png_img, descr);
+				s = Shape(ex_merge_anti_join_png_bmp, tokenNo, detailNo);
 			}
 			// Merge Semi Join
 			else
 			{
-				s = new ExplainShape(*ex_merge_semi_join_png_img, descr);
+				s = Shape(ex_merge_semi_join_png_bmp, tokenNo, detailNo);
 			}
 		}
 		// Merge Append
 		else if (token2 == wxT("Append"))
 		{
-			s = new ExplainShape(*ex_merge_append_png_img, descr);
+			s = Shape(ex_merge_append_png_bmp, tokenNo, detailNo);
 		}
 		else
 		{
-			s = new ExplainShape(*ex_merge_png_img, descr);
+			s = Shape(ex_merge_png_bmp, tokenNo, detailNo);
 		}
 	}
 	else if (token == wxT("Hash"))
 	{
 		if (token2 == wxT("Join"))
 		{
-			s = new ExplainShape(*ex_join_png_img, descr);
+			s = Shape(ex_join_png_bmp, tokenNo, detailNo);
 		}
 		else
 		{
@@ -283,21 +238,21 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 				// Hash Anti Join
 				if (token2 == wxT("Anti"))
 				{
-					s = new ExplainShape(*ex_hash_anti_join_png_img, descr);
+					s = Shape(ex_hash_anti_join_png_bmp, tokenNo, detailNo);
 				}
 				// Hash Semi Join
 				else if (token2 == wxT("Semi"))
 				{
-					s = new ExplainShape(*ex_hash_semi_join_png_img, descr);
+					s = Shape(ex_hash_semi_join_png_bmp, tokenNo, detailNo);
 				}
 				else
 				{
-					s = new ExplainShape(*ex_hash_png_img, descr);
+					s = Shape(ex_hash_png_bmp, tokenNo, detailNo);
 				}
 			}
 			else
 			{
-				s = new ExplainShape(*ex_hash_png_img, descr);
+				s = Shape(ex_hash_png_bmp, tokenNo, detailNo);
 			}
 		}
 	}
@@ -308,12 +263,12 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 			// HashSetOp Except ALL
 			if (token3 == wxT("ALL"))
 			{
-				s = new ExplainShape(*ex_hash_setop_except_all_png_img, descr);
+				s = Shape(ex_hash_setop_except_all_png_bmp, tokenNo, detailNo);
 			}
 			// HashSetOp Except
 			else
 			{
-				s = new ExplainShape(*ex_hash_setop_except_png_img, descr);
+				s = Shape(ex_hash_setop_except_png_bmp, tokenNo, detailNo);
 			}
 		}
 		else if (token2 == wxT("Intersect"))
@@ -321,249 +276,155 @@ ExplainShape *ExplainShape::Create(long level, ExplainShape *last, const wxStrin
 			// HashSetOp Intersect ALL
 			if (token3 == wxT("ALL"))
 			{
-				s = new ExplainShape(*ex_hash_setop_intersect_all_png_img, descr);
+				s = Shape(ex_hash_setop_intersect_all_png_bmp, tokenNo, detailNo);
 			}
 			// HashSetOp Intersect
 			else
 			{
-				s = new ExplainShape(*ex_hash_setop_intersect_png_img, descr);
+				s = Shape(ex_hash_setop_intersect_png_bmp, tokenNo, detailNo);
 			}
 		}
 		else
 		{
 			// HashSetOp ???
-			s = new ExplainShape(*ex_hash_setop_unknown_png_img, descr);
+			s = Shape(ex_hash_setop_unknown_png_bmp, tokenNo, detailNo);
 		}
 	}
-	else if (token == wxT("Subquery"))      s = new ExplainShape(*ex_subplan_png_img, descr, 0, 2);
-	else if (token == wxT("Function"))      s = new ExplainShape(*ex_result_png_img, descr, 0, 2);
-	else if (token == wxT("Materialize"))   s = new ExplainShape(*ex_materialize_png_img, descr);
-	else if (token == wxT("Sort"))          s = new ExplainShape(*ex_sort_png_img, descr);
-	else if (token == wxT("Group"))         s = new ExplainShape(*ex_group_png_img, descr);
+	else if (token == wxT("Subquery"))      s = Shape(ex_subplan_png_bmp, tokenNo, detailNo, 0, 2);
+	else if (token == wxT("Function"))      s = Shape(ex_result_png_bmp, tokenNo, detailNo, 0, 2);
+	else if (token == wxT("Materialize"))   s = Shape(ex_materialize_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("Sort"))          s = Shape(ex_sort_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("Group"))         s = Shape(ex_group_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("Aggregate") || token == wxT("GroupAggregate") || token == wxT("HashAggregate"))
-		s = new ExplainShape(*ex_aggregate_png_img, descr);
-	else if (token == wxT("Unique"))        s = new ExplainShape(*ex_unique_png_img, descr);
-	else if (token == wxT("SetOp"))         s = new ExplainShape(*ex_setop_png_img, descr);
-	else if (token == wxT("Limit"))         s = new ExplainShape(*ex_limit_png_img, descr);
-	else if (token == wxT("LockRows"))      s = new ExplainShape(*ex_lock_rows_png_img, descr);
+		s = Shape(ex_aggregate_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("Unique"))        s = Shape(ex_unique_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("SetOp"))         s = Shape(ex_setop_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("Limit"))         s = Shape(ex_limit_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("LockRows"))      s = Shape(ex_lock_rows_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("Bitmap"))
 	{
-		if (token2 == wxT("Index"))         s = new ExplainShape(*ex_bmp_index_png_img, descr, 4, 3);
-		else                                s = new ExplainShape(*ex_bmp_heap_png_img, descr, 4, 3);
+		if (token2 == wxT("Index"))         s = Shape(ex_bmp_index_png_bmp, tokenNo, detailNo, 4, 3);
+		else                                s = Shape(ex_bmp_heap_png_bmp, tokenNo, detailNo, 4, 3);
 	}
-	else if (token == wxT("BitmapAnd"))     s = new ExplainShape(*ex_bmp_and_png_img, descr);
-	else if (token == wxT("BitmapOr"))      s = new ExplainShape(*ex_bmp_or_png_img, descr);
+	else if (token == wxT("BitmapAnd"))     s = Shape(ex_bmp_and_png_bmp, tokenNo, detailNo);
+	else if (token == wxT("BitmapOr"))      s = Shape(ex_bmp_or_png_bmp, tokenNo, detailNo);
 	else if (token2 == wxT("Scan"))
 	{
 		if (token == wxT("Index"))
 			// Scan Index Backward
 			if (token3 == wxT("Backward"))
-				s = new ExplainShape(*ex_index_scan_png_img, descr, 4, 3);
+				s = Shape(ex_index_scan_png_bmp, tokenNo, detailNo, 4, 3);
 			else
-				s = new ExplainShape(*ex_index_scan_png_img, descr, 3, 2);
+				s = Shape(ex_index_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		// Tid Scan
 		else if (token == wxT("Tid"))
-			s = new ExplainShape(*ex_tid_scan_png_img, descr, 3, 2);
+			s = Shape(ex_tid_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		// WorkTable Scan
 		else if (token == wxT("WorkTable"))
-			s = new ExplainShape(*ex_worktable_scan_png_img, descr, 3, 2);
+			s = Shape(ex_worktable_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		// CTE Scan
 		else if (token == wxT("CTE"))
-			s = new ExplainShape(*ex_cte_scan_png_img, descr, 3, 2);
+			s = Shape(ex_cte_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		// Foreign Scan
 		else if (token == wxT("Foreign"))
-			s = new ExplainShape(*ex_foreign_scan_png_img, descr, 3, 2);
+			s = Shape(ex_foreign_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		// Values Scan
 		else if (token == wxT("Values"))
-			s = new ExplainShape(*ex_values_scan_png_img, descr, 3, 2);
+			s = Shape(ex_values_scan_png_bmp, tokenNo, detailNo, 3, 2);
 		else
-			s = new ExplainShape(*ex_scan_png_img, descr, 3, 2);
+			s = Shape(ex_scan_png_bmp, tokenNo, detailNo, 3, 2);
 	}
 	else if (token == wxT("Index"))
 	{
 		// Index Only Scan
 		if (token2 == wxT("Only") && token3 == wxT("Scan"))
 		{
-			s = new ExplainShape(*ex_index_only_scan_png_img, descr, 4, 3);
+			s = Shape(ex_index_only_scan_png_bmp, tokenNo, detailNo, 4, 3);
 		}
 	}
-	else if (token2 == wxT("Seek"))         s = new ExplainShape(*ex_seek_png_img, descr, 3, 2);
+	else if (token2 == wxT("Seek"))         s = Shape(ex_seek_png_bmp, tokenNo, detailNo, 3, 2);
 	// Recursive Union
 	else if (token == wxT("Recursive") && token2 == wxT("Union"))
-		s = new ExplainShape(*ex_recursive_union_png_img, descr);
+		s = Shape(ex_recursive_union_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("WindowAgg"))
-		s = new ExplainShape(*ex_window_aggregate_png_img, descr);
+		s = Shape(ex_window_aggregate_png_bmp, tokenNo, detailNo);
 
 	// DML
 	else if (token == wxT("Insert"))
-		s = new ExplainShape(*ex_insert_png_img, descr, 2, 1);
+		s = Shape(ex_insert_png_bmp, tokenNo, detailNo, 2, 1);
 	else if (token == wxT("Update"))
-		s = new ExplainShape(*ex_update_png_img, descr, 2, 1);
+		s = Shape(ex_update_png_bmp, tokenNo, detailNo, 2, 1);
 	else if (token == wxT("Delete"))
-		s = new ExplainShape(*ex_delete_png_img, descr, 2, 1);
+		s = Shape(ex_delete_png_bmp, tokenNo, detailNo, 2, 1);
 
 	// Greenplum additions
 	else if (token == wxT("Gather") && token2 == wxT("Motion"))
-		s = new ExplainShape(*ex_gather_motion_png_img, descr);
+		s = Shape(ex_gather_motion_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("Broadcast") && token2 == wxT("Motion"))
-		s = new ExplainShape(*ex_broadcast_motion_png_img, descr);
+		s = Shape(ex_broadcast_motion_png_bmp, tokenNo, detailNo);
 	else if (token == wxT("Redistribute") && token2 == wxT("Motion"))
-		s = new ExplainShape(*ex_redistribute_motion_png_img, descr);
+		s = Shape(ex_redistribute_motion_png_bmp, tokenNo, detailNo);
 
 	if (!s)
-		s = new ExplainShape(*ex_unknown_png_img, descr);
+		s = Shape(ex_unknown_png_bmp, tokenNo, detailNo);
 
-	s->SetDraggable(false);
-
-	s->level = level;
-
-	if (costPos > 0)
-	{
-		if (actPos > 0)
-		{
-			s->actual = str.Mid(actPos);
-			s->cost = str.Mid(costPos, actPos - costPos);
-		}
-		else
-			s->cost = str.Mid(costPos);
-	}
-	else if (actPos > 0)
-		s->actual = str.Mid(actPos);
-
-	int w = 50, h = 20;
-
-	wxBitmap &bmp = s->GetBitmap();
-	if (w < bmp.GetWidth())
-		w = bmp.GetWidth();
-
-	s->SetHeight(bmp.GetHeight() + BMP_BORDER + h);
-	s->SetWidth(w);
-
-	s->upperShape = last;
-	if (last)
-	{
-		s->kidNo = last->kidCount;
-		last->kidCount++;
-	}
-	else
-		s->kidNo = 0;
-
-	if (costPos > 0)
-	{
-		wxChar *cl = const_cast<wxChar *>((const wxChar *)str + costPos + 6);
-		wxChar *ch = wxStrstr(cl, wxT(".."));
-		if (ch)
-		{
-			*ch = 0;
-			ch += 2;
-		}
-		s->costLow = StrToDouble(cl);
-		if (ch)
-		{
-			wxChar *r = wxStrstr(ch, wxT(" rows="));
-			if (r)
-			{
-				*r = 0;
-				r += 6;
-			}
-			s->costHigh = StrToDouble(ch);
-			if (r)
-			{
-				wxChar *w = wxStrstr(r, wxT(" width="));
-				if (w)
-				{
-					*w = 0;
-					w += 7;
-				}
-				s->rows = StrToLong(r);
-				if (w)
-					s->width = StrToLong(w);
-			}
-		}
-	}
 	return s;
 }
 
 
-ExplainLine::ExplainLine(ExplainShape *from, ExplainShape *to, double weight)
+void ExplainShape::DrawLine(wxDC &dc, ExplainNode *from, const wxRealPoint &start, const wxRealPoint &end)
 {
-	SetCanvas(from->GetCanvas());
-	from->AddLine(this, to);
-	MakeLineControlPoints(4);
-
-	width = (int) log(from->GetAverageCost());
+	// If we got an average cost of 0, the logarithm is negative (or not
+	// a number), which will look pretty darn ugly as an arrow width!
+	// This may happen on Greenplum.
+	int width = 1;
+	if (from->GetAverageCost() > 1)
+		width = (int) log(from->GetAverageCost());
 	if (width > 10)
 		width = 10;
-
-	// If we got an average cost of 0, width is probably negative
-	// which will look pretty darn ugly as an arrow width!
-	// This may happen on Greenplum.
 	if (width < 1)
 		width = 1;
 
-	wxNode *first = GetLineControlPoints()->GetFirst();
-	wxNode *last  = GetLineControlPoints()->GetLast();
-	*(wxRealPoint *)first->GetData() = from->GetStartPoint();
-	*(wxRealPoint *)last->GetData() = to->GetEndPoint(from->GetKidno());
+	wxRealPoint point0 = start, point1 = start;
+	wxRealPoint point2 = end, point3 = end;
+	point1.x -= (point1.x - point2.x) / 3. + 8;
+	point2.x += (point1.x - point2.x) / 3. - 8;
 
-	wxRealPoint *p1 = (wxRealPoint *)first->GetNext()->GetData();
-	wxRealPoint *p2 = (wxRealPoint *)last->GetPrevious()->GetData();
-	*p1 = from->GetStartPoint();
-	*p2 = to->GetEndPoint(from->GetKidno());
-	p1->x -= (p1->x - p2->x) / 3. + 8;
-	p2->x += (p1->x - p2->x) / 3. - 8;
+	dc.SetPen(*wxThePenList->FindOrCreatePen(*wxBLACK, 1, wxSOLID));
+	dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(*wxLIGHT_GREY, wxSOLID));
 
-	Initialise();
-}
+	wxPoint points[11];
 
+	double phi  = atan2(point2.y - point1.y, point2.x - point1.x);
+	double offs = width * tan(phi / 2);
 
-#define ARROWWIDTH  4
+	points[0].x  = WXROUND(point0.x);
+	points[0].y  = WXROUND(point0.y) - width;
+	points[10].x = WXROUND(point0.x);
+	points[10].y = WXROUND(point0.y) + width;
 
+	points[1].x  = WXROUND(point1.x + offs);
+	points[1].y  = WXROUND(point1.y) - width;
+	points[9].x  = WXROUND(point1.x - offs);
+	points[9].y  = WXROUND(point1.y) + width;
 
-void ExplainLine::OnDraw(wxDC &dc)
-{
-	if (m_lineControlPoints)
-	{
-		dc.SetPen(*wxThePenList->FindOrCreatePen(*wxBLACK, 1, wxSOLID));
-		dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(*wxLIGHT_GREY, wxSOLID));
-
-		wxPoint *points = new wxPoint[11];
-		wxRealPoint *point0 = (wxRealPoint *) m_lineControlPoints->Item(0)->GetData();
-		wxRealPoint *point1 = (wxRealPoint *) m_lineControlPoints->Item(1)->GetData();
-		wxRealPoint *point2 = (wxRealPoint *) m_lineControlPoints->Item(2)->GetData();
-		wxRealPoint *point3 = (wxRealPoint *) m_lineControlPoints->Item(3)->GetData();
-
-		double phi  = atan2(point2->y - point1->y, point2->x - point1->x);
-		double offs = width * tan(phi / 2);
-
-		points[0].x  = WXROUND(point0->x);
-		points[0].y  = WXROUND(point0->y) - width;
-		points[10].x = WXROUND(point0->x);
-		points[10].y = WXROUND(point0->y) + width;
-
-		points[1].x  = WXROUND(point1->x + offs);
-		points[1].y  = WXROUND(point1->y) - width;
-		points[9].x  = WXROUND(point1->x - offs);
-		points[9].y  = WXROUND(point1->y) + width;
-
-		points[2].x  = WXROUND(point2->x + offs);
-		points[2].y  = WXROUND(point2->y) - width;
-		points[8].x  = WXROUND(point2->x - offs);
-		points[8].y  = WXROUND(point2->y) + width;
-
-		points[3].x  = WXROUND(point3->x) - width - ARROWWIDTH;
-		points[3].y  = WXROUND(point3->y) - width;
-		points[7].x  = WXROUND(point3->x) - width - ARROWWIDTH;
-		points[7].y  = WXROUND(point3->y) + width;
-
-		points[4].x  = points[3].x;
-		points[4].y  = points[3].y - ARROWWIDTH;
-		points[6].x  = points[7].x;
-		points[6].y  = points[7].y + ARROWWIDTH;
-
-		points[5].x  = WXROUND(point3->x);
-		points[5].y  = WXROUND(point3->y);
-
-		dc.DrawPolygon(11, points, 0, 0);
-	}
+	points[2].x  = WXROUND(point2.x + offs);
+	points[2].y  = WXROUND(point2.y) - width;
+	points[8].x  = WXROUND(point2.x - offs);
+	points[8].y  = WXROUND(point2.y) + width;
+
+	points[3].x  = WXROUND(point3.x) - width - ARROWWIDTH;
+	points[3].y  = WXROUND(point3.y) - width;
+	points[7].x  = WXROUND(point3.x) - width - ARROWWIDTH;
+	points[7].y  = WXROUND(point3.y) + width;
+
+	points[4].x  = points[3].x;
+	points[4].y  = points[3].y - ARROWWIDTH;
+	points[6].x  = points[7].x;
+	points[6].y  = points[7].y + ARROWWIDTH;
+
+	points[5].x  = WXROUND(point3.x);
+	points[5].y  = WXROUND(point3.y);
+
+	dc.DrawPolygon(11, points, 0, 0);
 }
@@ -12,6 +12,8 @@
 pgadmin3_SOURCES += \
 	db/keywords.c \
 	db/pgConn.cpp \
+	db/pgConnector.cpp \
+	db/pgConnPool.cpp \
 	db/pgSet.cpp \
 	db/pgQueryThread.cpp
 
@@ -28,6 +28,7 @@ typedef u_long in_addr_t;
 #include <arpa/inet.h>
 #include <netdb.h>
 #include <netinet/in.h>
+#include <poll.h>
 
 #ifndef INADDR_NONE
 #define INADDR_NONE (-1)
@@ -41,6 +42,7 @@ typedef u_long in_addr_t;
 #include "db/pgConn.h"
 #include "utils/misc.h"
 #include "db/pgSet.h"
+#include "db/pgConnPool.h"
 
 double pgConn::libpqVersion = 8.0;
 
@@ -49,10 +51,15 @@ static void pgNoticeProcessor(void *arg, const char *message)
 	((pgConn *)arg)->Notice(message);
 }
 
+// For connections in the pool, which have no pgConn
+static void pgNoticeDiscard(void *arg, const char *message)
+{
+}
+
 pgConn::pgConn(const wxString &server, const wxString &service, const wxString &hostaddr, const wxString &database, const wxString &username, const wxString &password,
                int port, const wxString &rolename, int sslmode, OID oid, const wxString &applicationname,
                const wxString &sslcert, const wxString &sslkey, const wxString &sslrootcert, const wxString &sslcrl,
-               const bool sslcompression) : m_cancelConn(NULL)
+               const bool sslcompression, long connecttimeout) : m_cancelConn(NULL)
 {
 	wxString msg;
 
@@ -79,11 +86,22 @@ pgConn::pgConn(const wxString &server, const wxString &service, const wxString &
 	conv = &wxConvLibc;
 	needColQuoting = false;
 	utfConnectString = false;
+	connectTimedOut = false;
+
+	// wxConfig must not be read from other threads: connections opened in
+	// the background are given the timeout (see pgServerConnectRequest)
+	if (connecttimeout >= 0)
+		connectTimeout = connecttimeout;
+	else if (wxThread::IsMain())
+		connectTimeout = settings->GetConnectTimeout();
+	else
+		connectTimeout = 30;
 
 	// Check the hostname/ipaddress
 	conn = 0;
 	noticeArg = 0;
 	connStatus = PGCONN_BAD;
+	preparedStatementCount = 0;
 
 	// Create the connection string
 	if (!server.IsEmpty())
@@ -198,6 +216,15 @@ pgConn::pgConn(const wxString &server, const wxString &service, const wxString &
 	dbHostName = server;
 	dbRole = rolename;
 
+	// The application name is set again when a pooled connection is
+	// reused, so it isn't part of the key.
+	poolServer = server + wxT(":") + NumToStr((long)port);
+	if (!hostaddr.IsEmpty())
+		poolServer += wxT("/") + hostaddr;
+	if (!service.IsEmpty())
+		poolServer += wxT("@") + service;
+	poolKey = poolServer + wxT("\n") + database + wxT("\n") + connstr + wxT("\n") + rolename;
+
 #ifdef HAVE_CONNINFO_PARSE
 	if (!applicationname.IsEmpty())
 	{
@@ -232,28 +259,121 @@ pgConn::~pgConn()
 
 bool pgConn::DoConnect()
 {
+	connectTimedOut = false;
+
+	// Pooled connections have been reset when they were closed; setting
+	// them up is also the check that they are still alive
+	while ((conn = pgConnPool::Lease(poolKey)) != NULL)
+	{
+		if (Initialize(true))
+		{
+			wxLogInfo(wxT("Reusing a pooled connection"));
+			return true;
+		}
+		PQfinish(conn);
+	}
+
 	wxCharBuffer cstrUTF = connstr.mb_str(wxConvUTF8);
-	conn = PQconnectdb(cstrUTF);
+	conn = ConnectPoll(cstrUTF);
 	if (PQstatus(conn) == CONNECTION_OK)
 		utfConnectString = true;
-	else
+	else if (conn && !connectTimedOut)
 	{
+		// No need to try again if the server could not be reached at all
 		wxCharBuffer cstrLibc = connstr.mb_str(wxConvLibc);
 		if (strcmp(cstrUTF, cstrLibc))
 		{
 			PQfinish(conn);
-			conn = PQconnectdb(cstrLibc);
+			conn = ConnectPoll(cstrLibc);
 		}
 	}
 
 	if (!Initialize())
 		return false;
 
+	pgConnPool::OpenServer(poolServer);
 	return true;
 }
 
 
-bool pgConn::Initialize()
+void pgConn::WaitForSocket(int sock, bool forRead, long timeout)
+{
+#ifdef __WXMSW__
+	fd_set fds;
+	struct timeval tv;
+
+	FD_ZERO(&fds);
+	FD_SET((SOCKET) sock, &fds);
+
+	tv.tv_sec = timeout / 1000;
+	tv.tv_usec = (timeout % 1000) * 1000;
+	select(sock + 1, forRead ? &fds : NULL, forRead ? NULL : &fds, NULL, &tv);
+#else
+	struct pollfd fds[1];
+
+	fds[0].fd = sock;
+	fds[0].events = forRead ? POLLIN : POLLOUT;
+	fds[0].revents = 0;
+
+	poll(fds, 1, (int)timeout);
+#endif
+}
+
+
+// Connects without waiting in libpq, so that the attempt can be given up
+// after the configured timeout, or when the thread connecting is deleted.
+// On timeout, NULL is returned and connectTimedOut is set.
+PGconn *pgConn::ConnectPoll(const char *connectString)
+{
+	long timeout = connectTimeout * 1000L;
+	wxLongLong deadline = wxGetLocalTimeMillis() + timeout;
+	wxThread *thread = wxThread::IsMain() ? NULL : wxThread::This();
+
+	PGconn *newConn = PQconnectStart(connectString);
+	if (!newConn || PQstatus(newConn) == CONNECTION_BAD)
+		return newConn;
+
+	PostgresPollingStatusType pollStatus = PGRES_POLLING_WRITING;
+	while (pollStatus != PGRES_POLLING_OK && pollStatus != PGRES_POLLING_FAILED)
+	{
+		long wait = thread ? 100 : 1000;
+		if (timeout > 0)
+		{
+			wxLongLong left = deadline - wxGetLocalTimeMillis();
+			if (left <= 0)
+			{
+				wxLogInfo(wxT("Connection attempt timed out after %ld seconds"), timeout / 1000);
+				connectTimedOut = true;
+				break;
+			}
+			if (left < wait)
+				wait = left.ToLong();
+		}
+
+		if (thread && thread->TestDestroy())
+			break;
+
+		// libpq may switch to another socket, e.g. when it retries
+		// without SSL
+		int sock = PQsocket(newConn);
+		if (sock < 0)
+			break;
+
+		WaitForSocket(sock, pollStatus == PGRES_POLLING_READING, wait);
+		pollStatus = PQconnectPoll(newConn);
+	}
+
+	if (pollStatus != PGRES_POLLING_OK && PQstatus(newConn) != CONNECTION_BAD)
+	{
+		PQfinish(newConn);
+		return NULL;
+	}
+
+	return newConn;
+}
+
+
+bool pgConn::Initialize(bool leased)
 {
 	// Set client encoding to Unicode/Ascii, Datestyle to ISO, and ask for notices.
 	if (PQstatus(conn) == CONNECTION_OK)
@@ -261,6 +381,12 @@ bool pgConn::Initialize()
 		connStatus = PGCONN_OK;
 		PQsetNoticeProcessor(conn, pgNoticeProcessor, this);
 
+		pgConnInfo info;
+		if (pgConnPool::GetInfo(poolKey, info))
+			return InitializeFromInfo(info, leased);
+		else if (leased)
+			return false;
+
 		wxString sql = wxT("SET DateStyle=ISO;\nSET client_min_messages=notice;\n");
 		if (BackendMinimumVersion(9, 0))
 			sql += wxT("SET bytea_output=escape;\n");
@@ -318,6 +444,8 @@ bool pgConn::Initialize()
 				else
 					return false;
 			}
+
+			SaveInfo();
 			return true;
 		}
 	}
@@ -325,15 +453,117 @@ bool pgConn::Initialize()
 }
 
 
+// Same as Initialize(), without asking the server again what an earlier
+// connection with the same key found out. The settings changed by the
+// session are reset when it is pooled, so they are all set again.
+bool pgConn::InitializeFromInfo(const pgConnInfo &info, bool leased)
+{
+	// Duplicate() may have set these already
+	if (!majorVersion)
+	{
+		majorVersion = info.majorVersion;
+		minorVersion = info.minorVersion;
+		patchVersion = info.patchVersion;
+		isEdb = info.isEdb;
+		isGreenplum = info.isGreenplum;
+	}
+	if (!features[FEATURE_INITIALIZED])
+		memcpy(features, info.features, sizeof(features));
+	if (reservedNamespaces.IsEmpty())
+		reservedNamespaces = info.reservedNamespaces;
+
+	needColQuoting = info.needColQuoting;
+	lastSystemOID = info.lastSystemOID;
+	dbOid = info.dbOid;
+	if (leased)
+		utfConnectString = info.utfConnectString;
+
+	if (info.encoding != wxT("SQL_ASCII") && info.encoding != wxT("MULE_INTERNAL"))
+		conv = &wxConvUTF8;
+	else
+		conv = &wxConvLibc;
+
+	wxString sql = wxT("SET DateStyle=ISO;\nSET client_min_messages=notice;\n");
+	if (BackendMinimumVersion(9, 0))
+	{
+		sql += wxT("SET bytea_output=escape;\n");
+		if (leased && !save_applicationname.IsEmpty())
+			sql += wxT("SET application_name=") + qtDbString(save_applicationname) + wxT(";\n");
+	}
+
+	wxLogInfo(wxT("Setting client_encoding to '%s'"), info.encoding.c_str());
+	sql += wxT("SET client_encoding=") + qtDbString(info.encoding) + wxT(";\n");
+
+	if (dbRole != wxEmptyString && BackendMinimumVersion(8, 1))
+		sql += wxT("SET ROLE TO ") + qtIdent(dbRole) + wxT(";\n");
+
+	// A pooled connection may have been closed by the server meanwhile;
+	// DoConnect() opens a new one then, so that is no error.
+	return ExecuteVoid(sql, !leased);
+}
+
+
+// Keeps what has been found out about the server and database for the
+// next connections with the same key
+void pgConn::SaveInfo()
+{
+	pgConnInfo info;
+	pgConnPool::GetInfo(poolKey, info);
+
+	BackendMinimumVersion(0, 0);
+	info.majorVersion = majorVersion;
+	info.minorVersion = minorVersion;
+	info.patchVersion = patchVersion;
+	info.isEdb = isEdb;
+	info.isGreenplum = isGreenplum;
+	if (features[FEATURE_INITIALIZED])
+		memcpy(info.features, features, sizeof(features));
+	if (!reservedNamespaces.IsEmpty())
+		info.reservedNamespaces = reservedNamespaces;
+
+	const char *encoding = PQparameterStatus(conn, "client_encoding");
+	if (!encoding)
+		return;
+	info.encoding = wxString::FromAscii(encoding);
+	info.dbOid = dbOid;
+	info.lastSystemOID = lastSystemOID;
+	info.needColQuoting = needColQuoting;
+	info.utfConnectString = utfConnectString;
+
+	pgConnPool::SetInfo(poolKey, info);
+}
+
+
 void pgConn::Close()
 {
 	if (conn)
 	{
 		CancelExecution();
-		PQfinish(conn);
+
+		// A session not in a transaction can be kept for the next connection
+		// with the same key, which saves the new backend and the
+		// authentication. The pool resets it with DISCARD ALL (8.3 and
+		// later) in the background, so that closing doesn't wait for the
+		// server.
+		bool pooled = false;
+		if (PQstatus(conn) == CONNECTION_OK && PQtransactionStatus(conn) == PQTRANS_IDLE)
+		{
+			SaveInfo();
+
+			if (BackendMinimumVersion(8, 3) && pgConnPool::HasRoom(poolKey))
+			{
+				// pgQueryThread leaves it nonblocking
+				PQsetnonblocking(conn, 0);
+				PQsetNoticeProcessor(conn, pgNoticeDiscard, NULL);
+				pooled = pgConnPool::Release(poolKey, conn);
+			}
+		}
+		if (!pooled)
+			PQfinish(conn);
 	}
 	conn = 0;
 	connStatus = PGCONN_BAD;
+	preparedStatements.clear();
 }
 
 
@@ -363,7 +593,7 @@ pgConn *pgConn::Duplicate(const wxString &_appName)
 	                         wxString(save_hostaddr), wxString(save_database), wxString(save_username),
 	                         wxString(save_password), save_port, save_rolename, save_sslmode, save_oid,
 	                         _appName.IsEmpty() ? save_applicationname : _appName, save_sslcert, save_sslkey,
-	                         save_sslrootcert, save_sslcrl, save_sslcompression);
+	                         save_sslrootcert, save_sslcrl, save_sslcompression, connectTimeout);
 
 	// Save the version and features information from the existing connection
 	res->majorVersion = majorVersion;
@@ -842,6 +1072,163 @@ pgSet *pgConn::ExecuteSet(const wxString &sql, bool reportError)
 	return new pgSet();
 }
 
+// Execute a query with parameters (referenced as $1, $2...). The query is
+// prepared the first time it is run on this connection and the prepared
+// statement reused afterwards, so it is only parsed and planned once.
+// If the server refuses to prepare it and the same query is given with
+// the values inlined, that one is run instead.
+pgSet *pgConn::ExecutePrepared(const wxString &sql, const wxArrayString &params, bool reportError,
+                               const wxString &inlined)
+{
+	if (GetStatus() != PGCONN_OK)
+		return new pgSet();
+
+	wxLogSql(wxT("Prepared query (%s:%d): %s"), this->GetHost().c_str(), this->GetPort(), sql.c_str());
+
+	// Convert the parameters to the connection encoding
+	int nParams = params.GetCount();
+	wxCharBuffer *buffers = new wxCharBuffer[nParams > 0 ? nParams : 1];
+	const char **values = (const char **)malloc((nParams > 0 ? nParams : 1) * sizeof(const char *));
+	bool converted = true;
+
+	for (int i = 0; i < nParams; i++)
+	{
+		buffers[i] = params[i].mb_str(*conv);
+		values[i] = buffers[i];
+		if (!values[i] && !params[i].IsEmpty())
+			converted = false;
+	}
+
+	wxCharBuffer queryBuf = sql.mb_str(*conv);
+	PGresult *qryRes = NULL;
+
+	if (!converted || !queryBuf)
+	{
+		lastResultStatus = PGRES_FATAL_ERROR;
+		SetLastResultError(NULL, _("the query could not be converted to the required encoding."));
+		if (reportError)
+			wxLogError(wxT("%s"), lastResultError.msg_primary.c_str());
+		else
+			wxLogQuietError(wxT("%s"), lastResultError.msg_primary.c_str());
+	}
+	else
+	{
+		// A prepared statement may have vanished behind our back (DISCARD,
+		// DEALLOCATE) or be unable to cope with a schema change: forget it
+		// and run the query once more, unless this would now fail because
+		// of the aborted transaction.
+		bool retried = false, useInlined = false;
+
+		while (true)
+		{
+			wxString name;
+			pgPreparedStatementHash::iterator it = preparedStatements.find(sql);
+			bool prepared = (it != preparedStatements.end());
+
+			if (prepared)
+			{
+				name = it->second;
+				if (name.IsEmpty() && !inlined.IsEmpty())
+				{
+					useInlined = true;
+					break;
+				}
+			}
+			else if (preparedStatements.size() < PGCONN_MAX_PREPARED)
+			{
+				name = wxString::Format(wxT("pgadmin_stmt_%ld"), ++preparedStatementCount);
+
+				// Within a transaction, a failure must not abort it before
+				// the inlined query runs
+				bool savepoint = !inlined.IsEmpty() && PQtransactionStatus(conn) == PQTRANS_INTRANS;
+				if (savepoint)
+					PQclear(PQexec(conn, "SAVEPOINT pgadmin_prepare"));
+
+				SetConnCancel();
+				qryRes = PQprepare(conn, name.mb_str(wxConvUTF8), queryBuf, nParams, NULL);
+				ResetConnCancel();
+
+				bool ok = (PQresultStatus(qryRes) == PGRES_COMMAND_OK);
+				if (savepoint)
+				{
+					if (!ok)
+						PQclear(PQexec(conn, "ROLLBACK TO SAVEPOINT pgadmin_prepare"));
+					PQclear(PQexec(conn, "RELEASE SAVEPOINT pgadmin_prepare"));
+				}
+
+				if (!ok)
+				{
+					if (!inlined.IsEmpty() && PQtransactionStatus(conn) != PQTRANS_INERROR)
+					{
+						// Binding the values changed the meaning of the query,
+						// which is not tried again on this connection
+						wxLogSql(wxT("Query could not be prepared: %s"), wxString(PQresultErrorMessage(qryRes), *conv).c_str());
+						PQclear(qryRes);
+						qryRes = NULL;
+						preparedStatements[sql] = wxEmptyString;
+						useInlined = true;
+					}
+					break;
+				}
+
+				PQclear(qryRes);
+				preparedStatements[sql] = name;
+			}
+
+			SetConnCancel();
+			if (name.IsEmpty())
+				qryRes = PQexecParams(conn, queryBuf, nParams, NULL, values, NULL, NULL, 0);
+			else
+				qryRes = PQexecPrepared(conn, name.mb_str(wxConvUTF8), nParams, values, NULL, NULL, 0);
+			ResetConnCancel();
+
+			if (!prepared || retried || PQresultStatus(qryRes) != PGRES_FATAL_ERROR
+			        || PQtransactionStatus(conn) != PQTRANS_IDLE)
+				break;
+
+			wxString state(PQresultErrorField(qryRes, PG_DIAG_SQLSTATE), wxConvUTF8);
+			if (state != wxT("26000") && state != wxT("0A000"))
+				break;
+
+			PQclear(qryRes);
+			qryRes = NULL;
+			preparedStatements.erase(sql);
+
+			if (state == wxT("0A000"))
+			{
+				PGresult *res = PQexec(conn, (wxT("DEALLOCATE ") + name).mb_str(wxConvUTF8));
+				PQclear(res);
+			}
+
+			retried = true;
+		}
+
+		if (useInlined)
+		{
+			delete [] buffers;
+			free(values);
+			return ExecuteSet(inlined, reportError);
+		}
+
+		lastResultStatus = PQresultStatus(qryRes);
+		SetLastResultError(qryRes);
+	}
+
+	delete [] buffers;
+	free(values);
+
+	if (qryRes && (lastResultStatus == PGRES_TUPLES_OK || lastResultStatus == PGRES_COMMAND_OK))
+		return new pgSet(qryRes, this, *conv, needColQuoting);
+
+	if (qryRes)
+	{
+		LogError(!reportError);
+		PQclear(qryRes);
+	}
+
+	return new pgSet();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // COPY functions
 //////////////////////////////////////////////////////////////////////////
@@ -931,6 +1318,8 @@ wxString pgConn::GetLastError() const
 	{
 		if (connStatus == PGCONN_BROKEN)
 			errmsg = _("Connection to database broken.");
+		else if (connectTimedOut)
+			errmsg = _("Timeout expired while connecting to the server.");
 		else
 			errmsg = _("No connection to database.");
 	}
@@ -1012,6 +1401,7 @@ void pgConn::Reset()
 
 	// Reset any vars that need to be in a defined state before connecting
 	needColQuoting = false;
+	preparedStatements.clear();
 
 	Initialize();
 }
@@ -0,0 +1,568 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnPool.cpp - Keeps closed connections open for reuse
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/timer.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgConnPool.h"
+#include "utils/sysLogger.h"
+
+
+// Whatever the settings say, the pool doesn't hold more than this many
+// sessions per key, in all, or for longer than this (seconds): each of
+// them is a backend on the server, counted against max_connections.
+#define POOL_MAX_PER_KEY    2
+#define POOL_MAX_TOTAL      4
+#define POOL_MAX_IDLE_TIME  300
+
+// How often idle connections are checked and closed (ms)
+#define POOL_PRUNE_INTERVAL 15000
+
+// How long the reset of a released connection may take (ms)
+#define POOL_RESET_TIMEOUT  5000
+
+
+pgConnInfo::pgConnInfo()
+{
+	majorVersion = minorVersion = patchVersion = 0;
+	isEdb = isGreenplum = false;
+	memset(features, 0, sizeof(features));
+	dbOid = lastSystemOID = 0;
+	needColQuoting = utfConnectString = false;
+}
+
+
+class pgConnPoolEntry
+{
+public:
+	pgConnPoolEntry() : hasInfo(false) {}
+
+	bool hasInfo;
+	pgConnInfo info;
+
+	// Oldest first
+	wxArrayPtrVoid idle;
+	wxArrayLong idleSince;
+};
+
+
+// Closes the idle connections even when no connection is opened or closed
+class pgConnPoolTimer : public wxTimer
+{
+public:
+	virtual void Notify()
+	{
+		pgConnPool::Prune();
+	}
+};
+
+
+// Resets the released connections one after the other, so that neither
+// the thread closing them nor the one taking them over waits for the
+// server
+class pgConnPoolResetter : public wxThread
+{
+public:
+	pgConnPoolResetter()
+		: wxThread(wxTHREAD_JOINABLE), queueCond(queueLock), stopping(false) {}
+
+	void Add(const wxString &key, PGconn *conn);
+
+	// Closes the connections waiting with keys starting with prefix
+	void Discard(const wxString &prefix);
+
+	// Closes the connections waiting, and ends the thread
+	void Stop();
+
+private:
+	virtual void *Entry();
+	bool Reset(PGconn *conn);
+
+	wxMutex queueLock;
+	wxCondition queueCond;
+	wxArrayString keys;
+	wxArrayPtrVoid conns;
+	bool stopping;
+};
+
+
+wxMutex pgConnPool::lock;
+pgConnPoolHash pgConnPool::entries;
+wxArrayString pgConnPool::closedServers;
+bool pgConnPool::cleared = false;
+wxTimer *pgConnPool::timer = NULL;
+pgConnPoolResetter *pgConnPool::resetter = NULL;
+size_t pgConnPool::resetting = 0;
+long pgConnPool::maxSize = 0;
+long pgConnPool::maxIdle = 0;
+
+
+// Runs a statement, giving up after timeout ms. If it returns a row, its
+// first column tells whether the session can be pooled.
+static bool ExecuteTimed(PGconn *conn, const char *sql, long timeout)
+{
+	if (!PQsendQuery(conn, sql))
+		return false;
+
+	wxLongLong deadline = wxGetLocalTimeMillis() + timeout;
+	while (PQisBusy(conn))
+	{
+		wxLongLong left = deadline - wxGetLocalTimeMillis();
+		if (left <= 0)
+			return false;
+
+		pgConn::WaitForSocket(PQsocket(conn), true, left.ToLong());
+		if (!PQconsumeInput(conn))
+			return false;
+	}
+
+	bool ok = true;
+	PGresult *res;
+	while ((res = PQgetResult(conn)) != NULL)
+	{
+		ExecStatusType status = PQresultStatus(res);
+		if (status == PGRES_TUPLES_OK)
+			ok = ok && PQntuples(res) == 1 && !strcmp(PQgetvalue(res, 0, 0), "f");
+		else if (status != PGRES_COMMAND_OK)
+			ok = false;
+		PQclear(res);
+	}
+
+	return ok && PQtransactionStatus(conn) == PQTRANS_IDLE;
+}
+
+
+void pgConnPoolResetter::Add(const wxString &key, PGconn *conn)
+{
+	wxMutexLocker locker(queueLock);
+
+	keys.Add(key);
+	conns.Add(conn);
+	queueCond.Signal();
+}
+
+
+void pgConnPoolResetter::Discard(const wxString &prefix)
+{
+	wxMutexLocker locker(queueLock);
+
+	size_t i = 0;
+	while (i < keys.GetCount())
+	{
+		if (keys.Item(i).StartsWith(prefix))
+		{
+			PQfinish((PGconn *)conns.Item(i));
+			keys.RemoveAt(i);
+			conns.RemoveAt(i);
+			pgConnPool::resetting--;
+		}
+		else
+			i++;
+	}
+}
+
+
+void pgConnPoolResetter::Stop()
+{
+	{
+		wxMutexLocker locker(queueLock);
+
+		stopping = true;
+		size_t i;
+		for (i = 0; i < conns.GetCount(); i++)
+			PQfinish((PGconn *)conns.Item(i));
+		keys.Clear();
+		conns.Clear();
+		queueCond.Signal();
+	}
+
+	Wait();
+}
+
+
+// A session holding session-level locks, temporary tables or LISTEN
+// registrations is closed rather than reset: that releases them at once
+bool pgConnPoolResetter::Reset(PGconn *conn)
+{
+	const char *check =
+	    PQserverVersion(conn) >= 90000 ?
+	    "SELECT EXISTS (SELECT 1 FROM pg_locks WHERE pid = pg_backend_pid() AND locktype = 'advisory')\n"
+	    "    OR EXISTS (SELECT 1 FROM pg_class WHERE relnamespace = pg_my_temp_schema())\n"
+	    "    OR EXISTS (SELECT 1 FROM pg_listening_channels())" :
+	    "SELECT EXISTS (SELECT 1 FROM pg_locks WHERE pid = pg_backend_pid() AND locktype = 'advisory')\n"
+	    "    OR EXISTS (SELECT 1 FROM pg_class WHERE relnamespace = pg_my_temp_schema())\n"
+	    "    OR EXISTS (SELECT 1 FROM pg_listener WHERE listenerpid = pg_backend_pid())";
+
+	// DISCARD ALL can't be part of a batch of statements
+	return ExecuteTimed(conn, check, POOL_RESET_TIMEOUT)
+	       && ExecuteTimed(conn, "DISCARD ALL", POOL_RESET_TIMEOUT);
+}
+
+
+void *pgConnPoolResetter::Entry()
+{
+	while (true)
+	{
+		wxString key;
+		PGconn *conn;
+
+		{
+			wxMutexLocker locker(queueLock);
+
+			while (!stopping && conns.IsEmpty())
+				queueCond.Wait();
+			if (stopping)
+				break;
+
+			key = keys.Item(0);
+			conn = (PGconn *)conns.Item(0);
+			keys.RemoveAt(0);
+			conns.RemoveAt(0);
+		}
+
+		if (Reset(conn))
+			pgConnPool::AddIdle(key, conn);
+		else
+		{
+			PQfinish(conn);
+
+			wxMutexLocker locker(pgConnPool::lock);
+			pgConnPool::resetting--;
+		}
+	}
+
+	return NULL;
+}
+
+
+wxString pgConnPool::ServerOf(const wxString &key)
+{
+	return key.BeforeFirst('\n');
+}
+
+
+void pgConnPool::ReadSettings()
+{
+	if (!wxThread::IsMain())
+		return;
+
+	maxSize = wxMin(settings->GetConnectionPoolSize(), (long)POOL_MAX_PER_KEY);
+	maxIdle = wxMin(settings->GetConnectionPoolIdleTime(), (long)POOL_MAX_IDLE_TIME);
+}
+
+
+// Including the ones being reset
+size_t pgConnPool::IdleCount()
+{
+	size_t count = resetting;
+
+	pgConnPoolHash::iterator it;
+	for (it = entries.begin(); it != entries.end(); ++it)
+		count += it->second->idle.GetCount();
+
+	return count;
+}
+
+
+// Whether an idle connection can still be used. Reading what the server
+// may have sent never blocks; it tells whether the server closed the
+// session meanwhile (it was shut down, or the backend was terminated).
+static bool IsAlive(PGconn *conn)
+{
+	return PQconsumeInput(conn) && PQstatus(conn) == CONNECTION_OK
+	       && PQtransactionStatus(conn) == PQTRANS_IDLE;
+}
+
+
+// Closes the connections idle for too long, or that are not usable
+// anymore
+void pgConnPool::Prune(long now)
+{
+	ReadSettings();
+
+	pgConnPoolHash::iterator it;
+	for (it = entries.begin(); it != entries.end(); ++it)
+	{
+		pgConnPoolEntry *entry = it->second;
+		size_t i = 0;
+		while (i < entry->idle.GetCount())
+		{
+			PGconn *conn = (PGconn *)entry->idle.Item(i);
+			if (now - entry->idleSince.Item(i) > maxIdle || !IsAlive(conn))
+			{
+				PQfinish(conn);
+				entry->idle.RemoveAt(i);
+				entry->idleSince.RemoveAt(i);
+			}
+			else
+				i++;
+		}
+	}
+}
+
+
+void pgConnPool::Prune()
+{
+	wxMutexLocker locker(lock);
+
+	Prune(wxGetLocalTime());
+
+	if (timer && IdleCount() == 0)
+		timer->Stop();
+}
+
+
+PGconn *pgConnPool::Lease(const wxString &key)
+{
+	wxMutexLocker locker(lock);
+
+	if (cleared || closedServers.Index(ServerOf(key)) != wxNOT_FOUND)
+		return NULL;
+
+	Prune(wxGetLocalTime());
+
+	pgConnPoolHash::iterator it = entries.find(key);
+	if (it == entries.end() || it->second->idle.IsEmpty())
+		return NULL;
+
+	// The most recently used one is the most likely to be still alive
+	pgConnPoolEntry *entry = it->second;
+	size_t last = entry->idle.GetCount() - 1;
+	PGconn *conn = (PGconn *)entry->idle.Item(last);
+	entry->idle.RemoveAt(last);
+	entry->idleSince.RemoveAt(last);
+
+	return conn;
+}
+
+
+bool pgConnPool::Release(const wxString &key, PGconn *conn)
+{
+	wxMutexLocker locker(lock);
+
+	if (cleared || closedServers.Index(ServerOf(key)) != wxNOT_FOUND)
+		return false;
+
+	Prune(wxGetLocalTime());
+
+	pgConnPoolHash::iterator it = entries.find(key);
+	size_t idle = (it == entries.end()) ? 0 : it->second->idle.GetCount();
+	if ((long)idle >= maxSize || IdleCount() >= POOL_MAX_TOTAL)
+		return false;
+
+	if (!resetter)
+	{
+		resetter = new pgConnPoolResetter();
+		if (resetter->Create() != wxTHREAD_NO_ERROR || resetter->Run() != wxTHREAD_NO_ERROR)
+		{
+			delete resetter;
+			resetter = NULL;
+			return false;
+		}
+	}
+
+	resetting++;
+	resetter->Add(key, conn);
+
+	// Timers only run on the main thread; connections released by other
+	// threads are pruned on the next call anyway
+	if (wxThread::IsMain())
+	{
+		if (!timer)
+			timer = new pgConnPoolTimer();
+		if (!timer->IsRunning())
+			timer->Start(POOL_PRUNE_INTERVAL);
+	}
+
+	return true;
+}
+
+
+void pgConnPool::AddIdle(const wxString &key, PGconn *conn)
+{
+	wxMutexLocker locker(lock);
+
+	resetting--;
+
+	// The server or the database may have been closed meanwhile
+	pgConnPoolEntry *entry = NULL;
+	if (!cleared && closedServers.Index(ServerOf(key)) == wxNOT_FOUND)
+	{
+		entry = entries[key];
+		if (!entry)
+		{
+			entry = new pgConnPoolEntry();
+			entries[key] = entry;
+		}
+	}
+
+	if (!entry || (long)entry->idle.GetCount() >= maxSize)
+	{
+		PQfinish(conn);
+		return;
+	}
+
+	entry->idle.Add(conn);
+	entry->idleSince.Add(wxGetLocalTime());
+}
+
+
+bool pgConnPool::HasRoom(const wxString &key)
+{
+	wxMutexLocker locker(lock);
+
+	if (cleared || closedServers.Index(ServerOf(key)) != wxNOT_FOUND)
+		return false;
+
+	ReadSettings();
+
+	if (IdleCount() >= POOL_MAX_TOTAL)
+		return false;
+
+	pgConnPoolHash::iterator it = entries.find(key);
+	if (it == entries.end())
+		return maxSize > 0;
+
+	return (long)it->second->idle.GetCount() < maxSize;
+}
+
+
+bool pgConnPool::GetInfo(const wxString &key, pgConnInfo &info)
+{
+	wxMutexLocker locker(lock);
+
+	pgConnPoolHash::iterator it = entries.find(key);
+	if (it == entries.end() || !it->second->hasInfo)
+		return false;
+
+	info = it->second->info;
+	return true;
+}
+
+
+void pgConnPool::SetInfo(const wxString &key, const pgConnInfo &info)
+{
+	wxMutexLocker locker(lock);
+
+	if (cleared)
+		return;
+
+	pgConnPoolEntry *entry = entries[key];
+	if (!entry)
+	{
+		entry = new pgConnPoolEntry();
+		entries[key] = entry;
+	}
+
+	entry->info = info;
+	entry->hasInfo = true;
+}
+
+
+// Closes the idle connections with keys starting with prefix, and forgets
+// their information.
+void pgConnPool::CloseMatching(const wxString &prefix)
+{
+	// The one being reset, if any, is closed when the reset is over
+	if (resetter)
+		resetter->Discard(prefix);
+
+	pgConnPoolHash::iterator it = entries.begin();
+	while (it != entries.end())
+	{
+		pgConnPoolHash::iterator cur = it++;
+		if (!cur->first.StartsWith(prefix))
+			continue;
+
+		pgConnPoolEntry *entry = cur->second;
+		size_t i;
+		for (i = 0; i < entry->idle.GetCount(); i++)
+			PQfinish((PGconn *)entry->idle.Item(i));
+
+		delete entry;
+		entries.erase(cur);
+	}
+}
+
+
+void pgConnPool::CloseServer(const wxString &server)
+{
+	wxMutexLocker locker(lock);
+
+	if (closedServers.Index(server) == wxNOT_FOUND)
+		closedServers.Add(server);
+
+	// The server may have been upgraded by the time it is connected to
+	// again, so the information goes too.
+	CloseMatching(server + wxT("\n"));
+
+	wxLogInfo(wxT("Closed the pooled connections to %s"), server.c_str());
+}
+
+
+void pgConnPool::CloseDatabase(const wxString &server, const wxString &database)
+{
+	wxMutexLocker locker(lock);
+
+	CloseMatching(server + wxT("\n") + database + wxT("\n"));
+}
+
+
+void pgConnPool::OpenServer(const wxString &server)
+{
+	wxMutexLocker locker(lock);
+
+	int index = closedServers.Index(server);
+	if (index != wxNOT_FOUND)
+		closedServers.RemoveAt(index);
+}
+
+
+void pgConnPool::Clear()
+{
+	// The resetter must not wait for the lock while it is stopped
+	{
+		wxMutexLocker locker(lock);
+		cleared = true;
+	}
+	if (resetter)
+	{
+		resetter->Stop();
+		delete resetter;
+		resetter = NULL;
+	}
+
+	wxMutexLocker locker(lock);
+
+	if (timer)
+	{
+		timer->Stop();
+		delete timer;
+		timer = NULL;
+	}
+
+	pgConnPoolHash::iterator it;
+	for (it = entries.begin(); it != entries.end(); ++it)
+	{
+		pgConnPoolEntry *entry = it->second;
+		size_t i;
+		for (i = 0; i < entry->idle.GetCount(); i++)
+			PQfinish((PGconn *)entry->idle.Item(i));
+
+		delete entry;
+	}
+	entries.clear();
+}
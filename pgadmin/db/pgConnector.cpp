@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnector.cpp - Opens connections in background threads
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// App headers
+#include "db/pgConn.h"
+#include "db/pgConnector.h"
+#include "utils/sysLogger.h"
+
+const wxEventType PGConnectEvent = wxNewEventType();
+
+
+// Takes the requests of a pgConnector until there are none left
+class pgConnectThread : public wxThread
+{
+public:
+	pgConnectThread(pgConnector *_connector)
+		: wxThread(wxTHREAD_JOINABLE), connector(_connector) {}
+
+private:
+	virtual void *Entry();
+
+	pgConnector *connector;
+};
+
+
+void *pgConnectThread::Entry()
+{
+	pgConnectRequest *request;
+
+	while ((request = connector->Next()) != NULL)
+	{
+		// pgConn gives up the attempt when the thread is deleted
+		request->conn = request->Open();
+
+		if (TestDestroy())
+		{
+			delete request;
+			break;
+		}
+		connector->Done(request);
+	}
+
+	return NULL;
+}
+
+
+pgConnectRequest::~pgConnectRequest()
+{
+	if (conn)
+		delete conn;
+}
+
+
+pgConnector::pgConnector(wxEvtHandler *_handler, int _maxThreads)
+	: handler(_handler), maxThreads(_maxThreads), running(0), stopped(false)
+{
+	if (maxThreads < 1)
+		maxThreads = 1;
+}
+
+
+pgConnector::~pgConnector()
+{
+	Stop();
+}
+
+
+void pgConnector::Add(pgConnectRequest *request)
+{
+	wxMutexLocker lock(queueLock);
+
+	if (stopped)
+	{
+		delete request;
+		return;
+	}
+
+	queue.Add(request);
+
+	if (running < maxThreads)
+	{
+		pgConnectThread *thread = new pgConnectThread(this);
+		if (thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR)
+		{
+			wxLogError(_("Failed to start a connection thread."));
+			delete thread;
+			return;
+		}
+		threads.Add(thread);
+		running++;
+	}
+}
+
+
+pgConnectRequest *pgConnector::Next()
+{
+	wxMutexLocker lock(queueLock);
+
+	if (stopped || queue.IsEmpty())
+	{
+		running--;
+		return NULL;
+	}
+
+	pgConnectRequest *request = queue.Item(0);
+	queue.RemoveAt(0);
+	return request;
+}
+
+
+void pgConnector::Done(pgConnectRequest *request)
+{
+	wxMutexLocker lock(queueLock);
+
+	if (stopped)
+	{
+		delete request;
+		return;
+	}
+
+	wxCommandEvent ev(PGConnectEvent, wxID_ANY);
+	ev.SetClientData(request);
+	handler->AddPendingEvent(ev);
+}
+
+
+void pgConnector::Stop()
+{
+	{
+		wxMutexLocker lock(queueLock);
+
+		stopped = true;
+
+		size_t i;
+		for (i = 0; i < queue.GetCount(); i++)
+			delete queue.Item(i);
+		queue.Clear();
+	}
+
+	// Not under the lock: the threads need it to finish
+	size_t i;
+	for (i = 0; i < threads.GetCount(); i++)
+	{
+		threads.Item(i)->Delete();
+		delete threads.Item(i);
+	}
+	threads.Clear();
+}
@@ -17,6 +17,12 @@
 // PostgreSQL headers
 #include <libpq-fe.h>
 
+#ifndef __WXMSW__
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 // App headers
 #include "db/pgSet.h"
 #include "db/pgConn.h"
@@ -27,6 +33,14 @@
 
 const wxEventType PGQueryResultEvent = wxNewEventType();
 
+// Chunks of a streamed result which may wait to be picked up by the GUI
+// before the thread stops reading from the server
+#define STREAM_MAX_PENDING 4
+
+// Chunks of a streamed result kept in memory once picked up. The grid
+// reads the others back from a temporary file when they are scrolled to.
+#define STREAM_MAX_RESIDENT 8
+
 // default notice processor for the pgQueryThread
 // we do assume that the argument passed will be always the
 // object of pgQueryThread
@@ -42,13 +56,34 @@ void pgNoticeProcessor(void *_arg, const char *_message)
 }
 
 
+// The pipe used to interrupt WaitForServer
+static void CreateWakeUpPipe(int fds[2])
+{
+	fds[0] = fds[1] = -1;
+
+#ifndef __WXMSW__
+	if (pipe(fds) != 0)
+	{
+		fds[0] = fds[1] = -1;
+		return;
+	}
+
+	fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+	fcntl(fds[1], F_SETFL, fcntl(fds[1], F_GETFL) | O_NONBLOCK);
+#endif
+}
+
+
 // support for multiple queries support
 pgQueryThread::pgQueryThread(pgConn *_conn, wxEvtHandler *_caller,
                              PQnoticeProcessor _processor, void *_noticeHandler) :
 	wxThread(wxTHREAD_JOINABLE), m_currIndex(-1), m_conn(_conn),
 	m_cancelled(false), m_multiQueries(true), m_useCallable(false),
+	m_queueCond(m_queueLock),
 	m_caller(_caller), m_processor(pgNoticeProcessor), m_noticeHandler(NULL),
-	m_eventOnCancellation(true)
+	m_eventOnCancellation(true), m_streamChunkRows(0), m_streamMaxRows(0),
+	m_streamRows(0), m_streamChunk(NULL), m_streamChunkFill(0),
+	m_streamStopped(false), m_streamTruncated(false), m_streamCond(m_streamLock)
 {
 	// check if we can really use the enterprisedb callable statement and
 	// required
@@ -79,6 +114,8 @@ pgQueryThread::pgQueryThread(pgConn *_conn, wxEvtHandler *_caller,
 		PQsetnonblocking(m_conn->conn, 1);
 	}
 
+	CreateWakeUpPipe(m_wakeupPipe);
+
 	if (_processor != NULL)
 	{
 		m_processor = _processor;
@@ -97,13 +134,18 @@ pgQueryThread::pgQueryThread(pgConn *_conn, const wxString &_qry,
                              int _resultToRetrieve, wxWindow *_caller, long _eventId, void *_data)
 	: wxThread(wxTHREAD_JOINABLE), m_currIndex(-1), m_conn(_conn),
 	  m_cancelled(false), m_multiQueries(false), m_useCallable(false),
+	  m_queueCond(m_queueLock),
 	  m_caller(NULL), m_processor(pgNoticeProcessor), m_noticeHandler(NULL),
-	  m_eventOnCancellation(true)
+	  m_eventOnCancellation(true), m_streamChunkRows(0), m_streamMaxRows(0),
+	  m_streamRows(0), m_streamChunk(NULL), m_streamChunkFill(0),
+	  m_streamStopped(false), m_streamTruncated(false), m_streamCond(m_streamLock)
 {
 	if (m_conn && m_conn->conn)
 	{
 		PQsetnonblocking(m_conn->conn, 1);
 	}
+
+	CreateWakeUpPipe(m_wakeupPipe);
 	m_queries.Add(
 	    new pgBatchQuery(_qry, (pgParamsArray *)NULL, _eventId, _data, false,
 	                     _resultToRetrieve));
@@ -117,6 +159,98 @@ pgQueryThread::pgQueryThread(pgConn *_conn, const wxString &_qry,
 	}
 }
 
+void pgQueryThread::CancelExecution()
+{
+	m_cancelled = true;
+	WakeUp();
+}
+
+
+void pgQueryThread::StopStreaming()
+{
+	m_streamStopped = true;
+	WakeUp();
+}
+
+
+// Interrupt the wait for the server, or for the next query
+void pgQueryThread::WakeUp()
+{
+#ifndef __WXMSW__
+	if (m_wakeupPipe[1] >= 0)
+	{
+		char c = 0;
+		if (write(m_wakeupPipe[1], &c, 1) < 0)
+		{
+			// The pipe is full: the thread has been woken up already
+		}
+	}
+#endif
+
+	{
+		wxMutexLocker lock(m_queueLock);
+		m_queueCond.Signal();
+	}
+
+	// A streamed transfer may be waiting for its chunks to be picked up
+	wxMutexLocker lock(m_streamLock);
+	m_streamCond.Signal();
+}
+
+
+// Wait until the server sends something (or can take more of the query
+// when it could not be sent at once), or until WakeUp is called
+void pgQueryThread::WaitForServer()
+{
+	int sock = PQsocket(m_conn->conn);
+
+	if (sock < 0)
+		return;
+
+	bool writing = (PQflush(m_conn->conn) == 1);
+
+#ifdef __WXMSW__
+	fd_set readFds, writeFds;
+	struct timeval tv;
+
+	FD_ZERO(&readFds);
+	FD_ZERO(&writeFds);
+	FD_SET((SOCKET) sock, &readFds);
+	if (writing)
+		FD_SET((SOCKET) sock, &writeFds);
+
+	// Nothing interrupts select() here: come back regularly to check
+	// whether the execution has been cancelled
+	tv.tv_sec = 0;
+	tv.tv_usec = 100000;
+	select(sock + 1, &readFds, &writeFds, NULL, &tv);
+#else
+	struct pollfd fds[2];
+	int nfds = 1;
+
+	fds[0].fd = sock;
+	fds[0].events = POLLIN | (writing ? POLLOUT : 0);
+	fds[0].revents = 0;
+
+	if (m_wakeupPipe[0] >= 0)
+	{
+		fds[1].fd = m_wakeupPipe[0];
+		fds[1].events = POLLIN;
+		fds[1].revents = 0;
+		nfds = 2;
+	}
+
+	if (poll(fds, nfds, nfds == 2 ? -1 : 100) > 0 && nfds == 2
+	        && (fds[1].revents & POLLIN))
+	{
+		char buf[16];
+		while (read(m_wakeupPipe[0], buf, sizeof(buf)) > 0)
+			;
+	}
+#endif
+}
+
+
 void pgQueryThread::SetEventOnCancellation(bool eventOnCancelled)
 {
 	m_eventOnCancellation = eventOnCancelled;
@@ -125,19 +259,172 @@ void pgQueryThread::SetEventOnCancellation(bool eventOnCancelled)
 void pgQueryThread::AddQuery(const wxString &_qry, pgParamsArray *_params,
                              long _eventId, void *_data, bool _useCallable, int _resultToRetrieve)
 {
+	wxMutexLocker lock(m_queueLock);
+
 	m_queries.Add(
 	    new pgBatchQuery(_qry, _params, _eventId, _data,
 	                     // use callable statement only if supported
 	                     m_useCallable && _useCallable, _resultToRetrieve));
 
 	wxLogInfo(wxT("queueing (%ld): %s"), GetId(), _qry.c_str());
+
+	m_queueCond.Signal();
 }
 
 
 pgQueryThread::~pgQueryThread()
 {
 	m_conn->RegisterNoticeProcessor(0, 0);
+	ResetStream();
 	WX_CLEAR_ARRAY(m_queries);
+
+#ifndef __WXMSW__
+	if (m_wakeupPipe[0] >= 0)
+		close(m_wakeupPipe[0]);
+	if (m_wakeupPipe[1] >= 0)
+		close(m_wakeupPipe[1]);
+#endif
+}
+
+
+void pgQueryThread::SetStreaming(long chunkRows, long maxRows)
+{
+#ifdef HAVE_SINGLE_ROW_MODE
+	// Streaming is only supported for a single query, and not for the
+	// EnterpriseDB callable statements
+	if (!m_multiQueries)
+	{
+		m_streamChunkRows = chunkRows;
+		m_streamMaxRows = maxRows;
+	}
+#endif
+}
+
+
+void pgQueryThread::ResetStream()
+{
+	wxMutexLocker lock(m_streamLock);
+
+	for (size_t i = 0 ; i < m_streamPending.GetCount() ; i++)
+		PQclear(m_streamPending[i]);
+	m_streamPending.Clear();
+
+	if (m_streamChunk)
+		PQclear(m_streamChunk);
+	m_streamChunk = NULL;
+	m_streamChunkFill = 0;
+	m_streamRows = 0;
+	m_streamStopped = false;
+	m_streamTruncated = false;
+}
+
+
+// Copy a single row result into the chunk being filled, and hand the chunk
+// over once it is full. Takes ownership of the row.
+void pgQueryThread::StreamRow(PGresult *row)
+{
+	int col, nCols = PQnfields(row);
+
+	if (!m_streamChunk)
+	{
+		PGresAttDesc *attrs = new PGresAttDesc[nCols + 1];
+
+		for (col = 0 ; col < nCols ; col++)
+		{
+			attrs[col].name = PQfname(row, col);
+			attrs[col].tableid = PQftable(row, col);
+			attrs[col].columnid = PQftablecol(row, col);
+			attrs[col].format = PQfformat(row, col);
+			attrs[col].typid = PQftype(row, col);
+			attrs[col].typlen = PQfsize(row, col);
+			attrs[col].atttypmod = PQfmod(row, col);
+		}
+
+		m_streamChunk = PQmakeEmptyPGresult(m_conn->conn, PGRES_TUPLES_OK);
+		PQsetResultAttrs(m_streamChunk, nCols, attrs);
+		m_streamChunkFill = 0;
+
+		delete[] attrs;
+	}
+
+	for (col = 0 ; col < nCols ; col++)
+	{
+		if (PQgetisnull(row, 0, col))
+			PQsetvalue(m_streamChunk, m_streamChunkFill, col, NULL, -1);
+		else
+			PQsetvalue(m_streamChunk, m_streamChunkFill, col,
+			           PQgetvalue(row, 0, col), PQgetlength(row, 0, col));
+	}
+	PQclear(row);
+
+	m_streamChunkFill++;
+	m_streamRows++;
+
+	if (m_streamChunkFill >= m_streamChunkRows)
+		FlushStreamChunk();
+
+	if (m_streamMaxRows > 0 && m_streamRows >= m_streamMaxRows)
+	{
+		m_streamTruncated = true;
+		m_streamStopped = true;
+	}
+}
+
+
+// Hand the current chunk over to FetchStreamedRows. Unless told otherwise,
+// wait while too many chunks are pending, so that a slow reader keeps the
+// memory used by the transfer bounded.
+void pgQueryThread::FlushStreamChunk(bool wait)
+{
+	if (!m_streamChunk)
+		return;
+
+	wxMutexLocker lock(m_streamLock);
+
+	// Signalled by FetchStreamedRows, and by WakeUp when the transfer is
+	// cancelled or stopped
+	while (wait && !m_cancelled && !m_streamStopped &&
+	        m_streamPending.GetCount() >= STREAM_MAX_PENDING)
+		m_streamCond.Wait();
+
+	m_streamPending.Add(m_streamChunk);
+	m_streamChunk = NULL;
+	m_streamChunkFill = 0;
+}
+
+
+long pgQueryThread::FetchStreamedRows()
+{
+	pgResultArray chunks;
+
+	{
+		wxMutexLocker lock(m_streamLock);
+		chunks = m_streamPending;
+		m_streamPending.Clear();
+		m_streamCond.Signal();
+	}
+
+	if (m_currIndex < 0)
+	{
+		for (size_t i = 0 ; i < chunks.GetCount() ; i++)
+			PQclear(chunks[i]);
+		return 0;
+	}
+
+	pgSet *&dataSet = m_queries[m_currIndex]->m_resultSet;
+
+	for (size_t i = 0 ; i < chunks.GetCount() ; i++)
+	{
+		if (!dataSet)
+		{
+			dataSet = new pgSet(chunks[i], m_conn, *(m_conn->conv), m_conn->needColQuoting);
+			dataSet->SetChunkLimit(STREAM_MAX_RESIDENT);
+		}
+		else
+			dataSet->AppendResult(chunks[i]);
+	}
+
+	return dataSet ? dataSet->NumRows() : 0;
 }
 
 
@@ -196,6 +483,8 @@ int pgQueryThread::Execute()
 
 	wxCharBuffer queryBuf = query.mb_str(conv);
 
+	ResetStream();
+
 	if (PQstatus(m_conn->conn) != CONNECTION_OK)
 	{
 		rc = pgQueryResultEvent::PGQ_CONN_LOST;
@@ -340,6 +629,14 @@ continue_without_error:
 	PGresult *lastResult = 0;
 	bool connExecutionCancelled = false;
 
+	// In streaming mode, the rows are fetched one by one from libpq and
+	// collected into chunks, instead of waiting for the complete result
+	bool streaming = false;
+#ifdef HAVE_SINGLE_ROW_MODE
+	if (m_streamChunkRows > 0 && !useCallable)
+		streaming = (PQsetSingleRowMode(m_conn->conn) == 1);
+#endif
+
 	while (true)
 	{
 		// This is a 'joinable' thread, it is not advisable to call 'delete'
@@ -374,6 +671,14 @@ continue_without_error:
 			}
 		}
 
+		// The user (or the row limit) stopped a streamed transfer: ask the
+		// server to stop sending rows, and keep what we have got so far
+		if (m_streamStopped && !connExecutionCancelled)
+		{
+			m_conn->CancelExecution();
+			connExecutionCancelled = true;
+		}
+
 		if ((rc = PQconsumeInput(m_conn->conn)) != 1)
 		{
 			if (m_cancelled)
@@ -416,8 +721,7 @@ continue_without_error:
 
 		if (PQisBusy(m_conn->conn))
 		{
-			Yield();
-			this->Sleep(10);
+			WaitForServer();
 
 			continue;
 		}
@@ -430,6 +734,28 @@ continue_without_error:
 		if (!res)
 			break;
 
+		if (streaming)
+		{
+#ifdef HAVE_SINGLE_ROW_MODE
+			if (PQresultStatus(res) == PGRES_SINGLE_TUPLE)
+			{
+				if (m_streamStopped)
+					PQclear(res);
+				else
+					StreamRow(res);
+
+				continue;
+			}
+#endif
+			// Once stopped, the statement ends with a "canceling statement"
+			// error, which is of no interest to the user
+			if (m_streamStopped)
+			{
+				PQclear(res);
+				continue;
+			}
+		}
+
 		if((PQresultStatus(res) == PGRES_NONFATAL_ERROR) ||
 		        (PQresultStatus(res) == PGRES_FATAL_ERROR) ||
 		        (PQresultStatus(res) == PGRES_BAD_RESPONSE))
@@ -473,10 +799,7 @@ continue_without_error:
 				res = NULL;
 
 				if (PQisBusy(m_conn->conn))
-				{
-					Yield();
-					this->Sleep(10);
-				}
+					WaitForServer();
 			}
 			while (true);
 
@@ -503,7 +826,6 @@ continue_without_error:
 			int copyRc;
 			char *buf;
 			int copyRows = 0;
-			int lastCopyRc = 0;
 
 			rc = PGRES_COPY_OUT;
 
@@ -540,13 +862,10 @@ continue_without_error:
 				if (copyRc > 0)
 					copyRows++;
 
-				if (lastCopyRc == 0 && copyRc == 0)
-				{
-					Yield();
-					this->Sleep(10);
-				}
 				if (copyRc == 0)
 				{
+					WaitForServer();
+
 					if (!PQconsumeInput(m_conn->conn))
 					{
 						// It might be the case - it is a result of the
@@ -581,7 +900,6 @@ continue_without_error:
 						return(RaiseEvent(rc));
 					}
 				}
-				lastCopyRc = copyRc;
 			}
 
 			res = PQgetResult(m_conn->conn);
@@ -634,6 +952,33 @@ out_of_consume_input_loop:
 		return rc;
 	}
 
+	if (streaming && m_streamRows > 0 &&
+	        (m_streamStopped || PQresultStatus(result ? result : lastResult) == PGRES_TUPLES_OK))
+	{
+		// The rows have been handed over in chunks already, the final
+		// (empty) result only marks the end of the data.
+		if (result)
+			PQclear(result);
+		if (lastResult && lastResult != result)
+			PQclear(lastResult);
+
+		FlushStreamChunk(false);
+
+		if (m_streamTruncated)
+			AppendMessage(wxString::Format(_("Data transfer stopped after the limit of %ld rows.\n"), m_streamRows));
+		else if (m_streamStopped)
+			AppendMessage(wxString::Format(_("Data transfer stopped after %ld rows.\n"), m_streamRows));
+		else
+			AppendMessage(wxString::Format(wxPLURAL("query result with %ld row will be returned.\n", "query result with %ld rows will be returned.\n",
+			                                        m_streamRows), m_streamRows));
+		AppendMessage(wxT("\n"));
+
+		rc = PGRES_TUPLES_OK;
+		insertedOid = 0;
+
+		return(RaiseEvent(1));
+	}
+
 	if (!result)
 		result = lastResult;
 
@@ -730,7 +1075,10 @@ void *pgQueryThread::Entry()
 		if (!m_multiQueries || m_cancelled)
 			break;
 
-		wxThread::Sleep(10);
+		// Wait for the next query
+		wxMutexLocker lock(m_queueLock);
+		while (!m_cancelled && m_currIndex >= ((int)m_queries.GetCount()) - 1)
+			m_queueCond.Wait();
 	}
 	while (true);
 
@@ -13,6 +13,8 @@
 
 // wxWindows headers
 #include <wx/wx.h>
+#include <wx/file.h>
+#include <wx/filename.h>
 
 // PostgreSQL headers
 #include <libpq-fe.h>
@@ -23,6 +25,39 @@
 #include "utils/sysLogger.h"
 #include "utils/pgDefs.h"
 
+
+// The appended results of a set with a chunk limit which don't fit in
+// memory, in a temporary file
+class pgSetSpill
+{
+public:
+	pgSetSpill(size_t max) : maxResident(max), failed(false) {}
+	~pgSetSpill()
+	{
+		if (file.IsOpened())
+			file.Close();
+		if (!path.IsEmpty())
+			wxRemoveFile(path);
+	}
+
+	size_t maxResident;
+
+	// Numbers of the chunks in memory, least recently read first
+	wxArrayLong resident;
+
+	// Where each chunk was written (-1: not yet), its size and its number
+	// of rows. A wxFileOffset may not fit in a long.
+	wxArrayDouble offsets;
+	wxArrayLong lengths, rows;
+
+	wxFile file;
+	wxString path;
+
+	// The file could not be created, so all chunks stay in memory
+	bool failed;
+};
+
+
 pgSet::pgSet()
 	: conv(wxConvLibc)
 {
@@ -31,6 +66,11 @@ pgSet::pgSet()
 	nCols = 0;
 	nRows = 0;
 	pos = 0;
+	colCache = 0;
+	chunkRows = 0;
+	spill = 0;
+	colNumbers = 0;
+	rowMap = 0;
 }
 
 pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
@@ -40,6 +80,11 @@ pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 
 	conn = newConn;
 	res = newRes;
+	colCache = 0;
+	chunkRows = 0;
+	spill = 0;
+	colNumbers = 0;
+	rowMap = 0;
 
 	// Make sure we have tuples
 	if (PQresultStatus(res) != PGRES_TUPLES_OK)
@@ -64,9 +109,292 @@ pgSet::pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt)
 }
 
 
+pgSet::pgSet(const pgSet &source, const wxArrayLong &rows)
+	: conv(source.conv)
+{
+	needColQuoting = source.needColQuoting;
+
+	conn = source.conn;
+	res = source.res;
+	chunks = source.chunks;
+	chunkRows = source.chunkRows;
+	spill = 0;
+	wxASSERT(!source.spill);
+	colCache = 0;
+	colNumbers = 0;
+
+	nCols = source.nCols;
+	colTypes = source.colTypes;
+	colFullTypes = source.colFullTypes;
+	colClasses = source.colClasses;
+
+	// Row numbers of the results, not of source
+	rowMap = new wxArrayLong();
+	for (size_t i = 0 ; i < rows.GetCount() ; i++)
+	{
+		long row = rows.Item(i);
+		if (source.rowMap)
+			row = source.rowMap->Item(row);
+		rowMap->Add(row);
+	}
+
+	nRows = rowMap->GetCount();
+	MoveFirst();
+}
+
+
 pgSet::~pgSet()
 {
+	if (colNumbers)
+		delete colNumbers;
+	ClearColumnCache();
+
+	// The results belong to the set the rows are taken from
+	if (rowMap)
+	{
+		delete rowMap;
+		return;
+	}
+
+	for (size_t i = 0 ; i < chunks.GetCount() ; i++)
+		PQclear(chunks[i]);
 	PQclear(res);
+
+	if (spill)
+		delete spill;
+}
+
+
+void pgSet::AppendResult(PGresult *chunk)
+{
+	wxASSERT(PQnfields(chunk) == nCols);
+	wxASSERT(!rowMap);
+
+	if (chunks.IsEmpty())
+		chunkRows = nRows;
+	wxASSERT(chunkRows > 0 && nRows % chunkRows == 0);
+
+	chunks.Add(chunk);
+	nRows += PQntuples(chunk);
+
+	if (spill)
+	{
+		spill->offsets.Add(-1);
+		spill->lengths.Add(0);
+		spill->rows.Add(PQntuples(chunk));
+		spill->resident.Add(chunks.GetCount() - 1);
+		EvictChunks();
+	}
+
+	if (colCache)
+	{
+		for (int col = 0 ; col < nCols ; col++)
+		{
+			if (colCache[col])
+				colCache[col]->Append(chunk, col, conv);
+		}
+	}
+
+	if (!pos)
+		MoveFirst();
+}
+
+
+void pgSet::SetChunkLimit(size_t maxChunks)
+{
+	wxASSERT(!rowMap && chunks.IsEmpty());
+
+	if (spill)
+		delete spill;
+	spill = 0;
+
+	if (!maxChunks)
+		return;
+
+	// The chunk just read back must stay while the previous one is used
+	spill = new pgSetSpill(maxChunks < 2 ? 2 : maxChunks);
+	ClearColumnCache();
+}
+
+
+PGresult *pgSet::ResidentChunk(long idx) const
+{
+	int i = spill->resident.Index(idx);
+	if (i != wxNOT_FOUND)
+	{
+		if ((size_t)i + 1 < spill->resident.GetCount())
+		{
+			spill->resident.RemoveAt(i);
+			spill->resident.Add(idx);
+		}
+		return chunks[idx];
+	}
+
+	chunks[idx] = ReadChunk(idx);
+	spill->resident.Add(idx);
+	EvictChunks();
+
+	return chunks[idx];
+}
+
+
+void pgSet::EvictChunks() const
+{
+	while (spill->resident.GetCount() > spill->maxResident)
+	{
+		long idx = spill->resident.Item(0);
+
+		// Chunks are not changed once appended, so they are written once
+		if (spill->offsets.Item(idx) < 0 && !WriteChunk(idx))
+			return;
+
+		PQclear(chunks[idx]);
+		chunks[idx] = NULL;
+		spill->resident.RemoveAt(0);
+	}
+}
+
+
+bool pgSet::WriteChunk(long idx) const
+{
+	if (spill->failed)
+		return false;
+
+	if (!spill->file.IsOpened())
+	{
+		spill->path = wxFileName::CreateTempFileName(wxT("pgadmin"));
+		if (spill->path.IsEmpty() || !spill->file.Open(spill->path, wxFile::read_write))
+		{
+			wxLogError(_("Could not create a temporary file for the query results; all rows are kept in memory."));
+			spill->failed = true;
+			return false;
+		}
+	}
+
+	PGresult *chunk = chunks[idx];
+	wxMemoryBuffer buf;
+	int row, col, rows = PQntuples(chunk);
+
+	// Each value as its length, -1 for NULL, followed by its bytes
+	for (row = 0 ; row < rows ; row++)
+	{
+		for (col = 0 ; col < nCols ; col++)
+		{
+			wxInt32 len = -1;
+			if (!PQgetisnull(chunk, row, col))
+				len = PQgetlength(chunk, row, col);
+
+			buf.AppendData(&len, sizeof(len));
+			if (len > 0)
+				buf.AppendData(PQgetvalue(chunk, row, col), len);
+		}
+	}
+
+	wxFileOffset offset = spill->file.SeekEnd();
+	if (offset == wxInvalidOffset || spill->file.Write(buf.GetData(), buf.GetDataLen()) != buf.GetDataLen())
+	{
+		wxLogError(_("Could not write query results to the temporary file %s."), spill->path.c_str());
+		return false;
+	}
+
+	spill->offsets[idx] = (double)offset;
+	spill->lengths[idx] = buf.GetDataLen();
+
+	return true;
+}
+
+
+PGresult *pgSet::ReadChunk(long idx) const
+{
+	PGresult *chunk = PQcopyResult(res, PG_COPYRES_ATTRS);
+	int row, col, rows = spill->rows.Item(idx);
+	size_t len = spill->lengths.Item(idx);
+
+	wxMemoryBuffer buf(len);
+	bool ok = spill->file.Seek((wxFileOffset)spill->offsets.Item(idx)) != wxInvalidOffset &&
+	          spill->file.Read(buf.GetWriteBuf(len), len) == (ssize_t)len;
+	buf.UngetWriteBuf(ok ? len : 0);
+
+	if (!ok)
+		wxLogError(_("Could not read query results from the temporary file %s."), spill->path.c_str());
+
+	const char *data = (const char *)buf.GetData();
+	const char *end = data + buf.GetDataLen();
+
+	for (row = 0 ; row < rows ; row++)
+	{
+		for (col = 0 ; col < nCols ; col++)
+		{
+			wxInt32 vlen = -1;
+
+			// Rows which could not be read are shown as empty values
+			if (data + sizeof(vlen) > end)
+			{
+				PQsetvalue(chunk, row, col, (char *)"", 0);
+				continue;
+			}
+
+			memcpy(&vlen, data, sizeof(vlen));
+			data += sizeof(vlen);
+
+			if (vlen < 0)
+				PQsetvalue(chunk, row, col, NULL, -1);
+			else
+			{
+				PQsetvalue(chunk, row, col, (char *)data, vlen);
+				data += vlen;
+			}
+		}
+	}
+
+	return chunk;
+}
+
+
+void pgSet::EnableColumnCache(bool enable)
+{
+	if (!enable)
+	{
+		ClearColumnCache();
+		return;
+	}
+
+	// The cache is indexed by the row numbers of the results
+	if (colCache || !nCols || rowMap || spill)
+		return;
+
+	// Columns are decoded lazily, the first time one of their values is read
+	colCache = new pgSetColumnCache*[nCols];
+	memset(colCache, 0, nCols * sizeof(pgSetColumnCache *));
+}
+
+
+void pgSet::ClearColumnCache()
+{
+	if (!colCache)
+		return;
+
+	for (int col = 0 ; col < nCols ; col++)
+	{
+		if (colCache[col])
+			delete colCache[col];
+	}
+	delete[] colCache;
+	colCache = 0;
+}
+
+
+const pgSetColumnCache *pgSet::GetColumnCache(const int col) const
+{
+	if (!colCache[col])
+	{
+		colCache[col] = new pgSetColumnCache();
+		colCache[col]->Append(res, col, conv);
+		for (size_t i = 0 ; i < chunks.GetCount() ; i++)
+			colCache[col]->Append(chunks[i], col, conv);
+	}
+
+	return colCache[col];
 }
 
 
@@ -194,18 +522,55 @@ wxString pgSet::ColName(const int col) const
 }
 
 
-int pgSet::ColNumber(const wxString &colname) const
+// Resolve a column name the way PQfnumber() does, but through a hash of the
+// column names built once per result, rather than converting the name and
+// scanning all the columns on every call.
+int pgSet::FindColumn(const wxString &colname) const
 {
-	int col;
+	if (!colNumbers)
+	{
+		colNumbers = new pgColNumberHash();
+		for (int col = 0 ; col < nCols ; col++)
+		{
+			wxString name = ColName(col);
+
+			// PQfnumber() returns the first match
+			if (colNumbers->find(name) == colNumbers->end())
+				(*colNumbers)[name] = col;
+		}
+	}
+
+	pgColNumberHash::const_iterator it;
 
 	if (needColQuoting)
+		it = colNumbers->find(colname);
+	else if (colname.Find(wxT('"')) != wxNOT_FOUND)
 	{
-		wxString quotedColName = colname;
-		quotedColName.Replace(wxT("\""), wxT("\"\""));
-		col = PQfnumber(res, (wxT("\"") + quotedColName + wxT("\"")).mb_str(conv));
+		// Leave the handling of quoted identifiers to libpq
+		return PQfnumber(res, colname.mb_str(conv));
 	}
 	else
-		col = PQfnumber(res, colname.mb_str(conv));
+	{
+		// Unquoted names are downcased (ASCII only) by PQfnumber()
+		wxString folded = colname;
+		for (size_t i = 0 ; i < folded.Length() ; i++)
+		{
+			wxChar c = folded[i];
+			if (c >= wxT('A') && c <= wxT('Z'))
+				folded[i] = (wxChar)(c + (wxT('a') - wxT('A')));
+		}
+		it = colNumbers->find(folded);
+	}
+
+	if (it == colNumbers->end())
+		return -1;
+	return it->second;
+}
+
+
+int pgSet::ColNumber(const wxString &colname) const
+{
+	int col = FindColumn(colname);
 
 	if (col < 0)
 	{
@@ -216,15 +581,7 @@ int pgSet::ColNumber(const wxString &colname) const
 
 bool pgSet::HasColumn(const wxString &colname) const
 {
-	if (needColQuoting)
-	{
-		wxString quotedColName = colname;
-		quotedColName.Replace(wxT("\""), wxT("\"\""));
-		return (PQfnumber(res, (wxT("\"") + quotedColName + wxT("\"")).mb_str(conv)) < 0 ? false : true);
-	}
-	else
-		return (PQfnumber(res, colname.mb_str(conv)) < 0 ? false : true);
-
+	return (FindColumn(colname) < 0 ? false : true);
 }
 
 
@@ -233,13 +590,15 @@ char *pgSet::GetCharPtr(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	return PQgetvalue(res, pos - 1, col);
+	long row = pos - 1;
+	PGresult *r = RowResult(row);
+	return PQgetvalue(r, row, col);
 }
 
 
 char *pgSet::GetCharPtr(const wxString &col) const
 {
-	return PQgetvalue(res, pos - 1, ColNumber(col));
+	return GetCharPtr(ColNumber(col));
 }
 
 
@@ -247,6 +606,9 @@ wxString pgSet::GetVal(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
+	if (colCache && col >= 0 && pos > 0 && pos <= nRows)
+		return GetColumnCache(col)->GetVal(pos - 1);
+
 	return wxString(GetCharPtr(col), conv);
 }
 
@@ -261,7 +623,7 @@ long pgSet::GetLong(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	char *c = GetCharPtr(col);
 	if (c)
 		return atol(c);
 	else
@@ -271,7 +633,7 @@ long pgSet::GetLong(const int col) const
 
 long pgSet::GetLong(const wxString &col) const
 {
-	char *c = PQgetvalue(res, pos - 1, ColNumber(col));
+	char *c = GetCharPtr(ColNumber(col));
 	if (c)
 		return atol(c);
 	else
@@ -283,7 +645,7 @@ bool pgSet::GetBool(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	char *c = GetCharPtr(col);
 	if (c)
 	{
 		if (*c == 't' || *c == '1' || !strcmp(c, "on"))
@@ -355,7 +717,7 @@ wxULongLong pgSet::GetLongLong(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	char *c = GetCharPtr(col);
 	if (c)
 		return atolonglong(c);
 	else
@@ -372,7 +734,7 @@ OID pgSet::GetOid(const int col) const
 {
 	wxASSERT(col < nCols && col >= 0);
 
-	char *c = PQgetvalue(res, pos - 1, col);
+	char *c = GetCharPtr(col);
 	if (c)
 		return (OID)strtoul(c, 0, 10);
 	else
@@ -392,6 +754,71 @@ wxString pgSet::ExecuteScalar(const wxString &sql) const
 }
 
 
+//////////////////////////////////////////////////////////////////
+
+pgSetColumnCache::pgSetColumnCache()
+{
+	rows = 0;
+	maxRows = 0;
+	offsets = new size_t[1];
+	offsets[0] = 0;
+	nulls = 0;
+}
+
+
+pgSetColumnCache::~pgSetColumnCache()
+{
+	delete[] offsets;
+	if (nulls)
+		delete[] nulls;
+}
+
+
+void pgSetColumnCache::Append(PGresult *res, int col, wxMBConv &conv)
+{
+	long row, newRows = PQntuples(res);
+	size_t rawLen = 0;
+
+	if (rows + newRows > maxRows)
+	{
+		long newMax = maxRows * 2;
+		if (newMax < rows + newRows)
+			newMax = rows + newRows;
+
+		size_t *newOffsets = new size_t[newMax + 1];
+		memcpy(newOffsets, offsets, (rows + 1) * sizeof(size_t));
+		delete[] offsets;
+		offsets = newOffsets;
+
+		unsigned char *newNulls = new unsigned char[(newMax >> 3) + 1];
+		memset(newNulls, 0, (newMax >> 3) + 1);
+		if (nulls)
+		{
+			memcpy(newNulls, nulls, (maxRows >> 3) + 1);
+			delete[] nulls;
+		}
+		nulls = newNulls;
+
+		maxRows = newMax;
+	}
+
+	// The raw length is a good upper bound of the decoded length
+	for (row = 0 ; row < newRows ; row++)
+		rawLen += PQgetlength(res, row, col);
+	data.Alloc(data.Length() + rawLen);
+
+	for (row = 0 ; row < newRows ; row++, rows++)
+	{
+		if (PQgetisnull(res, row, col))
+			nulls[rows >> 3] |= (unsigned char)(1 << (rows & 7));
+		else
+			data += wxString(PQgetvalue(res, row, col), conv);
+
+		offsets[rows + 1] = data.Length();
+	}
+}
+
+
 //////////////////////////////////////////////////////////////////
 
 pgSetIterator::pgSetIterator(pgConn *conn, const wxString &qry)
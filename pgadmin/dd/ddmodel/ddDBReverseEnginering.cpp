@@ -14,8 +14,10 @@
 // wxWindows headers
 #include <wx/wx.h>
 #include <wx/regex.h>
+#include <wx/timer.h>
 
 // App headers
+#include "utils/sysLogger.h"
 #include "schema/pgSchema.h"
 #include "schema/pgDatatype.h"
 #include "dd/ddmodel/ddDBReverseEngineering.h"
@@ -222,671 +224,551 @@ OID ddImportDBUtils::getTableOID(pgConn *connection, wxString schemaName, wxStri
 // Don't support inherited tables right now, or tables where a column is part of more than one Unique Key.
 ddStubTable *ddImportDBUtils::getTable(pgConn *connection, wxString tableName, OID tableOid)
 {
-	wxString sql;
-	int currentcol;
+	oidsHashMap tableOids;
+	stubTablesHashMap tables;
+
+	tableOids[tableName] = tableOid;
+	getTables(connection, tableOids, tables);
+
+	stubTablesHashMap::iterator it = tables.find(tableName);
+	if (it == tables.end())
+		return NULL;
+	return it->second;
+}
+
+// Reads the columns, primary and unique keys of all the tables with one query each,
+// instead of several queries per table. Inherited tables are left out of the result.
+void ddImportDBUtils::getTables(pgConn *connection, oidsHashMap &tableOids, stubTablesHashMap &tables)
+{
+	wxString sql, oidList;
+	stubTablesHashMap byOid;
 	ddStubTable *table = NULL;
 	ddStubColumn *column = NULL;
 
+	oidsHashMap::iterator oidIt;
+	for (oidIt = tableOids.begin(); oidIt != tableOids.end(); ++oidIt)
+	{
+		if (!oidList.IsEmpty())
+			oidList += wxT(", ");
+		oidList += NumToStr(oidIt->second);
+		byOid[NumToStr(oidIt->second)] = new ddStubTable(oidIt->first, oidIt->second);
+	}
+
+	if (oidList.IsEmpty())
+		return;
 
 	// grab inherited tables  [if found don't allow table import because this feature isn't supported right now]
-	sql = wxT("SELECT inhparent::regclass AS inhrelname,\n")
-	      wxT("  (SELECT count(*) FROM pg_attribute WHERE attrelid=inhparent AND attnum>0) AS colscount\n")
+	sql = wxT("SELECT DISTINCT inhrelid\n")
 	      wxT("  FROM pg_inherits\n")
-	      wxT("  WHERE inhrelid =  ") + NumToStr(tableOid) + wxT("::oid\n")
-	      wxT("  ORDER BY inhseqno");
+	      wxT("  WHERE inhrelid IN (") + oidList + wxT(")");
 	pgSet *inhtables = connection->ExecuteSet(sql);
 
-	if(inhtables && inhtables->Eof())
+	stubTablesHashMap::iterator it;
+	if (!inhtables)
 	{
-		wxString systemRestriction;
-		systemRestriction = wxT("\n   AND att.attnum > 0");
-
-		sql =
-		    wxT("SELECT att.*, def.*, pg_catalog.pg_get_expr(def.adbin, def.adrelid) AS defval, CASE WHEN att.attndims > 0 THEN 1 ELSE 0 END AS isarray, format_type(ty.oid,NULL) AS typname, format_type(ty.oid,att.atttypmod) AS displaytypname, tn.nspname as typnspname, et.typname as elemtypname,\n")
-		    wxT("  ty.typstorage AS defaultstorage, cl.relname, na.nspname, att.attstattarget, description, cs.relname AS sername, ns.nspname AS serschema,\n")
-		    wxT("  (SELECT count(1) FROM pg_type t2 WHERE t2.typname=ty.typname) > 1 AS isdup, indkey");
-
-		if (connection->BackendMinimumVersion(9, 1))
-			sql += wxT(",\n  coll.collname, nspc.nspname as collnspname");
-		if (connection->BackendMinimumVersion(8, 5))
-			sql += wxT(",\n  attoptions");
-		if (connection->BackendMinimumVersion(7, 4))
-			sql +=
-			    wxT(",\n")
-			    wxT("  EXISTS(SELECT 1 FROM  pg_constraint WHERE conrelid=att.attrelid AND contype='f'")
-			    wxT(" AND att.attnum=ANY(conkey)) As isfk");
-		if (connection->BackendMinimumVersion(9, 1))
-		{
-			sql += wxT(",\n(SELECT array_agg(label) FROM pg_seclabels sl1 WHERE sl1.objoid=att.attrelid AND sl1.objsubid=att.attnum) AS labels");
-			sql += wxT(",\n(SELECT array_agg(provider) FROM pg_seclabels sl2 WHERE sl2.objoid=att.attrelid AND sl2.objsubid=att.attnum) AS providers");
-		}
-
-		sql += wxT("\n")
-		       wxT("  FROM pg_attribute att\n")
-		       wxT("  JOIN pg_type ty ON ty.oid=atttypid\n")
-		       wxT("  JOIN pg_namespace tn ON tn.oid=ty.typnamespace\n")
-		       wxT("  JOIN pg_class cl ON cl.oid=att.attrelid\n")
-		       wxT("  JOIN pg_namespace na ON na.oid=cl.relnamespace\n")
-		       wxT("  LEFT OUTER JOIN pg_type et ON et.oid=ty.typelem\n")
-		       wxT("  LEFT OUTER JOIN pg_attrdef def ON adrelid=att.attrelid AND adnum=att.attnum\n")
-		       wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=att.attrelid AND des.objsubid=att.attnum\n")
-		       wxT("  LEFT OUTER JOIN (pg_depend JOIN pg_class cs ON objid=cs.oid AND cs.relkind='S') ON refobjid=att.attrelid AND refobjsubid=att.attnum\n")
-		       wxT("  LEFT OUTER JOIN pg_namespace ns ON ns.oid=cs.relnamespace\n")
-		       wxT("  LEFT OUTER JOIN pg_index pi ON pi.indrelid=att.attrelid AND indisprimary\n");
-		if (connection->BackendMinimumVersion(9, 1))
-			sql += wxT("  LEFT OUTER JOIN pg_collation coll ON att.attcollation=coll.oid\n")
-			       wxT("  LEFT OUTER JOIN pg_namespace nspc ON coll.collnamespace=nspc.oid\n");
-		sql += wxT(" WHERE att.attrelid = ") + NumToStr(tableOid)
-		       + systemRestriction + wxT("\n")
-		       wxT("   AND att.attisdropped IS FALSE\n")
-		       wxT(" ORDER BY att.attnum");
-
-		table = new ddStubTable(tableName, tableOid);
-
-		pgSet *columns = connection->ExecuteSet(sql);
-		if (columns)
-		{
-			currentcol = 0;
-			while (!columns->Eof())
-			{
-				currentcol++;
-				column = new ddStubColumn(columns->GetVal(wxT("attname")), tableOid);
-				column->pgColNumber = columns->GetLong(wxT("attnum"));
-				wxString pkCols = columns->GetVal(wxT("indkey"));
-				bool isPK = false;
-				wxStringTokenizer indkey(pkCols);
-				while (indkey.HasMoreTokens())
-				{
-					wxString str = indkey.GetNextToken();
-					if (StrToLong(str) == column->pgColNumber)
-					{
-						isPK = true;
-						break;
-					}
-				}
-				column->isPrimaryKey = isPK;
-
-				long typmod = columns->GetLong(wxT("atttypmod"));
-				pgDatatype *dt = new pgDatatype(columns->GetVal(wxT("typnspname")), columns->GetVal(wxT("typname")),
-				                                columns->GetBool(wxT("isdup")),
-				                                columns->GetLong(wxT("attndims")), typmod);
-
-				column->typeColumn = dt;
-				column->isNotNull = columns->GetBool(wxT("attnotnull"));
-				wxString colName = column->columnName;
-				table->cols[colName] = column;
-				columns->MoveNext();
-			}
-
-			delete columns;
-		}
-		setUniqueConstraints(connection, table);
-		setPkName(connection, table);
-		if(inhtables)
-		{
-			delete inhtables;
-			inhtables = NULL;
-		}
-		return table;
+		for (it = byOid.begin(); it != byOid.end(); ++it)
+			delete it->second;
+		return;
 	}
 
-	return table;
-}
-
-//true on everything fine, false when some error is found
-bool ddImportDBUtils::setUniqueConstraints(pgConn *connection, ddStubTable *table)
-{
-	bool out = true;
-	//temporary fix, this should be adapted to pgadmin way of working
-	// check for extended ruleutils with pretty-print option
-	wxString prettyOption;
-	wxString exprname = connection->ExecuteScalar(wxT("SELECT proname FROM pg_proc WHERE proname='pg_get_viewdef' AND proargtypes[1]=16"));
-	if (!exprname.IsEmpty())
-		prettyOption = wxT(", true");
-
-	wxString query;
-
-	wxString proname, projoin;
-	if (connection->BackendMinimumVersion(7, 4))
+	while (!inhtables->Eof())
 	{
-		proname = wxT("indnatts, ");
-		if (connection->BackendMinimumVersion(7, 5))
+		it = byOid.find(inhtables->GetVal(wxT("inhrelid")));
+		if (it != byOid.end())
 		{
-			proname += wxT("cls.reltablespace AS spcoid, spcname, ");
-			projoin = wxT("  LEFT OUTER JOIN pg_tablespace ta on ta.oid=cls.reltablespace\n");
+			delete it->second;
+			byOid.erase(it);
 		}
+		inhtables->MoveNext();
 	}
-	else
-	{
-		proname = wxT("proname, pn.nspname as pronspname, proargtypes, ");
-		projoin =   wxT("  LEFT OUTER JOIN pg_proc pr ON pr.oid=indproc\n")
-		            wxT("  LEFT OUTER JOIN pg_namespace pn ON pn.oid=pr.pronamespace\n");
-	}
-	query = wxT("SELECT DISTINCT ON(cls.relname) cls.oid, cls.relname as idxname, indrelid, indkey, indisclustered, indisunique, indisprimary, n.nspname,\n")
-	        wxT("       ") + proname + wxT("tab.relname as tabname, indclass, con.oid AS conoid, CASE contype WHEN 'p' THEN desp.description WHEN 'u' THEN desp.description WHEN 'x' THEN desp.description ELSE des.description END AS description,\n")
-	        wxT("       pg_get_expr(indpred, indrelid") + prettyOption + wxT(") as indconstraint, contype, condeferrable, condeferred, amname\n");
-	if (connection->BackendMinimumVersion(8, 2))
-		query += wxT(", substring(array_to_string(cls.reloptions, ',') from 'fillfactor=([0-9]*)') AS fillfactor \n");
-	query += wxT("  FROM pg_index idx\n")
-	         wxT("  JOIN pg_class cls ON cls.oid=indexrelid\n")
-	         wxT("  JOIN pg_class tab ON tab.oid=indrelid\n")
-	         + projoin +
-	         wxT("  JOIN pg_namespace n ON n.oid=tab.relnamespace\n")
-	         wxT("  JOIN pg_am am ON am.oid=cls.relam\n")
-	         wxT("  LEFT JOIN pg_depend dep ON (dep.classid = cls.tableoid AND dep.objid = cls.oid AND dep.refobjsubid = '0' AND dep.refclassid=(SELECT oid FROM pg_class WHERE relname='pg_constraint') AND dep.deptype='i')\n")
-	         wxT("  LEFT OUTER JOIN pg_constraint con ON (con.tableoid = dep.refclassid AND con.oid = dep.refobjid)\n")
-	         wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=cls.oid\n")
-	         wxT("  LEFT OUTER JOIN pg_description desp ON (desp.objoid=con.oid AND desp.objsubid = 0)\n")
-	         wxT(" WHERE indrelid = ") + NumToStr(table->OIDTable) + wxT("::oid")
-	         + wxT(" AND contype='u' ")
-	         + wxT("\n")
-	         wxT(" ORDER BY cls.relname");
-	pgSet *indexes = connection->ExecuteSet(query);
-	int ukIndex = -1;
-	wxArrayString UniqueKeysNames;
+	delete inhtables;
+
+	sql = wxT("SELECT att.attrelid, att.attname, att.attnum, att.atttypmod, att.attndims, att.attnotnull,\n")
+	      wxT("  format_type(ty.oid,NULL) AS typname, tn.nspname as typnspname,\n")
+	      wxT("  (SELECT count(1) FROM pg_type t2 WHERE t2.typname=ty.typname) > 1 AS isdup, indkey\n")
+	      wxT("  FROM pg_attribute att\n")
+	      wxT("  JOIN pg_type ty ON ty.oid=atttypid\n")
+	      wxT("  JOIN pg_namespace tn ON tn.oid=ty.typnamespace\n")
+	      wxT("  LEFT OUTER JOIN pg_index pi ON pi.indrelid=att.attrelid AND indisprimary\n")
+	      wxT(" WHERE att.attrelid IN (") + oidList + wxT(")\n")
+	      wxT("   AND att.attnum > 0\n")
+	      wxT("   AND att.attisdropped IS FALSE\n")
+	      wxT(" ORDER BY att.attrelid, att.attnum");
 
-	if (indexes)
+	pgSet *columns = connection->ExecuteSet(sql);
+	if (columns)
 	{
-		while (!indexes->Eof())
+		while (!columns->Eof())
 		{
-			ukIndex++;
-			wxString uniqueKeys = indexes->GetVal(wxT("indkey"));
-
-			UniqueKeysNames.Add(indexes->GetVal(wxT("idxname")));
+			it = byOid.find(columns->GetVal(wxT("attrelid")));
+			if (it == byOid.end())
+			{
+				columns->MoveNext();
+				continue;
+			}
+			table = it->second;
 
-			wxStringTokenizer indkey(uniqueKeys);
+			column = new ddStubColumn(columns->GetVal(wxT("attname")), table->OIDTable);
+			column->pgColNumber = columns->GetLong(wxT("attnum"));
+			wxString pkCols = columns->GetVal(wxT("indkey"));
+			bool isPK = false;
+			wxStringTokenizer indkey(pkCols);
 			while (indkey.HasMoreTokens())
 			{
-				//Get column number in unique key
 				wxString str = indkey.GetNextToken();
-				//look at all columns [change for hashmap in a future if that option is more optimized]
-				stubColsHashMap::iterator it;
-				ddStubColumn *item;
-				for (it = table->cols.begin(); it != table->cols.end(); ++it)
+				if (StrToLong(str) == column->pgColNumber)
 				{
-					wxString key = it->first;
-					item = it->second;
-					//If column belong to unique constraint mark it
-					if (StrToLong(str) == item->pgColNumber)
-					{
-						item->uniqueKeyIndex = ukIndex;
-					}
+					isPK = true;
+					break;
 				}
 			}
-			indexes->MoveNext();
-		}
-		table->UniqueKeysNames = UniqueKeysNames;
-		delete indexes;
-	}
-	return out;  //false in a future when detect a column in more than one unique key because this is not supported by database designer right now
-}
+			column->isPrimaryKey = isPK;
 
-//true on everything fine, false when some error is found
-bool ddImportDBUtils::setPkName(pgConn *connection, ddStubTable *table)
-{
-	bool out = true;
-	wxString pkName = wxEmptyString;
-
-	//temporary fix, this should be adapted to pgadmin way of working
-	// check for extended ruleutils with pretty-print option
-	wxString prettyOption;
-	wxString exprname = connection->ExecuteScalar(wxT("SELECT proname FROM pg_proc WHERE proname='pg_get_viewdef' AND proargtypes[1]=16"));
-	if (!exprname.IsEmpty())
-		prettyOption = wxT(", true");
-
-	wxString query;
+			long typmod = columns->GetLong(wxT("atttypmod"));
+			pgDatatype *dt = new pgDatatype(columns->GetVal(wxT("typnspname")), columns->GetVal(wxT("typname")),
+			                                columns->GetBool(wxT("isdup")),
+			                                columns->GetLong(wxT("attndims")), typmod);
 
-	wxString proname, projoin;
-	if (connection->BackendMinimumVersion(7, 4))
-	{
-		proname = wxT("indnatts, ");
-		if (connection->BackendMinimumVersion(7, 5))
-		{
-			proname += wxT("cls.reltablespace AS spcoid, spcname, ");
-			projoin = wxT("  LEFT OUTER JOIN pg_tablespace ta on ta.oid=cls.reltablespace\n");
+			column->typeColumn = dt;
+			column->isNotNull = columns->GetBool(wxT("attnotnull"));
+			wxString colName = column->columnName;
+			table->cols[colName] = column;
+			columns->MoveNext();
 		}
+
+		delete columns;
 	}
-	else
-	{
-		proname = wxT("proname, pn.nspname as pronspname, proargtypes, ");
-		projoin =   wxT("  LEFT OUTER JOIN pg_proc pr ON pr.oid=indproc\n")
-		            wxT("  LEFT OUTER JOIN pg_namespace pn ON pn.oid=pr.pronamespace\n");
-	}
-	query = wxT("SELECT DISTINCT ON(cls.relname) cls.oid, cls.relname as idxname, indrelid, indkey, indisclustered, indisunique, indisprimary, n.nspname,\n")
-	        wxT("       ") + proname + wxT("tab.relname as tabname, indclass, con.oid AS conoid, CASE contype WHEN 'p' THEN desp.description WHEN 'u' THEN desp.description WHEN 'x' THEN desp.description ELSE des.description END AS description,\n")
-	        wxT("       pg_get_expr(indpred, indrelid") + prettyOption + wxT(") as indconstraint, contype, condeferrable, condeferred, amname\n");
-	if (connection->BackendMinimumVersion(8, 2))
-		query += wxT(", substring(array_to_string(cls.reloptions, ',') from 'fillfactor=([0-9]*)') AS fillfactor \n");
-	query += wxT("  FROM pg_index idx\n")
-	         wxT("  JOIN pg_class cls ON cls.oid=indexrelid\n")
-	         wxT("  JOIN pg_class tab ON tab.oid=indrelid\n")
-	         + projoin +
-	         wxT("  JOIN pg_namespace n ON n.oid=tab.relnamespace\n")
-	         wxT("  JOIN pg_am am ON am.oid=cls.relam\n")
-	         wxT("  LEFT JOIN pg_depend dep ON (dep.classid = cls.tableoid AND dep.objid = cls.oid AND dep.refobjsubid = '0' AND dep.refclassid=(SELECT oid FROM pg_class WHERE relname='pg_constraint') AND dep.deptype='i')\n")
-	         wxT("  LEFT OUTER JOIN pg_constraint con ON (con.tableoid = dep.refclassid AND con.oid = dep.refobjid)\n")
-	         wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=cls.oid\n")
-	         wxT("  LEFT OUTER JOIN pg_description desp ON (desp.objoid=con.oid AND desp.objsubid = 0)\n")
-	         wxT(" WHERE indrelid = ") + NumToStr(table->OIDTable) + wxT("::oid")
-	         + wxT(" AND contype='p' ")
-	         + wxT("\n")
-	         wxT(" ORDER BY cls.relname");
-	pgSet *indexes = connection->ExecuteSet(query);
+
+	// Primary and unique keys; unique keys are numbered in name order for each table
+	sql = wxT("SELECT DISTINCT ON(indrelid, cls.relname) indrelid, cls.relname as idxname, indkey, contype\n")
+	      wxT("  FROM pg_index idx\n")
+	      wxT("  JOIN pg_class cls ON cls.oid=indexrelid\n")
+	      wxT("  JOIN pg_depend dep ON (dep.classid = cls.tableoid AND dep.objid = cls.oid AND dep.refobjsubid = '0' AND dep.refclassid=(SELECT oid FROM pg_class WHERE relname='pg_constraint') AND dep.deptype='i')\n")
+	      wxT("  JOIN pg_constraint con ON (con.tableoid = dep.refclassid AND con.oid = dep.refobjid)\n")
+	      wxT(" WHERE indrelid IN (") + oidList + wxT(") AND contype IN ('p', 'u')\n")
+	      wxT(" ORDER BY indrelid, cls.relname");
+
+	pgSet *indexes = connection->ExecuteSet(sql);
 	if (indexes)
 	{
 		while (!indexes->Eof())
 		{
-			pkName = indexes->GetVal(wxT("idxname"));
+			it = byOid.find(indexes->GetVal(wxT("indrelid")));
+			if (it == byOid.end())
+			{
+				indexes->MoveNext();
+				continue;
+			}
+			table = it->second;
+
+			if (indexes->GetVal(wxT("contype")) == wxT("p"))
+				table->PrimaryKeyName = indexes->GetVal(wxT("idxname"));
+			else
+			{
+				int ukIndex = table->UniqueKeysNames.GetCount();
+				table->UniqueKeysNames.Add(indexes->GetVal(wxT("idxname")));
+
+				//If column belong to unique constraint mark it
+				wxStringTokenizer indkey(indexes->GetVal(wxT("indkey")));
+				while (indkey.HasMoreTokens())
+				{
+					wxString str = indkey.GetNextToken();
+					column = table->getColumnByNumber(StrToLong(str));
+					if (column)
+						column->uniqueKeyIndex = ukIndex;
+				}
+			}
 			indexes->MoveNext();
 		}
 		delete indexes;
 	}
 
-	table->PrimaryKeyName = pkName;
-	return out;  //false in a future when detect a column in more than one unique key because this is not supported by database designer right now
+	for (it = byOid.begin(); it != byOid.end(); ++it)
+		tables[it->second->tableName] = it->second;
 }
 
 void ddImportDBUtils::getAllRelationships(pgConn *connection, stubTablesHashMap &tables, ddDatabaseDesign *design)
 {
-	wxString sql;
+	wxString sql, oidList;
 	ddRelationshipFigure *relation = NULL;
 	ddTableFigure *sourceTabFigure = NULL;
 	ddTableFigure *destTabFigure = NULL;
-	//Add Tables to the Model
+	//Tables by oid, to find the one each foreign key belongs to
+	stubTablesHashMap byOid;
 	stubTablesHashMap::iterator mainIt;
 	ddStubTable *destStubTable = NULL;
 	for (mainIt = tables.begin(); mainIt != tables.end(); ++mainIt)
 	{
-		wxString key = mainIt->first;
 		destStubTable = mainIt->second;
+		if (!oidList.IsEmpty())
+			oidList += wxT(", ");
+		oidList += NumToStr(destStubTable->OIDTable);
+		byOid[NumToStr(destStubTable->OIDTable)] = destStubTable;
+	}
+
+	if (oidList.IsEmpty())
+		return;
 
-		sql = wxT("SELECT ct.oid, conname, condeferrable, condeferred, confupdtype, confdeltype, confmatchtype, ")
-		      wxT("conkey, confkey, confrelid, nl.nspname as fknsp, cl.relname as fktab, ")
-		      wxT("nr.nspname as refnsp, cr.relname as reftab, description");
-		if (connection->BackendMinimumVersion(9, 1))
-			sql += wxT(", convalidated");
-		sql += wxT("\n  FROM pg_constraint ct\n")
-		       wxT("  JOIN pg_class cl ON cl.oid=conrelid\n")
-		       wxT("  JOIN pg_namespace nl ON nl.oid=cl.relnamespace\n")
-		       wxT("  JOIN pg_class cr ON cr.oid=confrelid\n")
-		       wxT("  JOIN pg_namespace nr ON nr.oid=cr.relnamespace\n")
-		       wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=ct.oid\n")
-		       wxT(" WHERE contype='f' AND conrelid = ") + NumToStr(destStubTable->OIDTable) + wxT("::oid")
-		       //+ restriction +
-		       + wxT("\n")
-		       wxT(" ORDER BY conname");
-
-		pgSet *foreignKeys = connection->ExecuteSet(sql);
-
-		if (foreignKeys && foreignKeys->NumRows() > 0)
+	//Read the foreign keys of all tables at once
+	sql = wxT("SELECT ct.oid, conrelid, conname, condeferrable, condeferred, confupdtype, confdeltype, confmatchtype, ")
+	      wxT("conkey, confkey, confrelid, nl.nspname as fknsp, cl.relname as fktab, ")
+	      wxT("nr.nspname as refnsp, cr.relname as reftab, description");
+	if (connection->BackendMinimumVersion(9, 1))
+		sql += wxT(", convalidated");
+	sql += wxT("\n  FROM pg_constraint ct\n")
+	       wxT("  JOIN pg_class cl ON cl.oid=conrelid\n")
+	       wxT("  JOIN pg_namespace nl ON nl.oid=cl.relnamespace\n")
+	       wxT("  JOIN pg_class cr ON cr.oid=confrelid\n")
+	       wxT("  JOIN pg_namespace nr ON nr.oid=cr.relnamespace\n")
+	       wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=ct.oid\n")
+	       wxT(" WHERE contype='f' AND conrelid IN (") + oidList + wxT(")\n")
+	       wxT(" ORDER BY conrelid, conname");
+
+	pgSet *foreignKeys = connection->ExecuteSet(sql);
+
+	if (foreignKeys && foreignKeys->NumRows() > 0)
+	{
+		while (!foreignKeys->Eof())
 		{
-			while (!foreignKeys->Eof())
+			destStubTable = byOid[foreignKeys->GetVal(wxT("conrelid"))];
+			wxString sourceSchema, destSchema;
+			sourceSchema = foreignKeys->GetVal(wxT("refnsp"));
+			destSchema = foreignKeys->GetVal(wxT("fknsp"));
+
+			//  Source Table  ----------------------<| Destination Table
+
+			if(sourceSchema.IsSameAs(destSchema, false))
 			{
-				wxString sourceSchema, destSchema;
-				sourceSchema = foreignKeys->GetVal(wxT("refnsp"));
-				destSchema = foreignKeys->GetVal(wxT("fknsp"));
+				wxString sourceTableName = foreignKeys->GetVal(wxT("reftab"));
+				wxString destTableName = foreignKeys->GetVal(wxT("fktab"));
 
-				//  Source Table  ----------------------<| Destination Table
+				destTabFigure = design->getTable(destTableName);
+				sourceTabFigure = design->getTable(sourceTableName);
 
-				if(sourceSchema.IsSameAs(destSchema, false))
+				//Only if both tables were imported at same time
+				if(destTabFigure != NULL && sourceTabFigure != NULL)
 				{
-					wxString sourceTableName = foreignKeys->GetVal(wxT("reftab"));
-					wxString destTableName = foreignKeys->GetVal(wxT("fktab"));
-
-					destTabFigure = design->getTable(destTableName);
-					sourceTabFigure = design->getTable(sourceTableName);
 
-					//Only if both tables were imported at same time
-					if(destTabFigure != NULL && sourceTabFigure != NULL)
+					int ukindex = -1; //Only Supporting foreign keys from PK right now when importing model
+					wxString RelationshipName = foreignKeys->GetVal(wxT("conname"));
+
+					wxString onUpd = foreignKeys->GetVal(wxT("confupdtype"));
+					actionKind onUpdate = 	onUpd.IsSameAs('a') ? FK_ACTION_NO :
+					                        onUpd.IsSameAs('r') ? FK_RESTRICT :
+					                        onUpd.IsSameAs('c') ? FK_CASCADE :
+					                        onUpd.IsSameAs('d') ? FK_SETDEFAULT :
+					                        onUpd.IsSameAs('n') ? FK_SETNULL : FK_ACTION_NO;
+
+
+					wxString onDel = foreignKeys->GetVal(wxT("confdeltype"));
+					actionKind onDelete = 	onUpd.IsSameAs('a') ? FK_ACTION_NO :
+					                        onUpd.IsSameAs('r') ? FK_RESTRICT :
+					                        onUpd.IsSameAs('c') ? FK_CASCADE :
+					                        onUpd.IsSameAs('d') ? FK_SETDEFAULT :
+					                        onUpd.IsSameAs('n') ? FK_SETNULL : FK_ACTION_NO;
+
+					wxString match = foreignKeys->GetVal(wxT("confmatchtype"));
+					bool matchSimple = 	match.IsSameAs('f') ? false :
+					                    match.IsSameAs('u') ? true : false;
+
+
+					//------ Preparing metada to allow discovery of some relationship attributes
+					//Source table columns
+					wxString fkColsSourceTable = foreignKeys->GetVal(wxT("confkey"));
+					//remove {} of string
+					fkColsSourceTable.Remove(0, 1);
+					fkColsSourceTable.RemoveLast();
+					wxString fkColsDestTable = foreignKeys->GetVal(wxT("conkey"));
+					//remove {} of string
+					fkColsDestTable.Remove(0, 1);
+					fkColsDestTable.RemoveLast();
+
+					wxSortedArrayInt sourceFkCols(sortFunc);
+					wxSortedArrayInt destFkCols(sortFunc);
+					wxSortedArrayInt sourcePKs(sortFunc);
+					wxSortedArrayInt destPKs(sortFunc);
+
+					//Split columns from sourceFk
+					wxStringTokenizer confkey(fkColsSourceTable);
+					while (confkey.HasMoreTokens())
 					{
+						wxString str = confkey.GetNextToken();
+						sourceFkCols.Add(StrToLong(str));
+					}
 
-						int ukindex = -1; //Only Supporting foreign keys from PK right now when importing model
-						wxString RelationshipName = foreignKeys->GetVal(wxT("conname"));
-
-						wxString onUpd = foreignKeys->GetVal(wxT("confupdtype"));
-						actionKind onUpdate = 	onUpd.IsSameAs('a') ? FK_ACTION_NO :
-						                        onUpd.IsSameAs('r') ? FK_RESTRICT :
-						                        onUpd.IsSameAs('c') ? FK_CASCADE :
-						                        onUpd.IsSameAs('d') ? FK_SETDEFAULT :
-						                        onUpd.IsSameAs('n') ? FK_SETNULL : FK_ACTION_NO;
-
-
-						wxString onDel = foreignKeys->GetVal(wxT("confdeltype"));
-						actionKind onDelete = 	onUpd.IsSameAs('a') ? FK_ACTION_NO :
-						                        onUpd.IsSameAs('r') ? FK_RESTRICT :
-						                        onUpd.IsSameAs('c') ? FK_CASCADE :
-						                        onUpd.IsSameAs('d') ? FK_SETDEFAULT :
-						                        onUpd.IsSameAs('n') ? FK_SETNULL : FK_ACTION_NO;
-
-						wxString match = foreignKeys->GetVal(wxT("confmatchtype"));
-						bool matchSimple = 	match.IsSameAs('f') ? false :
-						                    match.IsSameAs('u') ? true : false;
-
-
-						//------ Preparing metada to allow discovery of some relationship attributes
-						//Source table columns
-						wxString fkColsSourceTable = foreignKeys->GetVal(wxT("confkey"));
-						//remove {} of string
-						fkColsSourceTable.Remove(0, 1);
-						fkColsSourceTable.RemoveLast();
-						wxString fkColsDestTable = foreignKeys->GetVal(wxT("conkey"));
-						//remove {} of string
-						fkColsDestTable.Remove(0, 1);
-						fkColsDestTable.RemoveLast();
-
-						wxSortedArrayInt sourceFkCols(sortFunc);
-						wxSortedArrayInt destFkCols(sortFunc);
-						wxSortedArrayInt sourcePKs(sortFunc);
-						wxSortedArrayInt destPKs(sortFunc);
-
-						//Split columns from sourceFk
-						wxStringTokenizer confkey(fkColsSourceTable);
-						while (confkey.HasMoreTokens())
-						{
-							wxString str = confkey.GetNextToken();
-							sourceFkCols.Add(StrToLong(str));
-						}
-
-						//Split columns from destFk
-						wxStringTokenizer conkey(fkColsDestTable);
-						while (conkey.HasMoreTokens())
-						{
-							wxString str = conkey.GetNextToken();
-							destFkCols.Add(StrToLong(str));
-						}
+					//Split columns from destFk
+					wxStringTokenizer conkey(fkColsDestTable);
+					while (conkey.HasMoreTokens())
+					{
+						wxString str = conkey.GetNextToken();
+						destFkCols.Add(StrToLong(str));
+					}
 
-						//Get Stub of source table
-						ddStubTable *sourceStubTable = tables[sourceTableName];
+					//Get Stub of source table
+					ddStubTable *sourceStubTable = tables[sourceTableName];
 
-						//Get PK columns of source
-						stubColsHashMap::iterator it;
-						ddStubColumn *column;
-						for (it = sourceStubTable->cols.begin(); it != sourceStubTable->cols.end(); ++it)
-						{
-							wxString key = it->first;
-							column = it->second;
-							if(column->isPrimaryKey)
-								sourcePKs.Add(column->pgColNumber);
-						}
+					//Get PK columns of source
+					stubColsHashMap::iterator it;
+					ddStubColumn *column;
+					for (it = sourceStubTable->cols.begin(); it != sourceStubTable->cols.end(); ++it)
+					{
+						wxString key = it->first;
+						column = it->second;
+						if(column->isPrimaryKey)
+							sourcePKs.Add(column->pgColNumber);
+					}
 
-						//Get PK columns of dest
-						for (it = destStubTable->cols.begin(); it != destStubTable->cols.end(); ++it)
-						{
-							wxString key = it->first;
-							column = it->second;
-							if(column->isPrimaryKey)
-								destPKs.Add(column->pgColNumber);
-						}
+					//Get PK columns of dest
+					for (it = destStubTable->cols.begin(); it != destStubTable->cols.end(); ++it)
+					{
+						wxString key = it->first;
+						column = it->second;
+						if(column->isPrimaryKey)
+							destPKs.Add(column->pgColNumber);
+					}
 
-						//  Source Table  ----------------------<| Destination Table
-						//Default assumption is the source of this fk is a Primary Key.
-						bool fkFromPk = true;
+					//  Source Table  ----------------------<| Destination Table
+					//Default assumption is the source of this fk is a Primary Key.
+					bool fkFromPk = true;
 
-						//first check: number of columns used as fk at Source is the same of the pk at Source
-						if(sourceFkCols.Count() == sourcePKs.Count())
+					//first check: number of columns used as fk at Source is the same of the pk at Source
+					if(sourceFkCols.Count() == sourcePKs.Count())
+					{
+						int i;
+						//Because postgres columns numbers are stored in an ordered array,
+						//their index should be the same at all positions
+						int srcFkCount = sourceFkCols.Count();
+						for(i = 0; i < srcFkCount; i++)
 						{
-							int i;
-							//Because postgres columns numbers are stored in an ordered array,
-							//their index should be the same at all positions
-							int srcFkCount = sourceFkCols.Count();
-							for(i = 0; i < srcFkCount; i++)
+							if( sourceFkCols[i] != sourcePKs[i] )
 							{
-								if( sourceFkCols[i] != sourcePKs[i] )
-								{
-									fkFromPk = false;
-									break;
-								}
+								fkFromPk = false;
+								break;
 							}
 						}
-						else
-						{
-							fkFromPk = true;
-						}
+					}
+					else
+					{
+						fkFromPk = true;
+					}
 
-						//------ Finding fk from uk or pk?
-						int ukIndex = -1;
-						//if fkFromPk = false then is fkfromUK?, check that
-						//all source fk columns should belong to one Uk at source table.
-						if( fkFromPk == false )
+					//------ Finding fk from uk or pk?
+					int ukIndex = -1;
+					//if fkFromPk = false then is fkfromUK?, check that
+					//all source fk columns should belong to one Uk at source table.
+					if( fkFromPk == false )
+					{
+						bool error = false;
+						int baseColNumber = sourceFkCols[sourceFkCols.Count() - 1];
+						int baseUkIdxSourceCol = sourceStubTable->getColumnByNumber(baseColNumber)->uniqueKeyIndex;
+						int nextColNumber, nextUkIdxSourceCol;
+						int countSrcFkCols = sourceFkCols.Count() - 2;
+						while(countSrcFkCols >= 0)
 						{
-							bool error = false;
-							int baseColNumber = sourceFkCols[sourceFkCols.Count() - 1];
-							int baseUkIdxSourceCol = sourceStubTable->getColumnByNumber(baseColNumber)->uniqueKeyIndex;
-							int nextColNumber, nextUkIdxSourceCol;
-							int countSrcFkCols = sourceFkCols.Count() - 2;
-							while(countSrcFkCols >= 0)
+							nextColNumber = sourceFkCols[countSrcFkCols];
+							nextUkIdxSourceCol = sourceStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
+							countSrcFkCols--;
+							if(baseUkIdxSourceCol != nextUkIdxSourceCol)
 							{
-								nextColNumber = sourceFkCols[countSrcFkCols];
-								nextUkIdxSourceCol = sourceStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
-								countSrcFkCols--;
-								if(baseUkIdxSourceCol != nextUkIdxSourceCol)
-								{
-									error = true;
-									wxMessageBox(_("Error detecting kind of foreign key source: from Pk or from Uk"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
-									delete foreignKeys;
-									return;
-								}
-							}
-							if(!error)
-							{
-								ukIndex = baseUkIdxSourceCol;
+								error = true;
+								wxMessageBox(_("Error detecting kind of foreign key source: from Pk or from Uk"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
+								delete foreignKeys;
+								return;
 							}
 						}
-
-						//Last check of consistency
-						if(fkFromPk == false && ukIndex < 0)
+						if(!error)
 						{
-							wxMessageBox(_("Error detecting kind of foreign key source: from Pk or from Uk"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
-							delete foreignKeys;
-							return;
+							ukIndex = baseUkIdxSourceCol;
 						}
+					}
 
+					//Last check of consistency
+					if(fkFromPk == false && ukIndex < 0)
+					{
+						wxMessageBox(_("Error detecting kind of foreign key source: from Pk or from Uk"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
+						delete foreignKeys;
+						return;
+					}
 
-						//------ identifying relationship or not  -----|-<|?
-						//Default assumption is relationship is identifying
-						bool identifying = true;
 
-						//first check: number of columns used as fk at Source is the same of the pk at Source
-						if(destFkCols.Count() == destPKs.Count())
+					//------ identifying relationship or not  -----|-<|?
+					//Default assumption is relationship is identifying
+					bool identifying = true;
+
+					//first check: number of columns used as fk at Source is the same of the pk at Source
+					if(destFkCols.Count() == destPKs.Count())
+					{
+						int i;
+						//Because postgres columns numbers are stored in an ordered array,
+						//their index should be the same at all positions
+						int destFkCount = destFkCols.Count();
+						for(i = 0; i < destFkCount; i++)
 						{
-							int i;
-							//Because postgres columns numbers are stored in an ordered array,
-							//their index should be the same at all positions
-							int destFkCount = destFkCols.Count();
-							for(i = 0; i < destFkCount; i++)
+							if( destFkCols[i] != destPKs[i] )
 							{
-								if( destFkCols[i] != destPKs[i] )
-								{
-									identifying = false;
-									break;
-								}
+								identifying = false;
+								break;
 							}
 						}
-						else
-						{
-							identifying = false;
-						}
+					}
+					else
+					{
+						identifying = false;
+					}
 
-						//------ 1:1 or 1:M  ?  as a fact 1:1 have a fk,uk at destination table.
-						// A foreign key have an one to many relationship when there is an UK for same column(s)
-						// inside the foreign key. Assumption, a column on belong to one Uk (no more than one).
-						bool oneToMany = true;
-						int baseColNumber = destFkCols[destFkCols.Count() - 1];
-						int baseUkIdxDestCol = destStubTable->getColumnByNumber(baseColNumber)->uniqueKeyIndex;
-						if(baseUkIdxDestCol != -1)
+					//------ 1:1 or 1:M  ?  as a fact 1:1 have a fk,uk at destination table.
+					// A foreign key have an one to many relationship when there is an UK for same column(s)
+					// inside the foreign key. Assumption, a column on belong to one Uk (no more than one).
+					bool oneToMany = true;
+					int baseColNumber = destFkCols[destFkCols.Count() - 1];
+					int baseUkIdxDestCol = destStubTable->getColumnByNumber(baseColNumber)->uniqueKeyIndex;
+					if(baseUkIdxDestCol != -1)
+					{
+						oneToMany = false;
+						int nextUkIdxDestCol, nextColNumber;
+						int countDestFkCols = destFkCols.Count() - 2;
+						while(countDestFkCols >= 0)
 						{
-							oneToMany = false;
-							int nextUkIdxDestCol, nextColNumber;
-							int countDestFkCols = destFkCols.Count() - 2;
-							while(countDestFkCols >= 0)
+							nextColNumber = destFkCols[countDestFkCols];
+							nextUkIdxDestCol = destStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
+							countDestFkCols--;
+							//if a dest fk column is not in the same Uk index of first one
+							if(nextUkIdxDestCol != baseUkIdxDestCol)
 							{
-								nextColNumber = destFkCols[countDestFkCols];
-								nextUkIdxDestCol = destStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
-								countDestFkCols--;
-								//if a dest fk column is not in the same Uk index of first one
-								if(nextUkIdxDestCol != baseUkIdxDestCol)
-								{
-									oneToMany = true;
-									break;
-								}
+								oneToMany = true;
+								break;
 							}
 						}
+					}
 
-						//Step two check all column of fk are inside a unique key (all and not more)
-						if(oneToMany == false)  //assumption is 1:1 relationship until now
+					//Step two check all column of fk are inside a unique key (all and not more)
+					if(oneToMany == false)  //assumption is 1:1 relationship until now
+					{
+						int numberColsInUk = 0, nextUkIdxDestCol, nextColNumber;
+						ddStubColumn *item;
+						for (it = destStubTable->cols.begin(); it != destStubTable->cols.end(); ++it)
 						{
-							int numberColsInUk = 0, nextUkIdxDestCol, nextColNumber;
-							ddStubColumn *item;
-							for (it = destStubTable->cols.begin(); it != destStubTable->cols.end(); ++it)
+							wxString key = it->first;
+							item = it->second;
+							//at each column with same uk index that base comparison column, count it
+							nextColNumber = item->pgColNumber;
+							nextUkIdxDestCol = destStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
+							if( nextUkIdxDestCol == baseUkIdxDestCol)
 							{
-								wxString key = it->first;
-								item = it->second;
-								//at each column with same uk index that base comparison column, count it
-								nextColNumber = item->pgColNumber;
-								nextUkIdxDestCol = destStubTable->getColumnByNumber(nextColNumber)->uniqueKeyIndex;
-								if( nextUkIdxDestCol == baseUkIdxDestCol)
-								{
-									numberColsInUk++;
-								}
+								numberColsInUk++;
 							}
-
-							//number of columns in uk used by relationship is bigger or lesser than number of columns
-							//in destination table used by relationship as fk dest(dest fk columnn), then is not 1:1
-							if(numberColsInUk != destFkCols.Count())
-								oneToMany = true;
 						}
 
-						//Optional or Mandatory consistency
-						bool mandatoryRelationship;
+						//number of columns in uk used by relationship is bigger or lesser than number of columns
+						//in destination table used by relationship as fk dest(dest fk columnn), then is not 1:1
+						if(numberColsInUk != destFkCols.Count())
+							oneToMany = true;
+					}
 
-						int countDestFkCols = destFkCols.Count() - 1;
-						bool isNotNull;
-						int nnCols = 0, nullCols = 0, nextColNumber;
-						while(countDestFkCols >= 0)
-						{
-							nextColNumber = destFkCols[countDestFkCols];
-							isNotNull = destStubTable->getColumnByNumber(nextColNumber)->isNotNull;
-							countDestFkCols--;
-							if(isNotNull)
-								nnCols++;
-							else
-								nullCols++;
-						}
+					//Optional or Mandatory consistency
+					bool mandatoryRelationship;
 
-						if(nnCols == 0 && nullCols > 0)
-						{
-							mandatoryRelationship = false;
-						}
-						else if(nnCols > 0 && nullCols == 0)
-						{
-							mandatoryRelationship = true;
-						}
+					int countDestFkCols = destFkCols.Count() - 1;
+					bool isNotNull;
+					int nnCols = 0, nullCols = 0, nextColNumber;
+					while(countDestFkCols >= 0)
+					{
+						nextColNumber = destFkCols[countDestFkCols];
+						isNotNull = destStubTable->getColumnByNumber(nextColNumber)->isNotNull;
+						countDestFkCols--;
+						if(isNotNull)
+							nnCols++;
 						else
-						{
-							wxMessageBox(_("Error detecting kind of foreign key: null or not null"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
-							delete foreignKeys;
-							return;
-						}
+							nullCols++;
+					}
 
-						relation = new ddRelationshipFigure();
-						relation->setStartTerminal(new ddRelationshipTerminal(relation, false));
-						relation->setEndTerminal(new ddRelationshipTerminal(relation, true));
-						relation->clearPoints(0);
-						relation->initRelationValues(sourceTabFigure, destTabFigure, ukIndex, RelationshipName, onUpdate, onDelete, matchSimple, identifying, oneToMany, mandatoryRelationship, fkFromPk);
-						relation->updateConnection(0);
-						design->addTableToModel(relation);
-
-						//Add items to relationship
-						wxString srcColName, destColName;
-						ddColumnFigure *sourceCol = NULL, *destinationCol = NULL;
-						bool autoGenFk = false;
-						wxString initialColName;
-						ddRelationshipItem *item = NULL;
-						int i, srcFkCount = sourceFkCols.Count();
-						for(i = 0; i < srcFkCount ; i++)
-						{
-							srcColName  =  sourceStubTable->getColumnByNumber(sourceFkCols[i])->columnName;
-							destColName =  destStubTable->getColumnByNumber(destFkCols[i])->columnName;
-							sourceCol = sourceTabFigure->getColByName(srcColName);
-							destinationCol = destTabFigure->getColByName(destColName);
-							initialColName = srcColName;
-							item = new ddRelationshipItem();
-							item->initRelationshipItemValues(relation, destTabFigure, autoGenFk, destinationCol, sourceCol, initialColName);
-							relation->getItemsHashMap()[item->original->getColumnName()] = item;
-						}
+					if(nnCols == 0 && nullCols > 0)
+					{
+						mandatoryRelationship = false;
+					}
+					else if(nnCols > 0 && nullCols == 0)
+					{
+						mandatoryRelationship = true;
+					}
+					else
+					{
+						wxMessageBox(_("Error detecting kind of foreign key: null or not null"), _("Error importing relationship"),  wxICON_ERROR | wxOK);
+						delete foreignKeys;
+						return;
+					}
+
+					relation = new ddRelationshipFigure();
+					relation->setStartTerminal(new ddRelationshipTerminal(relation, false));
+					relation->setEndTerminal(new ddRelationshipTerminal(relation, true));
+					relation->clearPoints(0);
+					relation->initRelationValues(sourceTabFigure, destTabFigure, ukIndex, RelationshipName, onUpdate, onDelete, matchSimple, identifying, oneToMany, mandatoryRelationship, fkFromPk);
+					relation->updateConnection(0);
+					design->addTableToModel(relation);
+
+					//Add items to relationship
+					wxString srcColName, destColName;
+					ddColumnFigure *sourceCol = NULL, *destinationCol = NULL;
+					bool autoGenFk = false;
+					wxString initialColName;
+					ddRelationshipItem *item = NULL;
+					int i, srcFkCount = sourceFkCols.Count();
+					for(i = 0; i < srcFkCount ; i++)
+					{
+						srcColName  =  sourceStubTable->getColumnByNumber(sourceFkCols[i])->columnName;
+						destColName =  destStubTable->getColumnByNumber(destFkCols[i])->columnName;
+						sourceCol = sourceTabFigure->getColByName(srcColName);
+						destinationCol = destTabFigure->getColByName(destColName);
+						initialColName = srcColName;
+						item = new ddRelationshipItem();
+						item->initRelationshipItemValues(relation, destTabFigure, autoGenFk, destinationCol, sourceCol, initialColName);
+						relation->getItemsHashMap()[item->original->getColumnName()] = item;
 					}
 				}
-				foreignKeys->MoveNext();
 			}
-			delete foreignKeys;
+			foreignKeys->MoveNext();
 		}
 	}
+	if (foreignKeys)
+		delete foreignKeys;
 }
 
 bool ddImportDBUtils::existsFk(pgConn *connection, OID destTableOid, wxString schemaName, wxString fkName, wxString sourceTableName)
 {
 	wxString sql;
-	OID sourceOID = getTableOID(connection, schemaName, sourceTableName);
-	if(sourceOID == -1 )
-	{
-		return false;
-	}
 
-	sql = wxT("SELECT ct.oid, conname, condeferrable, condeferred, confupdtype, confdeltype, confmatchtype, ")
-	      wxT("conkey, confkey, confrelid, nl.nspname as fknsp, cl.relname as fktab, ")
-	      wxT("nr.nspname as refnsp, cr.relname as reftab, description");
-	if (connection->BackendMinimumVersion(9, 1))
-		sql += wxT(", convalidated");
-	sql += wxT("\n  FROM pg_constraint ct\n")
-	       wxT("  JOIN pg_class cl ON cl.oid=conrelid\n")
-	       wxT("  JOIN pg_namespace nl ON nl.oid=cl.relnamespace\n")
-	       wxT("  JOIN pg_class cr ON cr.oid=confrelid\n")
-	       wxT("  JOIN pg_namespace nr ON nr.oid=cr.relnamespace\n")
-	       wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=ct.oid\n")
-	       wxT(" WHERE contype='f' AND conrelid = ") + NumToStr(destTableOid) + wxT("::oid")
-	       wxT(" AND conname ='") + fkName + wxT("' ")
-	       wxT(" AND confrelid = ") + NumToStr(sourceOID) + wxT("::oid")
-	       wxT("\n")
-	       wxT(" ORDER BY conname");
+	//Source table is looked up by name in the same query
+	sql = wxT("SELECT ct.oid\n")
+	      wxT("  FROM pg_constraint ct\n")
+	      wxT("  JOIN pg_class cr ON cr.oid=confrelid\n")
+	      wxT("  JOIN pg_namespace nr ON nr.oid=cr.relnamespace\n")
+	      wxT(" WHERE contype='f' AND conrelid = ") + NumToStr(destTableOid) + wxT("::oid")
+	      wxT(" AND conname = ") + connection->qtDbString(fkName) +
+	      wxT(" AND cr.relkind = 'r' AND cr.relname = ") + connection->qtDbString(sourceTableName) +
+	      wxT(" AND nr.nspname = ") + connection->qtDbString(schemaName);
 
 	pgSet *foreignKeys = connection->ExecuteSet(sql);
+	if (!foreignKeys)
+		return false;
 
 	//relation don't exists then
-	if(foreignKeys->NumRows() == 0)
-	{
-		return false;
-	}
+	bool exists = foreignKeys->NumRows() > 0;
 	delete foreignKeys;
 
-	return true;
+	return exists;
 }
 
 int ddImportDBUtils::getPgColumnNum(pgConn *connection, wxString schemaName, wxString tableName, wxString columnName)
 {
 	int out = -1;
 	wxString sql;
-	OID tableOid = getTableOID(connection, schemaName, tableName);
-	wxString systemRestriction;
-	systemRestriction = wxT("\n   AND att.attnum > 0");
 
-	sql =  wxT("SELECT att.attrelid,att.attname, att.attnum ")
-	       wxT("\n")
+	sql =  wxT("SELECT att.attname, att.attnum\n")
 	       wxT("  FROM pg_attribute att\n")
-	       wxT("  JOIN pg_type ty ON ty.oid=atttypid\n")
-	       wxT("  JOIN pg_namespace tn ON tn.oid=ty.typnamespace\n")
 	       wxT("  JOIN pg_class cl ON cl.oid=att.attrelid\n")
 	       wxT("  JOIN pg_namespace na ON na.oid=cl.relnamespace\n")
-	       wxT("  LEFT OUTER JOIN pg_type et ON et.oid=ty.typelem\n")
-	       wxT("  LEFT OUTER JOIN pg_attrdef def ON adrelid=att.attrelid AND adnum=att.attnum\n")
-	       wxT("  LEFT OUTER JOIN pg_description des ON des.objoid=att.attrelid AND des.objsubid=att.attnum\n")
-	       wxT("  LEFT OUTER JOIN (pg_depend JOIN pg_class cs ON objid=cs.oid AND cs.relkind='S') ON refobjid=att.attrelid AND refobjsubid=att.attnum\n")
-	       wxT("  LEFT OUTER JOIN pg_namespace ns ON ns.oid=cs.relnamespace\n")
-	       wxT("  LEFT OUTER JOIN pg_index pi ON pi.indrelid=att.attrelid AND indisprimary\n");
-	if (connection->BackendMinimumVersion(9, 1))
-		sql += wxT("  LEFT OUTER JOIN pg_collation coll ON att.attcollation=coll.oid\n")
-		       wxT("  LEFT OUTER JOIN pg_namespace nspc ON coll.collnamespace=nspc.oid\n");
-	sql += wxT(" WHERE att.attrelid = ") + NumToStr(tableOid)
-	       + systemRestriction + wxT("\n")
+	       wxT(" WHERE cl.relkind = 'r' AND cl.relname = ") + connection->qtDbString(tableName) +
+	       wxT(" AND na.nspname = ") + connection->qtDbString(schemaName) + wxT("\n")
+	       wxT("   AND att.attnum > 0\n")
 	       wxT("   AND att.attisdropped IS FALSE\n")
 	       wxT(" ORDER BY att.attnum");
 
@@ -1636,6 +1518,8 @@ wxArrayString ddDBReverseEngineering::getTables()
 
 void ddDBReverseEngineering::OnFinishPressed(wxWizardEvent &event)
 {
+	wxStopWatch stopWatch;
+
 	//Add Tables to the Model
 	stubTablesHashMap::iterator it;
 	ddStubTable *item;
@@ -1647,6 +1531,8 @@ void ddDBReverseEngineering::OnFinishPressed(wxWizardEvent &event)
 	}
 	//Add All relationships to the Model
 	ddImportDBUtils::getAllRelationships(getConnection(), stubsHM, getDesign());
+
+	wxLogInfo(wxT("Imported %d tables into the design in %ld ms"), (int)stubsHM.size(), stopWatch.Time());
 }
 
 
@@ -1984,44 +1870,46 @@ void SelTablesPage::OnWizardPageChanging(wxWizardEvent &event)
 	else if(event.GetDirection())
 	{
 
-		int itemsCount = m_selTables->GetCount();
-		if( itemsCount > 0)
+		ReportPage *tmp = (ReportPage *) m_next;
+		wxStopWatch stopWatch;
+
+		//Read all selected tables at once
+		oidsHashMap selected;
+		stubTablesHashMap tables;
+		int item, itemsCount = m_selTables->GetCount();
+		for (item = 0; item < itemsCount; item++)
+			selected[m_selTables->GetString(item)] = wparent->tablesOIDHM[m_selTables->GetString(item)];
+		ddImportDBUtils::getTables(wparent->getConnection(), selected, tables);
+
+		int prepared = 0;
+		for (item = 0; item < itemsCount; item++)
 		{
-			int item = 0;
-			do
+			wxString tableName = m_selTables->GetString(item);
+			stubTablesHashMap::iterator it = tables.find(tableName);
+			ddStubTable *table = it != tables.end() ? it->second : NULL;
+			if(table == NULL)
 			{
-				ddStubTable *table = ddImportDBUtils::getTable(wparent->getConnection(), m_selTables->GetString(item), wparent->tablesOIDHM[m_selTables->GetString(item)]);
-				if(table == NULL)
-				{
-					ReportPage *tmp = (ReportPage *) m_next;
-					tmp->results->AppendText(_("Error when preparing to import table: ") + m_selTables->GetString(item) + _(", this table have inherited columns and this feature is not supported at this moment.\n\n"));
-				}
-				else if(wparent->getDesign()->getTable(m_selTables->GetString(item)) != NULL)
-				{
-					ReportPage *tmp = (ReportPage *) m_next;
-					tmp->results->AppendText(_("Error when preparing to import table: ") + m_selTables->GetString(item) + _(", this table already exists in the model and updating table at a model is not supported at this moment.\n\n"));
-				}
-				else if(table->tableName.Length() > 0)
-				{
-					if(m_next)
-					{
-						ReportPage *tmp = (ReportPage *) m_next;
-						tmp->results->AppendText(_("Prepared to import table: ") + table->tableName + _("\n"));
-						wparent->stubsHM[table->tableName] = table;
-					}
-				}
-				else
-				{
-					if(m_next)
-					{
-						ReportPage *tmp = (ReportPage *) m_next;
-						tmp->results->AppendText(_("Error when preparing to import table: ") + m_selTables->GetString(item) + _("\n"));
-					}
-				}
-				item++;
+				tmp->results->AppendText(_("Error when preparing to import table: ") + tableName + _(", this table have inherited columns and this feature is not supported at this moment.\n\n"));
+			}
+			else if(wparent->getDesign()->getTable(tableName) != NULL)
+			{
+				tmp->results->AppendText(_("Error when preparing to import table: ") + tableName + _(", this table already exists in the model and updating table at a model is not supported at this moment.\n\n"));
+				delete table;
+			}
+			else if(table->tableName.Length() > 0)
+			{
+				tmp->results->AppendText(_("Prepared to import table: ") + table->tableName + _("\n"));
+				wparent->stubsHM[table->tableName] = table;
+				prepared++;
+			}
+			else
+			{
+				tmp->results->AppendText(_("Error when preparing to import table: ") + tableName + _("\n"));
+				delete table;
 			}
-			while(item < itemsCount);
 		}
+
+		tmp->results->AppendText(wxString::Format(_("\n%d of %d tables read from the database in %ld ms.\n"), prepared, itemsCount, stopWatch.Time()));
 	}
 	else if(!event.GetDirection())
 	{
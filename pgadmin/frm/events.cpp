@@ -30,6 +30,7 @@
 #include "ctl/ctlSQLBox.h"
 #include "ctl/ctlMenuToolbar.h"
 #include "db/pgConn.h"
+#include "db/pgConnector.h"
 #include "schema/pgDatabase.h"
 #include "db/pgSet.h"
 #include "schema/pgServer.h"
@@ -86,6 +87,8 @@ BEGIN_EVENT_TABLE(frmMain, pgFrame)
 	EVT_COMMAND (wxID_ANY, SSH_TUNNEL_ERROR_EVENT, frmMain::OnSSHTunnelEvent)
 #endif
 
+	EVT_COMMAND (wxID_ANY, PGConnectEvent,  frmMain::OnServerConnected)
+
 END_EVENT_TABLE()
 
 void frmMain::OnChildFocus(wxChildFocusEvent &event)
@@ -2271,14 +2271,17 @@ sqlTable::sqlTable(pgConn *conn, pgQueryThread *_thread, const wxString &tabName
 
 
 	dataPool = 0;
-	addPool = new cacheLinePool(500);       // arbitrary initial size
 	lastRow = -1;
 	int i;
 	lineIndex = 0;
+	firstTombstone = -1;
+	tombstones = 0;
 
 	nRows = thread->DataSet()->NumRows();
 	nCols = thread->DataSet()->NumCols();
 
+	addPool = new cacheLinePool(500, nCols);       // arbitrary initial size
+
 	columns = new sqlCellAttr[nCols];
 	savedLine.cols = new wxString[nCols];
 
@@ -2482,7 +2485,7 @@ sqlTable::sqlTable(pgConn *conn, pgQueryThread *_thread, const wxString &tabName
 
 	if (nRows)
 	{
-		dataPool = new cacheLinePool(nRows);
+		dataPool = new cacheLinePool(nRows, nCols);
 		lineIndex = new int[nRows];
 		for (i = 0 ; i < nRows ; i++)
 			lineIndex[i] = i;
@@ -2506,6 +2509,7 @@ sqlTable::~sqlTable()
 	delete addPool;
 
 	delete[] columns;
+	delete[] savedLine.cols;
 
 	if (lineIndex)
 		delete[] lineIndex;
@@ -2611,7 +2615,7 @@ cacheLine *sqlTable::GetLine(int row)
 {
 	cacheLine *line;
 	if (row < nRows - rowsDeleted)
-		line = dataPool->Get(lineIndex[row]);
+		line = dataPool->Get(LineIndex(row));
 	else
 		line = addPool->Get(row - (nRows - rowsDeleted));
 
@@ -2619,6 +2623,25 @@ cacheLine *sqlTable::GetLine(int row)
 }
 
 
+// Deleted rows are marked in lineIndex and only removed from it when a row
+// behind the first of them is needed, so that deleting many rows (last to
+// first, as frmEditGrid::OnDelete does) moves the index once only.
+void sqlTable::CompactLineIndex()
+{
+	int used = nRows - rowsDeleted + tombstones;
+	int row = firstTombstone;
+
+	for (int i = firstTombstone ; i < used ; i++)
+	{
+		if (lineIndex[i] >= 0)
+			lineIndex[row++] = lineIndex[i];
+	}
+
+	firstTombstone = -1;
+	tombstones = 0;
+}
+
+
 
 wxString sqlTable::MakeKey(cacheLine *line)
 {
@@ -2835,7 +2858,7 @@ void sqlTable::SetValue(int row, int col, const wxString &value)
 			StoreLine();
 
 		if (!line->cols)
-			line->cols = new wxString[nCols];
+			line->cols = line->cells;
 
 		// remember line contents for later reference in update ... where
 		int i;
@@ -2865,7 +2888,7 @@ wxString sqlTable::GetValue(int row, int col)
 	wxString val;
 	cacheLine *line;
 	if (row < nRows - rowsDeleted)
-		line = dataPool->Get(lineIndex[row]);
+		line = dataPool->Get(LineIndex(row));
 	else
 		line = addPool->Get(row - (nRows - rowsDeleted));
 
@@ -2877,7 +2900,7 @@ wxString sqlTable::GetValue(int row, int col)
 
 	if (!line->cols)
 	{
-		line->cols = new wxString[nCols];
+		line->cols = line->cells;
 		if (row < nRows - rowsDeleted)
 		{
 			if (!thread)
@@ -2887,8 +2910,8 @@ wxString sqlTable::GetValue(int row, int col)
 			}
 
 			line->stored = true;
-			if (lineIndex[row] != thread->DataSet()->CurrentPos() - 1)
-				thread->DataSet()->Locate(lineIndex[row] + 1);
+			if (LineIndex(row) != thread->DataSet()->CurrentPos() - 1)
+				thread->DataSet()->Locate(LineIndex(row) + 1);
 
 			int i;
 			for (i = 0 ; i < nCols ; i++)
@@ -2942,20 +2965,30 @@ bool sqlTable::AppendRows(size_t rows)
 
 bool sqlTable::DeleteRows(size_t pos, size_t rows)
 {
-	size_t i = pos;
 	size_t rowsDone = 0;
+	size_t first = pos + rows;
+
+	if (rows == 0)
+		return false;
 
-	while (i < pos + rows)
+	// Rows are deleted last to first: each tombstone then lies before the
+	// ones already left, so that the line index is compacted once at most
+	// for the whole block, rather than once per row.
+	if (firstTombstone >= 0 && (int)pos >= firstTombstone)
+		CompactLineIndex();
+
+	size_t i = pos + rows;
+	while (i-- > pos)
 	{
-		cacheLine *line = GetLine(pos);
+		cacheLine *line = GetLine(i);
 		if (!line)
 			break;
 
 		// If line->cols is null, it probably means we need to force the cacheline to be populated.
 		if (!line->cols)
 		{
-			GetValue(pos, 0);
-			line = GetLine(pos);
+			GetValue(i, 0);
+			line = GetLine(i);
 		}
 
 		if (line->stored)
@@ -2967,20 +3000,21 @@ bool sqlTable::DeleteRows(size_t pos, size_t rows)
 			if (!done)
 				break;
 
-			if ((int)pos < nRows - rowsDeleted)
+			if ((int)i < nRows - rowsDeleted)
 			{
+				lineIndex[i] = -1;
+				firstTombstone = i;
+				tombstones++;
 				rowsDeleted++;
-				if ((int)pos < nRows - rowsDeleted)
-					memmove(lineIndex + pos, lineIndex + pos + 1, sizeof(*lineIndex) * (nRows - rowsDeleted - pos));
 			}
 			else
 			{
 				rowsAdded--;
-				if (GetLine(pos)->stored)
-					rowsStored--;
-				addPool->Delete(pos - (nRows - rowsDeleted));
+				rowsStored--;
+				addPool->Delete(i - (nRows - rowsDeleted));
 			}
 			rowsDone++;
+			first = i;
 		}
 		else
 		{
@@ -2989,12 +3023,11 @@ bool sqlTable::DeleteRows(size_t pos, size_t rows)
 			for (j = 0 ; j < nCols ; j++)
 				line->cols[j] = wxT("");
 		}
-		i++;
 	}
 
 	if (rowsDone > 0 && GetView())
 	{
-		wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_DELETED, pos, rowsDone);
+		wxGridTableMessage msg(this, wxGRIDTABLE_NOTIFY_ROWS_DELETED, first, rowsDone);
 		GetView()->ProcessTableMessage(msg);
 	}
 	return (rowsDone != 0);
@@ -3188,101 +3221,138 @@ int sqlCellAttr::precision()
 }
 
 
-cacheLinePool::cacheLinePool(int initialLines)
+cacheLinePool::cacheLinePool(int initialLines, int cols)
 {
-	ptr = new cacheLine*[initialLines];
-	if (ptr)
-	{
-		anzLines = initialLines;
-		memset(ptr, 0, sizeof(cacheLine *)*anzLines);
-	}
-	else
-	{
-		anzLines = 0;
-		wxLogError(__("Out of Memory for cacheLinePool"));
-	}
+	nCols = cols;
+	firstTombstone = -1;
+	usedSlots = 0;
+	nChunks = 0;
+	maxChunks = initialLines / CACHELINE_CHUNK + 1;
+	chunks = new cacheLine*[maxChunks];
+	chunkCells = new wxString*[maxChunks];
+
+	index.Alloc(initialLines);
+	index.Add(-1, initialLines);
 }
 
 
 
 cacheLinePool::~cacheLinePool()
 {
-	if (ptr)
+	while (nChunks--)
 	{
-		while (anzLines--)
-		{
-			if (ptr[anzLines])
-				delete ptr[anzLines];
-		}
-		delete[] ptr;
+		delete[] chunks[nChunks];
+		delete[] chunkCells[nChunks];
 	}
+	delete[] chunks;
+	delete[] chunkCells;
 }
 
 
 
 void cacheLinePool::Delete(int lineNo)
 {
-	if (ptr && lineNo >= 0 && lineNo < anzLines)
+	Compact(lineNo);
+
+	if (lineNo >= 0 && lineNo < (int)index.GetCount())
 	{
-#if 1
-		if (ptr[lineNo])
-			delete ptr[lineNo];
+		int slot = index[lineNo];
 
-		if (lineNo < anzLines - 1)
+		// Leave a tombstone: the line is cleared and its slot will be
+		// reused. The index entries behind it move when one of them is
+		// needed next.
+		if (slot >= 0)
 		{
-			// beware: overlapping copy
-			memmove(ptr + lineNo, ptr + lineNo + 1, sizeof(cacheLine *) * (anzLines - lineNo - 1));
+			cacheLine *line = Slot(slot);
+			for (int i = 0 ; i < nCols ; i++)
+				line->cells[i].Clear();
+			line->cols = 0;
+			line->stored = false;
+			line->readOnly = false;
+
+			freeSlots.Add(slot);
 		}
-#else
-		cacheLine *c;
-		c = ptr[0];
-		ptr[0] = ptr[1];
-		ptr[1] = c;
-#endif
-		ptr[anzLines - 1] = 0;
+		index[lineNo] = -2;
+		firstTombstone = lineNo;
 	}
 }
 
 
-cacheLine *cacheLinePool::Get(int lineNo)
+void cacheLinePool::Compact()
 {
-	if (lineNo < 0) return 0;
+	size_t i, line = firstTombstone;
 
-	if (lineNo >= anzLines)
+	for (i = firstTombstone ; i < index.GetCount() ; i++)
 	{
-		cacheLine **old = ptr;
-		int oldAnz = anzLines;
-		anzLines = lineNo + 100;
-		ptr = new cacheLine*[anzLines];
-		if (!ptr)
-		{
-			anzLines = 0;
-			wxLogError(__("Out of Memory for cacheLinePool"));
-		}
-		else
-		{
-			if (oldAnz)
-			{
-				memcpy(ptr, old, sizeof(cacheLine *)*oldAnz);
-				delete[] old;
-			}
-			memset(ptr + oldAnz, 0, anzLines - oldAnz);
-		}
+		if (index[i] != -2)
+			index[line++] = index[i];
 	}
+	index.RemoveAt(line, index.GetCount() - line);
+
+	firstTombstone = -1;
+}
+
 
-	if (lineNo < anzLines)
+int cacheLinePool::AllocSlot()
+{
+	if (!freeSlots.IsEmpty())
 	{
-		if (!ptr[lineNo])
-			ptr[lineNo] = new cacheLine();
-		return ptr[lineNo];
+		int slot = freeSlots.Last();
+		freeSlots.RemoveAt(freeSlots.GetCount() - 1);
+		return slot;
 	}
-	return 0;
+
+	if (usedSlots == nChunks * CACHELINE_CHUNK)
+	{
+		if (nChunks == maxChunks)
+		{
+			// only the chunk pointers are copied, lines never move
+			maxChunks *= 2;
+			cacheLine **newChunks = new cacheLine*[maxChunks];
+			wxString **newCells = new wxString*[maxChunks];
+			memcpy(newChunks, chunks, sizeof(cacheLine *) * nChunks);
+			memcpy(newCells, chunkCells, sizeof(wxString *) * nChunks);
+			delete[] chunks;
+			delete[] chunkCells;
+			chunks = newChunks;
+			chunkCells = newCells;
+		}
+
+		cacheLine *lines = new cacheLine[CACHELINE_CHUNK];
+		wxString *cells = new wxString[CACHELINE_CHUNK * nCols];
+		for (int i = 0 ; i < CACHELINE_CHUNK ; i++)
+			lines[i].cells = cells + i * nCols;
+
+		chunks[nChunks] = lines;
+		chunkCells[nChunks] = cells;
+		nChunks++;
+	}
+
+	return usedSlots++;
+}
+
+
+cacheLine *cacheLinePool::Get(int lineNo)
+{
+	if (lineNo < 0) return 0;
+
+	Compact(lineNo);
+
+	if (lineNo >= (int)index.GetCount())
+		index.Add(-1, lineNo + 1 - index.GetCount());
+
+	if (index[lineNo] < 0)
+		index[lineNo] = AllocSlot();
+
+	return Slot(index[lineNo]);
 }
 
 
 bool cacheLinePool::IsFilled(int lineNo)
 {
-	return (lineNo < anzLines && ptr[lineNo]);
+	Compact(lineNo);
+
+	return (lineNo >= 0 && lineNo < (int)index.GetCount() && index[lineNo] >= 0);
 }
 
 
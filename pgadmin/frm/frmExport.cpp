@@ -14,9 +14,12 @@
 // App headers
 #include "pgAdmin3.h"
 #include <wx/file.h>
+#include <wx/progdlg.h>
+#include <wx/regex.h>
 #include "frm/frmExport.h"
 #include "utils/sysSettings.h"
 #include "utils/misc.h"
+#include "utils/pgDefs.h"
 #include "ctl/ctlSQLResult.h"
 
 #define txtFilename     CTRL_TEXT("txtFilename")
@@ -32,6 +35,9 @@
 #define cbColSeparator  CTRL_COMBOBOX("cbColSeparator")
 #define cbQuoteChar     CTRL_COMBOBOX("cbQuoteChar")
 
+// Size of the buffer collecting the rows sent by COPY before writing them
+#define EXPORT_BUFFER_SIZE  (1024 * 1024)
+
 
 BEGIN_EVENT_TABLE(frmExport, pgDialog)
 	EVT_TEXT(XRCID("txtFilename"),          frmExport::OnChange)
@@ -298,6 +304,451 @@ bool frmExport::Export(pgSet *set)
 }
 
 
+// Check whether the query and the chosen options can be handled by COPY,
+// and build the COPY statement. The query is only prepared here, to learn
+// the names and types of its columns.
+bool frmExport::PrepareCopy(pgConn *conn, const wxString &query)
+{
+	copyQuery = wxEmptyString;
+
+	if (!conn || !conn->BackendMinimumVersion(8, 2) || rbQuoteNone->GetValue())
+		return false;
+
+	// COPY only takes single byte separators and quotes
+	wxString sep = cbColSeparator->GetValue();
+	wxString qc = cbQuoteChar->GetValue();
+	if (sep.Length() != 1 || qc.Length() != 1 || sep == qc || !sep.IsAscii() || !qc.IsAscii())
+		return false;
+
+	wxString sql = query.Strip(wxString::both);
+	while (sql.EndsWith(wxT(";")))
+		sql = sql.RemoveLast().Strip(wxString::trailing);
+
+	wxString first = sql.BeforeFirst(' ').BeforeFirst('\n').BeforeFirst('\t').BeforeFirst('(').Upper();
+	if (first != wxT("SELECT") && first != wxT("VALUES") && first != wxT("TABLE") && first != wxT("WITH"))
+		return false;
+
+	// A failure must not abort the transaction the query runs in
+	bool inTransaction = (conn->GetTxStatus() != PGCONN_TXSTATUS_IDLE);
+	if (inTransaction && !conn->ExecuteVoid(wxT("SAVEPOINT pgadmin_export"), false))
+		return false;
+
+	PGresult *res = PQprepare(conn->connection(), "", sql.mb_str(*conn->GetConv()), 0, NULL);
+	bool ok = (PQresultStatus(res) == PGRES_COMMAND_OK);
+	PQclear(res);
+
+	wxArrayString names, quoted, columns;
+	wxArrayLong types, unquotedTypes;
+	if (ok)
+	{
+		res = PQdescribePrepared(conn->connection(), "");
+		ok = (PQresultStatus(res) == PGRES_COMMAND_OK);
+
+		if (ok)
+		{
+			wxString oids;
+			for (int col = 0 ; col < PQnfields(res) ; col++)
+			{
+				wxString name(PQfname(res, col), *conn->GetConv());
+
+				// Columns can only be told apart by their names
+				if (names.Index(name) != wxNOT_FOUND)
+				{
+					ok = false;
+					break;
+				}
+				names.Add(name);
+				types.Add(PQftype(res, col));
+				oids += (col ? wxT(", ") : wxT("")) + NumToStr((long)PQftype(res, col));
+			}
+			PQclear(res);
+			ok = ok && names.GetCount() > 0;
+
+			// Same test as for the columns of a result set: only numbers and
+			// booleans are left unquoted
+			if (ok && !rbQuoteAll->GetValue())
+			{
+				pgSet *set = conn->ExecuteSet(
+				                 wxT("SELECT oid, CASE WHEN typbasetype=0 THEN oid else typbasetype END AS basetype\n")
+				                 wxT("  FROM pg_type WHERE oid IN (") + oids + wxT(")"), false);
+				while (set && !set->Eof())
+				{
+					switch (set->GetLong(1))
+					{
+						case PGOID_TYPE_BOOL:
+						case PGOID_TYPE_INT8:
+						case PGOID_TYPE_INT2:
+						case PGOID_TYPE_INT4:
+						case PGOID_TYPE_OID:
+						case PGOID_TYPE_XID:
+						case PGOID_TYPE_TID:
+						case PGOID_TYPE_CID:
+						case PGOID_TYPE_FLOAT4:
+						case PGOID_TYPE_FLOAT8:
+						case PGOID_TYPE_MONEY:
+						case PGOID_TYPE_BIT:
+						case PGOID_TYPE_NUMERIC:
+							unquotedTypes.Add(set->GetLong(0));
+							break;
+					}
+					set->MoveNext();
+				}
+				delete set;
+			}
+
+			for (size_t i = 0 ; ok && i < names.GetCount() ; i++)
+			{
+				wxString name = qtIdent(names[i]);
+				if (unquotedTypes.Index((long)types[i]) == wxNOT_FOUND)
+				{
+					quoted.Add(name);
+
+					// COPY never quotes NULLs, the grid export writes them as
+					// quoted empty strings
+					columns.Add(wxT("coalesce(q.") + name + wxT("::text, '') AS ") + name);
+				}
+				else
+					columns.Add(wxT("q.") + name);
+			}
+		}
+		else
+			PQclear(res);
+	}
+
+	if (inTransaction)
+	{
+		conn->ExecuteVoid(wxT("ROLLBACK TO SAVEPOINT pgadmin_export"), false);
+		conn->ExecuteVoid(wxT("RELEASE SAVEPOINT pgadmin_export"), false);
+	}
+
+	if (!ok)
+		return false;
+
+	wxString forceQuote, selectList;
+	for (size_t i = 0 ; i < quoted.GetCount() ; i++)
+	{
+		if (i)
+			forceQuote += wxT(", ");
+		forceQuote += quoted[i];
+	}
+	for (size_t i = 0 ; i < columns.GetCount() ; i++)
+	{
+		if (i)
+			selectList += wxT(", ");
+		selectList += columns[i];
+	}
+
+	// NULLs are quoted by wrapping the query, which would change the order
+	// of its rows and cannot be done with the data-modifying statements a
+	// WITH query may hold: those are exported row by row instead
+	if (!quoted.IsEmpty())
+	{
+		wxRegEx orderBy(wxT("ORDER[[:space:]]+BY"), wxRE_EXTENDED | wxRE_ICASE);
+		if (first == wxT("WITH") || orderBy.Matches(sql))
+			return false;
+
+		sql = wxT("SELECT ") + selectList + wxT(" FROM (") + sql + wxT(") q");
+	}
+
+	copyQuery = wxT("COPY (") + sql + wxT(") TO STDOUT");
+	if (conn->BackendMinimumVersion(9, 0))
+	{
+		copyQuery += wxT(" WITH (FORMAT csv");
+		if (chkColnames->GetValue())
+			copyQuery += wxT(", HEADER true");
+		copyQuery += wxT(", DELIMITER ") + conn->qtDbString(sep)
+		             + wxT(", QUOTE ") + conn->qtDbString(qc);
+		if (!forceQuote.IsEmpty())
+			copyQuery += wxT(", FORCE_QUOTE (") + forceQuote + wxT(")");
+		copyQuery += wxT(")");
+	}
+	else
+	{
+		copyQuery += wxT(" WITH CSV");
+		if (chkColnames->GetValue())
+			copyQuery += wxT(" HEADER");
+		copyQuery += wxT(" DELIMITER AS ") + conn->qtDbString(sep)
+		             + wxT(" QUOTE AS ") + conn->qtDbString(qc);
+		if (!forceQuote.IsEmpty())
+			copyQuery += wxT(" FORCE QUOTE ") + forceQuote;
+	}
+
+	return true;
+}
+
+
+bool frmExport::ExportCopy(pgConn *conn, long &rows, bool &fallback)
+{
+	rows = 0;
+	fallback = false;
+
+	if (copyQuery.IsEmpty())
+		return false;
+
+	wxLogInfo(wxT("Exporting data with COPY"));
+
+	// The query must still be runnable in the transaction if COPY fails
+	bool inTransaction = (conn->GetTxStatus() != PGCONN_TXSTATUS_IDLE);
+	if (inTransaction && !conn->ExecuteVoid(wxT("SAVEPOINT pgadmin_export"), false))
+	{
+		fallback = true;
+		return false;
+	}
+
+	exportCopyThread *thread = new exportCopyThread(conn, copyQuery, txtFilename->GetValue(),
+	        rbUnicode->GetValue(), rbCRLF->GetValue(), chkColnames->GetValue());
+
+	if (thread->Create() != wxTHREAD_NO_ERROR || thread->Run() != wxTHREAD_NO_ERROR)
+	{
+		delete thread;
+		wxLogError(_("Failed to start the data export."));
+		return false;
+	}
+
+	wxProgressDialog progress(_("Export data"), _("Writing data."), 100, parent,
+	                          wxPD_APP_MODAL | wxPD_CAN_ABORT | wxPD_ELAPSED_TIME);
+
+	wxLongLong bytes;
+	while (thread->IsRunning())
+	{
+		wxMilliSleep(100);
+
+		thread->GetProgress(rows, bytes);
+		wxString msg = wxString::Format(wxPLURAL("%ld row written", "%ld rows written", rows), rows)
+		               + wxT(" (") + wxFileName::GetHumanReadableSize(wxULongLong(bytes.GetValue())) + wxT(").");
+
+		if (!progress.Pulse(msg) && !thread->IsCancelled())
+			thread->Cancel();
+	}
+	thread->Wait();
+	thread->GetProgress(rows, bytes);
+
+	bool done = thread->Succeeded();
+	long skipped = thread->GetSkipped();
+	fallback = !done && thread->FailedBeforeData();
+
+	if (fallback)
+		wxLogInfo(wxT("COPY failed, exporting the rows of the query: %s"), thread->GetError().c_str());
+	else if (!done && !thread->IsCancelled())
+		wxLogError(wxT("%s"), thread->GetError().c_str());
+
+	delete thread;
+
+	if (inTransaction)
+	{
+		if (!done)
+			conn->ExecuteVoid(wxT("ROLLBACK TO SAVEPOINT pgadmin_export"), false);
+		conn->ExecuteVoid(wxT("RELEASE SAVEPOINT pgadmin_export"), false);
+	}
+
+	if (!done)
+		return false;
+
+	if (skipped)
+		wxLogError(wxPLURAL(
+		               "Data export incomplete.\n\n%d row contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
+		               "Data export incomplete.\n\n%d rows contained characters that could not be converted to the local charset.\n\nPlease correct the data or try using UTF8 instead.",
+		               skipped), skipped);
+	else
+		wxMessageBox(_("Data export completed successfully."), _("Export data"), wxICON_INFORMATION | wxOK);
+
+	return true;
+}
+
+
+exportCopyThread::exportCopyThread(pgConn *conn, const wxString &query, const wxString &_filename,
+                                   bool _unicode, bool _crlf, bool _header)
+	: wxThread(wxTHREAD_JOINABLE), connection(conn), copyQuery(query), filename(_filename),
+	  unicode(_unicode), crlf(_crlf), header(_header), bufferFill(0), rowsWritten(0), skipped(0),
+	  bytesWritten(0), cancelled(false), succeeded(false), serverFailed(false)
+{
+	buffer = new char[EXPORT_BUFFER_SIZE];
+
+	// Created here, so that Cancel() can be used as soon as the thread runs
+	cancelConn = PQgetCancel(connection->connection());
+}
+
+
+exportCopyThread::~exportCopyThread()
+{
+	if (cancelConn)
+		PQfreeCancel(cancelConn);
+	delete[] buffer;
+}
+
+
+void exportCopyThread::Cancel()
+{
+	cancelled = true;
+	CancelQuery();
+}
+
+
+void exportCopyThread::CancelQuery()
+{
+	char errbuf[256];
+
+	if (cancelConn)
+		PQcancel(cancelConn, errbuf, sizeof(errbuf));
+}
+
+
+void exportCopyThread::GetProgress(long &rows, wxLongLong &bytes)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	rows = rowsWritten;
+	bytes = bytesWritten;
+}
+
+
+bool exportCopyThread::Flush()
+{
+	if (bufferFill && file.Write(buffer, bufferFill) != bufferFill)
+	{
+		error = wxString::Format(_("Failed to write to file %s."), filename.c_str());
+		return false;
+	}
+	bufferFill = 0;
+	return true;
+}
+
+
+// Rows arrive in the connection encoding: they are written as they are
+// unless they have to be converted to the encoding of the file
+bool exportCopyThread::WriteRow(const char *data, int len)
+{
+	wxMBConv *conv = connection->GetConv();
+	wxCharBuffer converted;
+
+	if (unicode ? conv != &wxConvUTF8 : conv != &wxConvLibc)
+	{
+		wxString str(data, *conv, len);
+		converted = str.mb_str(unicode ? (wxMBConv &)wxConvUTF8 : (wxMBConv &)wxConvLibc);
+		if (!converted)
+		{
+			wxCriticalSectionLocker lock(progressLock);
+			if (header)
+				header = false;
+			else
+				skipped++;
+			return true;
+		}
+		data = converted;
+		len = strlen(data);
+	}
+
+	// COPY ends each row with a single LF
+	bool addCr = crlf && len > 0 && data[len - 1] == '\n';
+	size_t needed = len + (addCr ? 1 : 0);
+
+	if (bufferFill + needed > EXPORT_BUFFER_SIZE && !Flush())
+		return false;
+
+	if (needed > EXPORT_BUFFER_SIZE)
+	{
+		if (file.Write(data, len) != (size_t)len)
+		{
+			error = wxString::Format(_("Failed to write to file %s."), filename.c_str());
+			return false;
+		}
+		if (addCr && !Flush())
+			return false;
+	}
+	else
+	{
+		if (addCr)
+		{
+			memcpy(buffer + bufferFill, data, len - 1);
+			bufferFill += len - 1;
+			buffer[bufferFill++] = '\r';
+			buffer[bufferFill++] = '\n';
+		}
+		else
+		{
+			memcpy(buffer + bufferFill, data, len);
+			bufferFill += len;
+		}
+	}
+
+	wxCriticalSectionLocker lock(progressLock);
+	if (header)
+		header = false;
+	else
+		rowsWritten++;
+	bytesWritten += (long)needed;
+
+	return true;
+}
+
+
+void *exportCopyThread::Entry()
+{
+	PGconn *conn = connection->connection();
+
+	if (!file.Open(filename, wxFile::write))
+	{
+		error = wxString::Format(_("Failed to open file %s."), filename.c_str());
+		return NULL;
+	}
+
+	wxLogSql(wxT("COPY query (%s:%d): %s"), connection->GetHost().c_str(), connection->GetPort(), copyQuery.c_str());
+
+	PGresult *res = PQexec(conn, copyQuery.mb_str(*connection->GetConv()));
+	if (PQresultStatus(res) != PGRES_COPY_OUT)
+	{
+		error = wxString(PQresultErrorMessage(res), *connection->GetConv());
+		serverFailed = true;
+		PQclear(res);
+		file.Close();
+		return NULL;
+	}
+	PQclear(res);
+
+	// Stop writing on the first failure, but read the whole stream: the
+	// connection is not usable before
+	bool writing = true, stopped = false;
+	char *buf;
+	int len;
+	while ((len = PQgetCopyData(conn, &buf, 0)) > 0)
+	{
+		if (writing && !cancelled)
+			writing = WriteRow(buf, len);
+		PQfreemem(buf);
+
+		// No need to go on sending the data
+		if (!writing && !stopped)
+		{
+			CancelQuery();
+			stopped = true;
+		}
+	}
+
+	if (len == -2 && error.IsEmpty())
+	{
+		error = wxString(PQerrorMessage(conn), *connection->GetConv());
+		serverFailed = true;
+	}
+
+	while ((res = PQgetResult(conn)) != NULL)
+	{
+		if (PQresultStatus(res) != PGRES_COMMAND_OK && error.IsEmpty())
+		{
+			error = wxString(PQresultErrorMessage(res), *connection->GetConv());
+			serverFailed = true;
+		}
+		PQclear(res);
+	}
+
+	if (writing && !Flush())
+		writing = false;
+	file.Close();
+
+	succeeded = writing && !cancelled && error.IsEmpty();
+
+	return NULL;
+}
+
+
 void frmExport::OnCancel(wxCommandEvent &ev)
 {
 	if (IsModal())
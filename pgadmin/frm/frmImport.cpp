@@ -14,6 +14,16 @@
 #include <wx/wx.h>
 #include <wx/settings.h>
 #include <wx/filepicker.h>
+#include <wx/datetime.h>
+#include <wx/wfstream.h>
+#include <wx/zstream.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+#ifndef __WXMSW__
+#include <poll.h>
+#endif
 
 
 // App headers
@@ -29,6 +39,13 @@
 // Icons
 #include "images/reload.pngc"
 
+// Size of each of the two buffers the file is read into
+#define IMPORT_BUFFER_SIZE            (256 * 1024)
+
+// Resolution of the gauge, and how often it is refreshed (ms)
+#define IMPORT_GAUGE_RANGE            1000
+#define IMPORT_REFRESH                250
+
 
 #define nbNotebook                    CTRL_NOTEBOOK("nbNotebook")
 #define pickerImportfile              CTRL_FILEPICKER("pickerImportfile")
@@ -41,6 +58,7 @@
 #define cbEscape                      CTRL_COMBOBOX("cbEscape")
 #define txtNull                       CTRL_TEXT("txtNull")
 #define gauge                         CTRL_GAUGE("gauge")
+#define stProgress                    CTRL_STATIC("stProgress")
 #define lstColumnsToImport			  CTRL_CHECKLISTBOX("lstColumnsToImport")
 #define lstIgnoreForColumns			  CTRL_CHECKLISTBOX("lstIgnoreForColumns")
 
@@ -49,15 +67,21 @@ BEGIN_EVENT_TABLE(frmImport, pgDialog)
 	EVT_COMBOBOX(XRCID("cbFormat"),   frmImport::OnChangeFormat)
 	EVT_BUTTON(wxID_OK,               frmImport::OnOK)
 	EVT_BUTTON (wxID_HELP,            frmImport::OnHelp)
+	EVT_BUTTON (wxID_CANCEL,          frmImport::OnCancel)
+	EVT_CLOSE(                        frmImport::OnClose)
+	EVT_TIMER(wxID_ANY,               frmImport::OnTimer)
 END_EVENT_TABLE()
 
 
 frmImport::frmImport(frmMain *form, pgObject *_object, pgConn *_conn)
+	: timer(this)
 {
 	// Initialize variables
 	connection = _conn;
 	object = _object;
 	done = false;
+	reader = NULL;
+	copyThread = NULL;
 
 	// Set-up window
 	SetFont(settings->GetSystemFont());
@@ -135,6 +159,7 @@ frmImport::frmImport(frmMain *form, pgObject *_object, pgConn *_conn)
 
 frmImport::~frmImport()
 {
+	StopImport();
 	SavePosition();
 }
 
@@ -161,11 +186,6 @@ void frmImport::OnOK(wxCommandEvent &ev)
 	wxString columnsToIgnoreForNulls = wxEmptyString;
 	bool allColumnsToImport = true;
 	bool someColumnsToIgnoreForNulls = false;
-	wxFileName fn;
-	wxFile *file;
-	bool copydone = false;
-	bool goterror = false;
-	int nCount = 8192;
 
 	if (!done)
 	{
@@ -276,83 +296,505 @@ void frmImport::OnOK(wxCommandEvent &ev)
 			return;
 		}
 
-		// Open CSV file
-		fn = wxFileName(pickerImportfile->GetPath());
-		file = new wxFile(fn.GetFullPath(), wxFile::read);
+		// The file is read ahead in its own thread while the data is sent
+		reader = new importReaderThread(pickerImportfile->GetPath());
+		if (!reader->IsOk())
+		{
+			wxLogError(wxT("%s"), reader->GetError().c_str());
+			delete reader;
+			reader = NULL;
+			return;
+		}
 
-		// Set range for gauge
-		gauge->SetRange(file->Length());
+		// Rows are only counted for the text formats
+		copyThread = new importCopyThread(connection, query, reader, cbFormat->GetValue() != wxT("binary"));
 
-		// Start COPY
-		if (!connection->StartCopy(query))
+		if (reader->Create() != wxTHREAD_NO_ERROR || reader->Run() != wxTHREAD_NO_ERROR)
 		{
-			goterror = true;
+			delete copyThread;
+			copyThread = NULL;
+			delete reader;
+			reader = NULL;
+			wxLogError(_("Failed to start the data import."));
+			return;
 		}
-
-		// Send COPY data
-		while (!copydone && !goterror)
+		if (copyThread->Create() != wxTHREAD_NO_ERROR || copyThread->Run() != wxTHREAD_NO_ERROR)
 		{
-			// Read a buffer
-			char *buffer = new char[nCount + 4];
-			memset(buffer, 0, nCount + 4);
-			off_t len = file->Read(buffer, nCount);
+			delete copyThread;
+			copyThread = NULL;
+			StopImport();
+			wxLogError(_("Failed to start the data import."));
+			return;
+		}
 
-			// If we read something, send it to the server
-			if (len > 0)
-			{
-				if (!connection->PutCopyData(buffer, len))
-				{
-					goterror = true;
-				}
-				else
-				{
-					gauge->SetValue(gauge->GetValue() + len);
-					Update();
-				}
-			}
+		wxLogInfo(wxT("Importing %s file %s"), reader->IsCompressed() ? wxT("compressed") : wxT("plain"),
+		          pickerImportfile->GetPath().c_str());
 
-			// If we read nothing, we're done
-			copydone = len == 0;
+		gauge->SetRange(IMPORT_GAUGE_RANGE);
+		gauge->SetValue(0);
+		stProgress->SetLabel(wxEmptyString);
+		btnOK->Disable();
 
-			// Clean the buffer
-			delete[] buffer;
-		}
+		stopWatch.Start();
+		timer.Start(IMPORT_REFRESH);
+	}
+	else
+	{
+		Close();
+	}
+}
 
-		// Close CSV file
-		file->Close();
 
-		// End COPY
-		if (goterror)
-		{
-			connection->EndPutCopy(_("Copy failed!"));
-		}
+void frmImport::OnCancel(wxCommandEvent &ev)
+{
+	StopImport();
+	pgDialog::OnCancel(ev);
+}
+
+
+void frmImport::OnClose(wxCloseEvent &ev)
+{
+	StopImport();
+	pgDialog::OnClose(ev);
+}
+
+
+void frmImport::OnTimer(wxTimerEvent &ev)
+{
+	if (!copyThread)
+		return;
+
+	if (copyThread->IsRunning())
+		ShowProgress();
+	else
+		ImportDone();
+}
+
+
+// Aborts a running import, the COPY is rolled back. Both threads, if
+// there, have been started.
+void frmImport::StopImport()
+{
+	timer.Stop();
+
+	if (copyThread)
+	{
+		copyThread->Cancel();
+		copyThread->Wait();
+		delete copyThread;
+		copyThread = NULL;
+	}
+
+	if (reader)
+	{
+		reader->Stop();
+		reader->Wait();
+		delete reader;
+		reader = NULL;
+	}
+}
+
+
+void frmImport::ShowProgress()
+{
+	wxLongLong bytes, rows;
+	copyThread->GetProgress(bytes, rows);
+
+	wxFileOffset length = reader->GetFileLength();
+	wxFileOffset position = reader->GetFilePosition();
+	long elapsed = stopWatch.Time();
+
+	if (length > 0)
+		gauge->SetValue((int)(position * IMPORT_GAUGE_RANGE / length));
+
+	if (elapsed <= 0)
+		return;
+
+	// Throughput is that of the data sent, the remaining time is estimated
+	// from the position in the (possibly compressed) file
+	wxString msg = wxFileName::GetHumanReadableSize(wxULongLong((bytes * 1000 / elapsed).GetValue())) + wxT("/s");
+	if (rows > 0)
+		msg += wxString::Format(_(", %ld rows/s"), (rows * 1000 / elapsed).ToLong());
+	if (position > 0 && position < length)
+	{
+		wxFileOffset remaining = (length - position) * elapsed / position;
+		msg += wxString::Format(_(", %s remaining"),
+		                        wxTimeSpan::Milliseconds(wxLongLong(remaining)).Format(wxT("%H:%M:%S")).c_str());
+	}
+
+	stProgress->SetLabel(msg);
+}
+
+
+void frmImport::ImportDone()
+{
+	timer.Stop();
+
+	wxLongLong bytes, rows;
+	copyThread->GetProgress(bytes, rows);
+	copyThread->Wait();
+	reader->Wait();
+
+	bool goterror = !copyThread->Succeeded();
+	wxString error = reader->GetError();
+	if (error.IsEmpty())
+		error = copyThread->GetError();
+
+	delete copyThread;
+	copyThread = NULL;
+	delete reader;
+	reader = NULL;
+
+	btnOK->Enable();
+
+	if (goterror)
+	{
+		gauge->SetValue(0);
+		stProgress->SetLabel(wxEmptyString);
+		wxLogError(_("Copy failed!\n") + error);
+	}
+	else
+	{
+		gauge->SetValue(IMPORT_GAUGE_RANGE);
+
+		wxString msg = wxFileName::GetHumanReadableSize(wxULongLong(bytes.GetValue()));
+		if (rows > 0)
+			msg += wxT(", ") + wxString::Format(wxPLURAL("%ld row", "%ld rows", rows.ToLong()), rows.ToLong());
+		msg += wxString::Format(_(" imported in %s"),
+		                        wxTimeSpan::Milliseconds(stopWatch.Time()).Format(wxT("%H:%M:%S")).c_str());
+		stProgress->SetLabel(msg);
+
+		btnOK->SetLabel(wxT("Done"));
+		done = true;
+	}
+}
+
+
+importReaderThread::importReaderThread(const wxString &_filename)
+	: wxThread(wxTHREAD_JOINABLE), filename(_filename), file(NULL), stream(NULL), compressed(false),
+	  fileLength(0), filePosition(0), bufferCond(bufferLock), nextBuffer(0), finished(false), stopped(false)
+{
+	for (int i = 0; i < 2; i++)
+	{
+		buffers[i] = NULL;
+		bufferLen[i] = 0;
+		bufferFull[i] = false;
+	}
+
+	file = new wxFileInputStream(filename);
+	if (!file->IsOk())
+	{
+		error = wxString::Format(_("Failed to open file %s."), filename.c_str());
+		return;
+	}
+	fileLength = file->GetLength();
+
+	// gzip files are recognized by their magic number and decompressed
+	// on the fly
+	unsigned char magic[2];
+	if (file->Read(magic, sizeof(magic)).LastRead() == sizeof(magic)
+	        && magic[0] == 0x1f && magic[1] == 0x8b && wxZlibInputStream::CanHandleGZip())
+		compressed = true;
+	file->SeekI(0);
+
+	if (compressed)
+		stream = new wxZlibInputStream(*file, wxZLIB_GZIP);
+	else
+		stream = file;
+
+	buffers[0] = new char[IMPORT_BUFFER_SIZE];
+	buffers[1] = new char[IMPORT_BUFFER_SIZE];
+}
+
+
+importReaderThread::~importReaderThread()
+{
+	if (stream != file)
+		delete stream;
+	delete file;
+	delete[] buffers[0];
+	delete[] buffers[1];
+}
+
+
+const char *importReaderThread::NextBuffer(size_t &len)
+{
+	wxMutexLocker lock(bufferLock);
+
+	while (!bufferFull[nextBuffer] && !finished && !stopped)
+		bufferCond.Wait();
+
+	if (!bufferFull[nextBuffer] || stopped)
+		return NULL;
+
+	len = bufferLen[nextBuffer];
+	return buffers[nextBuffer];
+}
+
+
+void importReaderThread::ReleaseBuffer()
+{
+	wxMutexLocker lock(bufferLock);
+
+	bufferFull[nextBuffer] = false;
+	nextBuffer = 1 - nextBuffer;
+	bufferCond.Broadcast();
+}
+
+
+void importReaderThread::Stop()
+{
+	wxMutexLocker lock(bufferLock);
+
+	stopped = true;
+	bufferCond.Broadcast();
+}
+
+
+wxFileOffset importReaderThread::GetFilePosition()
+{
+	wxMutexLocker lock(bufferLock);
+	return filePosition;
+}
+
+
+size_t importReaderThread::Fill(char *buffer)
+{
+	stream->Read(buffer, IMPORT_BUFFER_SIZE);
+
+	if (stream->GetLastError() == wxSTREAM_READ_ERROR)
+	{
+		if (compressed)
+			error = wxString::Format(_("Failed to decompress file %s."), filename.c_str());
 		else
-		{
-			goterror = !connection->EndPutCopy(wxT(""));
-		}
+			error = wxString::Format(_("Failed to read file %s."), filename.c_str());
+		return 0;
+	}
 
-		// Get final status of the COPY command
-		if (!connection->GetCopyFinalStatus())
-		{
-			goterror = true;
-		}
+	return stream->LastRead();
+}
+
+
+void *importReaderThread::Entry()
+{
+	int current = 0;
 
-		if (goterror)
+	while (true)
+	{
 		{
-			wxLogError(_("Copy failed!\n") + connection->GetLastError());
+			wxMutexLocker lock(bufferLock);
+			while (bufferFull[current] && !stopped)
+				bufferCond.Wait();
+			if (stopped)
+				break;
 		}
-		else
+
+		// The sender does not touch an empty buffer: fill it unlocked
+		size_t len = Fill(buffers[current]);
+
+		wxMutexLocker lock(bufferLock);
+		filePosition = file->TellI();
+
+		if (len == 0)
 		{
-			btnOK->SetLabel(wxT("Done"));
-			done = true;
+			finished = true;
+			bufferCond.Broadcast();
+			break;
 		}
+
+		bufferLen[current] = len;
+		bufferFull[current] = true;
+		bufferCond.Broadcast();
+
+		current = 1 - current;
 	}
+
+	return NULL;
+}
+
+
+importCopyThread::importCopyThread(pgConn *conn, const wxString &query, importReaderThread *_reader, bool _countRows)
+	: wxThread(wxTHREAD_JOINABLE), connection(conn), copyQuery(query), reader(_reader),
+	  countRows(_countRows), bytesSent(0), rowsSent(0), cancelled(false), succeeded(false)
+{
+}
+
+
+importCopyThread::~importCopyThread()
+{
+}
+
+
+void importCopyThread::GetProgress(wxLongLong &bytes, wxLongLong &rows)
+{
+	wxCriticalSectionLocker lock(progressLock);
+	bytes = bytesSent;
+	rows = rowsSent;
+}
+
+
+// Waits until the server accepts more data or has sent something. The wait
+// is short, so that a cancellation is noticed even if the server stalls.
+bool importCopyThread::WaitForSocket()
+{
+	PGconn *conn = connection->connection();
+	int sock = PQsocket(conn);
+	bool readable;
+
+	if (sock < 0)
+		return false;
+
+#ifdef __WXMSW__
+	fd_set readFds, writeFds;
+	struct timeval tv;
+
+	FD_ZERO(&readFds);
+	FD_ZERO(&writeFds);
+	FD_SET((SOCKET) sock, &readFds);
+	FD_SET((SOCKET) sock, &writeFds);
+
+	tv.tv_sec = 0;
+	tv.tv_usec = 100000;
+	readable = select(sock + 1, &readFds, &writeFds, NULL, &tv) > 0
+	           && FD_ISSET((SOCKET) sock, &readFds);
+#else
+	struct pollfd fds[1];
+
+	fds[0].fd = sock;
+	fds[0].events = POLLIN | POLLOUT;
+	fds[0].revents = 0;
+
+	readable = poll(fds, 1, 100) > 0 && (fds[0].revents & POLLIN);
+#endif
+
+	// An error sent by the server during the COPY has to be read
+	return !readable || PQconsumeInput(conn);
+}
+
+
+bool importCopyThread::SendData(const char *data, size_t len)
+{
+	PGconn *conn = connection->connection();
+	int rc;
+
+	while ((rc = PQputCopyData(conn, data, (int)len)) == 0)
+	{
+		if (cancelled || !WaitForSocket())
+			return false;
+	}
+
+	// Do not let libpq queue more than a buffer
+	while (rc == 1 && (rc = PQflush(conn)) == 1)
+	{
+		if (cancelled || !WaitForSocket())
+			return false;
+	}
+
+	if (rc < 0)
+	{
+		error = wxString(PQerrorMessage(conn), *connection->GetConv());
+		return false;
+	}
+
+	long rows = 0;
+	if (countRows)
+	{
+		const char *end = data + len;
+		for (const char *p = data; (p = (const char *)memchr(p, '\n', end - p)) != NULL; p++)
+			rows++;
+	}
+
+	wxCriticalSectionLocker lock(progressLock);
+	bytesSent += (long)len;
+	rowsSent += rows;
+
+	return true;
+}
+
+
+bool importCopyThread::EndCopy(const char *errormsg)
+{
+	PGconn *conn = connection->connection();
+	int rc;
+
+	while ((rc = PQputCopyEnd(conn, errormsg)) == 0)
+	{
+		if (!WaitForSocket())
+			return false;
+	}
+
+	while (rc == 1 && (rc = PQflush(conn)) == 1)
+	{
+		if (!WaitForSocket())
+			return false;
+	}
+
+	return rc == 0 || rc == 1;
+}
+
+
+void *importCopyThread::Entry()
+{
+	PGconn *conn = connection->connection();
+	wxMBConv *conv = connection->GetConv();
+
+	wxLogSql(wxT("COPY query (%s:%d): %s"), connection->GetHost().c_str(), connection->GetPort(), copyQuery.c_str());
+
+	PGresult *res = PQexec(conn, copyQuery.mb_str(*conv));
+	if (PQresultStatus(res) != PGRES_COPY_IN)
+	{
+		error = wxString(PQresultErrorMessage(res), *conv);
+		PQclear(res);
+		reader->Stop();
+		return NULL;
+	}
+	PQclear(res);
+
+	// Sending does not block, so a cancellation is handled promptly
+	PQsetnonblocking(conn, 1);
+
+	const char *data;
+	size_t len;
+	bool sending = true;
+	while (sending && (data = reader->NextBuffer(len)) != NULL)
+	{
+		sending = !cancelled && SendData(data, len);
+		reader->ReleaseBuffer();
+	}
+	reader->Stop();
+
+	// The reader error is set before it reports the end of the file
+	wxString readError = reader->GetError();
+
+	// Any message makes the server abort the COPY
+	bool ended;
+	if (cancelled)
+		ended = EndCopy("canceled by user");
+	else if (!readError.IsEmpty())
+		ended = EndCopy(readError.mb_str(*conv));
+	else if (!sending)
+		ended = EndCopy("import failed");
 	else
+		ended = EndCopy(NULL);
+
+	if (!ended && error.IsEmpty())
+		error = wxString(PQerrorMessage(conn), *conv);
+
+	PQsetnonblocking(conn, 0);
+
+	while ((res = PQgetResult(conn)) != NULL)
 	{
-		Close();
+		if (PQresultStatus(res) != PGRES_COMMAND_OK && error.IsEmpty())
+			error = wxString(PQresultErrorMessage(res), *conv);
+		PQclear(res);
 	}
+
+	succeeded = sending && !cancelled && readError.IsEmpty() && error.IsEmpty();
+
+	return NULL;
 }
 
+
 importFactory::importFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar) : contextActionFactory(list)
 {
 	mnu->Append(id, _("&Import..."), _("Import CSV file into a relation"));
@@ -42,6 +42,7 @@
 #include "ctl/ctlMenuToolbar.h"
 #include "ctl/ctlSQLBox.h"
 #include "db/pgConn.h"
+#include "db/pgConnector.h"
 #include "db/pgSet.h"
 #include "agent/pgaJob.h"
 #include "schema/pgDatabase.h"
@@ -104,6 +105,8 @@ frmMain::frmMain(const wxString &title)
 	: pgFrame((wxFrame *)NULL, title)
 {
 	msgLevel = 0;
+	connector = NULL;
+	reconnectTotal = reconnectDone = 0;
 	lastPluginUtility = NULL;
 	pluginUtilityCount = 0;
 	m_refreshing = false;
@@ -238,11 +241,18 @@ frmMain::frmMain(const wxString &title)
 	browser->Expand(root);
 	browser->SortChildren(root);
 	browser->SetFocus();
+
+	if (settings->GetReconnectServers())
+		ReconnectServers();
 }
 
 
 frmMain::~frmMain()
 {
+	// No more connections to hand over
+	if (connector)
+		delete connector;
+
 	// Store the servers, to ensure we store the last database/schema etc
 	StoreServers();
 
@@ -580,6 +590,10 @@ void frmMain::Refresh(pgObject *data)
 
 		browser->DeleteChildren(currentItem);
 
+		// Rows read ahead for other objects may be just as outdated
+		if (data->GetDatabase())
+			data->GetDatabase()->InvalidateCatalogSnapshot();
+
 		// refresh information about the object
 		data->SetDirty();
 
@@ -1132,6 +1146,113 @@ int frmMain::ReconnectServer(pgServer *server, bool restore)
 }
 
 
+// Connects the servers that were connected when pgAdmin was last closed.
+// The connections are opened in the background; each server is then set up
+// on its own as soon as its connection is there.
+void frmMain::ReconnectServers()
+{
+	wxTreeItemIdValue foldercookie, servercookie;
+	wxTreeItemId folderitem, serveritem;
+
+	folderitem = browser->GetFirstChild(browser->GetRootItem(), foldercookie);
+	while (folderitem)
+	{
+		serveritem = browser->GetFirstChild(folderitem, servercookie);
+		while (serveritem)
+		{
+			pgObject *object = browser->GetObject(serveritem);
+			if (object && object->IsCreatedBy(serverFactory))
+			{
+				pgServer *server = (pgServer *)object;
+				bool wasConnected = false;
+
+				if (server->GetServerIndex())
+					settings->Read(wxT("Servers/") + NumToStr(server->GetServerIndex()) + wxT("/Connected"), &wasConnected, false);
+
+				pgConnectRequest *request = NULL;
+				if (wasConnected && !server->GetConnected())
+					request = server->CreateConnectRequest();
+
+				if (request)
+				{
+					if (!connector)
+						connector = new pgConnector(this, settings->GetConnectThreads());
+					connector->Add(request);
+					reconnectTotal++;
+				}
+			}
+			serveritem = browser->GetNextChild(folderitem, servercookie);
+		}
+		folderitem = browser->GetNextChild(browser->GetRootItem(), foldercookie);
+	}
+
+	if (reconnectTotal)
+		SetStatusText(wxString::Format(_("Reconnecting %d servers..."), reconnectTotal));
+}
+
+
+void frmMain::OnServerConnected(wxCommandEvent &event)
+{
+	pgServerConnectRequest *request = (pgServerConnectRequest *)event.GetClientData();
+	pgServer *server = request->GetServer();
+	pgConn *conn = request->TakeConnection();
+
+	reconnectDone++;
+
+	// The server may have been removed or connected by hand meanwhile
+	bool found = false;
+	wxTreeItemIdValue foldercookie, servercookie;
+	wxTreeItemId folderitem = browser->GetFirstChild(browser->GetRootItem(), foldercookie);
+	while (folderitem && !found)
+	{
+		wxTreeItemId serveritem = browser->GetFirstChild(folderitem, servercookie);
+		while (serveritem && !found)
+		{
+			found = (browser->GetObject(serveritem) == server);
+			serveritem = browser->GetNextChild(folderitem, servercookie);
+		}
+		folderitem = browser->GetNextChild(browser->GetRootItem(), foldercookie);
+	}
+
+	if (found && !server->GetConnected())
+	{
+		if (conn && conn->GetStatus() == PGCONN_OK)
+		{
+			StartMsg(wxString::Format(_("Connecting to server %s"), server->GetDescription().c_str()));
+
+			server->SetConnection(conn, request->GetDatabase());
+			conn = NULL;
+
+			if (server->Connect(this, false) == PGCONN_OK)
+				server->ShowTreeDetail(browser);
+			else
+				server->Disconnect(this);
+		}
+		else
+		{
+			// Not worth a message box: the server can still be connected
+			// by hand
+			wxString error;
+			if (conn)
+				error = conn->GetLastError().Trim();
+			wxLogInfo(wxT("Could not reconnect to server %s: %s"), server->GetDescription().c_str(), error.c_str());
+		}
+	}
+
+	if (conn)
+		delete conn;
+	delete request;
+
+	if (reconnectDone < reconnectTotal)
+		SetStatusText(wxString::Format(_("Reconnected %d of %d servers..."), reconnectDone, reconnectTotal));
+	else
+	{
+		SetStatusText(wxString::Format(_("Reconnected %d servers."), reconnectTotal));
+		reconnectTotal = reconnectDone = 0;
+	}
+}
+
+
 bool frmMain::reportError(const wxString &error, const wxString &msgToIdentify, const wxString &hint)
 {
 	bool identified = false;
@@ -1220,6 +1341,7 @@ void frmMain::StoreServers()
 					settings->WriteBool(key + wxT("StorePwd"), server->GetStorePwd());
 					settings->Write(key + wxT("Rolename"), server->GetRolename());
 					settings->WriteBool(key + wxT("Restore"), server->GetRestore());
+					settings->WriteBool(key + wxT("Connected"), server->GetConnected());
 					settings->Write(key + wxT("Database"), server->GetDatabaseName());
 					settings->Write(key + wxT("Username"), server->GetUsername());
 					settings->Write(key + wxT("LastDatabase"), server->GetLastDatabase());
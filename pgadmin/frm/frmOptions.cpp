@@ -71,6 +71,7 @@
 #define radLoglevel                 CTRL_RADIOBOX("radLoglevel")
 #define txtMaxRows                  CTRL_TEXT("txtMaxRows")
 #define txtMaxColSize               CTRL_TEXT("txtMaxColSize")
+#define txtStreamMaxRows            CTRL_TEXT("txtStreamMaxRows")
 #define pickerFont                  CTRL_FONTPICKER("pickerFont")
 #define chkUnicodeFile              CTRL_CHECKBOX("chkUnicodeFile")
 #define chkWriteBOM                 CTRL_CHECKBOX("chkWriteBOM")
@@ -92,6 +93,7 @@
 #define chkAutoCommit               CTRL_CHECKBOX("chkAutoCommit")
 #define chkDoubleClickProperties    CTRL_CHECKBOX("chkDoubleClickProperties")
 #define chkShowNotices			    CTRL_CHECKBOX("chkShowNotices")
+#define chkReconnectServers         CTRL_CHECKBOX("chkReconnectServers")
 #define cbLanguage                  CTRL_COMBOBOX("cbLanguage")
 #define pickerSqlFont               CTRL_FONTPICKER("pickerSqlFont")
 #define chkSuppressHints            CTRL_CHECKBOX("chkSuppressHints")
@@ -276,6 +278,7 @@ frmOptions::frmOptions(frmMain *parent)
 	wxTextValidator numval(wxFILTER_NUMERIC);
 	txtMaxRows->SetValidator(numval);
 	txtMaxColSize->SetValidator(numval);
+	txtStreamMaxRows->SetValidator(numval);
 	txtAutoRowCount->SetValidator(numval);
 	txtIndent->SetValidator(numval);
 	txtHistoryMaxQueries->SetValidator(numval);
@@ -285,6 +288,7 @@ frmOptions::frmOptions(frmMain *parent)
 	radLoglevel->SetSelection(settings->GetLogLevel());
 	txtMaxRows->SetValue(NumToStr(settings->GetMaxRows()));
 	txtMaxColSize->SetValue(NumToStr(settings->GetMaxColSize()));
+	txtStreamMaxRows->SetValue(NumToStr(settings->GetStreamMaxRows()));
 	chkAskSaveConfirm->SetValue(!settings->GetAskSaveConfirmation());
 	chkAskDelete->SetValue(settings->GetConfirmDelete());
 	chkShowUsersForPrivileges->SetValue(settings->GetShowUsersForPrivileges());
@@ -309,6 +313,7 @@ frmOptions::frmOptions(frmMain *parent)
 	txtDecimalMark->SetValue(settings->GetDecimalMark());
 	chkColumnNames->SetValue(settings->GetColumnNames());
 	chkShowNotices->SetValue(settings->GetShowNotices());
+	chkReconnectServers->SetValue(settings->GetReconnectServers());
 
 	txtPgHelpPath->SetValue(settings->GetPgHelpPath());
 	txtEdbHelpPath->SetValue(settings->GetEdbHelpPath());
@@ -648,6 +653,7 @@ void frmOptions::OnOK(wxCommandEvent &ev)
 	// Query parameter
 	settings->SetMaxRows(StrToLong(txtMaxRows->GetValue()));
 	settings->SetMaxColSize(StrToLong(txtMaxColSize->GetValue()));
+	settings->SetStreamMaxRows(StrToLong(txtStreamMaxRows->GetValue()));
 
 	settings->SetAskSaveConfirmation(!chkAskSaveConfirm->GetValue());
 	settings->SetConfirmDelete(chkAskDelete->GetValue());
@@ -675,6 +681,7 @@ void frmOptions::OnOK(wxCommandEvent &ev)
 	settings->SetAutoCommit(chkAutoCommit->GetValue());
 	settings->SetDoubleClickProperties(chkDoubleClickProperties->GetValue());
 	settings->SetShowNotices(chkShowNotices->GetValue());
+	settings->SetReconnectServers(chkReconnectServers->GetValue());
 
 	settings->SetUnicodeFile(chkUnicodeFile->GetValue());
 	settings->SetWriteBOM(chkWriteBOM->GetValue());
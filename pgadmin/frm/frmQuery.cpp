@@ -122,6 +122,7 @@ BEGIN_EVENT_TABLE(frmQuery, pgFrame)
 	EVT_MENU(MNU_CANCEL,            frmQuery::OnCancel)
 	EVT_MENU(MNU_AUTOROLLBACK,      frmQuery::OnAutoRollback)
 	EVT_MENU(MNU_AUTOCOMMIT,        frmQuery::OnAutoCommit)
+	EVT_MENU(MNU_STREAMRESULTS,     frmQuery::OnStreamResults)
 	EVT_MENU(MNU_CONTENTS,          frmQuery::OnContents)
 	EVT_MENU(MNU_HELP,              frmQuery::OnHelp)
 	EVT_MENU(MNU_CLEARHISTORY,      frmQuery::OnClearHistory)
@@ -311,6 +312,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	eo->Append(MNU_COSTS, _("Costs"), _("Explain analyze query with (or without) costs"), wxITEM_CHECK);
 	eo->Append(MNU_BUFFERS, _("Buffers"), _("Explain analyze query with (or without) buffers"), wxITEM_CHECK);
 	eo->Append(MNU_TIMING, _("Timing"), _("Explain analyze query with (or without) timing"), wxITEM_CHECK);
+	eo->Append(MNU_EXPLAINJSON, _("JSON format"), _("Read the plan from the server in JSON format: faster for large plans, but Data Output shows it as a single JSON value"), wxITEM_CHECK);
 	queryMenu->Append(MNU_EXPLAINOPTIONS, _("Explain &options"), eo, _("Options modifying Explain output"));
 	queryMenu->AppendSeparator();
 	queryMenu->Append(MNU_SAVEHISTORY, _("Save history"), _("Save history of executed commands."));
@@ -318,6 +320,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	queryMenu->AppendSeparator();
 	queryMenu->Append(MNU_AUTOROLLBACK, _("&Auto-Rollback"), _("Rollback the current transaction if an error is detected"), wxITEM_CHECK);
 	queryMenu->Append(MNU_AUTOCOMMIT, _("&Auto-Commit"), _("Auto commit the cuurent transaction"), wxITEM_CHECK);
+	queryMenu->Append(MNU_STREAMRESULTS, _("&Stream results"), _("Show the rows of a query while they are being retrieved, up to the limit set in the options"), wxITEM_CHECK);
 	queryMenu->AppendSeparator();
 	queryMenu->Append(MNU_CANCEL, _("&Cancel\tAlt-Break"), _("Cancel query"));
 	menuBar->Append(queryMenu, _("&Query"));
@@ -374,6 +377,7 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	queryMenu->Check(MNU_COSTS, settings->GetExplainCosts());
 	queryMenu->Check(MNU_BUFFERS, settings->GetExplainBuffers());
 	queryMenu->Check(MNU_TIMING, settings->GetExplainTiming());
+	queryMenu->Check(MNU_EXPLAINJSON, settings->GetExplainJson());
 
 	UpdateRecentFiles();
 
@@ -568,6 +572,10 @@ frmQuery::frmQuery(frmMain *form, const wxString &_title, pgConn *_conn, const w
 	bVal = settings->GetAutoCommit();
 	queryMenu->Check(MNU_AUTOCOMMIT, bVal);
 
+	// Stream results
+	bVal = settings->GetStreamResults();
+	queryMenu->Check(MNU_STREAMRESULTS, bVal);
+
 	// Auto indent
 	settings->Read(wxT("frmQuery/AutoIndent"), &bVal, true);
 	editMenu->Check(MNU_AUTOINDENT, bVal);
@@ -839,6 +847,13 @@ void frmQuery::OnAutoCommit(wxCommandEvent &event)
 	settings->WriteBool(wxT("frmQuery/AutoCommit"), queryMenu->IsChecked(MNU_AUTOCOMMIT));
 }
 
+void frmQuery::OnStreamResults(wxCommandEvent &event)
+{
+	queryMenu->Check(MNU_STREAMRESULTS, event.IsChecked());
+
+	settings->SetStreamResults(queryMenu->IsChecked(MNU_STREAMRESULTS));
+}
+
 void frmQuery::OnAutoIndent(wxCommandEvent &event)
 {
 	editMenu->Check(MNU_AUTOINDENT, event.IsChecked());
@@ -1480,7 +1495,7 @@ void frmQuery::updateMenu(bool allowUpdateModelSize)
 		}
 	}
 
-	canSaveExplain = explainCanvas->GetDiagram()->GetCount() > 0;
+	canSaveExplain = !explainCanvas->IsEmpty();
 
 	if (allowUpdateModelSize)
 	{
@@ -1740,6 +1755,7 @@ void frmQuery::OnClose(wxCloseEvent &event)
 	settings->SetExplainCosts(queryMenu->IsChecked(MNU_COSTS));
 	settings->SetExplainBuffers(queryMenu->IsChecked(MNU_BUFFERS));
 	settings->SetExplainTiming(queryMenu->IsChecked(MNU_TIMING));
+	settings->SetExplainJson(queryMenu->IsChecked(MNU_EXPLAINJSON));
 
 	sqlResult->Abort();                           // to make sure conn is unused
 
@@ -2106,7 +2122,14 @@ void frmQuery::OnCancel(wxCommandEvent &event)
 	SetStatusText(_("Cancelling."), STATUSPOS_MSGS);
 
 	if (sqlResult->RunStatus() == CTLSQL_RUNNING)
+	{
+		// A streamed result keeps the rows received so far, and completes
+		// normally
+		if (sqlResult->StopStreaming())
+			return;
+
 		sqlResult->Abort();
+	}
 	else if (pgScript->IsRunning())
 		pgScript->Terminate();
 
@@ -2148,6 +2171,7 @@ void frmQuery::OnExplain(wxCommandEvent &event)
 		bool costs = queryMenu->IsChecked(MNU_COSTS);
 		bool buffers = queryMenu->IsChecked(MNU_BUFFERS) && analyze;
 		bool timing = queryMenu->IsChecked(MNU_TIMING) && analyze;
+		bool json = queryMenu->IsChecked(MNU_EXPLAINJSON);
 
 		sql += wxT("(");
 		if (analyze)
@@ -2173,6 +2197,11 @@ void frmQuery::OnExplain(wxCommandEvent &event)
 			else
 				sql += wxT(", TIMING off ");
 		}
+		// Large plans are read much faster from the structured output, but
+		// the Data Output pane then shows one JSON value rather than the
+		// text plan: off unless asked for
+		if (json)
+			sql += wxT(", FORMAT JSON");
 		sql += wxT(")");
 	}
 	else
@@ -2504,6 +2533,45 @@ void frmQuery::execQuery(const wxString &query, int resultToRetrieve, bool singl
 	if (!queryMenu->IsChecked(MNU_AUTOCOMMIT) && conn->GetTxStatus() == PQTRANS_IDLE && !isBeginNotRequired(query))
 		conn->ExecuteVoid(wxT("BEGIN;"));
 
+	// The result of a single query going to a file is streamed from the
+	// server with COPY when possible, rather than collected in memory first
+	if (toFile && isSingleStatement(query) && qi->toFileExportForm->PrepareCopy(conn, query))
+	{
+		SetStatusText(_("Writing data."), STATUSPOS_MSGS);
+
+		long rows = 0;
+		bool fallback = false;
+		bool done = qi->toFileExportForm->ExportCopy(conn, rows, fallback);
+
+		// Otherwise the rows are read and written as for any other query
+		if (!fallback)
+		{
+			timer.Stop();
+			elapsedQuery = wxGetLocalTimeMillis() - startTimeQuery;
+			SetStatusText(elapsedQuery.ToString() + wxT(" ms"), STATUSPOS_SECS);
+			SetStatusText(wxString::Format(wxPLURAL("%ld row.", "%ld rows.", rows), rows), STATUSPOS_ROWS);
+
+			if (done)
+				showMessage(wxString::Format(wxPLURAL("%ld row written to file.", "%ld rows written to file.", rows), rows),
+				            _("Data written to file."));
+			else
+				showMessage(_("Data export aborted."));
+
+			delete qi;
+			completeQuery(done, false, false);
+			return;
+		}
+
+		SetStatusText(_("Query is running."), STATUSPOS_MSGS);
+	}
+
+	// Rows can only be shown while they arrive for a single statement
+	if (queryMenu->IsChecked(MNU_STREAMRESULTS) && !toFile && !explain && !singleResult &&
+	        isSingleStatement(query))
+		sqlResult->SetStreaming(settings->GetStreamChunkRows(), settings->GetStreamMaxRows());
+	else
+		sqlResult->SetStreaming(0);
+
 	if (sqlResult->Execute(query, resultToRetrieve, this, QUERY_COMPLETE, qi) >= 0)
 	{
 		// Return and wait for the result
@@ -2513,6 +2581,17 @@ void frmQuery::execQuery(const wxString &query, int resultToRetrieve, bool singl
 	completeQuery(false, false, false);
 }
 
+// Rough check for a query string holding one statement only. A semicolon
+// inside a literal or comment makes it answer false, which is safe.
+bool frmQuery::isSingleStatement(wxString query)
+{
+	query = query.Trim();
+	if (query.EndsWith(wxT(";")))
+		query.RemoveLast();
+
+	return !query.Contains(wxT(";"));
+}
+
 bool frmQuery::isBeginNotRequired(wxString query)
 {
 	int	wordlen = 0;
@@ -2705,6 +2784,9 @@ void frmQuery::OnQueryComplete(pgQueryResultEvent &ev)
 
 	timer.Stop();
 
+	// Pick up the last chunks of a streamed result
+	sqlResult->FetchStreamedRows();
+
 	wxString str;
 	str = sqlResult->GetMessagesAndClear();
 	msgResult->AppendText(str);
@@ -3087,6 +3169,16 @@ void frmQuery::OnTimer(wxTimerEvent &event)
 		msgHistory->AppendText(str + wxT("\n"));
 	}
 
+	if (sqlResult->IsStreaming() && sqlResult->RunStatus() == CTLSQL_RUNNING)
+	{
+		sqlResult->DisplayStreamedRows();
+		long maxRows = settings->GetStreamMaxRows();
+		if (sqlResult->NumRows() && maxRows > 0)
+			SetStatusText(wxString::Format(_("Retrieving data: %ld of at most %ld rows."), sqlResult->NumRows(), maxRows), STATUSPOS_MSGS);
+		else if (sqlResult->NumRows())
+			SetStatusText(wxString::Format(wxPLURAL("Retrieving data: %ld row.", "Retrieving data: %ld rows.", sqlResult->NumRows()), sqlResult->NumRows()), STATUSPOS_MSGS);
+	}
+
 	// Increase the granularity for longer running queries
 	if (elapsedQuery > 200 && timer.GetInterval() == 10 && timer.IsRunning())
 	{
@@ -104,6 +104,8 @@ BEGIN_EVENT_TABLE(frmStatus, pgFrame)
 	EVT_LIST_COL_END_DRAG(CTL_XACTLIST,           frmStatus::OnChgColSizeXactGrid)
 
 	EVT_TIMER(TIMER_LOG_ID,                       frmStatus::OnRefreshLogTimer)
+	EVT_MENU(STATUS_SNAPSHOT_ID,                  frmStatus::OnSnapshot)
+	EVT_MENU(STATUS_LOGBATCH_ID,                  frmStatus::OnLogBatch)
 	EVT_LIST_ITEM_SELECTED(CTL_LOGLIST,           frmStatus::OnSelLogItem)
 	EVT_LIST_ITEM_DESELECTED(CTL_LOGLIST,         frmStatus::OnSelLogItem)
 
@@ -113,6 +115,291 @@ BEGIN_EVENT_TABLE(frmStatus, pgFrame)
 END_EVENT_TABLE();
 
 
+// Update a cell only when its content actually changed, so that
+// unchanged rows aren't redrawn on each refresh
+static void SetListCell(ctlListView *list, long row, int col, const wxString &value)
+{
+	if (list->GetText(row, col) != value)
+		list->SetItem(row, col, value);
+}
+
+
+statusListView::statusListView(wxWindow *p, int id)
+	: ctlListView(p, id, wxDefaultPosition, wxDefaultSize, wxLC_VIRTUAL | wxSUNKEN_BORDER)
+{
+	nCols = 0;
+	resort = RESORT_NONE;
+}
+
+
+void statusListView::BeginUpdate()
+{
+	nCols = GetColumnCount();
+	newKeys.Empty();
+	newCells.Empty();
+	newColours.Empty();
+}
+
+
+void statusListView::AppendRow(const wxString &key, const wxArrayString &rowCells, const wxColour &colour)
+{
+	wxASSERT(rowCells.GetCount() == nCols);
+
+	newKeys.Add(key);
+	for (size_t col = 0; col < nCols; col++)
+		newCells.Add(rowCells.Item(col));
+	if (colour.Ok())
+		newColours.Add((colour.Red() << 16) | (colour.Green() << 8) | colour.Blue());
+	else
+		newColours.Add(-1);
+}
+
+
+bool statusListView::RowChanged(long row) const
+{
+	if (row >= (long)keys.GetCount())
+		return true;
+	if (keys.Item(row) != newKeys.Item(row) || colours.Item(row) != newColours.Item(row))
+		return true;
+
+	for (size_t col = row * nCols; col < (row + 1) * nCols; col++)
+	{
+		if (cells.Item(col) != newCells.Item(col))
+			return true;
+	}
+	return false;
+}
+
+
+// Put the new rows whose key was shown already where they were, in the
+// order of the previous refresh, followed by the rows with a new key
+void statusListView::KeepOrder()
+{
+	long oldCount = keys.GetCount();
+	long newCount = newKeys.GetCount();
+	long row;
+
+	statusKeyHash newRowOfKey;
+	for (row = 0; row < newCount; row++)
+		newRowOfKey[newKeys.Item(row)] = row;
+
+	wxArrayLong order;
+	wxArrayShort placed;
+	order.Alloc(newCount);
+	placed.Add(0, newCount);
+	for (row = 0; row < oldCount; row++)
+	{
+		statusKeyHash::iterator it = newRowOfKey.find(keys.Item(row));
+		if (it != newRowOfKey.end() && !placed.Item(it->second))
+		{
+			order.Add(it->second);
+			placed[it->second] = 1;
+		}
+	}
+	for (row = 0; row < newCount; row++)
+	{
+		if (!placed.Item(row))
+			order.Add(row);
+	}
+
+	wxArrayString orderedKeys, orderedCells;
+	wxArrayInt orderedColours;
+	orderedKeys.Alloc(newCount);
+	orderedCells.Alloc(newCells.GetCount());
+	orderedColours.Alloc(newCount);
+	for (row = 0; row < newCount; row++)
+	{
+		long from = order.Item(row);
+		orderedKeys.Add(newKeys.Item(from));
+		for (size_t col = from * nCols; col < (from + 1) * nCols; col++)
+			orderedCells.Add(newCells.Item(col));
+		orderedColours.Add(newColours.Item(from));
+	}
+
+	newKeys = orderedKeys;
+	newCells = orderedCells;
+	newColours = orderedColours;
+}
+
+
+void statusListView::EndUpdate()
+{
+	long oldCount = keys.GetCount();
+	long newCount = newKeys.GetCount();
+	long row;
+
+	// The order of the query is only taken when the list is sorted
+	if (resort == RESORT_QUEUED)
+		resort = RESORT_NONE;
+	else
+		KeepOrder();
+
+	// Remember which rows are selected before they move
+	wxArrayString selectedKeys;
+	wxArrayLong selectedRows;
+	for (row = GetFirstSelected(); row >= 0 && row < oldCount; row = GetNextSelected(row))
+	{
+		selectedKeys.Add(keys.Item(row));
+		selectedRows.Add(row);
+	}
+
+	// Find the ranges of rows whose key or content changed
+	wxArrayLong firstChanged, lastChanged;
+	for (row = 0; row < newCount; row++)
+	{
+		if (!RowChanged(row))
+			continue;
+
+		if (lastChanged.GetCount() && lastChanged.Last() == row - 1)
+			lastChanged.Last() = row;
+		else
+		{
+			firstChanged.Add(row);
+			lastChanged.Add(row);
+		}
+	}
+
+	keys = newKeys;
+	cells = newCells;
+	colours = newColours;
+	newKeys.Empty();
+	newCells.Empty();
+	newColours.Empty();
+
+	if (newCount != oldCount)
+		SetItemCount(newCount);
+	for (size_t range = 0; range < firstChanged.GetCount(); range++)
+		RefreshItems(firstChanged.Item(range), lastChanged.Item(range));
+
+	// Move the selection along with its rows
+	if (selectedKeys.GetCount())
+	{
+		statusKeyHash rowOfKey;
+		for (row = 0; row < newCount; row++)
+			rowOfKey[keys.Item(row)] = row;
+
+		for (size_t i = 0; i < selectedRows.GetCount(); i++)
+		{
+			row = selectedRows.Item(i);
+			if (row < newCount && keys.Item(row) != selectedKeys.Item(i))
+				Select(row, false);
+		}
+		for (size_t i = 0; i < selectedKeys.GetCount(); i++)
+		{
+			statusKeyHash::iterator it = rowOfKey.find(selectedKeys.Item(i));
+			if (it != rowOfKey.end() && !IsSelected(it->second))
+				Select(it->second, true);
+		}
+	}
+}
+
+
+wxString statusListView::OnGetItemText(long item, long column) const
+{
+	if (item < 0 || item >= (long)keys.GetCount() || column >= (long)nCols)
+		return wxEmptyString;
+	return cells.Item(item * nCols + column);
+}
+
+
+int statusListView::OnGetItemImage(long item) const
+{
+	return -1;
+}
+
+
+wxListItemAttr *statusListView::OnGetItemAttr(long item) const
+{
+	if (item < 0 || item >= (long)colours.GetCount() || colours.Item(item) < 0)
+		return NULL;
+
+	int colour = colours.Item(item);
+	attr.SetBackgroundColour(wxColour((colour >> 16) & 0xff, (colour >> 8) & 0xff, colour & 0xff));
+	return &attr;
+}
+
+
+logListView::logListView(wxWindow *p, int id)
+	: ctlListView(p, id, wxDefaultPosition, wxDefaultSize, wxLC_VIRTUAL | wxSUNKEN_BORDER)
+{
+	nCols = 0;
+	first = 0;
+	count = 0;
+}
+
+
+void logListView::AppendRows(const wxArrayString &rowCells)
+{
+	if (nCols != (size_t)GetColumnCount())
+	{
+		ClearRows();
+		nCols = GetColumnCount();
+	}
+	if (!nCols)
+		return;
+
+	bool wrapped = false;
+	for (size_t cell = 0; cell + nCols <= rowCells.GetCount(); cell += nCols)
+	{
+		if (count < STATUS_LOG_MAX_ROWS)
+		{
+			for (size_t col = 0; col < nCols; col++)
+				ring.Add(rowCells.Item(cell + col));
+			count++;
+		}
+		else
+		{
+			// Overwrite the oldest row
+			for (size_t col = 0; col < nCols; col++)
+				ring[first * nCols + col] = rowCells.Item(cell + col);
+			first = (first + 1) % STATUS_LOG_MAX_ROWS;
+			wrapped = true;
+		}
+	}
+
+	SetItemCount(count);
+
+	// All rows moved up
+	if (wrapped)
+		Refresh();
+}
+
+
+void logListView::AppendRow(const wxString &text)
+{
+	wxArrayString rowCells;
+
+	rowCells.Add(text);
+	for (int col = 1; col < GetColumnCount(); col++)
+		rowCells.Add(wxEmptyString);
+	AppendRows(rowCells);
+}
+
+
+void logListView::ClearRows()
+{
+	ring.Empty();
+	first = 0;
+	count = 0;
+	SetItemCount(0);
+	Refresh();
+}
+
+
+wxString logListView::OnGetItemText(long item, long column) const
+{
+	if (item < 0 || (size_t)item >= count || column >= (long)nCols)
+		return wxEmptyString;
+	return ring.Item(((first + item) % STATUS_LOG_MAX_ROWS) * nCols + column);
+}
+
+
+int logListView::OnGetItemImage(long item) const
+{
+	return -1;
+}
+
+
 int frmStatus::cboToRate()
 {
 	int rate = 0;
@@ -173,7 +460,6 @@ wxString frmStatus::rateToCboString(int rate)
 
 frmStatus::frmStatus(frmMain *form, const wxString &_title, pgConn *conn) : pgFrame(NULL, _title)
 {
-	wxString initquery;
 	bool highlight = false;
 
 	dlgName = wxT("frmStatus");
@@ -182,7 +468,9 @@ frmStatus::frmStatus(frmMain *form, const wxString &_title, pgConn *conn) : pgFr
 
 	mainForm = form;
 	connection = conn;
-	locks_connection = conn;
+	collector = NULL;
+	lockCollector = NULL;
+	logReader = NULL;
 
 	statusTimer = 0;
 	locksTimer = 0;
@@ -192,21 +480,19 @@ frmStatus::frmStatus(frmMain *form, const wxString &_title, pgConn *conn) : pgFr
 	logHasTimestamp = false;
 	logFormatKnown = false;
 
-	// Only superusers can set these parameters...
-	pgUser *user = new pgUser(connection->GetUser());
-	if (user)
-	{
-		if (user->GetSuperuser())
-		{
-			// Make the connection quiet on the logs
-			if (connection->BackendMinimumVersion(8, 0))
-				initquery = wxT("SET log_statement='none';SET log_duration='off';SET log_min_duration_statement=-1;");
-			else
-				initquery = wxT("SET log_statement='off';SET log_duration='off';SET log_min_duration_statement=-1;");
-			connection->ExecuteVoid(initquery, false);
-		}
-		delete user;
-	}
+	// Make the connection quiet on the logs
+	SetQuietLogging(connection);
+
+	// The activity, transactions and locks lists are refreshed by
+	// collector threads, each of them on a connection of its own. If the
+	// server refuses it, the collector tries again on its next refresh.
+	collector = new statusCollector(this, OpenCollectorConnection());
+	collector->Create();
+	collector->Run();
+
+	lockCollector = new statusCollector(this, OpenCollectorConnection());
+	lockCollector->Create();
+	lockCollector->Run();
 
 	// Notify wxAUI which frame to use
 	manager.SetManagedWindow(this);
@@ -401,6 +687,26 @@ frmStatus::~frmStatus()
 	// Delete the refresh timer
 	delete refreshUITimer;
 
+	// Stop the collectors, they own their connections
+	if (collector)
+	{
+		collector->Stop();
+		collector->Wait();
+		delete collector;
+	}
+	if (lockCollector)
+	{
+		lockCollector->Stop();
+		lockCollector->Wait();
+		delete lockCollector;
+	}
+	if (logReader)
+	{
+		logReader->Stop();
+		logReader->Wait();
+		delete logReader;
+	}
+
 	// If the status window wasn't launched in standalone mode...
 	if (mainForm)
 		mainForm->RemoveFrame(this);
@@ -439,11 +745,6 @@ frmStatus::~frmStatus()
 	}
 
 	// If connection is still available, delete it
-	if (locks_connection && locks_connection != connection)
-	{
-		if (locks_connection->IsAlive())
-			delete locks_connection;
-	}
 	if (connection)
 	{
 		if (connection->IsAlive())
@@ -504,28 +805,70 @@ void frmStatus::OnExit(wxCommandEvent &event)
 
 void frmStatus::OnChangeDatabase(wxCommandEvent &ev)
 {
-	wxString initquery;
+	pgConn *lockConn = new pgConn(connection->GetHostName(), connection->GetService(), connection->GetHostAddr(), cbDatabase->GetValue(),
+	                              connection->GetUser(), connection->GetPassword(), connection->GetPort(), connection->GetRole(), connection->GetSslMode(),
+	                              0, connection->GetApplicationName(), connection->GetSSLCert(), connection->GetSSLKey(), connection->GetSSLRootCert(), connection->GetSSLCrl(),
+	                              connection->GetSSLCompression());
 
-	if (locks_connection != connection)
+	// Keep showing the locks of the previous database if this one fails
+	if (lockConn->GetStatus() != PGCONN_OK)
 	{
-		delete locks_connection;
+		wxLogError(_("Could not connect to database %s:\n%s"), cbDatabase->GetValue().c_str(), lockConn->GetLastError().c_str());
+		delete lockConn;
+		return;
 	}
 
-	locks_connection = new pgConn(connection->GetHostName(), connection->GetService(), connection->GetHostAddr(), cbDatabase->GetValue(),
-	                              connection->GetUser(), connection->GetPassword(), connection->GetPort(), connection->GetRole(), connection->GetSslMode(),
-	                              0, connection->GetApplicationName(), connection->GetSSLCert(), connection->GetSSLKey(), connection->GetSSLRootCert(), connection->GetSSLCrl(),
-	                              connection->GetSSLCompression());
+	SetQuietLogging(lockConn);
+
+	// The locks collector switches to it before its next query
+	lockCollector->SetConnection(lockConn);
+}
+
+
+pgConn *frmStatus::DuplicateConnection()
+{
+	pgConn *conn = connection->Duplicate();
+
+	if (conn->GetStatus() != PGCONN_OK)
+	{
+		wxLogError(_("Could not open another connection to the server:\n%s"), conn->GetLastError().c_str());
+		delete conn;
+		return NULL;
+	}
+
+	SetQuietLogging(conn);
+	return conn;
+}
 
-	pgUser *user = new pgUser(locks_connection->GetUser());
+
+pgConn *frmStatus::OpenCollectorConnection()
+{
+	pgConn *conn = connection->Duplicate();
+
+	if (conn->GetStatus() == PGCONN_OK)
+		SetQuietLogging(conn);
+	else
+		wxLogError(_("Could not open another connection to the server:\n%s"), conn->GetLastError().c_str());
+
+	return conn;
+}
+
+
+void frmStatus::SetQuietLogging(pgConn *conn)
+{
+	wxString initquery;
+
+	// Only superusers can set these parameters...
+	pgUser *user = new pgUser(conn->GetUser());
 	if (user)
 	{
 		if (user->GetSuperuser())
 		{
-			if (locks_connection->BackendMinimumVersion(8, 0))
+			if (conn->BackendMinimumVersion(8, 0))
 				initquery = wxT("SET log_statement='none';SET log_duration='off';SET log_min_duration_statement=-1;");
 			else
 				initquery = wxT("SET log_statement='off';SET log_duration='off';SET log_min_duration_statement=-1;");
-			locks_connection->ExecuteVoid(initquery, false);
+			conn->ExecuteVoid(initquery, false);
 		}
 		delete user;
 	}
@@ -548,12 +891,12 @@ void frmStatus::AddStatusPane()
 	// Disable sort on Mac.
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), true);
 #endif
-	wxListCtrl *lstStatus = new wxListCtrl(pnlActivity, CTL_STATUSLIST, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxSUNKEN_BORDER);
+	statusList = new statusListView(pnlActivity, CTL_STATUSLIST);
 	// Now switch back
 #ifdef __WXMAC__
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), false);
 #endif
-	grdActivity->Add(lstStatus, 0, wxGROW, 3);
+	grdActivity->Add(statusList, 0, wxGROW, 3);
 
 	// Add the panel to the notebook
 	manager.AddPane(pnlActivity,
@@ -567,7 +910,6 @@ void frmStatus::AddStatusPane()
 	grdActivity->Fit(pnlActivity);
 
 	// Add each column to the list control
-	statusList = (ctlListView *)lstStatus;
 	statusList->AddColumn(_("PID"), 35);
 	if (connection->BackendMinimumVersion(8, 5))
 		statusList->AddColumn(_("Application name"), 70);
@@ -652,12 +994,12 @@ void frmStatus::AddLockPane()
 	// Disable sort on Mac.
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), true);
 #endif
-	wxListCtrl *lstLocks = new wxListCtrl(pnlLock, CTL_LOCKLIST, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxSUNKEN_BORDER);
+	lockList = new statusListView(pnlLock, CTL_LOCKLIST);
 	// Now switch back
 #ifdef __WXMAC__
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), false);
 #endif
-	grdLock->Add(lstLocks, 0, wxGROW, 3);
+	grdLock->Add(lockList, 0, wxGROW, 3);
 
 	// Add the panel to the notebook
 	manager.AddPane(pnlLock,
@@ -671,17 +1013,16 @@ void frmStatus::AddLockPane()
 	grdLock->Fit(pnlLock);
 
 	// Add each column to the list control
-	lockList = (ctlListView *)lstLocks;
 	lockList->AddColumn(wxT("PID"), 35);
 	lockList->AddColumn(_("Database"), 50);
 	lockList->AddColumn(_("Relation"), 50);
 	lockList->AddColumn(_("User"), 50);
-	if (locks_connection->BackendMinimumVersion(8, 3))
+	if (connection->BackendMinimumVersion(8, 3))
 		lockList->AddColumn(_("XID"), 50);
 	lockList->AddColumn(_("TX"), 50);
 	lockList->AddColumn(_("Mode"), 50);
 	lockList->AddColumn(_("Granted"), 50);
-	if (locks_connection->BackendMinimumVersion(7, 4))
+	if (connection->BackendMinimumVersion(7, 4))
 		lockList->AddColumn(_("Start"), 50);
 	lockList->AddColumn(_("Query"), 500);
 
@@ -844,12 +1185,12 @@ void frmStatus::AddLogPane()
 	// Disable sort on Mac.
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), true);
 #endif
-	wxListCtrl *lstLog = new wxListCtrl(pnlLog, CTL_LOGLIST, wxDefaultPosition, wxDefaultSize, wxLC_REPORT | wxSUNKEN_BORDER);
+	logList = new logListView(pnlLog, CTL_LOGLIST);
 	// Now switch back
 #ifdef __WXMAC__
 	wxSystemOptions::SetOption(wxT("mac.listctrl.always_use_generic"), false);
 #endif
-	grdLog->Add(lstLog, 0, wxGROW, 3);
+	grdLog->Add(logList, 0, wxGROW, 3);
 
 	// Add the panel to the notebook
 	manager.AddPane(pnlLog,
@@ -862,9 +1203,6 @@ void frmStatus::AddLogPane()
 	pnlLog->SetSizer(grdLog);
 	grdLog->Fit(pnlLog);
 
-	// Add the log list
-	logList = (ctlListView *)lstLog;
-
 	// We don't need this report (but we need the pane)
 	// if server release is less than 8.0 or if server has no adminpack
 	if (!(connection->BackendMinimumVersion(8, 0) &&
@@ -891,7 +1229,7 @@ void frmStatus::AddLogPane()
 		if (!connection->HasFeature(FEATURE_FILEREAD, true))
 		{
 			logList->InsertColumn(logList->GetColumnCount(), _("Message"), wxLIST_FORMAT_LEFT, 800);
-			logList->InsertItem(logList->GetItemCount(), _("Logs are not available for this server."), -1);
+			logList->AppendRow(_("Logs are not available for this server."));
 			logList->Enable(false);
 			logTimer = NULL;
 			// We're done
@@ -949,6 +1287,22 @@ void frmStatus::AddLogPane()
 	// Re-initialize variables
 	logfileLength = 0;
 
+	// The logfiles are read in the background, on a connection of its own
+	pgConn *logConn = DuplicateConnection();
+	if (!logConn)
+	{
+		logList->AppendRow(_("Logs cannot be read: no connection available."));
+		logList->Enable(false);
+		cbLogfiles->Disable();
+		btnRotateLog->Disable();
+		logTimer = NULL;
+		return;
+	}
+	logReader = new statusLogReader(this, logConn, logList->GetColumnCount(), logFormat,
+	                                logFmtPos, logFormatKnown, logHasTimestamp);
+	logReader->Create();
+	logReader->Run();
+
 	// Read logRate configuration
 	settings->Read(wxT("frmStatus/RefreshLogRate"), &logRate, 10);
 
@@ -1315,14 +1669,12 @@ void frmStatus::OnRefreshUITimer(wxTimerEvent &event)
 
 void frmStatus::OnRefreshStatusTimer(wxTimerEvent &event)
 {
-	long pid = 0;
 	wxString pidcol = connection->BackendMinimumVersion(9, 2) ? wxT("p.pid") : wxT("p.procpid");
 	wxString querycol = connection->BackendMinimumVersion(9, 2) ? wxT("query") : wxT("current_query");
 
 	if (! viewMenu->IsChecked(MNU_STATUSPAGE))
 		return;
 
-	checkConnection();
 	if (!connection)
 	{
 		statusTimer->Stop();
@@ -1334,9 +1686,6 @@ void frmStatus::OnRefreshStatusTimer(wxTimerEvent &event)
 		return;
 	}
 
-	wxCriticalSectionLocker lock(gs_critsect);
-
-	long row = 0;
 	wxString q = wxT("SELECT ");
 
 	// PID
@@ -1417,126 +1766,111 @@ void frmStatus::OnRefreshStatusTimer(wxTimerEvent &event)
 
 	// And the rest of the query...
 	q += wxT("FROM pg_stat_activity p ")
-	     wxT("ORDER BY ") + NumToStr((long)statusSortColumn) + wxT(" ") + statusSortOrder;
+	     wxT("ORDER BY ") + NumToStr((long)statusSortColumn) + wxT(" ") + statusSortOrder + wxT(", pid");
 
-	pgSet *dataSet1 = connection->ExecuteSet(q);
-	if (dataSet1)
+	// Skip this tick if the previous refresh is still on its way
+	if (collector->Collect(PANE_STATUS, q))
 	{
+		statusList->Queued();
 		statusBar->SetStatusText(_("Refreshing status list."));
-		statusList->Freeze();
+	}
+}
 
-		// Clear the queries array content
-		queries.Clear();
 
-		while (!dataSet1->Eof())
-		{
-			pid = dataSet1->GetLong(wxT("pid"));
+void frmStatus::ShowStatusSnapshot(const statusSnapshot *snapshot)
+{
+	long pid = 0;
+	wxArrayString cells;
+	wxColour colour;
 
-			// Update the UI
-			if (pid != backend_pid)
-			{
-				// Add the query content to the queries array
-				queries.Add(dataSet1->GetVal(wxT("query")));
+	statusList->BeginUpdate();
 
-				if (row >= statusList->GetItemCount())
-				{
-					statusList->InsertItem(row, NumToStr(pid), -1);
-					row = statusList->GetItemCount() - 1;
-				}
-				else
-				{
-					statusList->SetItem(row, 0, NumToStr(pid));
-				}
+	// Clear the queries array content
+	queries.Clear();
 
-				wxString qry = dataSet1->GetVal(wxT("query"));
+	for (long row = 0; row < snapshot->NumRows(); row++)
+	{
+		pid = snapshot->GetLong(row, wxT("pid"));
 
-				int colpos = 1;
-				if (connection->BackendMinimumVersion(8, 5))
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("application_name")));
-				statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("datname")));
-				statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("usename")));
+		// Update the UI
+		if (!IsOwnBackend(pid))
+		{
+			wxString qry = snapshot->GetVal(row, wxT("query"));
 
-				if (connection->BackendMinimumVersion(8, 1))
-				{
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("client")));
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("backend_start")));
-				}
-				if (connection->BackendMinimumVersion(7, 4))
-				{
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("query_start")));
-				}
+			// Add the query content to the queries array
+			queries.Add(qry);
 
-				if (connection->BackendMinimumVersion(8, 3))
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("xact_start")));
+			cells.Empty();
+			cells.Add(NumToStr(pid));
+			if (connection->BackendMinimumVersion(8, 5))
+				cells.Add(snapshot->GetVal(row, wxT("application_name")));
+			cells.Add(snapshot->GetVal(row, wxT("datname")));
+			cells.Add(snapshot->GetVal(row, wxT("usename")));
 
-				if (connection->BackendMinimumVersion(9, 2))
-				{
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("state")));
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("state_change")));
-				}
+			if (connection->BackendMinimumVersion(8, 1))
+			{
+				cells.Add(snapshot->GetVal(row, wxT("client")));
+				cells.Add(snapshot->GetVal(row, wxT("backend_start")));
+			}
+			if (connection->BackendMinimumVersion(7, 4))
+			{
+				cells.Add(snapshot->GetVal(row, wxT("query_start")));
+			}
 
-				if (connection->BackendMinimumVersion(9, 4))
-				{
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("backend_xid")));
-					statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("backend_xmin")));
-				}
+			if (connection->BackendMinimumVersion(8, 3))
+				cells.Add(snapshot->GetVal(row, wxT("xact_start")));
 
-				statusList->SetItem(row, colpos++, dataSet1->GetVal(wxT("blockedby")));
-				statusList->SetItem(row, colpos, qry);
+			if (connection->BackendMinimumVersion(9, 2))
+			{
+				cells.Add(snapshot->GetVal(row, wxT("state")));
+				cells.Add(snapshot->GetVal(row, wxT("state_change")));
+			}
 
-				// Colorize the new line
-				if (viewMenu->IsChecked(MNU_HIGHLIGHTSTATUS))
-				{
-					statusList->SetItemBackgroundColour(row,
-					                                    wxColour(settings->GetActiveProcessColour()));
-					if (qry == wxT("<IDLE>") || qry == wxT("<IDLE> in transaction0"))
-						statusList->SetItemBackgroundColour(row,
-						                                    wxColour(settings->GetIdleProcessColour()));
-					if (connection->BackendMinimumVersion(9, 2))
-					{
-						if (dataSet1->GetVal(wxT("state")) != wxT("active"))
-							statusList->SetItemBackgroundColour(row,
-							                                    wxColour(settings->GetIdleProcessColour()));
-					}
+			if (connection->BackendMinimumVersion(9, 4))
+			{
+				cells.Add(snapshot->GetVal(row, wxT("backend_xid")));
+				cells.Add(snapshot->GetVal(row, wxT("backend_xmin")));
+			}
 
-					if (dataSet1->GetVal(wxT("blockedby")).Length() > 0)
-						statusList->SetItemBackgroundColour(row,
-						                                    wxColour(settings->GetBlockedProcessColour()));
-					if (dataSet1->GetBool(wxT("slowquery")))
-						statusList->SetItemBackgroundColour(row,
-						                                    wxColour(settings->GetSlowProcessColour()));
+			cells.Add(snapshot->GetVal(row, wxT("blockedby")));
+			cells.Add(qry);
+
+			// Colorize the line
+			if (viewMenu->IsChecked(MNU_HIGHLIGHTSTATUS))
+			{
+				colour = wxColour(settings->GetActiveProcessColour());
+				if (qry == wxT("<IDLE>") || qry == wxT("<IDLE> in transaction0"))
+					colour = wxColour(settings->GetIdleProcessColour());
+				if (connection->BackendMinimumVersion(9, 2))
+				{
+					if (snapshot->GetVal(row, wxT("state")) != wxT("active"))
+						colour = wxColour(settings->GetIdleProcessColour());
 				}
-				else
-					statusList->SetItemBackgroundColour(row, *wxWHITE);
 
-				row++;
+				if (snapshot->GetVal(row, wxT("blockedby")).Length() > 0)
+					colour = wxColour(settings->GetBlockedProcessColour());
+				if (snapshot->GetBool(row, wxT("slowquery")))
+					colour = wxColour(settings->GetSlowProcessColour());
 			}
-			dataSet1->MoveNext();
-		}
-		delete dataSet1;
-
-		while (row < statusList->GetItemCount())
-			statusList->DeleteItem(row);
+			else
+				colour = *wxWHITE;
 
-		statusList->Thaw();
-		wxListEvent ev;
-		OnSelStatusItem(ev);
-		statusBar->SetStatusText(_("Done."));
+			statusList->AppendRow(NumToStr(pid), cells, colour);
+		}
 	}
-	else
-		checkConnection();
+
+	statusList->EndUpdate();
+	wxListEvent ev;
+	OnSelStatusItem(ev);
 }
 
 
 void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 {
-	long pid = 0;
-
 	if (! viewMenu->IsChecked(MNU_LOCKPAGE))
 		return;
 
-	checkConnection();
-	if (!locks_connection)
+	if (!connection)
 	{
 		statusTimer->Stop();
 		locksTimer->Stop();
@@ -1547,8 +1881,6 @@ void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 		return;
 	}
 
-	wxCriticalSectionLocker lock(gs_critsect);
-
 	// There are no sort operator for xid before 8.3
 	if (!connection->BackendMinimumVersion(8, 3) && lockSortColumn == 5)
 	{
@@ -1556,9 +1888,8 @@ void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 		lockSortColumn = 1;
 	}
 
-	long row = 0;
 	wxString sql;
-	if (locks_connection->BackendMinimumVersion(8, 3))
+	if (connection->BackendMinimumVersion(8, 3))
 	{
 		sql = wxT("SELECT pg_stat_get_backend_pid(svrid) AS pid, ")
 		      wxT("(SELECT datname FROM pg_database WHERE oid = pgl.database) AS dbname, ")
@@ -1570,9 +1901,9 @@ void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 		      wxT("FROM pg_stat_get_backend_idset() svrid, pg_locks pgl ")
 		      wxT("LEFT JOIN pg_class pgc ON pgl.relation=pgc.oid ")
 		      wxT("WHERE pgl.pid = pg_stat_get_backend_pid(svrid) ")
-		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder;
+		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder + wxT(", pid, class, mode");
 	}
-	else if (locks_connection->BackendMinimumVersion(7, 4))
+	else if (connection->BackendMinimumVersion(7, 4))
 	{
 		sql = wxT("SELECT pg_stat_get_backend_pid(svrid) AS pid, ")
 		      wxT("(SELECT datname FROM pg_database WHERE oid = pgl.database) AS dbname, ")
@@ -1584,7 +1915,7 @@ void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 		      wxT("FROM pg_stat_get_backend_idset() svrid, pg_locks pgl ")
 		      wxT("LEFT JOIN pg_class pgc ON pgl.relation=pgc.oid ")
 		      wxT("WHERE pgl.pid = pg_stat_get_backend_pid(svrid) ")
-		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder;
+		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder + wxT(", pid, class, mode");
 	}
 	else
 	{
@@ -1597,73 +1928,70 @@ void frmStatus::OnRefreshLocksTimer(wxTimerEvent &event)
 		      wxT("FROM pg_stat_get_backend_idset() svrid, pg_locks pgl ")
 		      wxT("LEFT JOIN pg_class pgc ON pgl.relation=pgc.oid ")
 		      wxT("WHERE pgl.pid = pg_stat_get_backend_pid(svrid) ")
-		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder;
+		      wxT("ORDER BY ") + NumToStr((long)lockSortColumn) + wxT(" ") + lockSortOrder + wxT(", pid, class, mode");
 	}
 
-	pgSet *dataSet2 = locks_connection->ExecuteSet(sql);
-	if (dataSet2)
+	// Skip this tick if the previous refresh is still on its way
+	if (lockCollector->Collect(PANE_LOCKS, sql))
 	{
+		lockList->Queued();
 		statusBar->SetStatusText(_("Refreshing locks list."));
-		lockList->Freeze();
-
-		while (!dataSet2->Eof())
-		{
-			pid = dataSet2->GetLong(wxT("pid"));
+	}
+}
 
-			if (pid != backend_pid)
-			{
-				if (row >= lockList->GetItemCount())
-				{
-					lockList->InsertItem(row, NumToStr(pid), -1);
-					row = lockList->GetItemCount() - 1;
-				}
-				else
-				{
-					lockList->SetItem(row, 0, NumToStr(pid));
-				}
 
-				int colpos = 1;
-				lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("dbname")));
-				lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("class")));
-				lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("user")));
-				if (locks_connection->BackendMinimumVersion(8, 3))
-					lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("virtualxid")));
-				lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("transaction")));
-				lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("mode")));
-
-				if (dataSet2->GetVal(wxT("granted")) == wxT("t"))
-					lockList->SetItem(row, colpos++, _("Yes"));
-				else
-					lockList->SetItem(row, colpos++, _("No"));
+void frmStatus::ShowLockSnapshot(const statusSnapshot *snapshot)
+{
+	long pid = 0;
+	wxArrayString cells;
 
-				wxString qry = dataSet2->GetVal(wxT("query"));
+	lockList->BeginUpdate();
 
-				if (locks_connection->BackendMinimumVersion(7, 4))
-				{
-					if (qry.IsEmpty() || qry == wxT("<IDLE>"))
-						lockList->SetItem(row, colpos++, wxEmptyString);
-					else
-						lockList->SetItem(row, colpos++, dataSet2->GetVal(wxT("query_start")));
-				}
-				lockList->SetItem(row, colpos++, qry.Left(250));
+	for (long row = 0; row < snapshot->NumRows(); row++)
+	{
+		pid = snapshot->GetLong(row, wxT("pid"));
 
-				row++;
-			}
-			dataSet2->MoveNext();
-		}
+		if (!IsOwnBackend(pid))
+		{
+			cells.Empty();
+			cells.Add(NumToStr(pid));
+			cells.Add(snapshot->GetVal(row, wxT("dbname")));
+			cells.Add(snapshot->GetVal(row, wxT("class")));
+			cells.Add(snapshot->GetVal(row, wxT("user")));
+			if (connection->BackendMinimumVersion(8, 3))
+				cells.Add(snapshot->GetVal(row, wxT("virtualxid")));
+			cells.Add(snapshot->GetVal(row, wxT("transaction")));
+			cells.Add(snapshot->GetVal(row, wxT("mode")));
 
-		delete dataSet2;
+			if (snapshot->GetVal(row, wxT("granted")) == wxT("t"))
+				cells.Add(_("Yes"));
+			else
+				cells.Add(_("No"));
 
-		while (row < lockList->GetItemCount())
-			lockList->DeleteItem(row);
+			wxString qry = snapshot->GetVal(row, wxT("query"));
 
-		lockList->Thaw();
-		wxListEvent ev;
-		OnSelLockItem(ev);
-		statusBar->SetStatusText(_("Done."));
+			if (connection->BackendMinimumVersion(7, 4))
+			{
+				if (qry.IsEmpty() || qry == wxT("<IDLE>"))
+					cells.Add(wxEmptyString);
+				else
+					cells.Add(snapshot->GetVal(row, wxT("query_start")));
+			}
+			cells.Add(qry.Left(250));
+
+			// A backend holds many locks, so the lock itself is part of the key
+			wxString key = NumToStr(pid) + wxT("|") + snapshot->GetVal(row, wxT("dbname"))
+			               + wxT("|") + snapshot->GetVal(row, wxT("class"))
+			               + wxT("|") + snapshot->GetVal(row, wxT("virtualxid"))
+			               + wxT("|") + snapshot->GetVal(row, wxT("transaction"))
+			               + wxT("|") + snapshot->GetVal(row, wxT("mode"));
+			lockList->AppendRow(key, cells);
+		}
 	}
-	else
-		checkConnection();
+
+	lockList->EndUpdate();
+	wxListEvent ev;
+	OnSelLockItem(ev);
 }
 
 
@@ -1672,7 +2000,6 @@ void frmStatus::OnRefreshXactTimer(wxTimerEvent &event)
 	if (! viewMenu->IsEnabled(MNU_XACTPAGE) || ! viewMenu->IsChecked(MNU_XACTPAGE) || !xactTimer)
 		return;
 
-	checkConnection();
 	if (!connection)
 	{
 		statusTimer->Stop();
@@ -1683,8 +2010,6 @@ void frmStatus::OnRefreshXactTimer(wxTimerEvent &event)
 		return;
 	}
 
-	wxCriticalSectionLocker lock(gs_critsect);
-
 	// There are no sort operator for xid before 8.3
 	if (!connection->BackendMinimumVersion(8, 3) && xactSortColumn == 1)
 	{
@@ -1692,7 +2017,6 @@ void frmStatus::OnRefreshXactTimer(wxTimerEvent &event)
 		xactSortColumn = 2;
 	}
 
-	long row = 0;
 	wxString sql;
 	if (connection->BackendMinimumVersion(8, 3))
 		sql = wxT("SELECT transaction::text, gid, prepared, owner, database ")
@@ -1703,47 +2027,47 @@ void frmStatus::OnRefreshXactTimer(wxTimerEvent &event)
 		      wxT("FROM pg_prepared_xacts ")
 		      wxT("ORDER BY ") + NumToStr((long)xactSortColumn) + wxT(" ") + xactSortOrder;
 
-	pgSet *dataSet3 = connection->ExecuteSet(sql);
-	if (dataSet3)
-	{
+	// Skip this tick if the previous refresh is still on its way
+	if (collector->Collect(PANE_XACT, sql))
 		statusBar->SetStatusText(_("Refreshing transactions list."));
-		xactList->Freeze();
+}
 
-		while (!dataSet3->Eof())
-		{
-			long xid = dataSet3->GetLong(wxT("transaction"));
 
-			if (row >= xactList->GetItemCount())
-			{
-				xactList->InsertItem(row, NumToStr(xid), -1);
-				row = xactList->GetItemCount() - 1;
-			}
-			else
-			{
-				xactList->SetItem(row, 0, NumToStr(xid));
-			}
+void frmStatus::ShowXactSnapshot(const statusSnapshot *snapshot)
+{
+	long row = 0;
+
+	xactList->Freeze();
 
-			int colpos = 1;
-			xactList->SetItem(row, colpos++, dataSet3->GetVal(wxT("gid")));
-			xactList->SetItem(row, colpos++, dataSet3->GetVal(wxT("prepared")));
-			xactList->SetItem(row, colpos++, dataSet3->GetVal(wxT("owner")));
-			xactList->SetItem(row, colpos++, dataSet3->GetVal(wxT("database")));
+	for (long snaprow = 0; snaprow < snapshot->NumRows(); snaprow++)
+	{
+		long xid = snapshot->GetLong(snaprow, wxT("transaction"));
 
-			row++;
-			dataSet3->MoveNext();
+		if (row >= xactList->GetItemCount())
+		{
+			xactList->InsertItem(row, NumToStr(xid), -1);
+			row = xactList->GetItemCount() - 1;
+		}
+		else
+		{
+			SetListCell(xactList, row, 0, NumToStr(xid));
 		}
-		delete dataSet3;
 
-		while (row < xactList->GetItemCount())
-			xactList->DeleteItem(row);
+		int colpos = 1;
+		SetListCell(xactList, row, colpos++, snapshot->GetVal(snaprow, wxT("gid")));
+		SetListCell(xactList, row, colpos++, snapshot->GetVal(snaprow, wxT("prepared")));
+		SetListCell(xactList, row, colpos++, snapshot->GetVal(snaprow, wxT("owner")));
+		SetListCell(xactList, row, colpos++, snapshot->GetVal(snaprow, wxT("database")));
 
-		xactList->Thaw();
-		wxListEvent ev;
-		OnSelXactItem(ev);
-		statusBar->SetStatusText(_("Done."));
+		row++;
 	}
-	else
-		checkConnection();
+
+	while (row < xactList->GetItemCount())
+		xactList->DeleteItem(row);
+
+	xactList->Thaw();
+	wxListEvent ev;
+	OnSelXactItem(ev);
 }
 
 
@@ -1752,7 +2076,6 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 	if (! viewMenu->IsEnabled(MNU_LOGPAGE) || ! viewMenu->IsChecked(MNU_LOGPAGE) || !logTimer)
 		return;
 
-	checkConnection();
 	if (!connection)
 	{
 		statusTimer->Stop();
@@ -1763,8 +2086,6 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 		return;
 	}
 
-	wxCriticalSectionLocker lock(gs_critsect);
-
 	if (connection->GetLastResultError().sql_state == wxT("42501"))
 	{
 		// Don't have superuser privileges, so can't do anything with the log display
@@ -1776,8 +2097,6 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 		return;
 	}
 
-	long newlen = 0;
-
 	if (logDirectory.IsEmpty())
 	{
 		// freshly started
@@ -1794,7 +2113,6 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 		}
 		if (fillLogfileCombo())
 		{
-			savedPartialLine.Clear();
 			cbLogfiles->SetSelection(0);
 			wxCommandEvent ev;
 			OnLoadLogfile(ev);
@@ -1804,9 +2122,9 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 		{
 			logDirectory = wxT("-");
 			if (connection->BackendMinimumVersion(8, 3))
-				logList->AppendItem(-1, wxString(_("logging_collector not enabled or log_filename misconfigured")));
+				logList->AppendRow(_("logging_collector not enabled or log_filename misconfigured"));
 			else
-				logList->AppendItem(-1, wxString(_("redirect_stderr not enabled or log_filename misconfigured")));
+				logList->AppendRow(_("redirect_stderr not enabled or log_filename misconfigured"));
 			cbLogfiles->Disable();
 			btnRotateLog->Disable();
 		}
@@ -1815,33 +2133,24 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 	if (logDirectory == wxT("-"))
 		return;
 
+	// Skip this tick while the reader is still busy
+	if (logReader->IsBusy())
+		return;
+
 	if (isCurrent)
 	{
-		// check if the current logfile changed
-		pgSet *set = connection->ExecuteSet(wxT("SELECT pg_file_length(") + connection->qtDbString(logfileName) + wxT(") AS len"));
-		if (set)
-		{
-			newlen = set->GetLong(wxT("len"));
-			delete set;
-		}
-		else
-		{
-			checkConnection();
-			return;
-		}
-		if (newlen > logfileLength)
-		{
-			statusBar->SetStatusText(_("Refreshing log list."));
-			addLogFile(logfileName, logfileTimestamp, newlen, logfileLength, false);
-			statusBar->SetStatusText(_("Done."));
-
-			// as long as there was new data, the logfile is probably the current
-			// one so we don't need to check for rotation
-			return;
-		}
+		// Read whatever was added to the current logfile; the rotation
+		// gets checked once the reader found nothing new
+		logReader->Read(logfileName, logfileLength, false, true);
+		return;
 	}
 
-	//
+	checkLogRotation();
+}
+
+
+void frmStatus::checkLogRotation()
+{
 	wxString newDirectory = connection->ExecuteScalar(wxT("SHOW log_directory"));
 
 	int newfiles = 0;
@@ -1862,11 +2171,10 @@ void frmStatus::OnRefreshLogTimer(wxTimerEvent &event)
 
 			while (newfiles--)
 			{
-				addLogLine(_("pgadmin:Logfile rotated."), false);
 				wxDateTime *ts = (wxDateTime *)cbLogfiles->wxItemContainer::GetClientData(pos++);
 				wxASSERT(ts != 0);
 
-				addLogFile(ts, skipFirst);
+				addLogFile(ts, skipFirst, _("pgadmin:Logfile rotated."));
 				skipFirst = false;
 
 				pos++;
@@ -1887,12 +2195,45 @@ void frmStatus::OnRefresh(wxCommandEvent &event)
 }
 
 
-void frmStatus::checkConnection()
+void frmStatus::OnSnapshot(wxCommandEvent &event)
 {
-	if (!locks_connection->IsAlive())
+	statusSnapshot *snapshot = (statusSnapshot *)event.GetClientData();
+	statusCollector *from = (snapshot->GetPane() == PANE_LOCKS ? lockCollector : collector);
+
+	if (snapshot->IsOk() && connection)
 	{
-		locks_connection = connection;
+		switch (snapshot->GetPane())
+		{
+			case PANE_STATUS:
+				ShowStatusSnapshot(snapshot);
+				break;
+			case PANE_LOCKS:
+				ShowLockSnapshot(snapshot);
+				break;
+			case PANE_XACT:
+				ShowXactSnapshot(snapshot);
+				break;
+		}
+		statusBar->SetStatusText(_("Done."));
 	}
+	// The collector connects again itself, before its next query
+	else if (snapshot->IsBroken() && connection)
+		checkConnection();
+
+	// Ready for the next tick
+	from->Done(snapshot->GetPane());
+	delete snapshot;
+}
+
+
+bool frmStatus::IsOwnBackend(long pid)
+{
+	return pid == backend_pid || pid == collector->GetBackendPID() || pid == lockCollector->GetBackendPID();
+}
+
+
+void frmStatus::checkConnection()
+{
 	if (!connection->IsAlive())
 	{
 		delete connection;
@@ -1910,209 +2251,426 @@ void frmStatus::checkConnection()
 }
 
 
-void frmStatus::addLogFile(wxDateTime *dt, bool skipFirst)
+void frmStatus::addLogFile(wxDateTime *dt, bool skipFirst, const wxString &banner)
 {
 	pgSet *set = connection->ExecuteSet(
-	                 wxT("SELECT filetime, filename, pg_file_length(filename) AS len ")
+	                 wxT("SELECT filetime, filename ")
 	                 wxT("  FROM pg_logdir_ls() AS A(filetime timestamp, filename text) ")
 	                 wxT(" WHERE filetime = '") + DateToAnsiStr(*dt) + wxT("'::timestamp"));
 	if (set)
 	{
 		logfileName = set->GetVal(wxT("filename"));
 		logfileTimestamp = set->GetDateTime(wxT("filetime"));
-		long len = set->GetLong(wxT("len"));
-
 		logfileLength = 0;
-		addLogFile(logfileName, logfileTimestamp, len, logfileLength, skipFirst);
+
+		statusBar->SetStatusText(_("Reading log from server..."));
+		logReader->Read(logfileName, 0, skipFirst, isCurrent, banner);
 
 		delete set;
 	}
 }
 
 
-void frmStatus::addLogFile(const wxString &filename, const wxDateTime timestamp, long len, long &read, bool skipFirst)
+void frmStatus::OnLogBatch(wxCommandEvent &event)
 {
-	wxString line;
+	statusLogBatch *batch = (statusLogBatch *)event.GetClientData();
 
-	if (skipFirst)
+	// Rows of a file that isn't shown anymore
+	if (batch->generation != logReader->GetGeneration())
 	{
-		long maxServerLogSize = settings->GetMaxServerLogSize();
+		delete batch;
+		return;
+	}
+
+	if (batch->cells.GetCount())
+		logList->AppendRows(batch->cells);
 
-		if (!logfileLength && maxServerLogSize && logfileLength > maxServerLogSize)
+	if (batch->filename == logfileName)
+		logfileLength = batch->offset;
+
+	if (batch->last)
+	{
+		if (batch->sqlState == wxT("42501"))
 		{
-			long maxServerLogSize = settings->GetMaxServerLogSize();
-			len = read - maxServerLogSize;
+			// Don't have superuser privileges, so can't do anything with the log display
+			logTimer->Stop();
+			cbLogfiles->Disable();
+			btnRotateLog->Disable();
+			manager.GetPane(wxT("Logfile")).Show(false);
+			manager.Update();
+		}
+		else if (batch->broken)
+			checkConnection();
+		else if (!logReader->IsBusy())
+		{
+			statusBar->SetStatusText(_("Done."));
+
+			// as long as there was new data, the logfile is probably the current
+			// one so we don't need to check for rotation
+			if (isCurrent && !batch->newData && batch->filename == logfileName)
+				checkLogRotation();
 		}
-		else
-			skipFirst = false;
 	}
 
-	// If GPDB 3.3 and later, log is normally in CSV format.  Let's get a whole log line before calling addLogLine,
-	// so we can do things smarter.
+	delete batch;
+}
 
-	// PostgreSQL can log in CSV format, as well as regular format.  Normally, we'd only see
-	// the regular format logs here, because pg_logdir_ls only returns those.  But if pg_logdir_ls is
-	// changed to return the csv format log files, we should handle it.
 
-	bool csv_log_format = filename.Right(4) == wxT(".csv");
+statusLogReader::statusLogReader(frmStatus *_form, pgConn *conn, size_t _nCols, const wxString &_logFormat,
+                                 int _logFmtPos, bool _logFormatKnown, bool _logHasTimestamp)
+	: wxThread(wxTHREAD_JOINABLE), readerCond(readerLock)
+{
+	form = _form;
+	connection = conn;
+	nCols = _nCols;
+	logFormat = _logFormat;
+	logFmtPos = _logFmtPos;
+	logFormatKnown = _logFormatKnown;
+	logHasTimestamp = _logHasTimestamp;
+	gpdb = conn->GetIsGreenplum();
 
-	if (csv_log_format && savedPartialLine.length() > 0)
-	{
-		if (read == 0)  // Starting at beginning of log file
-			savedPartialLine.clear();
-		else
-			line = savedPartialLine;
-	}
+	// pg_read_binary_file() returns the bytes as they are in the file,
+	// whatever the encodings of the log entries
+	binaryRead = conn->BackendMinimumVersion(9, 1);
+	chunkSize = STATUS_LOG_START_CHUNK;
+
+	carryScanned = 0;
+	carryInQuote = false;
+	resync = false;
+
+	generation = 0;
+	working = false;
+	stopping = false;
+}
+
+
+statusLogReader::~statusLogReader()
+{
+	WX_CLEAR_ARRAY(requests);
+	delete connection;
+}
+
+
+void statusLogReader::Read(const wxString &filename, long offset, bool skipFirst, bool tail, const wxString &banner)
+{
+	wxMutexLocker lock(readerLock);
+
+	statusLogRequest *request = new statusLogRequest;
+	request->filename = filename;
+	request->banner = banner;
+	request->offset = offset;
+	request->maxSize = skipFirst ? settings->GetMaxServerLogSize() : 0;
+	request->tail = tail;
+	request->generation = generation;
+
+	requests.Add(request);
+	readerCond.Signal();
+}
+
+
+void statusLogReader::Reset()
+{
+	wxMutexLocker lock(readerLock);
+
+	WX_CLEAR_ARRAY(requests);
+	generation++;
+}
+
+
+int statusLogReader::GetGeneration()
+{
+	wxMutexLocker lock(readerLock);
+	return generation;
+}
+
+
+bool statusLogReader::IsBusy()
+{
+	wxMutexLocker lock(readerLock);
+	return working || requests.GetCount() > 0;
+}
+
+
+void statusLogReader::Stop()
+{
+	wxMutexLocker lock(readerLock);
+
+	stopping = true;
+	connection->CancelExecution();
+	readerCond.Signal();
+}
+
+
+bool statusLogReader::Aborted(int requestGeneration)
+{
+	wxMutexLocker lock(readerLock);
+	return stopping || requestGeneration != generation;
+}
 
-	while (len > read)
+
+void statusLogReader::PostBatch(statusLogBatch *batch)
+{
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, STATUS_LOGBATCH_ID);
+	ev.SetClientData(batch);
+#if wxCHECK_VERSION(2, 9, 0)
+	form->GetEventHandler()->AddPendingEvent(ev);
+#else
+	form->AddPendingEvent(ev);
+#endif
+}
+
+
+void *statusLogReader::Entry()
+{
+	while (true)
 	{
-		statusBar->SetStatusText(_("Reading log from server..."));
-		pgSet *set = connection->ExecuteSet(wxT("SELECT pg_file_read(") +
-		                                    connection->qtDbString(filename) + wxT(", ") + NumToStr(read) + wxT(", 50000)"));
-		if (!set)
-		{
-			connection->IsAlive();
-			return;
-		}
-		char *raw = set->GetCharPtr(0);
+		statusLogRequest *request;
 
-		if (!raw || !*raw)
 		{
-			delete set;
-			break;
+			wxMutexLocker lock(readerLock);
+
+			working = false;
+			while (!stopping && !requests.GetCount())
+				readerCond.Wait();
+			if (stopping)
+				break;
+
+			request = requests.Item(0);
+			requests.RemoveAt(0);
+			working = true;
 		}
 
-		read += strlen(raw);
+		ReadFile(request);
+		delete request;
+	}
 
-		wxString str;
-		if (wxString(wxString(raw, wxConvLibc).wx_str(), wxConvUTF8).Len() > 0)
-			str = line + wxString(wxString(raw, wxConvLibc).wx_str(), wxConvUTF8);
-		else
-			str = line + wxTextBuffer::Translate(wxString(raw, set->GetConversion()), wxTextFileType_Unix);
+	return NULL;
+}
 
-		delete set;
 
-		if (str.Len() == 0)
+void statusLogReader::ReadFile(statusLogRequest *request)
+{
+	statusLogBatch *batch;
+	bool csv = request->filename.Right(4) == wxT(".csv");
+	long offset = request->offset;
+	long len = 0;
+
+	// Whatever is left from another file won't get completed anymore
+	if (request->filename != carryFile || offset == 0)
+	{
+		if (carry.GetDataLen() && !csv && carryFile.Right(4) != wxT(".csv"))
 		{
-			wxString msgstr = _("The server log contains entries in multiple encodings and cannot be displayed by pgAdmin.");
-			wxMessageBox(msgstr);
-			return;
+			batch = new statusLogBatch;
+			batch->filename = carryFile;
+			batch->generation = request->generation;
+			AddRecord((const char *)carry.GetData(), carry.GetDataLen(), false, batch->cells);
+			PostBatch(batch);
 		}
+		carryFile = request->filename;
+		carry.SetDataLen(0);
+		carryScanned = 0;
+		carryInQuote = false;
+		resync = false;
+	}
 
-		if (csv_log_format)
-		{
-			// This will work for any DB using CSV format logs
+	batch = new statusLogBatch;
+	batch->filename = request->filename;
+	batch->generation = request->generation;
+	batch->offset = offset;
 
-			if (logHasTimestamp)
-			{
-				// Right now, csv format logs from GPDB and PostgreSQL always start with a timestamp, so we count on that.
+	if (!request->banner.IsEmpty())
+		ParseLine(request->banner, false, false, batch->cells);
 
-				// And the only reason we need to do that is to make sure we are in sync.
+	pgSet *set = connection->ExecuteSet(wxT("SELECT pg_file_length(") + connection->qtDbString(request->filename) + wxT(") AS len"), false);
+	if (set && connection->GetLastResultStatus() == PGRES_TUPLES_OK)
+		len = set->GetLong(wxT("len"));
+	else
+	{
+		batch->sqlState = connection->GetLastResultError().sql_state;
+		batch->broken = !connection->IsAlive();
+		batch->last = true;
+		if (set)
+			delete set;
+		PostBatch(batch);
+		return;
+	}
+	delete set;
 
-				// Bad things happen if we start in the middle of a
-				// double-quoted string, as we would never find a correct line terminator!
+	// Only show the end of big files; the first line is probably truncated
+	if (request->maxSize && offset == 0 && len > request->maxSize)
+	{
+		offset = len - request->maxSize;
+		resync = true;
+	}
 
-				// In CSV logs, the first field must be a Timestamp, so must start with "2009" or "201" or "202" (at least for the next 20 years).
-				if (str.length() > 4 && str.Left(4) != wxT("2009") && str.Left(3) != wxT("201") && str.Left(3) != wxT("202"))
-				{
-					wxLogNotice(wxT("Log line does not start with timestamp: %s \n"), str.Mid(0, 100).c_str());
-					// Something isn't right, as we are not at the beginning of a csv log record.
-					// We should never get here, but if we do, try to handle it in a smart way.
-					str = str.Mid(str.Find(wxT("\n20")) + 1); // Try to re-sync.
-				}
-			}
+	while (len > offset && !Aborted(request->generation))
+	{
+		wxString sql;
+		if (binaryRead)
+			sql = wxT("SELECT pg_read_binary_file(");
+		else
+			sql = wxT("SELECT pg_file_read(");
+		sql += connection->qtDbString(request->filename) + wxT(", ") + NumToStr(offset) + wxT(", ") + NumToStr(chunkSize) + wxT(")");
 
-			CSVLineTokenizer tk(str);
+		wxLongLong started = wxGetLocalTimeMillis();
+		set = connection->ExecuteSet(sql, false);
+		wxLongLong elapsed = wxGetLocalTimeMillis() - started;
 
-			logList->Freeze();
+		if (!set || connection->GetLastResultStatus() != PGRES_TUPLES_OK)
+		{
+			batch->sqlState = connection->GetLastResultError().sql_state;
+			batch->broken = !connection->IsAlive();
+			if (set)
+				delete set;
+			break;
+		}
 
-			while (tk.HasMoreLines())
+		char *raw = set->GetCharPtr(0);
+		size_t rawLen = 0;
+		if (binaryRead)
+		{
+			unsigned char *bytes = raw ? PQunescapeBytea((unsigned char *)raw, &rawLen) : NULL;
+			if (bytes)
 			{
-				line.Clear();
+				SplitRecords((const char *)bytes, rawLen, csv, batch->cells);
+				PQfreemem(bytes);
+			}
+		}
+		else if (raw)
+		{
+			rawLen = strlen(raw);
+			SplitRecords(raw, rawLen, csv, batch->cells);
+		}
+		delete set;
 
-				bool partial;
-				str = tk.GetNextLine(partial);
-				if (partial)
-				{
-					line = str; // Start of a log line, but not complete.  Loop back, Read more data.
-					break;
-				}
+		if (!rawLen)
+			break;
 
-				// Some extra debug checking, assuming csv logs line start with timestamps.
-				// Not really necessary, but it is good for debugging if something isn't right.
-				if (logHasTimestamp)
-				{
-					// The first field must be a Timestamp, so must start with "2009" or "201" or "202" (at least for the next 20 years).
-					// This is just an extra check to make sure we haven't gotten out of sync with the log.
-					if (str.length() > 5 && str.Left(4) != wxT("2009") && str.Left(3) != wxT("201") && str.Left(3) != wxT("202"))
-					{
-						// BUG:  We are out of sync on the log
-						wxLogNotice(wxT("Log line does not start with timestamp: %s\n"), str.c_str());
-					}
-					else if (str.length() < 20)
-					{
-						// BUG:  We are out of sync on the log, or the log is garbled
-						wxLogNotice(wxT("Log line too short: %s\n"), str.c_str());
-					}
-				}
+		offset += rawLen;
+		batch->newData = true;
 
-				// Looks like we have a good complete CSV log record.
-				addLogLine(str.Trim(), true, true);
-			}
+		// Grow the chunks while round trips are cheap, shrink them when slow
+		if (elapsed < 250 && chunkSize < STATUS_LOG_MAX_CHUNK)
+			chunkSize *= 2;
+		else if (elapsed > 1000 && chunkSize > STATUS_LOG_MIN_CHUNK)
+			chunkSize /= 2;
 
-			logList->Thaw();
-		}
-		else
+		if (len > offset)
 		{
-			// Non-csv format log file
+			batch->offset = offset;
+			PostBatch(batch);
 
-			bool hasCr = (str.Right(1) == wxT("\n"));
+			batch = new statusLogBatch;
+			batch->filename = request->filename;
+			batch->generation = request->generation;
+			batch->newData = true;
+		}
+	}
 
-			wxStringTokenizer tk(str, wxT("\n"));
+	// A file that is not written to anymore ends with its last line
+	if (!request->tail && carry.GetDataLen())
+	{
+		if (!csv)
+			AddRecord((const char *)carry.GetData(), carry.GetDataLen(), false, batch->cells);
+		carry.SetDataLen(0);
+		carryScanned = 0;
+		carryInQuote = false;
+	}
 
-			logList->Freeze();
+	batch->offset = offset;
+	batch->last = true;
+	PostBatch(batch);
+}
 
-			while (tk.HasMoreTokens())
-			{
-				str = tk.GetNextToken();
-				if (skipFirst)
-				{
-					// could be truncated
-					skipFirst = false;
-					continue;
-				}
 
-				if (tk.HasMoreTokens() || hasCr)
-					addLogLine(str.Trim());
-				else
-					line = str;
-			}
+void statusLogReader::SplitRecords(const char *data, size_t len, bool csv, wxArrayString &cells)
+{
+	carry.AppendData((void *)data, len);
 
-			logList->Thaw();
+	const char *buf = (const char *)carry.GetData();
+	size_t buflen = carry.GetDataLen();
+	size_t start = 0;
+
+	// Started in the middle of the file: skip to the beginning of a record,
+	// CSV records starting with their timestamp
+	if (resync)
+	{
+		for (start = 0; start < buflen; start++)
+		{
+			if (buf[start] == '\n' && (!csv || !logHasTimestamp ||
+			                           (start + 2 < buflen && buf[start + 1] == '2' && buf[start + 2] == '0')))
+				break;
+		}
+		if (start >= buflen)
+		{
+			carry.SetDataLen(0);
+			carryScanned = 0;
+			return;
 		}
+		start++;
+		carryScanned = start;
+		resync = false;
 	}
 
-	savedPartialLine.clear();
-
-	if (!line.IsEmpty())
+	// Only the new bytes get scanned; a newline inside a quoted
+	// CSV field doesn't end the record
+	for (size_t pos = carryScanned; pos < buflen; pos++)
 	{
-		// We finished reading to the end of the log file, but still have some data left
-		if (csv_log_format)
+		if (csv && buf[pos] == '"')
+			carryInQuote = !carryInQuote;
+		else if (buf[pos] == '\n' && !carryInQuote)
 		{
-			savedPartialLine = line;    // Save partial log line for next read of the data file.
-			line.Clear();
+			AddRecord(buf + start, pos - start, csv, cells);
+			start = pos + 1;
 		}
-		else
-			addLogLine(line.Trim());
 	}
 
+	// Keep the incomplete record for the next chunk
+	if (start)
+	{
+		size_t rest = buflen - start;
+		if (rest)
+			memmove(carry.GetData(), buf + start, rest);
+		carry.SetDataLen(rest);
+	}
+	carryScanned = carry.GetDataLen();
+}
+
+
+void statusLogReader::AddRecord(const char *data, size_t len, bool csv, wxArrayString &cells)
+{
+	if (len && data[len - 1] == '\r')
+		len--;
+	if (!len)
+		return;
+
+	// Each record is converted on its own, so that a log holding
+	// entries in several encodings still shows all of them
+	wxString str(data, wxConvUTF8, len);
+	if (str.IsEmpty())
+		str = wxString(data, wxConvLibc, len);
+
+	ParseLine(str.Trim(), true, csv, cells);
+}
+
+
+void statusLogReader::NewRow(wxArrayString &cells, const wxString &first) const
+{
+	cells.Add(first);
+	for (size_t col = 1; col < nCols; col++)
+		cells.Add(wxEmptyString);
 }
 
 
-void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_format)
+void statusLogReader::SetCell(wxArrayString &cells, int col, const wxString &value) const
 {
-	int row = logList->GetItemCount();
+	if (col >= 0 && (size_t)col < nCols && cells.GetCount() >= nCols)
+		cells[cells.GetCount() - nCols + col] = value;
+}
+
 
+void statusLogReader::ParseLine(const wxString &str, bool formatted, bool csv_log_format, wxArrayString &cells) const
+{
 	int idxTimeStampCol = -1, idxLevelCol = -1;
 	int idxLogEntryCol = 0;
 
@@ -2132,26 +2690,26 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 	}
 
 	if (!logFormatKnown)
-		logList->AppendItem(-1, str);
+		NewRow(cells, str);
 	else if ((!csv_log_format) && str.Find(':') < 0)
 	{
 		// Must be a continuation of a previous line.
-		logList->InsertItem(row, wxEmptyString, -1);
-		logList->SetItem(row, idxLogEntryCol, str);
+		NewRow(cells, wxEmptyString);
+		SetCell(cells, idxLogEntryCol, str);
 	}
 	else if (!formatted)
 	{
 		// Not from a log, from pgAdmin itself.
 		if (logHasTimestamp)
 		{
-			logList->InsertItem(row, wxEmptyString, -1);
-			logList->SetItem(row, idxLevelCol, str.BeforeFirst(':'));
+			NewRow(cells, wxEmptyString);
+			SetCell(cells, idxLevelCol, str.BeforeFirst(':'));
 		}
 		else
 		{
-			logList->InsertItem(row, str.BeforeFirst(':'), -1);
+			NewRow(cells, str.BeforeFirst(':'));
 		}
-		logList->SetItem(row, idxLogEntryCol, str.AfterFirst(':'));
+		SetCell(cells, idxLogEntryCol, str.AfterFirst(':'));
 	}
 	else // formatted log
 	{
@@ -2166,16 +2724,14 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 				// Must be a continuation of the previous line or garbage,
 				// or we are out of sync in our CSV handling.
 				// We shouldn't ever get here.
-				logList->InsertItem(row, wxEmptyString, -1);
-				logList->SetItem(row, 2, str);
+				NewRow(cells, wxEmptyString);
+				SetCell(cells, 2, str);
 			}
 			else
 			{
 				CSVTokenizer tk(str);
 
-				bool gpdb = connection->GetIsGreenplum();
-
-				// Get the fields from the CSV log.
+								// Get the fields from the CSV log.
 				wxString logTime = tk.GetNextToken();
 				wxString logUser = tk.GetNextToken();
 				wxString logDatabase = tk.GetNextToken();
@@ -2233,20 +2789,20 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 				else
 					wxString logFuncFileLine = tk.GetNextToken();
 
-				logList->InsertItem(row, logTime, -1);      // Insert timestamp (with time zone)
+				NewRow(cells, logTime);      // Insert timestamp (with time zone)
 
-				logList->SetItem(row, 1, logSeverity);
+				SetCell(cells, 1, logSeverity);
 
 				// Display the logMessage, breaking it into lines
 				wxStringTokenizer lm(logMessage, wxT("\n"));
-				logList->SetItem(row, 2, lm.GetNextToken());
+				SetCell(cells, 2, lm.GetNextToken());
 
-				logList->SetItem(row, 3, logSession);
-				logList->SetItem(row, 4, logCmdcount);
-				logList->SetItem(row, 5, logDatabase);
+				SetCell(cells, 3, logSession);
+				SetCell(cells, 4, logCmdcount);
+				SetCell(cells, 5, logDatabase);
 				if ((!gpdb) || (logSegment.length() > 0 && logSegment != wxT("seg-1")))
 				{
-					logList->SetItem(row, 6, logSegment);
+					SetCell(cells, 6, logSegment);
 				}
 				else
 				{
@@ -2264,7 +2820,7 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 							logSegment = logMessage.Mid(segpos + 1);
 							if (logSegment.Find(wxT(' ')) > 0)
 								logSegment = logSegment.Mid(0, logSegment.Find(wxT(' ')));
-							logList->SetItem(row, 6, logSegment);
+							SetCell(cells, 6, logSegment);
 						}
 					}
 				}
@@ -2272,27 +2828,24 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 				// The rest of the lines from the logMessage
 				while (lm.HasMoreTokens())
 				{
-					int controw = logList->GetItemCount();
-					logList->InsertItem(controw, wxEmptyString, -1);
-					logList->SetItem(controw, 2, lm.GetNextToken());
+					NewRow(cells, wxEmptyString);
+					SetCell(cells, 2, lm.GetNextToken());
 				}
 
 				// Add the detail
 				wxStringTokenizer ld(logDetail, wxT("\n"));
 				while (ld.HasMoreTokens())
 				{
-					int controw = logList->GetItemCount();
-					logList->InsertItem(controw, wxEmptyString, -1);
-					logList->SetItem(controw, 2, ld.GetNextToken());
+					NewRow(cells, wxEmptyString);
+					SetCell(cells, 2, ld.GetNextToken());
 				}
 
 				// And the hint
 				wxStringTokenizer lh(logHint, wxT("\n"));
 				while (lh.HasMoreTokens())
 				{
-					int controw = logList->GetItemCount();
-					logList->InsertItem(controw, wxEmptyString, -1);
-					logList->SetItem(controw, 2, lh.GetNextToken());
+					NewRow(cells, wxEmptyString);
+					SetCell(cells, 2, lh.GetNextToken());
 				}
 
 				if (logDebug.length() > 0)
@@ -2306,15 +2859,13 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 						wxStringTokenizer lh(logDebug, wxT("\n"));
 						if (lh.HasMoreTokens())
 						{
-							int controw = logList->GetItemCount();
-							logList->InsertItem(controw, wxEmptyString, -1);
-							logList->SetItem(controw, 2, wxT("statement: ") + lh.GetNextToken());
+							NewRow(cells, wxEmptyString);
+							SetCell(cells, 2, wxT("statement: ") + lh.GetNextToken());
 						}
 						while (lh.HasMoreTokens())
 						{
-							int controw = logList->GetItemCount();
-							logList->InsertItem(controw, wxEmptyString, -1);
-							logList->SetItem(controw, 2, lh.GetNextToken());
+							NewRow(cells, wxEmptyString);
+							SetCell(cells, 2, lh.GetNextToken());
 						}
 					}
 				}
@@ -2327,21 +2878,19 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 						wxStringTokenizer ls(logStack, wxT("\n"));
 						if (ls.HasMoreTokens())
 						{
-							int controw = logList->GetItemCount();
-							logList->InsertItem(controw, wxEmptyString, -1);
-							logList->SetItem(controw, 1, wxT("STACK"));
-							logList->SetItem(controw, 2, ls.GetNextToken());
+							NewRow(cells, wxEmptyString);
+							SetCell(cells, 1, wxT("STACK"));
+							SetCell(cells, 2, ls.GetNextToken());
 						}
 						while (ls.HasMoreTokens())
 						{
-							int controw = logList->GetItemCount();
-							logList->InsertItem(controw, wxEmptyString, -1);
-							logList->SetItem(controw, 2, ls.GetNextToken());
+							NewRow(cells, wxEmptyString);
+							SetCell(cells, 2, ls.GetNextToken());
 						}
 					}
 			}
 		}
-		else if (connection->GetIsGreenplum())
+		else if (gpdb)
 		{
 			// Greenplum 3.2 and before.  log_line_prefix =  "%m|%u|%d|%p|%I|%X|:-"
 
@@ -2364,21 +2913,21 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 			{
 				// No Timestamp?  Must be a continuation of a previous line?
 				// Not sure if it is possible to get here.
-				logList->InsertItem(row, wxEmptyString, -1);
-				logList->SetItem(row, 2, rest);
+				NewRow(cells, wxEmptyString);
+				SetCell(cells, 2, rest);
 			}
 			else if (logSeverity.Length() > 1)
 			{
 				// Normal case:  Start of a new log record.
-				logList->InsertItem(row, ts, -1);
-				logList->SetItem(row, 1, logSeverity);
-				logList->SetItem(row, 2, rest);
+				NewRow(cells, ts);
+				SetCell(cells, 1, logSeverity);
+				SetCell(cells, 2, rest);
 			}
 			else
 			{
 				// Continuation of previous line
-				logList->InsertItem(row, wxEmptyString, -1);
-				logList->SetItem(row, 2, rest);
+				NewRow(cells, wxEmptyString);
+				SetCell(cells, 2, rest);
 			}
 		}
 		else
@@ -2395,15 +2944,15 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 					wxString ts = str.Mid(logFmtPos, str.Length() - rest.Length() - logFmtPos - 1);
 
 					int pos = ts.Find(logFormat.c_str()[logFmtPos + 2], true);
-					logList->InsertItem(row, ts.Left(pos), -1);
-					logList->SetItem(row, idxLevelCol, ts.Mid(pos + logFormat.Length() - logFmtPos - 2));
-					logList->SetItem(row, idxLogEntryCol, rest.Mid(2));
+					NewRow(cells, ts.Left(pos));
+					SetCell(cells, idxLevelCol, ts.Mid(pos + logFormat.Length() - logFmtPos - 2));
+					SetCell(cells, idxLogEntryCol, rest.Mid(2));
 				}
 				else
 				{
-					logList->InsertItem(row, wxEmptyString, -1);
-					logList->SetItem(row, idxLevelCol, str.BeforeFirst(':'));
-					logList->SetItem(row, idxLogEntryCol, str.AfterFirst(':').Mid(2));
+					NewRow(cells, wxEmptyString);
+					SetCell(cells, idxLevelCol, str.BeforeFirst(':'));
+					SetCell(cells, idxLogEntryCol, str.AfterFirst(':').Mid(2));
 				}
 			}
 			else
@@ -2416,11 +2965,11 @@ void frmStatus::addLogLine(const wxString &str, bool formatted, bool csv_log_for
 				int pos = rest.Find(':');
 
 				if (pos < 0)
-					logList->InsertItem(row, rest, -1);
+					NewRow(cells, rest);
 				else
 				{
-					logList->InsertItem(row, rest.BeforeFirst(':'), -1);
-					logList->SetItem(row, idxLogEntryCol, rest.AfterFirst(':').Mid(2));
+					NewRow(cells, rest.BeforeFirst(':'));
+					SetCell(cells, idxLogEntryCol, rest.AfterFirst(':').Mid(2));
 				}
 			}
 		}
@@ -2497,7 +3046,8 @@ void frmStatus::OnLoadLogfile(wxCommandEvent &event)
 
 		if (ts != NULL && (!logfileTimestamp.IsValid() || *ts != logfileTimestamp))
 		{
-			logList->DeleteAllItems();
+			logReader->Reset();
+			logList->ClearRows();
 			addLogFile(ts, true);
 		}
 	}
@@ -3049,6 +3599,7 @@ void frmStatus::OnSortStatusGrid(wxListEvent &event)
 		SetColumnImage(statusList, statusSortColumn - 1, 1);
 
 	// Refresh grid
+	statusList->Resort();
 	wxTimerEvent evt;
 	OnRefreshStatusTimer(evt);
 }
@@ -3090,6 +3641,7 @@ void frmStatus::OnSortLockGrid(wxListEvent &event)
 		SetColumnImage(lockList, lockSortColumn - 1, 1);
 
 	// Refresh grid
+	lockList->Resort();
 	wxTimerEvent evt;
 	OnRefreshLocksTimer(evt);
 }
@@ -3171,6 +3723,221 @@ void frmStatus::OnChgColSizeXactGrid(wxListEvent &event)
 }
 
 
+wxString statusSnapshot::GetVal(long row, const wxString &colname) const
+{
+	for (size_t col = 0; col < nCols; col++)
+	{
+		if (colNames.Item(col) == colname)
+			return cells.Item(row * nCols + col);
+	}
+	return wxEmptyString;
+}
+
+
+long statusSnapshot::GetLong(long row, const wxString &colname) const
+{
+	return StrToLong(GetVal(row, colname));
+}
+
+
+bool statusSnapshot::GetBool(long row, const wxString &colname) const
+{
+	return StrToBool(GetVal(row, colname));
+}
+
+
+statusCollector::statusCollector(frmStatus *_form, pgConn *conn)
+	: wxThread(wxTHREAD_JOINABLE), collectorCond(collectorLock)
+{
+	form = _form;
+	connection = NULL;
+	nextConnection = conn;
+	backendPid = (conn && conn->GetStatus() == PGCONN_OK) ? conn->GetBackendPID() : 0;
+	stopping = false;
+	switching = true;
+
+	for (int pane = 0; pane <= PANE_LOG; pane++)
+	{
+		busy[pane] = false;
+		queued[pane] = false;
+	}
+}
+
+
+statusCollector::~statusCollector()
+{
+	if (connection)
+		delete connection;
+	if (nextConnection)
+		delete nextConnection;
+}
+
+
+bool statusCollector::Collect(int pane, const wxString &sql)
+{
+	wxMutexLocker lock(collectorLock);
+
+	if (stopping || busy[pane])
+		return false;
+
+	busy[pane] = true;
+	queued[pane] = true;
+	pending[pane] = sql;
+	collectorCond.Signal();
+
+	return true;
+}
+
+
+void statusCollector::Done(int pane)
+{
+	wxMutexLocker lock(collectorLock);
+	busy[pane] = false;
+}
+
+
+void statusCollector::SetConnection(pgConn *conn)
+{
+	wxMutexLocker lock(collectorLock);
+
+	if (nextConnection)
+		delete nextConnection;
+	nextConnection = conn;
+	switching = true;
+	backendPid = (conn && conn->GetStatus() == PGCONN_OK) ? conn->GetBackendPID() : 0;
+}
+
+
+long statusCollector::GetBackendPID()
+{
+	wxMutexLocker lock(collectorLock);
+	return backendPid;
+}
+
+
+void statusCollector::Stop()
+{
+	wxMutexLocker lock(collectorLock);
+
+	stopping = true;
+	if (connection)
+		connection->CancelExecution();
+	collectorCond.Signal();
+}
+
+
+void *statusCollector::Entry()
+{
+	while (true)
+	{
+		int pane = 0;
+		wxString sql;
+
+		{
+			wxMutexLocker lock(collectorLock);
+
+			while (!stopping)
+			{
+				for (pane = PANE_STATUS; pane <= PANE_LOG; pane++)
+				{
+					if (queued[pane])
+						break;
+				}
+				if (pane <= PANE_LOG)
+					break;
+				collectorCond.Wait();
+			}
+			if (stopping)
+				break;
+
+			// Switch to the new connection while nothing runs on the old one
+			if (switching)
+			{
+				if (connection)
+					delete connection;
+				connection = nextConnection;
+				nextConnection = NULL;
+				switching = false;
+			}
+
+			queued[pane] = false;
+			sql = pending[pane];
+		}
+
+		// Without a connection the tick is skipped: an empty snapshot
+		// only makes the pane ready for the next refresh
+		if (connection && connection->GetStatus() != PGCONN_OK)
+			Reconnect();
+		if (connection && connection->GetStatus() == PGCONN_OK)
+			PostSnapshot(Query(connection, pane, sql));
+		else
+			PostSnapshot(new statusSnapshot(pane));
+	}
+
+	return NULL;
+}
+
+
+// Opens a new connection like the one that failed or broke, in this
+// thread so that the window never waits for the server
+void statusCollector::Reconnect()
+{
+	pgConn *conn = connection->Duplicate();
+	if (conn->GetStatus() != PGCONN_OK)
+	{
+		delete conn;
+		return;
+	}
+
+	frmStatus::SetQuietLogging(conn);
+
+	wxMutexLocker lock(collectorLock);
+	delete connection;
+	connection = conn;
+	backendPid = conn->GetBackendPID();
+}
+
+
+statusSnapshot *statusCollector::Query(pgConn *conn, int pane, const wxString &sql)
+{
+	statusSnapshot *snapshot = new statusSnapshot(pane);
+	pgSet *set = conn->ExecuteSet(sql, false);
+	if (set && conn->GetLastResultStatus() == PGRES_TUPLES_OK)
+	{
+		snapshot->nCols = set->NumCols();
+		for (size_t col = 0; col < snapshot->nCols; col++)
+			snapshot->colNames.Add(set->ColName(col));
+
+		snapshot->cells.Alloc(set->NumRows() * snapshot->nCols);
+		while (!set->Eof())
+		{
+			for (size_t col = 0; col < snapshot->nCols; col++)
+				snapshot->cells.Add(set->GetVal(col));
+			set->MoveNext();
+		}
+		snapshot->ok = true;
+	}
+	else
+		snapshot->broken = !conn->IsAlive();
+	if (set)
+		delete set;
+
+	return snapshot;
+}
+
+
+void statusCollector::PostSnapshot(statusSnapshot *snapshot)
+{
+	wxCommandEvent ev(wxEVT_COMMAND_MENU_SELECTED, STATUS_SNAPSHOT_ID);
+	ev.SetClientData(snapshot);
+#if wxCHECK_VERSION(2, 9, 0)
+	form->GetEventHandler()->AddPendingEvent(ev);
+#else
+	form->AddPendingEvent(ev);
+#endif
+}
+
+
 serverStatusFactory::serverStatusFactory(menuFactoryList *list, wxMenu *mnu, ctlMenuToolbar *toolbar) : actionFactory(list)
 {
 	mnu->Append(id, _("&Server Status"), _("Displays the current database status."));
@@ -18,6 +18,7 @@
 
 // App headers
 #include "gqb/gqbBrowser.h"
+#include "gqb/gqbCatalogCache.h"
 #include "gqb/gqbEvents.h"
 #include "gqb/gqbSchema.h"
 #include "gqb/gqbDatabase.h"
@@ -36,7 +37,10 @@
 
 BEGIN_EVENT_TABLE(gqbBrowser, wxTreeCtrl)
 	EVT_TREE_ITEM_ACTIVATED(GQB_BROWSER, gqbBrowser::OnItemActivated)
+	EVT_TREE_ITEM_EXPANDING(GQB_BROWSER, gqbBrowser::OnItemExpanding)
 	EVT_TREE_BEGIN_DRAG(GQB_BROWSER, gqbBrowser::OnBeginDrag)
+	EVT_TREE_ITEM_MENU(GQB_BROWSER, gqbBrowser::OnItemMenu)
+	EVT_MENU(GQB_REFRESH, gqbBrowser::OnRefresh)
 END_EVENT_TABLE()
 
 gqbBrowser::gqbBrowser(wxWindow *parent, wxWindowID id, const wxPoint &pos, const wxSize &size, long style, gqbController *_controller)
@@ -44,6 +48,7 @@ gqbBrowser::gqbBrowser(wxWindow *parent, wxWindowID id, const wxPoint &pos, cons
 {
 	controller = _controller;
 	rootNode = (wxTreeItemId *)NULL;
+	conn = NULL;
 
 	// Create normal images list of browser
 	// Remember to update enum gqbImages in gqbBrowser.h if changing the images!!
@@ -65,6 +70,9 @@ gqbBrowser::gqbBrowser(wxWindow *parent, wxWindowID id, const wxPoint &pos, cons
 gqbBrowser::~gqbBrowser()
 {
 	this->DeleteAllItems();        // This remove and delete data inside tree's node
+
+	if (!cacheKey.IsEmpty())
+		gqbCatalogCache::release(cacheKey);
 }
 
 
@@ -91,17 +99,65 @@ void gqbBrowser::OnItemActivated(wxTreeEvent &event)
 			controller->addTableToModel(item, wxPoint(10, 10));
 			controller->getView()->Refresh();
 		}
-		else if (GetChildrenCount(itemId) == 0 && object->getType() == GQB_SCHEMA)
-		{
-			gqbSchema *schema = (gqbSchema *)object;
-			schema->createObjects(this, schema->getOid(), itemId, GQB_IMG_TABLE, GQB_IMG_VIEW, GQB_IMG_EXTTABLE);
-		}
+		else if (object->getType() == GQB_SCHEMA)
+			populateSchema(itemId);
 	}
 
 }
 
+
+// Schemas get their tables and views the first time they are expanded
+void gqbBrowser::OnItemExpanding(wxTreeEvent &event)
+{
+	populateSchema(event.GetItem());
+}
+
+
+void gqbBrowser::populateSchema(wxTreeItemId itemId)
+{
+	gqbObject *object = (gqbObject *) GetItemData(itemId);
+	if (object && object->getType() == GQB_SCHEMA && GetChildrenCount(itemId, false) == 0)
+	{
+		gqbSchema *schema = (gqbSchema *)object;
+		wxBusyCursor wait;
+		schema->createObjects(this, schema->getOid(), itemId, GQB_IMG_TABLE, GQB_IMG_VIEW, GQB_IMG_EXTTABLE);
+	}
+}
+
+// The catalog cache is shared by the Query tool windows and only read
+// again when it expires, so the user can ask for the objects to be reread
+void gqbBrowser::OnItemMenu(wxTreeEvent &event)
+{
+	if (!conn)
+		return;
+
+	wxMenu menu;
+	menu.Append(GQB_REFRESH, _("&Refresh"));
+	PopupMenu(&menu, event.GetPoint());
+}
+
+
+void gqbBrowser::OnRefresh(wxCommandEvent &WXUNUSED(event))
+{
+	if (!conn)
+		return;
+
+	gqbCatalogCache::invalidate(conn);
+	refreshTables(conn);
+	controller->getView()->Refresh();
+}
+
+
 void gqbBrowser::refreshTables(pgConn *connection)
 {
+	// The previous connection may have been to another database. The new
+	// cache is held first so that the same one is not freed and read again.
+	wxString previousKey = cacheKey;
+	cacheKey = gqbCatalogCache::acquire(connection);
+	if (!previousKey.IsEmpty())
+		gqbCatalogCache::release(previousKey);
+	conn = connection;
+
 	controller->emptyModel();
 	this->DeleteAllItems();
 	gqbDatabase *Data = new gqbDatabase(wxEmptyString, connection);
@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// gqbCatalogCache.cpp - Relations and columns read for the GQB browser
+//
+//////////////////////////////////////////////////////////////////////////
+
+// App headers
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// App headers
+#include "gqb/gqbCatalogCache.h"
+
+gqbCatalogCacheHash gqbCatalogCache::caches;
+
+
+gqbCatalogCache::gqbCatalogCache()
+{
+	created = wxGetLocalTime();
+	showSystemObjects = settings->GetShowSystemObjects();
+	users = 0;
+}
+
+
+gqbCatalogCache::~gqbCatalogCache()
+{
+	clear();
+}
+
+
+void gqbCatalogCache::clear()
+{
+	gqbRelationsHash::iterator it;
+	for (it = relations.begin(); it != relations.end(); ++it)
+		delete it->second;
+	relations.clear();
+	columns.clear();
+
+	created = wxGetLocalTime();
+	showSystemObjects = settings->GetShowSystemObjects();
+}
+
+
+wxString gqbCatalogCache::keyFor(pgConn *conn)
+{
+	return conn->GetPoolServer() + wxT("\n") + conn->GetDbname() + wxT("\n")
+	       + conn->GetUser() + wxT("\n") + conn->GetRole();
+}
+
+
+gqbCatalogCache *gqbCatalogCache::forConnection(pgConn *conn)
+{
+	wxString key = keyFor(conn);
+
+	gqbCatalogCache *cache = caches[key];
+	if (!cache)
+	{
+		cache = new gqbCatalogCache();
+		caches[key] = cache;
+	}
+	else if (wxGetLocalTime() - cache->created > GQB_CACHE_MAX_AGE ||
+	         cache->showSystemObjects != settings->GetShowSystemObjects())
+		cache->clear();
+
+	return cache;
+}
+
+
+wxString gqbCatalogCache::acquire(pgConn *conn)
+{
+	forConnection(conn)->users++;
+
+	return keyFor(conn);
+}
+
+
+void gqbCatalogCache::invalidate(pgConn *conn)
+{
+	gqbCatalogCacheHash::iterator it = caches.find(keyFor(conn));
+	if (it != caches.end() && it->second)
+		it->second->clear();
+}
+
+
+void gqbCatalogCache::release(const wxString &key)
+{
+	gqbCatalogCacheHash::iterator it = caches.find(key);
+	if (it == caches.end())
+		return;
+
+	gqbCatalogCache *cache = it->second;
+	if (cache && --cache->users > 0)
+		return;
+
+	delete cache;
+	caches.erase(it);
+}
+
+
+gqbCachedRelations *gqbCatalogCache::getRelations(pgConn *conn, OID schemaOid)
+{
+	gqbCachedRelations *rels = relations[schemaOid];
+	if (rels)
+		return rels;
+
+	rels = new gqbCachedRelations();
+	relations[schemaOid] = rels;
+
+	wxString query = wxT("SELECT oid, relname, relkind\n")
+	                 wxT("  FROM pg_class\n")
+	                 wxT(" WHERE relkind IN ('r','v','x','m') AND relnamespace = ") + NumToStr(schemaOid) + wxT(";");
+
+	pgSet *tables = conn->ExecuteSet(query);
+	if (tables)
+	{
+		while (!tables->Eof())
+		{
+			rels->oids.Add((long)tables->GetOid(wxT("oid")));
+			rels->names.Add(tables->GetVal(wxT("relname")));
+			rels->kinds.Add(tables->GetVal(wxT("relkind")));
+			tables->MoveNext();
+		}
+		delete tables;
+	}
+
+	return rels;
+}
+
+
+const wxArrayString &gqbCatalogCache::getColumns(pgConn *conn, OID relOid)
+{
+	gqbColumnsHash::iterator it = columns.find(relOid);
+	if (it != columns.end())
+		return it->second;
+
+	// Relations without columns must not be read again
+	wxArrayString &names = columns[relOid];
+
+	wxString systemRestriction;
+	if (!showSystemObjects)
+		systemRestriction = wxT("\n   AND attnum > 0");
+
+	wxString sql =
+	    wxT("SELECT attname FROM pg_attribute att\n")
+	    wxT(" WHERE attrelid = ") + NumToStr(relOid)
+	    + systemRestriction + wxT("\n")
+	    wxT("   AND attisdropped IS FALSE\n")
+	    wxT(" ORDER BY attnum");
+
+	pgSet *set = conn->ExecuteSet(sql);
+	if (set)
+	{
+		while (!set->Eof())
+		{
+			names.Add(set->GetVal(wxT("attname")));
+			set->MoveNext();
+		}
+		delete set;
+	}
+
+	return names;
+}
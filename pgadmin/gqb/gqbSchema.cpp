@@ -20,6 +20,7 @@
 #include "gqb/gqbObject.h"
 #include "gqb/gqbTable.h"
 #include "gqb/gqbBrowser.h"
+#include "gqb/gqbCatalogCache.h"
 
 gqbSchema::gqbSchema(gqbObject *parent, wxString name, pgConn *connection, OID oid)
 	: gqbObject(name, parent, connection, oid)
@@ -36,49 +37,36 @@ void gqbSchema::createObjects(gqbBrowser *tablesBrowser, OID oidVal, wxTreeItemI
 
 void gqbSchema::createTables(gqbBrowser *tablesBrowser, wxTreeItemId parentNode, OID oidVal, int tableImage, int viewImage, int xTableImage)
 {
-	wxString query;
+	// Get the child objects; their columns are read when first needed.
+	gqbCachedRelations *tables = gqbCatalogCache::forConnection(conn)->getRelations(conn, oidVal);
 
-	// Get the child objects.
-	query = wxT("SELECT oid, relname, relkind\n")
-	        wxT("  FROM pg_class\n")
-	        wxT(" WHERE relkind IN ('r','v','x','m') AND relnamespace = ") + NumToStr(oidVal) + wxT(";");
-
-	pgSet *tables = conn->ExecuteSet(query);
-	wxTreeItemId parent;
-
-	if (tables)
+	size_t i;
+	for (i = 0; i < tables->oids.GetCount(); i++)
 	{
-		while (!tables->Eof())
-		{
-			gqbTable *table = 0;
-			wxString tmpname = tables->GetVal(wxT("relname"));
-			wxString relkind = tables->GetVal(wxT("relkind"));
+		gqbTable *table = 0;
+		OID tableOid = (OID)tables->oids.Item(i);
+		wxString tmpname = tables->names.Item(i);
+		wxString relkind = tables->kinds.Item(i);
 
-			if (relkind == wxT("r")) // Table
-			{
-				table = new gqbTable(this, tmpname, conn, GQB_TABLE, tables->GetOid(wxT("oid")));
-				parent = tablesBrowser->AppendItem(parentNode, tables->GetVal(wxT("relname")) , tableImage, tableImage, table);
-			}
-			else if (relkind == wxT("v") || relkind == wxT("m"))
-			{
-				table = new gqbTable(this, tmpname, conn, GQB_VIEW, tables->GetOid(wxT("oid")));
-				parent = tablesBrowser->AppendItem(parentNode, tables->GetVal(wxT("relname")) , viewImage, viewImage, table);
-			}
-			else if (relkind == wxT("x"))  // Greenplum external table
-			{
-				table = new gqbTable(this, tmpname, conn, GQB_TABLE, tables->GetOid(wxT("oid")));
-				parent = tablesBrowser->AppendItem(parentNode, tables->GetVal(wxT("relname")), xTableImage, xTableImage, table);
-			}
-
-			// Create columns inside this table.
-			if (table)
-				table->createObjects(tablesBrowser, conn, tables->GetOid(wxT("oid")), parent);
-
-			tables->MoveNext();
+		if (relkind == wxT("r")) // Table
+		{
+			table = new gqbTable(this, tmpname, conn, GQB_TABLE, tableOid);
+			tablesBrowser->AppendItem(parentNode, tmpname, tableImage, tableImage, table);
+		}
+		else if (relkind == wxT("v") || relkind == wxT("m"))
+		{
+			table = new gqbTable(this, tmpname, conn, GQB_VIEW, tableOid);
+			tablesBrowser->AppendItem(parentNode, tmpname, viewImage, viewImage, table);
+		}
+		else if (relkind == wxT("x"))  // Greenplum external table
+		{
+			table = new gqbTable(this, tmpname, conn, GQB_TABLE, tableOid);
+			tablesBrowser->AppendItem(parentNode, tmpname, xTableImage, xTableImage, table);
 		}
-
-		delete tables;
 	}
 
-	tablesBrowser->SortChildren(parentNode);
+	if (tables->oids.IsEmpty())
+		tablesBrowser->SetItemHasChildren(parentNode, false);
+	else
+		tablesBrowser->SortChildren(parentNode);
 }
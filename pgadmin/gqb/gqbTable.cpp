@@ -20,16 +20,19 @@
 #include "gqb/gqbTable.h"
 #include "gqb/gqbColumn.h"
 #include "gqb/gqbArrayCollection.h"
+#include "gqb/gqbCatalogCache.h"
 
 gqbTable::gqbTable(gqbObject *parent, wxString name, pgConn *connection, type_gqbObject type, OID oid)
 	: gqbObjectCollection(name, parent, connection, oid)
 {
 	setType(type);
+	columnsLoaded = false;
 }
 
 
 gqbIteratorBase *gqbTable::createColumnsIterator()
 {
+	loadColumns();
 	return createIterator();
 }
 
@@ -40,44 +43,21 @@ void gqbTable::addColumn(gqbColumn *column)
 }
 
 
-void gqbTable::createObjects(gqbBrowser *_tablesBrowser,  pgConn *_conn, OID oidVal,  wxTreeItemId parentNode)
+// Read the columns the first time they are needed, i.e. when the table is
+// added to the model, rather than when the schema is expanded.
+void gqbTable::loadColumns()
 {
-	createColumns(_conn, _tablesBrowser, parentNode, oidVal);
-}
-
-void gqbTable::createColumns(pgConn *conn, gqbBrowser *tablesBrowser, wxTreeItemId parentNode,  OID oidVal)
-{
-
-	wxString systemRestriction;
-	if (!settings->GetShowSystemObjects())
-		systemRestriction = wxT("\n   AND attnum > 0");
+	if (columnsLoaded)
+		return;
+	columnsLoaded = true;
 
-	wxString sql =
-	    wxT("SELECT attname FROM pg_attribute att\n")
-	    wxT(" WHERE attrelid = ")
-	    + NumToStr(oidVal)
-	    + systemRestriction + wxT("\n")
-	    wxT("   AND attisdropped IS FALSE\n")
-	    wxT(" ORDER BY attnum");
+	const wxArrayString &names = gqbCatalogCache::forConnection(conn)->getColumns(conn, getOid());
 
-	pgSet *columns = conn->ExecuteSet(sql);
-	if (columns)
+	size_t i;
+	for (i = 0; i < names.GetCount(); i++)
 	{
-		while (!columns->Eof())
-		{
-			if (tablesBrowser)
-			{
-				//Disable, Column SHOULDN'T be added to tree only use for debug purposes tablesBrowser->AppendItem(parentNode, columns->GetVal(wxT("attname")) , -1, -1);
-				wxString tmpname = wxString(columns->GetVal(wxT("attname")));
-				gqbColumn *column = new gqbColumn(this, tmpname, conn);
-				this->addColumn(column);
-				columns->MoveNext();
-			}
-			else
-				break;
-		}
-
-		delete columns;
+		gqbColumn *column = new gqbColumn(this, names.Item(i), conn);
+		this->addColumn(column);
 	}
 }
 
@@ -85,6 +65,7 @@ void gqbTable::createColumns(pgConn *conn, gqbBrowser *tablesBrowser, wxTreeItem
 //work as a synonym for function
 int gqbTable::countCols()
 {
+	loadColumns();
 	return this->countObjects();
 }
 
@@ -92,11 +73,13 @@ int gqbTable::countCols()
 //work as a synonym for function & return correct type
 gqbColumn *gqbTable::getColumnAtIndex(int index)
 {
+	loadColumns();
 	return (gqbColumn *)this->getObjectAtIndex(index);
 }
 
 
 int gqbTable::indexColumn(gqbColumn *col)
 {
+	loadColumns();
 	return this->indexObject(col);
 }
@@ -12,6 +12,7 @@
 pgadmin3_SOURCES += \
 	gqb/gqbArrayCollection.cpp \
 	gqb/gqbBrowser.cpp \
+	gqb/gqbCatalogCache.cpp \
 	gqb/gqbCollection.cpp \
 	gqb/gqbColumn.cpp \
 	gqb/gqbController.cpp \
@@ -93,17 +93,21 @@ void hdChangeConnectionHandle::invokeEnd(hdMouseEvent &event, hdDrawingView *vie
 hdIFigure *hdChangeConnectionHandle::findConnectableFigure (int posIdx, int x, int y, hdDrawing *drawing)
 {
 	hdIFigure *out = NULL;
-	hdIteratorBase *iterator = drawing->figuresInverseEnumerator();
-	while(iterator->HasNext())
+	wxArrayPtrVoid candidates;
+	hdRect point(x, y, 1, 1);
+	drawing->findFigures(posIdx, point, candidates);
+
+	//Front to back
+	int i;
+	for(i = candidates.GetCount() - 1; i >= 0; i--)
 	{
-		hdIFigure *figure = (hdIFigure *) iterator->Next();
+		hdIFigure *figure = (hdIFigure *) candidates.Item(i);
 		if(figure->containsPoint(posIdx, x, y) && isConnectionPossible(figure))
 		{
 			out = figure;
 			break;
 		}
 	}
-	delete iterator;
 	return out;
 }
 hdIConnector *hdChangeConnectionHandle::findConnectionTarget(int posIdx, int x, int y, hdDrawing *drawing)
@@ -57,10 +57,12 @@ void hdDrawing::add(hdIFigure *figure)
 {
 	if(figures)
 		figures->addItem(figure);
+	spatialIndex.invalidate();
 }
 
 void hdDrawing::remove(hdIFigure *figure)
 {
+	spatialIndex.invalidate();
 	if(figures)
 	{
 		figures->removeItem(figure);
@@ -76,13 +78,24 @@ bool hdDrawing::includes(hdIFigure *figure)
 	return false;
 }
 
+hdSpatialIndex &hdDrawing::getIndex(int posIdx)
+{
+	if(!spatialIndex.isValid(posIdx))
+		spatialIndex.rebuild(figures, posIdx);
+	return spatialIndex;
+}
+
 hdIFigure *hdDrawing::findFigure(int posIdx, int x, int y)
 {
 	hdIFigure *tmp = NULL, *out = NULL;
-	hdIteratorBase *iterator = figures->createIterator();
-	while(iterator->HasNext())
+	wxArrayPtrVoid candidates;
+	hdRect point(x, y, 1, 1);
+	getIndex(posIdx).query(point, candidates);
+
+	size_t i;
+	for(i = 0; i < candidates.GetCount(); i++)
 	{
-		tmp = (hdIFigure *)iterator->Next();
+		tmp = (hdIFigure *)candidates.Item(i);
 		if(tmp->containsPoint(posIdx, x, y))
 		{
 			out = tmp;
@@ -90,32 +103,18 @@ hdIFigure *hdDrawing::findFigure(int posIdx, int x, int y)
 		}
 	}
 
-	delete iterator;;
-
 	return out;
 }
 
-void hdDrawing::recalculateDisplayBox(int posIdx)
+//Figures which may intersect rect, in drawing order
+void hdDrawing::findFigures(int posIdx, hdRect &rect, wxArrayPtrVoid &result)
 {
-	bool first = true;
-	hdIFigure *figure = NULL;
-
-	hdIteratorBase *iterator = figures->createIterator();
-	while(iterator->HasNext())
-	{
-		figure = (hdIFigure *)iterator->Next();
-		if(first)
-		{
-			displayBox = figure->displayBox().gethdRect(posIdx);
-			first = false;
-		}
-		else
-		{
-			displayBox.add(figure->displayBox().gethdRect(posIdx));
-		}
-	}
+	getIndex(posIdx).query(rect, result);
+}
 
-	delete iterator;
+void hdDrawing::recalculateDisplayBox(int posIdx)
+{
+	displayBox = getIndex(posIdx).getBounds();
 }
 
 void hdDrawing::bringToFront(hdIFigure *figure)
@@ -123,6 +122,7 @@ void hdDrawing::bringToFront(hdIFigure *figure)
 	//To bring to front this figure need to be at last position when is draw
 	//because this reason sendToBack (last position) is used.
 	figures->sendToBack(figure);
+	spatialIndex.invalidate();
 }
 
 void hdDrawing::sendToBack(hdIFigure *figure)
@@ -130,6 +130,7 @@ void hdDrawing::sendToBack(hdIFigure *figure)
 	//To send to back this figure need to be at first position when is draw
 	//because this reason bringToFront (1st position) is used.
 	figures->bringToFront(figure);
+	spatialIndex.invalidate();
 }
 
 hdRect &hdDrawing::DisplayBox()
@@ -150,6 +151,7 @@ hdIteratorBase *hdDrawing::figuresInverseEnumerator()
 void hdDrawing::deleteAllFigures()
 {
 	selection->removeAll();
+	spatialIndex.invalidate();
 
 	hdIFigure *tmp;
 	while(figures->count() > 0)
@@ -164,6 +166,7 @@ void hdDrawing::deleteAllFigures()
 void hdDrawing::removeAllFigures()
 {
 	selection->removeAll();
+	spatialIndex.invalidate();
 
 	hdIFigure *tmp;
 	while(figures->count() > 0)
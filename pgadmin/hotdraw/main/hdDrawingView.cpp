@@ -95,25 +95,38 @@ void hdDrawingView::onPaint(wxPaintEvent &event)
 	wxPaintDC dcc(this);
 	wxBufferedDC dc(&dcc, canvasSize);
 	dc.Clear();
+
+	//Only figures intersecting the damaged region need to be drawn. Figures
+	//may have changed since last paint, so the index is built again.
+	wxRect damaged = GetUpdateRegion().GetBox();
+	CalcUnscrolledPosition(damaged.x, damaged.y, &damaged.x, &damaged.y);
+	hdRect area(damaged.x, damaged.y, damaged.width, damaged.height);
+	drawing->invalidateIndex();
+
 	hdIFigure *toDraw = NULL;
-	hdIteratorBase *iterator = drawing->figuresEnumerator();
+	wxArrayPtrVoid visible;
+	drawing->findFigures(diagramIndex, area, visible);
 
-	while(iterator->HasNext())
+	size_t i;
+	for(i = 0; i < visible.GetCount(); i++)
 	{
-		toDraw = (hdIFigure *)iterator->Next();
+		toDraw = (hdIFigure *)visible.Item(i);
 		if(toDraw->isSelected(diagramIndex))
 			toDraw->drawSelected(dc, this);
 		else
 			toDraw->draw(dc, this);
 	}
 
-	delete iterator;
-
 	hdIHandle *tmpHandle = NULL;
 	hdIteratorBase *selectionIterator = drawing->selectionFigures();//selection->createIterator();
 	while(selectionIterator->HasNext())
 	{
 		toDraw = (hdIFigure *)selectionIterator->Next();
+		hdRect box = toDraw->displayBox().gethdRect(diagramIndex);
+		box.Inflate(HD_INDEX_MARGIN, HD_INDEX_MARGIN);
+		if(!box.Intersects(area))
+			continue;
+
 		hdIteratorBase *handlesIterator = toDraw->handlesEnumerator()->createIterator();
 		while(handlesIterator->HasNext())
 		{
@@ -246,6 +259,7 @@ void hdDrawingView::onMotion(wxMouseEvent &event)
 		hdMouseEvent ddEvent = hdMouseEvent(event, this);
 		if(event.Dragging())
 		{
+			drawing->invalidateIndex();
 			_tool->mouseDrag(ddEvent);
 			this->Refresh();			//only a dragging event on montion will change model
 		}
@@ -261,6 +275,7 @@ void hdDrawingView::onMouseDown(wxMouseEvent &event)
 	this->AcceptsFocus();
 	this->SetFocus();
 	startDrag = event.GetPosition();
+	drawing->invalidateIndex();
 	hdMouseEvent ddEvent = hdMouseEvent(event, this);
 	_tool->mouseDown(ddEvent);
 	this->Refresh();
@@ -270,6 +285,7 @@ void hdDrawingView::onMouseUp(wxMouseEvent &event)
 {
 	this->AcceptsFocus();
 	this->SetFocus();
+	drawing->invalidateIndex();
 	hdMouseEvent ddEvent = hdMouseEvent(event, this);
 	_tool->mouseUp(ddEvent);
 	this->Refresh();
@@ -277,6 +293,7 @@ void hdDrawingView::onMouseUp(wxMouseEvent &event)
 
 void hdDrawingView::onKeyDown(wxKeyEvent &event)
 {
+	drawing->invalidateIndex();
 	hdKeyEvent ddEvent = hdKeyEvent(event, this);
 	_tool->keyDown(ddEvent);
 	this->Refresh();
@@ -284,6 +301,7 @@ void hdDrawingView::onKeyDown(wxKeyEvent &event)
 
 void hdDrawingView::onKeyUp(wxKeyEvent &event)
 {
+	drawing->invalidateIndex();
 	hdKeyEvent ddEvent = hdKeyEvent(event, this);
 	_tool->keyUp(ddEvent);
 	this->Refresh();
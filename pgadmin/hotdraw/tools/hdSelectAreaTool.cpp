@@ -97,10 +97,14 @@ void hdSelectAreaTool::mouseDrag(hdMouseEvent &event)
 void hdSelectAreaTool::selectFiguresOnRect(bool shiftPressed, hdDrawingView *view)
 {
 	hdIFigure *figure;
-	hdIteratorBase *iterator = view->getDrawing()->figuresInverseEnumerator();
-	while(iterator->HasNext())
+	wxArrayPtrVoid candidates;
+	view->getDrawing()->findFigures(view->getIdx(), selectionRect, candidates);
+
+	//Front to back, like figuresInverseEnumerator()
+	int i;
+	for(i = candidates.GetCount() - 1; i >= 0; i--)
 	{
-		figure = (hdIFigure *)iterator->Next();
+		figure = (hdIFigure *)candidates.Item(i);
 		if(selectionRect.Contains(figure->displayBox().gethdRect(view->getIdx())))
 		{
 			if(shiftPressed)
@@ -113,7 +117,6 @@ void hdSelectAreaTool::selectFiguresOnRect(bool shiftPressed, hdDrawingView *vie
 			}
 		}
 	}
-	delete iterator;
 }
 
 void hdSelectAreaTool::drawSelectionRect(hdDrawingView *view)
@@ -0,0 +1,143 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// hdSpatialIndex.cpp - Uniform grid to find the figures of a drawing near a
+// point or inside a rectangle without looking at all of them
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgAdmin3.h"
+
+// wxWindows headers
+#include <wx/wx.h>
+
+// App headers
+#include "hotdraw/utilities/hdSpatialIndex.h"
+#include "hotdraw/figures/hdIFigure.h"
+
+
+static int compareInts(int *first, int *second)
+{
+	return *first - *second;
+}
+
+hdSpatialIndex::hdSpatialIndex()
+{
+	valid = false;
+	indexedPosIdx = -1;
+}
+
+hdSpatialIndex::~hdSpatialIndex()
+{
+}
+
+unsigned long hdSpatialIndex::cellKey(int cx, int cy)
+{
+	return ((unsigned long)(cx & 0xffff) << 16) | (unsigned long)(cy & 0xffff);
+}
+
+void hdSpatialIndex::cellsOf(const wxRect &box, int &x1, int &y1, int &x2, int &y2)
+{
+	// Round towards minus infinity, figures removed from a diagram sit at -1,-1
+	int right = box.x + box.width, bottom = box.y + box.height;
+	x1 = box.x >= 0 ? box.x / HD_INDEX_CELL_SIZE : (box.x + 1) / HD_INDEX_CELL_SIZE - 1;
+	y1 = box.y >= 0 ? box.y / HD_INDEX_CELL_SIZE : (box.y + 1) / HD_INDEX_CELL_SIZE - 1;
+	x2 = right >= 0 ? right / HD_INDEX_CELL_SIZE : (right + 1) / HD_INDEX_CELL_SIZE - 1;
+	y2 = bottom >= 0 ? bottom / HD_INDEX_CELL_SIZE : (bottom + 1) / HD_INDEX_CELL_SIZE - 1;
+}
+
+void hdSpatialIndex::rebuild(hdCollection *drawingFigures, int posIdx)
+{
+	figures.Clear();
+	boxX.Clear();
+	boxY.Clear();
+	boxWidth.Clear();
+	boxHeight.Clear();
+	cells.clear();
+	large.Clear();
+	bounds = hdRect();
+
+	hdIFigure *figure;
+	int i = 0;
+	hdIteratorBase *iterator = drawingFigures->createIterator();
+	while(iterator->HasNext())
+	{
+		figure = (hdIFigure *)iterator->Next();
+		hdRect box = figure->displayBox().gethdRect(posIdx);
+		if(i == 0)
+			bounds = box;
+		else
+			bounds.add(box);
+
+		box.Inflate(HD_INDEX_MARGIN, HD_INDEX_MARGIN);
+		figures.Add(figure);
+		boxX.Add(box.x);
+		boxY.Add(box.y);
+		boxWidth.Add(box.width);
+		boxHeight.Add(box.height);
+
+		int x1, y1, x2, y2;
+		cellsOf(box, x1, y1, x2, y2);
+		if((x2 - x1 + 1) * (y2 - y1 + 1) > HD_INDEX_MAX_CELLS)
+			large.Add(i);
+		else
+		{
+			int cx, cy;
+			for(cx = x1; cx <= x2; cx++)
+				for(cy = y1; cy <= y2; cy++)
+					cells[cellKey(cx, cy)].Add(i);
+		}
+		i++;
+	}
+	delete iterator;
+
+	indexedPosIdx = posIdx;
+	valid = true;
+}
+
+void hdSpatialIndex::query(const hdRect &rect, wxArrayPtrVoid &result)
+{
+	wxArrayInt found;
+	int x1, y1, x2, y2, cx, cy;
+	size_t i;
+
+	cellsOf(rect, x1, y1, x2, y2);
+
+	// Looking at each figure is cheaper than looking at lots of cells
+	if((x2 - x1 + 1) * (y2 - y1 + 1) > (int)figures.GetCount())
+	{
+		for(i = 0; i < figures.GetCount(); i++)
+			found.Add(i);
+	}
+	else
+	{
+		for(cx = x1; cx <= x2; cx++)
+		{
+			for(cy = y1; cy <= y2; cy++)
+			{
+				hdIndexCells::iterator it = cells.find(cellKey(cx, cy));
+				if(it != cells.end())
+					WX_APPEND_ARRAY(found, it->second);
+			}
+		}
+		WX_APPEND_ARRAY(found, large);
+		found.Sort(compareInts);
+	}
+
+	int last = -1;
+	for(i = 0; i < found.GetCount(); i++)
+	{
+		int pos = found.Item(i);
+		if(pos == last)
+			continue;
+		last = pos;
+
+		wxRect box(boxX.Item(pos), boxY.Item(pos), boxWidth.Item(pos), boxHeight.Item(pos));
+		if(box.Intersects(rect))
+			result.Add(figures.Item(pos));
+	}
+}
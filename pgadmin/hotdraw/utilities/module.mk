@@ -18,7 +18,8 @@ pgadmin3_SOURCES += \
 	hotdraw/utilities/hdMultiPosRect.cpp \
 	hotdraw/utilities/hdPoint.cpp \
 	hotdraw/utilities/hdRect.cpp \
-	hotdraw/utilities/hdRemoveDeleteDialog.cpp
+	hotdraw/utilities/hdRemoveDeleteDialog.cpp \
+	hotdraw/utilities/hdSpatialIndex.cpp
 
 EXTRA_DIST += \
 	hotdraw/utilities/module.mk
@@ -18,6 +18,7 @@
 #include "db/pgSet.h"
 #include "db/pgConn.h"
 #include "ctlSQLGrid.h"
+#include "db/pgQueryThread.h"
 #include "frm/frmExport.h"
 
 #define CTLSQL_RUNNING 100  // must be greater than ExecStatusType PGRES_xxx values
@@ -68,6 +69,20 @@ public:
 	void ResultsFinished();
 	void OnGridSelect(wxGridRangeSelectEvent &event);
 
+	// Streaming of huge results: set before Execute()
+	void SetStreaming(long chunkRows, long maxRows = 0)
+	{
+		streamChunkRows = chunkRows;
+		streamMaxRows = maxRows;
+	}
+	bool IsStreaming() const
+	{
+		return thread && thread->IsStreaming();
+	}
+	long FetchStreamedRows();
+	void DisplayStreamedRows();
+	bool StopStreaming();
+
 	wxArrayString colNames;
 	wxArrayString colTypes;
 	wxArrayLong colTypClasses;
@@ -76,6 +91,7 @@ private:
 	pgQueryThread *thread;
 	pgConn *conn;
 	bool rowcountSuppressed;
+	long streamChunkRows, streamMaxRows;
 };
 
 class sqlResultTable : public wxGridTableBase
@@ -22,108 +22,81 @@
 #define pgTipWindowBase wxFrame
 #endif
 
-#include <ogl/ogl.h>
+#include "ctl/explainPlan.h"
 
-
-#if wxUSE_DEPRECATED
-#error wxUSE_DEPRECATED should be 0!
+#ifndef WXROUND
+#define WXROUND(x) ( (long) (x + 0.5) )
 #endif
 
 
-class ExplainShape;
 class ExplainPopup;
 class ExplainText;
 
-class ExplainCanvas : public wxShapeCanvas
+class ExplainCanvas : public wxScrolledWindow
 {
 public:
 	ExplainCanvas(wxWindow *parent);
 	~ExplainCanvas();
 
-	void ShowPopup(ExplainShape *s);
+	void ShowPopup(int pos);
 	void SetExplainString(const wxString &str);
 	void Clear();
+	bool IsEmpty()
+	{
+		return plan.IsEmpty();
+	}
+	ExplainNode *GetNode(int pos)
+	{
+		return plan.GetNode(pos);
+	}
+	void ToggleNode(int pos);
 	void SaveAsImage(const wxString &fileName, wxBitmapType imageType);
 
 private:
+	void OnPaint(wxPaintEvent &ev);
 	void OnMouseMotion(wxMouseEvent &ev);
+	void OnLeftDown(wxMouseEvent &ev);
+
+	void Draw(wxDC &dc, const wxRect &rect);
+	void DrawLine(wxDC &dc, const wxRect &rect, ExplainNode *from, ExplainNode *to);
+	void GetNodePosition(ExplainNode *node, int &x, int &y);
+	int FindNode(int x, int y);
+	void SetVirtualPlanSize();
 
-	ExplainShape *rootShape;
+	ExplainPlan plan;
 	ExplainPopup *popup;
+	int x0, y0, xoffs, yoffs;
 
 	DECLARE_EVENT_TABLE()
 };
 
 
-class ExplainShape : public wxBitmapShape
+// Images of the plan nodes, and how they are drawn. Nodes are drawn
+// centered on x, y.
+class ExplainShape
 {
 public:
-	ExplainShape(const wxImage &bmp, const wxString &description, long tokenNo = -1, long detailNo = -1);
-	static ExplainShape *Create(long level, ExplainShape *last, const wxString &str);
+	// Returns the image for a node described by str, NULL if it is a line
+	// of the text output which is not a node. tokenNo and detailNo are set
+	// for ExplainNode::SetLabel().
+	static wxBitmap *GetBitmap(const wxString &str, int &tokenNo, int &detailNo);
 
-	void SetCondition(const wxString &str)
-	{
-		if (condition.Length() == 0) condition = str;
-		else condition += wxT(" ") + str;
-	}
-	long GetLevel()
-	{
-		return level;
-	}
-	wxRealPoint GetStartPoint();
-	wxRealPoint GetEndPoint(int kidNo);
-	int GetKidno()
-	{
-		return kidNo;
-	}
+	// Space taken by a node and its label
+	static wxSize GetSize();
 
-	ExplainShape *GetUpper()
-	{
-		return upperShape;
-	}
-	double GetAverageCost()
-	{
-		return (costHigh - costLow) / 2 + costLow;
-	}
-
-protected:
-	void OnDraw(wxDC &dc);
-	void OnLeftClick(double x, double y, int keys = 0, int attachment = 0);
-
-	ExplainShape *upperShape;
-
-	void SetLabel(const wxString &str, int tokenNo = -1, int detailNo = -1);
-
-	long level;
-	wxString description, detail, condition, label;
-	wxString cost, actual;
-	double costLow, costHigh;
-	long rows, width;
-	int kidCount, kidNo;
-	int totalShapes; // horizontal space usage by shape and its kids
-	int usedShapes;
-	bool m_rootShape;
-
-	friend class ExplainCanvas;
-	friend class ExplainText;
-};
+	static void Draw(wxDC &dc, ExplainNode *node, int x, int y);
+	static wxRealPoint GetStartPoint(ExplainNode *node, int x, int y);
+	static wxRealPoint GetEndPoint(ExplainNode *node, int x, int y, int kidNo);
 
-
-class ExplainLine : public wxLineShape
-{
-public:
-	ExplainLine(ExplainShape *from, ExplainShape *to, double weight = 0);
-
-private:
-	int width;
-	void OnDraw(wxDC &dc);
+	// Arrow from a node to its upper, as wide as the cost of the node
+	static void DrawLine(wxDC &dc, ExplainNode *from, const wxRealPoint &start, const wxRealPoint &end);
 };
 
 
 class ExplainPopup : public pgTipWindowBase
 {
 public:
-	ExplainPopup(ExplainCanvas *parent, ExplainShape *shape, ExplainPopup **popup = NULL);
+	ExplainPopup(ExplainCanvas *parent, int pos, const wxRect &rect, ExplainPopup **popup = NULL);
 	void Close();
 	~ExplainPopup();
 
@@ -143,6 +116,8 @@ protected:
 
 	ExplainPopup **m_ptr;
 	wxRect         m_rectBound;
+	ExplainCanvas *m_canvas;
+	int            m_node;
 
 	ExplainText   *m_explainText;
 
@@ -0,0 +1,132 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// explainPlan.h - Plan tree shown by the Explain canvas
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef EXPLAINPLAN_H
+#define EXPLAINPLAN_H
+
+// Nodes spending at least this fraction of the time (or of the cost,
+// without analyze) of the whole plan are highlighted
+#define EXPLAIN_HOT_SHARE   0.05
+
+
+// One node of a plan. Costs, rows and timings are kept as numbers, the
+// texts shown for them are made when they are needed.
+class ExplainNode
+{
+public:
+	ExplainNode(int level, int upper);
+
+	void SetLabel(const wxString &str, int tokenNo = -1, int detailNo = -1);
+	void SetCondition(const wxString &str)
+	{
+		if (condition.Length() == 0) condition = str;
+		else condition += wxT(" ") + str;
+	}
+	double GetAverageCost()
+	{
+		return (costHigh - costLow) / 2 + costLow;
+	}
+	wxString GetCostText();
+	wxString GetActualText();
+
+	wxString description, detail, condition, label;
+	wxBitmap *bitmap;
+
+	bool hasCost, hasActual, hasTiming;
+	double costLow, costHigh, rows;
+	long width;
+	double actualLow, actualHigh, actualRows, loops;
+
+	// Part of the time (or cost) of the plan spent in the node itself, and
+	// the largest one of a node of its subtree
+	double share, subtreeShare;
+
+	// Positions in ExplainPlan of the node above, of the last of the nodes
+	// below and of the one before this node below the same upper. The
+	// subtree of a node are the nodes up to end.
+	int level, upper, lastKid, prevKid, end;
+	int kidCount, kidNo;
+	bool collapsed;
+
+	// Set by ExplainPlan::Layout()
+	int row, totalRows, usedRows;
+};
+
+
+// The nodes of one or more plans, below a root node which is never shown.
+// Nodes are kept in the order of the plan (each one before the nodes
+// below it), so that a subtree is a range of positions.
+class ExplainPlan
+{
+public:
+	ExplainPlan();
+	~ExplainPlan();
+
+	void Clear();
+	bool IsEmpty()
+	{
+		return nodes.GetCount() < 2;
+	}
+
+	// Output of EXPLAIN (FORMAT JSON)
+	bool ParseJson(const wxString &str);
+
+	// Output of EXPLAIN in text format
+	void ParseText(const wxString &str);
+
+	// Gives a row to every node not hidden in a collapsed subtree; the first
+	// node below another one takes the row of its upper.
+	void Layout();
+
+	void Toggle(int pos);
+
+	size_t GetCount()
+	{
+		return nodes.GetCount();
+	}
+	ExplainNode *GetNode(int pos)
+	{
+		return (ExplainNode *)nodes.Item(pos);
+	}
+	int GetMaxLevel()
+	{
+		return maxLevel;
+	}
+	int GetRowCount()
+	{
+		return IsEmpty() ? 0 : GetNode(0)->totalRows;
+	}
+
+	// Positions of the nodes shown after Layout(), in plan order, so that
+	// their rows never decrease
+	const wxArrayInt &GetShown()
+	{
+		return shown;
+	}
+
+	// Index in GetShown() of the first node at or below row
+	size_t FindShown(int row);
+
+	// Position of the node shown at row and level, or -1
+	int FindNode(int row, int level);
+
+private:
+	int AddNode(int level, int upper);
+	void Finish();
+
+	wxArrayPtrVoid nodes;
+	wxArrayInt shown;
+	int maxLevel;
+
+	friend class ExplainJsonReader;
+};
+
+#endif
@@ -26,6 +26,7 @@ pgadmin3_SOURCES += \
 	include/ctl/ctlProgressStatusBar.h \
 	include/ctl/ctlTree.h \
 	include/ctl/explainCanvas.h \
+	include/ctl/explainPlan.h \
 	include/ctl/timespin.h \
 	include/ctl/wxgridsel.h \
 	include/ctl/xh_calb.h \
@@ -11,6 +11,8 @@
 
 pgadmin3_SOURCES += \
 	  include/db/pgConn.h \
+	  include/db/pgConnector.h \
+	  include/db/pgConnPool.h \
 	  include/db/pgQueryThread.h \
 	  include/db/pgQueryResultEvent.h \
 	  include/db/pgSet.h
@@ -14,6 +14,7 @@
 
 // wxWindows headers
 #include <wx/wx.h>
+#include <wx/hashmap.h>
 
 // PostgreSQL headers
 #include <libpq-fe.h>
@@ -21,6 +22,8 @@
 // App headers
 #include "pgSet.h"
 
+class pgConnInfo;
+
 // status enums
 enum
 {
@@ -82,6 +85,13 @@ typedef struct pgError
 	void SetError(PGresult *_res = NULL, wxMBConv *_conv = NULL);
 } pgError;
 
+// Maximum number of statements prepared by ExecutePrepared on a connection
+#define PGCONN_MAX_PREPARED 100
+
+// Names of the statements prepared on a connection, by query text; empty
+// for a query the server refused to prepare
+WX_DECLARE_STRING_HASH_MAP(wxString, pgPreparedStatementHash);
+
 class pgConn
 {
 public:
@@ -90,7 +100,7 @@ public:
 	       int port = 5432, const wxString &rolename = wxT(""), int sslmode = 0, OID oid = 0,
 	       const wxString &applicationname = wxT("pgAdmin"),
 	       const wxString &sslcert = wxT(""), const wxString &sslkey = wxT(""), const wxString &sslrootcert = wxT(""), const wxString &sslcrl = wxT(""),
-	       const bool sslcompression = true);
+	       const bool sslcompression = true, long connecttimeout = -1);
 	~pgConn();
 
 	bool IsSuperuser();
@@ -125,11 +135,16 @@ public:
 		return pg_valid_server_encoding_id(encid) == 0 ? false : true;
 	}
 
+	// Waits for the socket for at most timeout ms
+	static void WaitForSocket(int sock, bool forRead, long timeout);
+
 	void Close();
 	bool Reconnect();
 	bool ExecuteVoid(const wxString &sql, bool reportError = true);
 	wxString ExecuteScalar(const wxString &sql, bool reportError = true);
 	pgSet *ExecuteSet(const wxString &sql, bool reportError = true);
+	pgSet *ExecutePrepared(const wxString &sql, const wxArrayString &params, bool reportError = true,
+	                       const wxString &inlined = wxEmptyString);
 	void CancelExecution(void);
 
 	wxString GetHostAddr() const
@@ -140,6 +155,11 @@ public:
 	{
 		return save_service;
 	}
+	// Identifies the server in pgConnPool
+	wxString GetPoolServer() const
+	{
+		return poolServer;
+	}
 	wxString GetUser() const
 	{
 		return wxString(PQuser(conn), *conv);
@@ -274,11 +294,15 @@ protected:
 	pgError lastResultError;
 
 	wxMBConv *conv;
-	bool needColQuoting, utfConnectString;
+	bool needColQuoting, utfConnectString, connectTimedOut;
+	long connectTimeout; // seconds, read from the settings on the main thread
 	wxString dbRole, dbHost, dbHostName;
 	OID lastSystemOID;
 	OID dbOid;
 
+	pgPreparedStatementHash preparedStatements;
+	long preparedStatementCount;
+
 	void *noticeArg;
 	PQnoticeProcessor noticeProc;
 	static double libpqVersion;
@@ -287,7 +311,10 @@ protected:
 
 private:
 	bool DoConnect();
-	bool Initialize();
+	PGconn *ConnectPoll(const char *connectString);
+	bool Initialize(bool leased = false);
+	bool InitializeFromInfo(const pgConnInfo &info, bool leased);
+	void SaveInfo();
 
 	wxString qtString(const wxString &value);
 
@@ -298,6 +325,7 @@ private:
 
 	wxString reservedNamespaces;
 	wxString connstr;
+	wxString poolServer, poolKey;
 
 	wxString save_server, save_service, save_hostaddr, save_database, save_username, save_password, save_rolename, save_applicationname;
 	wxString save_sslcert, save_sslkey, save_sslrootcert, save_sslcrl;
@@ -0,0 +1,114 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnPool.h - Keeps closed connections open for reuse
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGCONNPOOL_H
+#define PGCONNPOOL_H
+
+#include <wx/wx.h>
+#include <wx/hashmap.h>
+
+// PostgreSQL headers
+#include <libpq-fe.h>
+
+// App headers
+#include "utils/misc.h"
+
+
+// What pgConn learns about the server and database once; handed to the
+// next connections with the same key so they don't query it again.
+class pgConnInfo
+{
+public:
+	pgConnInfo();
+
+	int majorVersion, minorVersion, patchVersion;
+	bool isEdb, isGreenplum;
+	bool features[32];
+	wxString reservedNamespaces;
+
+	wxString encoding;
+	OID dbOid, lastSystemOID;
+	bool needColQuoting, utfConnectString;
+};
+
+
+class pgConnPoolEntry;
+class pgConnPoolResetter;
+WX_DECLARE_STRING_HASH_MAP(pgConnPoolEntry *, pgConnPoolHash);
+
+
+// The connections pgConn closes are kept here for at most
+// GetConnectionPoolIdleTime() seconds. They are reset with DISCARD ALL by a
+// background thread as they are released, or closed if they hold advisory
+// locks, temporary tables or LISTEN registrations, or if the reset takes
+// too long. A timer closes them when they have been idle too long or
+// the server closed them. The key identifies the
+// server, database, user and credentials; it starts with the server and
+// the database name, each followed by a newline, so that all the
+// connections of a server or database can be closed at once.
+// All functions may be called from any thread.
+class pgConnPool
+{
+public:
+	// An idle connection for the key, or NULL
+	static PGconn *Lease(const wxString &key);
+
+	// Whether Release() would keep another connection for the key
+	static bool HasRoom(const wxString &key);
+
+	// Takes ownership of conn if it returns true
+	static bool Release(const wxString &key, PGconn *conn);
+
+	static bool GetInfo(const wxString &key, pgConnInfo &info);
+	static void SetInfo(const wxString &key, const pgConnInfo &info);
+
+	// Closes the idle connections to a server and stops keeping new ones,
+	// until it is connected to again (Open).
+	static void CloseServer(const wxString &server);
+	static void OpenServer(const wxString &server);
+
+	// A database can't be dropped or renamed while there are sessions on it
+	static void CloseDatabase(const wxString &server, const wxString &database);
+
+	// Closes all idle connections; nothing is pooled afterwards
+	static void Clear();
+
+	// Closes the connections idle for too long, or closed by the server
+	static void Prune();
+
+private:
+	friend class pgConnPoolResetter;
+
+	// Called by the resetter once conn has been reset
+	static void AddIdle(const wxString &key, PGconn *conn);
+
+	static void Prune(long now);
+	static void ReadSettings();
+	static size_t IdleCount();
+	static void CloseMatching(const wxString &prefix);
+	static wxString ServerOf(const wxString &key);
+
+	static wxMutex lock;
+	static pgConnPoolHash entries;
+	static wxArrayString closedServers;
+	static bool cleared;
+	static wxTimer *timer;
+
+	// Released connections not reset yet
+	static pgConnPoolResetter *resetter;
+	static size_t resetting;
+
+	// The settings, read on the main thread only (wxConfig isn't
+	// thread-safe)
+	static long maxSize, maxIdle;
+};
+
+#endif
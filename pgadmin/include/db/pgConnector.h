@@ -0,0 +1,86 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgConnector.h - Opens connections in background threads
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGCONNECTOR_H
+#define PGCONNECTOR_H
+
+#include "wx/wx.h"
+#include "wx/event.h"
+#include "wx/dynarray.h"
+
+class pgConn;
+class pgConnectThread;
+
+// Sent to the handler of the pgConnector for each request done, with the
+// request as client data. The handler owns the request from then on.
+extern const wxEventType PGConnectEvent;
+
+
+// A connection to open in the background. Open() runs in a worker thread:
+// it gets a copy of everything it needs when the request is created, and
+// must not touch the GUI.
+class pgConnectRequest
+{
+public:
+	pgConnectRequest() : conn(NULL) {}
+	virtual ~pgConnectRequest();
+
+	// The connection opened, if any; the caller becomes its owner
+	pgConn *TakeConnection()
+	{
+		pgConn *res = conn;
+		conn = NULL;
+		return res;
+	}
+
+protected:
+	virtual pgConn *Open() = 0;
+
+private:
+	pgConn *conn;
+
+	friend class pgConnectThread;
+};
+
+WX_DEFINE_ARRAY_PTR(pgConnectRequest *, pgConnectRequestArray);
+WX_DEFINE_ARRAY_PTR(pgConnectThread *, pgConnectThreadArray);
+
+
+// Runs the requests added with at most maxThreads connections being
+// opened at the same time; each attempt is bound by the connection timeout
+// of pgConn.
+class pgConnector
+{
+public:
+	pgConnector(wxEvtHandler *handler, int maxThreads);
+	~pgConnector();
+
+	void Add(pgConnectRequest *request);
+
+	// Drops the requests not started yet, and abandons the running ones
+	void Stop();
+
+private:
+	pgConnectRequest *Next();
+	void Done(pgConnectRequest *request);
+
+	wxEvtHandler *handler;
+	int maxThreads, running;
+	bool stopped;
+
+	wxMutex queueLock;
+	pgConnectRequestArray queue;
+	pgConnectThreadArray threads;
+
+	friend class pgConnectThread;
+};
+
+#endif
@@ -232,9 +232,24 @@ public:
 		return (_idx >= 0 && _idx > m_currIndex ? -1L : m_queries[_idx]->m_insertedOid);
 	}
 
-	inline void CancelExecution()
+	void CancelExecution();
+
+	// Streaming mode: rows are handed over in chunks of chunkRows rows
+	// while the query is still running (single query only). The transfer
+	// stops on its own once maxRows rows (if > 0) have been received.
+	void SetStreaming(long chunkRows, long maxRows = 0);
+	bool IsStreaming() const
+	{
+		return m_streamChunkRows > 0;
+	}
+	// Stop a streamed transfer, keeping the rows received so far
+	void StopStreaming();
+	// Move the chunks received so far into the result set; must be called
+	// from the thread owning the result set (usually the GUI thread).
+	long FetchStreamedRows();
+	long StreamedRows() const
 	{
-		m_cancelled = true;
+		return m_streamRows;
 	}
 
 	inline size_t GetNumberQueries()
@@ -257,6 +272,11 @@ public:
 private:
 	int Execute();
 	int RaiseEvent(int _retval = 0);
+	void StreamRow(PGresult *row);
+	void FlushStreamChunk(bool wait = true);
+	void ResetStream();
+	void WaitForServer();
+	void WakeUp();
 
 	// Queries to be exectued
 	pgBatchQueryArray  m_queries;
@@ -276,6 +296,12 @@ private:
 	bool               m_executing;
 	// Queries are being accessed at this time
 	wxMutex            m_queriesLock;
+	// Signalled when a query is queued (or the execution cancelled)
+	wxMutex            m_queueLock;
+	wxCondition        m_queueCond;
+	// Interrupts the wait on the server socket (not on Windows, where the
+	// wait is bounded instead)
+	int                m_wakeupPipe[2];
 	// When one thread is accesing messages, other should not be able to access it
 	wxCriticalSection  m_criticalSection;
 	// Event Handler
@@ -284,6 +310,23 @@ private:
 	PQnoticeProcessor  m_processor;
 	// Notice Handler
 	void              *m_noticeHandler;
+	// Rows per chunk in streaming mode (0: no streaming)
+	long               m_streamChunkRows;
+	// Maximum number of rows to be streamed (0: no limit)
+	long               m_streamMaxRows;
+	// Rows received so far in streaming mode
+	long               m_streamRows;
+	// Chunk being filled, and number of rows in it
+	PGresult          *m_streamChunk;
+	long               m_streamChunkFill;
+	// Chunks not yet picked up by FetchStreamedRows
+	pgResultArray      m_streamPending;
+	// Streamed transfer stopped by the user, or by the row limit
+	bool               m_streamStopped;
+	bool               m_streamTruncated;
+	// Signalled when pending chunks are picked up, or the transfer stops
+	wxMutex            m_streamLock;
+	wxCondition        m_streamCond;
 
 };
 
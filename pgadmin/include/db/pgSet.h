@@ -15,6 +15,7 @@
 // wxWindows headers
 #include <wx/wx.h>
 #include <wx/datetime.h>
+#include <wx/hashmap.h>
 
 // PostgreSQL headers
 #include <libpq-fe.h>
@@ -31,6 +32,45 @@ typedef enum
 } pgTypClass;
 
 class pgConn;
+class pgSetSpill;
+
+WX_DEFINE_ARRAY_PTR(PGresult *, pgResultArray);
+WX_DECLARE_STRING_HASH_MAP(int, pgColNumberHash);
+
+// Decoded copy of a single result column. All values of the column are
+// converted once into one contiguous buffer, addressed through per-row
+// offsets, with a bitmap marking the NULL values.
+class pgSetColumnCache
+{
+public:
+	pgSetColumnCache();
+	~pgSetColumnCache();
+
+	// Decode the column's values of another result and add them at the end
+	void Append(PGresult *res, int col, wxMBConv &conv);
+
+	wxString GetVal(long row) const
+	{
+		return data.Mid(offsets[row], offsets[row + 1] - offsets[row]);
+	}
+	size_t GetLength(long row) const
+	{
+		return offsets[row + 1] - offsets[row];
+	}
+	bool IsNull(long row) const
+	{
+		return (nulls[row >> 3] & (1 << (row & 7))) != 0;
+	}
+
+private:
+	pgSetColumnCache(const pgSetColumnCache &);
+	pgSetColumnCache &operator=(const pgSetColumnCache &);
+
+	wxString data;
+	size_t *offsets;
+	unsigned char *nulls;
+	long rows, maxRows;
+};
 
 // Class declarations
 class pgSet
@@ -38,6 +78,10 @@ class pgSet
 public:
 	pgSet();
 	pgSet(PGresult *newRes, pgConn *newConn, wxMBConv &cnv, bool needColQt);
+	// A set of some of the rows of source, in the order given by their
+	// (zero based) numbers. It shares the results of source, which must
+	// not be deleted before it.
+	pgSet(const pgSet &source, const wxArrayLong &rows);
 	~pgSet();
 	long NumRows() const
 	{
@@ -99,7 +143,9 @@ public:
 	}
 	bool IsNull(const int col) const
 	{
-		return (PQgetisnull(res, pos - 1, col) != 0);
+		long row = pos - 1;
+		PGresult *r = RowResult(row);
+		return (PQgetisnull(r, row, col) != 0);
 	}
 	int ColScale(const int col) const;
 	int ColNumber(const wxString &colName) const;
@@ -131,6 +177,25 @@ public:
 		return conv;
 	}
 
+	// When enabled, GetVal() serves values from columns decoded once on
+	// first access instead of converting the raw value on every call.
+	// Not available with a chunk limit, as the cache would hold all rows.
+	void EnableColumnCache(bool enable = true);
+	bool IsColumnCacheEnabled() const
+	{
+		return colCache != 0;
+	}
+
+	// Add the rows of another result with the same columns at the end of
+	// the set. The set takes ownership of the result. All results but the
+	// last one must have the same number of rows.
+	void AppendResult(PGresult *chunk);
+
+	// Keep at most maxChunks of the appended results in memory. The least
+	// recently read ones are written to a temporary file, and read back
+	// when one of their rows is needed again. 0 keeps them all.
+	void SetChunkLimit(size_t maxChunks);
+
 	wxString GetCommandStatus() const
 	{
 		if (res)
@@ -149,6 +214,45 @@ protected:
 	bool needColQuoting;
 	mutable wxArrayString colTypes, colFullTypes;
 	wxArrayInt colClasses;
+
+	// Find the result holding the given (zero based) row, and turn the row
+	// number into a row number within that result
+	PGresult *RowResult(long &row) const
+	{
+		if (rowMap)
+			row = rowMap->Item(row);
+		if (chunks.IsEmpty() || row < chunkRows)
+			return res;
+
+		long idx = row / chunkRows;
+		row -= idx * chunkRows;
+		if (spill)
+			return ResidentChunk(idx - 1);
+		return chunks[idx - 1];
+	}
+
+private:
+	PGresult *ResidentChunk(long idx) const;
+	PGresult *ReadChunk(long idx) const;
+	bool WriteChunk(long idx) const;
+	void EvictChunks() const;
+
+	const pgSetColumnCache *GetColumnCache(const int col) const;
+	void ClearColumnCache();
+	int FindColumn(const wxString &colname) const;
+
+	// Column name to number lookup, built on first use
+	mutable pgColNumberHash *colNumbers;
+
+	mutable pgSetColumnCache **colCache;
+	// Results appended after the first one; those written to the
+	// temporary file are NULL here
+	mutable pgResultArray chunks;
+	long chunkRows;
+	mutable pgSetSpill *spill;
+
+	// Rows of the results shown by a set of some of the rows of another one
+	wxArrayLong *rowMap;
 };
 
 
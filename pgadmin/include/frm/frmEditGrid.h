@@ -36,29 +36,36 @@
 #endif
 #endif
 
+// A cached row of the grid. The cells are owned by the cacheLinePool; cols
+// stays NULL until the line has been filled, and then points to cells.
 class cacheLine
 {
 public:
 	cacheLine()
 	{
 		cols = 0;
+		cells = 0;
 		stored = false;
 		readOnly = false;
 	}
-	~cacheLine()
-	{
-		if (cols) delete[] cols;
-	}
 
 	wxString *cols;
+	wxString *cells;
 	bool stored, readOnly;
 };
 
 
+// Number of lines allocated at once by a cacheLinePool
+#define CACHELINE_CHUNK 1024
+
+// Store of cached rows. Lines are allocated in chunks, together with the
+// contiguous cell storage of all their columns, and never move; an index
+// maps the line numbers to the slots. Deleted lines are cleared and their
+// slots reused.
 class cacheLinePool
 {
 public:
-	cacheLinePool(int initialLines);
+	cacheLinePool(int initialLines, int cols);
 	~cacheLinePool();
 	cacheLine *operator[] (int line)
 	{
@@ -69,8 +76,26 @@ public:
 	void Delete(int lineNo);
 
 private:
-	cacheLine **ptr;
-	int anzLines;
+	int AllocSlot();
+	cacheLine *Slot(int slot)
+	{
+		return chunks[slot / CACHELINE_CHUNK] + slot % CACHELINE_CHUNK;
+	}
+	void Compact(int lineNo)
+	{
+		if (firstTombstone >= 0 && lineNo >= firstTombstone)
+			Compact();
+	}
+	void Compact();
+
+	int nCols;
+	wxArrayInt index;       // line number -> slot, -1 if not allocated yet, -2 if deleted
+	int firstTombstone;     // first deleted entry still in index, or -1
+	wxArrayInt freeSlots;   // slots of deleted lines
+	cacheLine **chunks;
+	wxString **chunkCells;
+	int nChunks, maxChunks;
+	int usedSlots;
 };
 
 
@@ -209,6 +234,13 @@ private:
 	wxString primaryKeyColNumbers;
 
 	cacheLine *GetLine(int row);
+	int LineIndex(int row)
+	{
+		if (firstTombstone >= 0 && row >= firstTombstone)
+			CompactLineIndex();
+		return lineIndex[row];
+	}
+	void CompactLineIndex();
 	wxString MakeKey(cacheLine *line);
 	void SetNumberEditor(int col, int len);
 
@@ -217,6 +249,8 @@ private:
 	int lastRow;
 
 	int *lineIndex;     // reindex of lines in dataSet to handle deleted rows
+	int firstTombstone; // first deleted row still in lineIndex (as -1), or -1
+	int tombstones;     // deleted rows still in lineIndex
 
 	int nCols;          // columns from dataSet
 	int nRows;          // rows initially returned by dataSet
@@ -15,9 +15,75 @@
 
 class ctlSQLResult;
 class pgSet;
+class pgConn;
 
+#include <wx/file.h>
+#include <wx/thread.h>
+#include <libpq-fe.h>
 #include "dlg/dlgClasses.h"
 
+// Runs a COPY ... TO STDOUT and writes the data it sends to a file
+class exportCopyThread : public wxThread
+{
+public:
+	exportCopyThread(pgConn *conn, const wxString &query, const wxString &filename,
+	                 bool unicode, bool crlf, bool header);
+	~exportCopyThread();
+
+	// May be called from any thread
+	void Cancel();
+	void GetProgress(long &rows, wxLongLong &bytes);
+
+	bool IsCancelled() const
+	{
+		return cancelled;
+	}
+	bool Succeeded() const
+	{
+		return succeeded;
+	}
+	long GetSkipped() const
+	{
+		return skipped;
+	}
+	const wxString &GetError() const
+	{
+		return error;
+	}
+
+	// The server refused or aborted the COPY before any row was written,
+	// so the rows can still be exported another way
+	bool FailedBeforeData() const
+	{
+		return serverFailed && !cancelled && rowsWritten == 0;
+	}
+
+private:
+	virtual void *Entry();
+	void CancelQuery();
+	bool WriteRow(const char *data, int len);
+	bool Flush();
+
+	pgConn *connection;
+	PGcancel *cancelConn;
+	wxString copyQuery, filename;
+	bool unicode, crlf;
+
+	// The first line sent is the header, which is not a row
+	bool header;
+
+	wxFile file;
+	char *buffer;
+	size_t bufferFill;
+
+	wxCriticalSection progressLock;
+	long rowsWritten, skipped;
+	wxLongLong bytesWritten;
+
+	bool cancelled, succeeded, serverFailed;
+	wxString error;
+};
+
 // Class declarations
 class frmExport : public pgDialog
 {
@@ -27,6 +93,13 @@ public:
 
 	bool Export(pgSet *set);
 
+	// Exporting the result of a single query: it is run as COPY ... TO
+	// STDOUT, and streamed to the file, whenever the options allow it.
+	// If the server rejects the COPY before sending any row, ExportCopy()
+	// sets fallback and the query should be exported with Export().
+	bool PrepareCopy(pgConn *conn, const wxString &query);
+	bool ExportCopy(pgConn *conn, long &rows, bool &fallback);
+
 private:
 	void OnChange(wxCommandEvent &ev);
 	void OnHelp(wxCommandEvent &ev);
@@ -35,6 +108,7 @@ private:
 	void OnBrowseFile(wxCommandEvent &ev);
 
 	wxWindow *parent;
+	wxString copyQuery;
 
 	DECLARE_EVENT_TABLE()
 };
@@ -13,10 +13,116 @@
 #ifndef FRMIMPORT_H
 #define FRMIMPORT_H
 
+#include <wx/timer.h>
+
 #include "dlg/dlgClasses.h"
 #include "utils/factory.h"
 
 class frmMain;
+class wxInputStream;
+class wxFileInputStream;
+
+
+// Reads the file to import ahead of the COPY. The data goes through two
+// buffers: one is filled here while the other one is being sent.
+class importReaderThread : public wxThread
+{
+public:
+	importReaderThread(const wxString &filename);
+	~importReaderThread();
+
+	bool IsOk() const
+	{
+		return stream != NULL;
+	}
+	bool IsCompressed() const
+	{
+		return compressed;
+	}
+	const wxString &GetError() const
+	{
+		return error;
+	}
+
+	// Called by the sender: NextBuffer() waits for the next filled buffer
+	// and returns NULL at the end of the file, ReleaseBuffer() hands the
+	// buffer back once it has been sent
+	const char *NextBuffer(size_t &len);
+	void ReleaseBuffer();
+	void Stop();
+
+	wxFileOffset GetFileLength() const
+	{
+		return fileLength;
+	}
+	wxFileOffset GetFilePosition();
+
+private:
+	virtual void *Entry();
+	size_t Fill(char *buffer);
+
+	wxString filename;
+	wxFileInputStream *file;
+	wxInputStream *stream;
+	bool compressed;
+	wxFileOffset fileLength, filePosition;
+
+	wxMutex bufferLock;
+	wxCondition bufferCond;
+	char *buffers[2];
+	size_t bufferLen[2];
+	bool bufferFull[2];
+	int nextBuffer;
+	bool finished, stopped;
+
+	wxString error;
+};
+
+
+// Runs the COPY FROM STDIN, sending what importReaderThread reads
+class importCopyThread : public wxThread
+{
+public:
+	importCopyThread(pgConn *conn, const wxString &query, importReaderThread *reader, bool countRows);
+	~importCopyThread();
+
+	// May be called from any thread
+	void Cancel()
+	{
+		cancelled = true;
+	}
+	void GetProgress(wxLongLong &bytes, wxLongLong &rows);
+
+	bool IsCancelled() const
+	{
+		return cancelled;
+	}
+	bool Succeeded() const
+	{
+		return succeeded;
+	}
+	const wxString &GetError() const
+	{
+		return error;
+	}
+
+private:
+	virtual void *Entry();
+	bool SendData(const char *data, size_t len);
+	bool EndCopy(const char *errormsg);
+	bool WaitForSocket();
+
+	pgConn *connection;
+	wxString copyQuery;
+	importReaderThread *reader;
+	bool countRows;
+
+	wxCriticalSection progressLock;
+	wxLongLong bytesSent, rowsSent;
+
+	bool cancelled, succeeded;
+	wxString error;
+};
 
 class frmImport : public pgDialog
 {
@@ -29,11 +135,23 @@ private:
 	void OnSelectFilename(wxCommandEvent &ev);
 	void OnChangeFormat(wxCommandEvent &ev);
 	void OnOK(wxCommandEvent &ev);
+	void OnCancel(wxCommandEvent &ev);
+	void OnClose(wxCloseEvent &ev);
+	void OnTimer(wxTimerEvent &ev);
+
+	void StopImport();
+	void ShowProgress();
+	void ImportDone();
 
 	pgConn *connection;
 	pgObject *object;
 	bool done;
 
+	importReaderThread *reader;
+	importCopyThread *copyThread;
+	wxTimer timer;
+	wxStopWatch stopWatch;
+
 	DECLARE_EVENT_TABLE()
 };
 
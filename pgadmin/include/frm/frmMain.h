@@ -50,6 +50,7 @@ class serverCollection;
 class propertyFactory;
 class pluginUtilityFactory;
 class ctlMenuButton;
+class pgConnector;
 
 // A plugin utility
 typedef struct PluginUtility
@@ -138,6 +139,7 @@ public:
 	};
 	void StoreServers();
 	int ReconnectServer(pgServer *server, bool restore = true);
+	void ReconnectServers();
 	void ReportConnError(pgServer *server);
 	pgServerCollection *GetServerCollection()
 	{
@@ -202,6 +204,9 @@ private:
 	wxString timermsg;
 	long msgLevel;
 
+	pgConnector *connector;
+	int reconnectTotal, reconnectDone;
+
 	bool m_refreshing;
 
 	wxTreeItemId denyCollapseItem;
@@ -237,6 +242,7 @@ private:
 	void OnCollapse(wxTreeEvent &event);
 	void OnExpand(wxTreeEvent &event);
 	void OnClose(wxCloseEvent &event);
+	void OnServerConnected(wxCommandEvent &event);
 
 	void OnNew(wxCommandEvent &event);
 	void OnDelete(wxCommandEvent &ev);
@@ -200,6 +200,7 @@ private:
 	void OnSaveHistory(wxCommandEvent &event);
 	void OnAutoRollback(wxCommandEvent &event);
 	void OnAutoCommit(wxCommandEvent &event);
+	void OnStreamResults(wxCommandEvent &event);
 	void OnChangeConnection(wxCommandEvent &ev);
 	void OnClearHistory(wxCommandEvent &event);
 	void OnActivate(wxActivateEvent &event);
@@ -241,6 +242,7 @@ private:
 	void OnQueryComplete(pgQueryResultEvent &ev);
 	void completeQuery(bool done, bool explain, bool verbose);
 	bool isBeginNotRequired(wxString query);
+	bool isSingleStatement(wxString query);
 	void OnScriptComplete(wxCommandEvent &ev);
 	void setTools(const bool running);
 	void showMessage(const wxString &msg, const wxString &msgShort = wxT(""));
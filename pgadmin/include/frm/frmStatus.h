@@ -18,6 +18,8 @@
 #include <wx/listctrl.h>
 #include <wx/spinctrl.h>
 #include <wx/notebook.h>
+#include <wx/thread.h>
+#include <wx/hashmap.h>
 
 // wxAUI
 #include <wx/aui/aui.h>
@@ -25,6 +27,7 @@
 #include "dlg/dlgClasses.h"
 #include "utils/factory.h"
 #include "ctl/ctlAuiNotebook.h"
+#include "ctl/ctlListView.h"
 
 enum
 {
@@ -53,7 +56,9 @@ enum
 	TIMER_STATUS_ID,
 	TIMER_LOCKS_ID,
 	TIMER_XACT_ID,
-	TIMER_LOG_ID
+	TIMER_LOG_ID,
+	STATUS_SNAPSHOT_ID,
+	STATUS_LOGBATCH_ID
 };
 
 
@@ -82,11 +87,253 @@ enum
 #endif
 
 
-static wxCriticalSection gs_critsect;
+// Number of log entries kept for display
+#define STATUS_LOG_MAX_ROWS     100000
+
+// Size of the chunks read from the server log; it grows and shrinks
+// between these bounds depending on how long a round trip takes
+#define STATUS_LOG_MIN_CHUNK    16384
+#define STATUS_LOG_START_CHUNK  65536
+#define STATUS_LOG_MAX_CHUNK    4194304
 
 
 // Class declarations
 
+class frmStatus;
+
+// A snapshot of one refresh of a pane. It is built by a statusCollector
+// on its own thread and never changes once handed over to the window.
+class statusSnapshot
+{
+public:
+	statusSnapshot(int _pane) : pane(_pane), ok(false), broken(false), nCols(0) {}
+
+	int GetPane() const
+	{
+		return pane;
+	}
+	bool IsOk() const
+	{
+		return ok;
+	}
+	bool IsBroken() const
+	{
+		return broken;
+	}
+	long NumRows() const
+	{
+		return nCols ? (long)(cells.GetCount() / nCols) : 0;
+	}
+	wxString GetVal(long row, const wxString &colname) const;
+	long GetLong(long row, const wxString &colname) const;
+	bool GetBool(long row, const wxString &colname) const;
+
+private:
+	friend class statusCollector;
+
+	int pane;
+	bool ok, broken;
+	size_t nCols;
+	wxArrayString colNames, cells;
+};
+
+
+WX_DECLARE_STRING_HASH_MAP(long, statusKeyHash);
+
+// A virtual list view for the activity and locks panes. Each row has a
+// key (the pid, or the pid and the lock for the locks pane). Rows keep
+// their place from one refresh to the next, new ones are added at the end,
+// so that a refresh only redraws the rows that changed.
+class statusListView : public ctlListView
+{
+public:
+	statusListView(wxWindow *p, int id);
+
+	void BeginUpdate();
+	void AppendRow(const wxString &key, const wxArrayString &cells, const wxColour &colour = wxNullColour);
+	void EndUpdate();
+
+	// Show the rows in the order of the first refresh queued after Resort(),
+	// as when the user sorts the list. Queued() is called when a refresh has
+	// been queued.
+	void Resort()
+	{
+		resort = RESORT_WANTED;
+	}
+	void Queued()
+	{
+		if (resort == RESORT_WANTED)
+			resort = RESORT_QUEUED;
+	}
+
+protected:
+	virtual wxString OnGetItemText(long item, long column) const;
+	virtual int OnGetItemImage(long item) const;
+	virtual wxListItemAttr *OnGetItemAttr(long item) const;
+
+private:
+	bool RowChanged(long row) const;
+	void KeepOrder();
+
+	enum
+	{
+		RESORT_NONE,
+		RESORT_WANTED,
+		RESORT_QUEUED
+	};
+
+	wxArrayString keys, cells, newKeys, newCells;
+	wxArrayInt colours, newColours;
+	size_t nCols;
+	int resort;
+	mutable wxListItemAttr attr;
+};
+
+
+// A virtual list view for the logfile pane, keeping the last
+// STATUS_LOG_MAX_ROWS rows in a ring.
+class logListView : public ctlListView
+{
+public:
+	logListView(wxWindow *p, int id);
+
+	// Append rows given as a flat array of GetColumnCount() cells per row
+	void AppendRows(const wxArrayString &rowCells);
+	void AppendRow(const wxString &text);
+	void ClearRows();
+
+protected:
+	virtual wxString OnGetItemText(long item, long column) const;
+	virtual int OnGetItemImage(long item) const;
+
+private:
+	wxArrayString ring;
+	size_t nCols, first, count;
+};
+
+
+class statusLogRequest
+{
+public:
+	wxString filename, banner;
+	long offset, maxSize;
+	bool tail;
+	int generation;
+};
+
+WX_DEFINE_ARRAY_PTR(statusLogRequest *, statusLogRequestArray);
+
+
+// The rows parsed from one chunk of a logfile
+class statusLogBatch
+{
+public:
+	statusLogBatch() : offset(0), generation(0), last(false), newData(false), broken(false) {}
+
+	wxString filename, sqlState;
+	long offset;
+	int generation;
+	bool last, newData, broken;
+	wxArrayString cells;
+};
+
+
+// Reads server logfiles in the background on its own connection. The
+// files are read in adaptive chunks, split into records as the bytes
+// arrive and parsed into rows, which are posted as statusLogBatches.
+class statusLogReader : public wxThread
+{
+public:
+	statusLogReader(frmStatus *form, pgConn *conn, size_t nCols, const wxString &logFormat,
+	                int logFmtPos, bool logFormatKnown, bool logHasTimestamp);
+	~statusLogReader();
+
+	virtual void *Entry();
+
+	// Queue the reading of a file from the given offset. With tail set,
+	// an incomplete last line is kept until the next read of that file.
+	void Read(const wxString &filename, long offset, bool skipFirst, bool tail, const wxString &banner = wxEmptyString);
+
+	// Forget queued requests, anything already read is discarded
+	void Reset();
+	int GetGeneration();
+	bool IsBusy();
+	void Stop();
+
+private:
+	void ReadFile(statusLogRequest *request);
+	void SplitRecords(const char *data, size_t len, bool csv, wxArrayString &cells);
+	void AddRecord(const char *data, size_t len, bool csv, wxArrayString &cells);
+	void PostBatch(statusLogBatch *batch);
+	bool Aborted(int generation);
+
+	void ParseLine(const wxString &str, bool formatted, bool csv_log_format, wxArrayString &cells) const;
+	void NewRow(wxArrayString &cells, const wxString &first) const;
+	void SetCell(wxArrayString &cells, int col, const wxString &value) const;
+
+	frmStatus *form;
+	pgConn *connection;
+
+	size_t nCols;
+	wxString logFormat;
+	int logFmtPos;
+	bool logFormatKnown, logHasTimestamp, gpdb;
+	bool binaryRead;
+	long chunkSize;
+
+	// Bytes of a record not terminated yet, and how far they were scanned
+	wxString carryFile;
+	wxMemoryBuffer carry;
+	size_t carryScanned;
+	bool carryInQuote, resync;
+
+	wxMutex readerLock;
+	wxCondition readerCond;
+	statusLogRequestArray requests;
+	int generation;
+	bool working, stopping;
+};
+
+
+// Runs the refresh queries of the status window on its own connection,
+// one pane at a time, and posts the results back as statusSnapshots.
+class statusCollector : public wxThread
+{
+public:
+	statusCollector(frmStatus *form, pgConn *conn);
+	~statusCollector();
+
+	virtual void *Entry();
+
+	// Queue a refresh; returns false while the previous one for
+	// this pane hasn't been handed over to the window yet. Without a
+	// working connection, the thread connects again before running it.
+	bool Collect(int pane, const wxString &sql);
+	void Done(int pane);
+
+	// Takes ownership of the connection, which may be NULL or not
+	// connected yet; the switch happens between two queries
+	void SetConnection(pgConn *conn);
+	long GetBackendPID();
+	void Stop();
+
+private:
+	statusSnapshot *Query(pgConn *conn, int pane, const wxString &sql);
+	void Reconnect();
+	void PostSnapshot(statusSnapshot *snapshot);
+
+	frmStatus *form;
+	pgConn *connection, *nextConnection;
+	long backendPid;
+
+	wxMutex collectorLock;
+	wxCondition collectorCond;
+	bool stopping, switching;
+	bool busy[PANE_LOG + 1], queued[PANE_LOG + 1];
+	wxString pending[PANE_LOG + 1];
+};
+
+
 class frmStatus : public pgFrame
 {
 public:
@@ -94,11 +341,23 @@ public:
 	~frmStatus();
 	void Go();
 
+	// Also used by the collector threads on the connections they open
+	static void SetQuietLogging(pgConn *conn);
+
 private:
 	wxAuiManager manager;
 
 	frmMain *mainForm;
-	pgConn *connection, *locks_connection;
+	pgConn *connection;
+	statusCollector *collector, *lockCollector;
+
+	// A new connection for a background thread, or NULL if the server
+	// refused it
+	pgConn *DuplicateConnection();
+
+	// Same for a collector, which keeps the connection even if the server
+	// refused it, to connect again later
+	pgConn *OpenCollectorConnection();
 
 	wxString logFormat;
 	bool logHasTimestamp, logFormatKnown;
@@ -107,8 +366,6 @@ private:
 	wxDateTime logfileTimestamp, latestTimestamp;
 	wxString logDirectory, logfileName;
 
-	wxString savedPartialLine;
-
 	bool showCurrent, isCurrent;
 
 	long backend_pid;
@@ -134,10 +391,11 @@ private:
 	wxTimer *statusTimer, *locksTimer, *xactTimer, *logTimer;
 	int statusRate, locksRate, xactRate, logRate;
 
-	ctlListView   *statusList;
-	ctlListView   *lockList;
+	statusListView *statusList;
+	statusListView *lockList;
 	ctlListView   *xactList;
-	ctlListView   *logList;
+	logListView   *logList;
+	statusLogReader *logReader;
 
 	wxMenu        *actionMenu;
 	wxMenu        *statusPopupMenu;
@@ -178,6 +436,12 @@ private:
 	void OnRefreshLocksTimer(wxTimerEvent &event);
 	void OnRefreshXactTimer(wxTimerEvent &event);
 	void OnRefreshLogTimer(wxTimerEvent &event);
+	void OnSnapshot(wxCommandEvent &event);
+
+	void ShowStatusSnapshot(const statusSnapshot *snapshot);
+	void ShowLockSnapshot(const statusSnapshot *snapshot);
+	void ShowXactSnapshot(const statusSnapshot *snapshot);
+	bool IsOwnBackend(long pid);
 
 	void SetColumnImage(ctlListView *list, int col, int image);
 	void OnSortStatusGrid(wxListEvent &event);
@@ -222,9 +486,9 @@ private:
 	int fillLogfileCombo();
 	void emptyLogfileCombo();
 
-	void addLogFile(wxDateTime *dt, bool skipFirst);
-	void addLogFile(const wxString &filename, const wxDateTime timestamp, long len, long &read, bool skipFirst);
-	void addLogLine(const wxString &str, bool formatted = true, bool csv_log_format = false);
+	void addLogFile(wxDateTime *dt, bool skipFirst, const wxString &banner = wxEmptyString);
+	void checkLogRotation();
+	void OnLogBatch(wxCommandEvent &event);
 
 	void checkConnection();
 
@@ -70,8 +70,10 @@ enum
 	MNU_COSTS,
 	MNU_BUFFERS,
 	MNU_TIMING,
+	MNU_EXPLAINJSON,
 	MNU_AUTOROLLBACK,
 	MNU_AUTOCOMMIT,
+	MNU_STREAMRESULTS,
 	MNU_CLEARHISTORY,
 	MNU_SAVEHISTORY,
 	MNU_CHECKALIVE,
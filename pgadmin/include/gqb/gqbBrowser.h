@@ -57,11 +57,17 @@ private:
 
 	wxTreeItemId rootNode, catalogsNode, schemasNode;
 	void OnItemActivated(wxTreeEvent &event);
+	void OnItemExpanding(wxTreeEvent &event);
+	void OnItemMenu(wxTreeEvent &event);
+	void OnRefresh(wxCommandEvent &event);
+	void populateSchema(wxTreeItemId itemId);
 	void OnBeginDrag(wxTreeEvent &event);
 	wxString NumToStr(OID value);
 	gqbController *controller;			//Allow access to controller functions like add table to model
 	wxImageList *imageList;
 	int xx, yy;
+	wxString cacheKey;					// Catalog cache held for the database shown
+	pgConn *conn;						// Connection of the database shown
 
 	DECLARE_EVENT_TABLE()
 };
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// gqbCatalogCache.h - Relations and columns read for the GQB browser
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef GQBCATALOGCACHE_H
+#define GQBCATALOGCACHE_H
+
+#include <wx/hashmap.h>
+
+class pgConn;
+
+// How long (in seconds) what has been read for a database is reused
+#define GQB_CACHE_MAX_AGE 300
+
+// The tables and views of a schema
+class gqbCachedRelations
+{
+public:
+	wxArrayLong oids;
+	wxArrayString names, kinds;
+};
+
+WX_DECLARE_HASH_MAP(OID, gqbCachedRelations *, wxIntegerHash, wxIntegerEqual, gqbRelationsHash);
+WX_DECLARE_HASH_MAP(OID, wxArrayString, wxIntegerHash, wxIntegerEqual, gqbColumnsHash);
+
+class gqbCatalogCache;
+WX_DECLARE_STRING_HASH_MAP(gqbCatalogCache *, gqbCatalogCacheHash);
+
+// Kept per database and user, so that all Query tool windows connected to
+// the same database share what has been read. Each GQB browser showing the
+// database holds it, from acquire() to release(); it is freed when the last
+// one closes.
+class gqbCatalogCache
+{
+public:
+	~gqbCatalogCache();
+
+	static gqbCatalogCache *forConnection(pgConn *conn);
+
+	// Holds the cache of the connection's database until release() is
+	// called with the key returned.
+	static wxString acquire(pgConn *conn);
+	static void release(const wxString &key);
+
+	// Forgets what has been read for the connection's database, when the
+	// user asks for a refresh.
+	static void invalidate(pgConn *conn);
+
+	gqbCachedRelations *getRelations(pgConn *conn, OID schemaOid);
+
+	// The columns of a relation are read the first time they are needed.
+	const wxArrayString &getColumns(pgConn *conn, OID relOid);
+
+private:
+	gqbCatalogCache();
+	void clear();
+	static wxString keyFor(pgConn *conn);
+
+	long created;
+	bool showSystemObjects;
+	int users;
+	gqbRelationsHash relations;
+	gqbColumnsHash columns;
+
+	static gqbCatalogCacheHash caches;
+};
+#endif
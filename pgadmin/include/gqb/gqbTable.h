@@ -24,7 +24,6 @@ class gqbTable : public gqbObjectCollection
 {
 public:
 	gqbTable(gqbObject *parent, wxString name, pgConn *connection, type_gqbObject type, OID oid);
-	void createObjects(gqbBrowser *_tablesBrowser,  pgConn *_conn, OID oidVal, wxTreeItemId parentNode);
 	gqbIteratorBase *createColumnsIterator();
 	int countCols();
 	gqbColumn *getColumnAtIndex(int index);
@@ -32,7 +31,8 @@ public:
 
 private:
 	void addColumn(gqbColumn *column);    // Used only as synonym for gqbObjectCollection addObject
-	void createColumns(pgConn *conn, gqbBrowser *tablesBrowser, wxTreeItemId parentNode,  OID oidVal);
+	void loadColumns();
+	bool columnsLoaded;
 
 };
 #endif
@@ -12,6 +12,7 @@
 pgadmin3_SOURCES += \
     include/gqb/gqbArrayCollection.h \
     include/gqb/gqbBrowser.h \
+    include/gqb/gqbCatalogCache.h \
     include/gqb/gqbCollection.h \
     include/gqb/gqbCollectionBase.h \
     include/gqb/gqbColumn.h \
@@ -14,6 +14,7 @@
 
 #include "hotdraw/figures/hdIFigure.h"
 #include "hotdraw/utilities/hdRect.h"
+#include "hotdraw/utilities/hdSpatialIndex.h"
 
 
 // Main model of drawing
@@ -26,6 +27,13 @@ public:
 	virtual void remove(hdIFigure *figure);
 	virtual bool includes(hdIFigure *figure);
 	virtual hdIFigure *findFigure(int posIdx, int x, int y);
+	virtual void findFigures(int posIdx, hdRect &rect, wxArrayPtrVoid &result);
+	// Must be called when figures may have moved or changed size; the index
+	// is then rebuilt on its next use
+	void invalidateIndex()
+	{
+		spatialIndex.invalidate();
+	};
 	virtual void recalculateDisplayBox(int posIdx);
 	virtual void bringToFront(hdIFigure *figure);
 	virtual void sendToBack(hdIFigure *figure);
@@ -81,5 +89,7 @@ private:
 	hdCollection *handles;
 	hdRect displayBox;
 	wxString drawingName;
+	hdSpatialIndex spatialIndex;
+	hdSpatialIndex &getIndex(int posIdx);
 };
 #endif
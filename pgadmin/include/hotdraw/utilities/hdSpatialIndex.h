@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// hdSpatialIndex.h - Uniform grid to find the figures of a drawing near a
+// point or inside a rectangle without looking at all of them
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef HDSPATIALINDEX_H
+#define HDSPATIALINDEX_H
+#include "hotdraw/main/hdObject.h"
+#include "hotdraw/utilities/hdRect.h"
+#include "hotdraw/utilities/hdCollection.h"
+
+// Size in pixels of the square cells of the grid
+#define HD_INDEX_CELL_SIZE 128
+
+// Added around each figure's box: lines are hit a few pixels away from
+// them, and handles and terminals are drawn beyond the box
+#define HD_INDEX_MARGIN 16
+
+// Figures covering more cells than this are kept apart and always returned
+#define HD_INDEX_MAX_CELLS 1024
+
+WX_DECLARE_HASH_MAP(unsigned long, wxArrayInt, wxIntegerHash, wxIntegerEqual, hdIndexCells);
+
+class hdSpatialIndex : public hdObject
+{
+public:
+	hdSpatialIndex();
+	~hdSpatialIndex();
+
+	// Indexes the figures at their position in diagram posIdx
+	void rebuild(hdCollection *figures, int posIdx);
+	void invalidate()
+	{
+		valid = false;
+	};
+	bool isValid(int posIdx)
+	{
+		return valid && posIdx == indexedPosIdx;
+	};
+
+	// Adds the figures which may intersect rect to result, back to front
+	// (the order in which they are drawn)
+	void query(const hdRect &rect, wxArrayPtrVoid &result);
+
+	// Union of the boxes of all the figures, without the margin
+	hdRect &getBounds()
+	{
+		return bounds;
+	};
+
+private:
+	void cellsOf(const wxRect &box, int &x1, int &y1, int &x2, int &y2);
+	unsigned long cellKey(int cx, int cy);
+
+	bool valid;
+	int indexedPosIdx;
+	hdRect bounds;
+
+	// Figures and their boxes with margin, in drawing order
+	wxArrayPtrVoid figures;
+	wxArrayInt boxX, boxY, boxWidth, boxHeight;
+
+	// Positions in figures, by cell
+	hdIndexCells cells;
+	wxArrayInt large;
+};
+#endif
@@ -19,7 +19,8 @@ pgadmin3_SOURCES += \
 	include/hotdraw/utilities/hdMouseEvent.h \
 	include/hotdraw/utilities/hdPoint.h \
 	include/hotdraw/utilities/hdRect.h \
-	include/hotdraw/utilities/hdRemoveDeleteDialog.h
+	include/hotdraw/utilities/hdRemoveDeleteDialog.h \
+	include/hotdraw/utilities/hdSpatialIndex.h
 
 EXTRA_DIST += \
 	include/hotdraw/utilities/module.mk
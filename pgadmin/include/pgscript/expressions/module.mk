@@ -46,6 +46,7 @@ pgadmin3_SOURCES += \
 	include/pgscript/expressions/pgsParenthesis.h \
 	include/pgscript/expressions/pgsPlus.h \
 	include/pgscript/expressions/pgsRemoveLine.h \
+	include/pgscript/expressions/pgsSeed.h \
 	include/pgscript/expressions/pgsTimes.h \
 	include/pgscript/expressions/pgsTrim.h
 
@@ -38,6 +38,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSASSIGN_H_*/
@@ -39,6 +39,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSASSIGNTORECORD_H_*/
@@ -41,6 +41,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSCAST_H_*/
@@ -24,6 +24,20 @@ private:
 
 	wxString m_query;
 
+	/** Text of the query around its variables (one item more than m_vars),
+	 * with the escape sequences resolved. */
+	wxArrayString m_parts;
+
+	/** Variables referenced in the query, in order of appearance. */
+	wxArrayString m_vars;
+
+	/** For each variable: is it a whole string literal ('@var')? In that
+	 * case the quotes are not part of m_parts. */
+	wxArrayInt m_quoted;
+
+	/** Can the query be sent as a prepared statement with parameters? */
+	bool m_preparable;
+
 	pgsOutputStream *m_cout;
 
 	pgsThread *m_app;
@@ -45,6 +59,15 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+private:
+
+	/** Splits m_query around its variables, done once for all. */
+	void parse();
+
+	/** Returns the type of the SQL numeric constant that value would be,
+	 * or an empty string if it is not a number. */
+	static wxString number_type(const wxString &value);
+
 };
 
 #endif /*PGSEXECUTE_H_*/
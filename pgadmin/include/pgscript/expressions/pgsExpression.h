@@ -13,12 +13,52 @@
 
 #include "pgscript/pgScript.h"
 #include "pgscript/utilities/pgsCopiedPtr.h"
+#include "pgscript/utilities/pgsSharedPtr.h"
 
 class pgsProgram;
 class pgsVariable;
 
-WX_DECLARE_STRING_HASH_MAP(pgsCopiedPtr<pgsVariable>, pgsVarMap);
-typedef pgsCopiedPtr<pgsVariable> pgsOperand;
+// Values are shared between variables and operands instead of being copied
+// each time a variable is read. They are never modified, except records
+// which are detached first (copy-on-write).
+WX_DECLARE_STRING_HASH_MAP(pgsSharedPtr<pgsVariable>, pgsVarHash);
+WX_DECLARE_STRING_HASH_MAP(long, pgsSlotHash);
+typedef pgsSharedPtr<pgsVariable> pgsOperand;
+
+/**
+ * Variables by name. Before a program runs, pgsProgram gives each of its
+ * identifiers a slot, so that reading a variable does not look its name up
+ * each time. A slot points to the value of the variable in the map once it
+ * exists: entries are never moved nor removed, except by clear().
+ */
+class pgsVarMap : public pgsVarHash
+{
+
+private:
+
+	pgsSlotHash m_slots;
+
+	wxArrayString m_slot_names;
+
+	wxArrayPtrVoid m_slot_values;
+
+public:
+
+	pgsVarMap();
+
+	pgsVarMap(const pgsVarMap &that);
+
+	pgsVarMap &operator=(const pgsVarMap &that);
+
+	/** Slot of a variable, the same for all the identifiers of that name. */
+	long slot(const wxString &name);
+
+	/** Value of the variable of a slot, or 0 if it has not been set. */
+	pgsOperand *at(const long &slot);
+
+	void clear();
+
+};
 
 class pgsExpression
 {
@@ -43,6 +83,10 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const = 0;
 
+	/** Gives the identifiers of the expression their slot in vars, once
+	 * before the program runs. Does nothing by default. */
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSEXPRESSION_H_*/
@@ -46,6 +46,7 @@
 #include "pgsParenthesis.h"
 #include "pgsPlus.h"
 #include "pgsRemoveLine.h"
+#include "pgsSeed.h"
 #include "pgsTimes.h"
 #include "pgsTrim.h"
 
@@ -43,6 +43,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSGENDATETIME_H_*/
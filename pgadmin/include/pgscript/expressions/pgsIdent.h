@@ -21,6 +21,12 @@ protected:
 
 	wxString m_name;
 
+	/** Slot of the variable in the map, -1 until resolve() is called. */
+	mutable long m_slot;
+
+	/** The value of the variable, or 0 if it has not been set. */
+	pgsOperand *lookup(pgsVarMap &vars) const;
+
 public:
 
 	pgsIdent(const wxString &name);
@@ -37,6 +43,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 public:
 
 	static const wxString m_now;
@@ -38,6 +38,8 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const = 0;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 };
 
 #endif /*PGSOPERATION_H_*/
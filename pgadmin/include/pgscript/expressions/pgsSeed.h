@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PGSSEED_H_
+#define PGSSEED_H_
+
+#include "pgscript/pgScript.h"
+#include "pgscript/expressions/pgsExpression.h"
+#include "pgscript/expressions/pgsIdent.h"
+
+/**
+ * Seed of the generators which are not given one: the time the script was
+ * parsed, mixed with @WORKER in the workers of a PARALLEL block so that they
+ * draw different values.
+ */
+class pgsSeed : public pgsExpression
+{
+
+private:
+
+	long m_time;
+
+	pgsIdent m_worker;
+
+public:
+
+	pgsSeed();
+
+	virtual ~pgsSeed();
+
+	/* pgsSeed(const pgsSeed & that); */
+
+	/* pgsSeed & operator=(const pgsSeed & that); */
+
+	virtual pgsExpression *clone() const;
+
+	virtual wxString value() const;
+
+	virtual pgsOperand eval(pgsVarMap &vars) const;
+
+	virtual void resolve(pgsVarMap &vars) const;
+
+};
+
+#endif /*PGSSEED_H_*/
@@ -13,6 +13,48 @@
 
 #include "pgscript/pgScript.h"
 #include "pgscript/generators/pgsIntegerGen.h"
+#include "pgscript/utilities/pgsSharedPtr.h"
+
+// Content of a dictionary file with the offset of each of its lines,
+// loaded once per file and shared by all the generators reading it
+class pgsDictionaryIndex
+{
+
+private:
+
+	char *m_data;
+	wxArrayLong m_offsets; // Start of each line, plus the end of the last one
+
+	// Converted content, when a '\n' byte may be part of another character
+	// in the encoding of the file (UTF-16, UTF-32): offsets are then
+	// positions in this string
+	wxString m_text;
+
+	wxDateTime m_modified;
+	wxFileOffset m_size;
+
+public:
+
+	pgsDictionaryIndex(const wxString &file_path, wxMBConv &conv);
+
+	~pgsDictionaryIndex();
+
+	long nb_lines() const;
+
+	wxString get_line(long line_nb, wxMBConv &conv) const;
+
+	bool is_current(const wxString &file_path) const;
+
+	/** Are line ends single '\n' bytes in this encoding? */
+	static bool is_ascii_compatible(wxMBConv &conv);
+
+private:
+
+	pgsDictionaryIndex(const pgsDictionaryIndex &that);
+
+	pgsDictionaryIndex &operator =(const pgsDictionaryIndex &that);
+
+};
 
 class pgsDictionaryGen : public pgsObjectGen
 {
@@ -21,9 +63,13 @@ private:
 
 	typedef pgsCopiedPtr<pgsIntegerGen> pgsRandomizer; // Needs a clone() method
 
+	typedef pgsSharedPtr<pgsDictionaryIndex> pgsIndex;
+
 	wxString m_file_path;
 	wxCSConv m_conv;
 
+	pgsIndex m_index;
+
 	long m_nb_lines;
 
 	pgsRandomizer m_randomizer;
@@ -49,9 +95,7 @@ private:
 
 private:
 
-	long count_lines();
-
-	wxString get_line(long line_nb);
+	static pgsIndex get_index(const wxString &file_path, wxMBConv &conv);
 
 };
 
@@ -78,12 +78,71 @@ private:
 		/* pgsNormalIntGen(const pgsNormalIntGen & that); */
 	};
 
+	// Same sequences as the two generators above, computed on 64-bit
+	// integers: used whenever the bounds fit in them
+	class pgsInt64Gen
+	{
+
+	public:
+
+		virtual ~pgsInt64Gen();
+
+		virtual wxLongLong_t random() = 0;
+
+		virtual pgsInt64Gen *clone() = 0;
+	};
+
+	class pgsSequentialInt64Gen : public pgsInt64Gen
+	{
+
+	private:
+
+		wxULongLong_t m_state;
+		wxULongLong_t m_mask; // Modulus minus 1, the modulus being a power of 2
+		wxLongLong_t m_range;
+
+		wxLongLong_t m_remainder;
+
+		wxLongLong_t m_buffer[pgsNumberGen::BUFFER_SIZE];
+		size_t m_buffer_count;
+
+	public:
+
+		pgsSequentialInt64Gen(const wxLongLong_t &range, const long &seed);
+
+		virtual wxLongLong_t random();
+
+		virtual pgsInt64Gen *clone();
+	};
+
+	class pgsNormalInt64Gen : public pgsInt64Gen
+	{
+
+	private:
+
+		wxLongLong_t m_state;
+		wxLongLong_t m_range;
+
+		static const wxLongLong_t arg_a;
+		static const wxLongLong_t arg_m;
+
+	public:
+
+		pgsNormalInt64Gen(const wxLongLong_t &range, const long &seed);
+
+		virtual wxLongLong_t random();
+
+		virtual pgsInt64Gen *clone();
+	};
+
 	friend class pgsRealGen;
 
 private:
 
 	typedef pgsCopiedPtr<pgsNumberGen> pgsRandomizer; // Needs a clone() method
 
+	typedef pgsCopiedPtr<pgsInt64Gen> pgsInt64Randomizer;
+
 	MAPM m_min;
 	MAPM m_max;
 	MAPM m_range;
@@ -92,6 +151,10 @@ private:
 
 	pgsRandomizer m_randomizer;
 
+	// Only set when the 64-bit generators can be used
+	pgsInt64Randomizer m_int64_randomizer;
+	wxLongLong_t m_int64_min;
+
 public:
 
 	pgsIntegerGen(const MAPM &min, const MAPM &max,
@@ -103,6 +166,8 @@ public:
 
 	long random_long();
 
+	wxLongLong_t random_int64();
+
 	virtual ~pgsIntegerGen();
 
 	virtual pgsIntegerGen *clone();
@@ -13,9 +13,51 @@
 
 #include "pgscript/pgScript.h"
 #include "pgscript/generators/pgsIntegerGen.h"
+#include "pgscript/utilities/pgsSharedPtr.h"
 
 class pgsThread;
 
+// Values of the referenced column, read from the server once and shared by
+// a generator and its clones
+class pgsReferenceKeys
+{
+
+private:
+
+	wxMemoryBuffer m_data; // Raw values as sent by the server
+	wxArrayLong m_offsets; // Start of each value, plus the end of the last one
+	wxMBConv *m_conv;
+
+	long m_version; // Incremented each time the values are read
+	long m_loaded; // When they were read
+
+public:
+
+	// Above this number of rows, a random sample of about as many rows is kept
+	static const long MAX_KEYS = 1000000;
+
+	pgsReferenceKeys(pgsThread *app, const wxString &table, const wxString &column);
+
+	~pgsReferenceKeys();
+
+	void load(pgsThread *app, const wxString &table, const wxString &column);
+
+	long nb_keys() const;
+
+	wxString get_key(long key_nb) const;
+
+	const long &version() const;
+
+	const long &loaded() const;
+
+private:
+
+	pgsReferenceKeys(const pgsReferenceKeys &that);
+
+	pgsReferenceKeys &operator =(const pgsReferenceKeys &that);
+
+};
+
 class pgsReferenceGen : public pgsObjectGen
 {
 
@@ -23,19 +65,27 @@ private:
 
 	typedef pgsCopiedPtr<pgsIntegerGen> pgsRandomizer; // Needs a clone() method
 
+	typedef pgsSharedPtr<pgsReferenceKeys> pgsKeys;
+
 	pgsThread *m_app;
 	wxString m_table;
 	wxString m_column;
 	bool m_sequence;
 
-	MAPM m_nb_rows;
+	// Seconds after which the values are read again, 0 for never
+	long m_refresh;
+
+	pgsKeys m_keys;
+	long m_version;
+	long m_nb_keys;
 
 	pgsRandomizer m_randomizer;
 
 public:
 
 	pgsReferenceGen(pgsThread *app, const wxString &table, const wxString &column,
-	                const bool &sequence = false, const long &seed = wxDateTime::GetTimeNow());
+	                const bool &sequence = false, const long &seed = wxDateTime::GetTimeNow(),
+	                const long &refresh = 0);
 
 	bool is_sequence() const;
 
@@ -48,6 +98,10 @@ public:
 	/* pgsReferenceGen & operator =(const pgsReferenceGen & that); */
 
 	/* pgsReferenceGen(const pgsReferenceGen & that); */
+
+private:
+
+	void init_randomizer();
 };
 
 #endif /*PGSREFERENCEGEN_H_*/
@@ -23,6 +23,10 @@ class pgsString;
  * number otherwise it is a string. The difference between a string stored
  * in this object and a string stored in pgsString is that a string in pgsNumber
  * cannot be concatenated with another one in pgsPlus.
+ *
+ * Integers fitting in 64 bits are also kept as such so that arithmetic and
+ * comparisons between them neither go through MAPM nor parse and print text.
+ * Other numbers and results which would overflow go through MAPM.
  */
 class pgsNumber : public pgsVariable
 {
@@ -59,12 +63,22 @@ public:
 
 protected:
 
-	wxString m_data;
+	/** Text of the number, made from m_int when it is first needed */
+	mutable wxString m_data;
+
+	mutable bool m_has_data;
+
+	/** Whether m_int holds the value of the number */
+	bool m_is_int;
+
+	wxLongLong_t m_int;
 
 public:
 
 	explicit pgsNumber(const wxString &data, const bool &is_real = pgsInt);
 
+	explicit pgsNumber(const wxLongLong_t &data, const bool &is_real = pgsInt);
+
 	virtual ~pgsNumber();
 
 	virtual pgsVariable *clone() const;
@@ -79,12 +93,30 @@ public:
 
 	virtual pgsOperand eval(pgsVarMap &vars) const;
 
+	/** Whether the number is an integer fitting in 64 bits */
+	bool is_int64() const;
+
+	/** Value of the number when is_int64() */
+	const wxLongLong_t &int64() const;
+
+	MAPM mapm() const;
+
+private:
+
+	/** Returns -1, 0 or 1 when this number is lower, equal or greater */
+	int compare(const pgsNumber &that) const;
+
 public:
 
 	bool is_valid() const;
 
 	static pgsTypes num_type(const wxString &num);
 
+	/** Reads an integer of the form [+-]?[0-9]+ if it fits in 64 bits */
+	static bool to_int64(const wxString &num, wxLongLong_t &result);
+
+	static bool to_int64(const char *num, wxLongLong_t &result);
+
 public:
 
 	virtual pgsNumber number() const;
@@ -15,11 +15,88 @@
 #include "pgscript/objects/pgsVariable.h"
 
 WX_DECLARE_OBJARRAY(pgsOperand, pgsVectorRecordLine);
-WX_DECLARE_OBJARRAY(pgsVectorRecordLine, pgsVectorRecord);
 
 class pgsNumber;
 class pgsString;
 
+/**
+ * Values of one column of a record, one per line. Integers are kept in a
+ * contiguous array of 64-bit values and reals and strings by their text, so
+ * that no operand is created for the cells of a result set. Other values
+ * (generators assigned to a cell) are kept as operands.
+ */
+class pgsRecordColumn
+{
+
+public:
+
+	enum pgsKinds
+	{
+		pgsKString = 0,
+		pgsKInt,
+		pgsKReal,
+		pgsKOperand
+	};
+
+private:
+
+	// One unsigned char (pgsKinds) per line
+	wxMemoryBuffer m_kinds;
+
+	// One wxLongLong_t per line: the value of pgsKInt cells and the position
+	// in m_operands of pgsKOperand cells
+	wxMemoryBuffer m_ints;
+
+	// Text of pgsKString and pgsKReal cells, empty for the others
+	wxArrayString m_texts;
+
+	pgsVectorRecordLine m_operands;
+
+	// Positions in m_operands no longer used by any line, reused first
+	wxArrayLong m_free_operands;
+
+public:
+
+	pgsRecordColumn();
+
+	pgsRecordColumn(const pgsRecordColumn &that);
+
+	pgsRecordColumn &operator =(const pgsRecordColumn &that);
+
+	size_t count() const;
+
+	/** Adds nb_lines empty strings at the end */
+	void add_lines(const size_t &nb_lines);
+
+	void remove_line(const size_t &line);
+
+	void set(const size_t &line, const pgsOperand &value);
+
+	void set_int(const size_t &line, const wxLongLong_t &value);
+
+	/** Kind must be pgsKString or pgsKReal */
+	void set_text(const size_t &line, const wxString &text, const pgsKinds &kind);
+
+	pgsOperand get(const size_t &line) const;
+
+	/** Same as get(line)->value() without creating an operand */
+	wxString value(const size_t &line) const;
+
+	bool is_number(const size_t &line) const;
+
+private:
+
+	unsigned char *kinds() const;
+
+	wxLongLong_t *ints() const;
+
+	/** Frees the operand of line if it holds one */
+	void release_operand(const size_t &line);
+
+};
+
+WX_DECLARE_OBJARRAY(pgsRecordColumn, pgsVectorRecordColumns);
+
 class pgsRecord : public pgsVariable
 {
 
@@ -55,12 +132,18 @@ public:
 
 protected:
 
-	pgsVectorRecord m_record;
+	pgsVectorRecordColumns m_record;
 
 	wxArrayString m_columns;
 
+	wxLongLong_t m_nb_lines;
+
 public:
 
+	/** How many lines an insertion can add at once, beyond the last one:
+	 * a typo in a line number must not allocate gigabytes. */
+	static const long max_growth = 1000000;
+
 	explicit pgsRecord(const USHORT &nb_columns);
 
 	virtual ~pgsRecord();
@@ -77,25 +160,40 @@ public:
 
 public:
 
-	USHORT count_lines() const;
+	wxLongLong_t count_lines() const;
 
 	USHORT count_columns() const;
 
 	/**
 	 * Inserts a new element at line.column. If there is something then
-	 * it is deleted before inserting the new element.
+	 * it is deleted before inserting the new element. Fails if line is
+	 * max_growth lines or more beyond the end of the record.
 	 */
-	bool insert(const USHORT &line, const USHORT &column,
+	bool insert(const wxLongLong_t &line, const USHORT &column,
 	            pgsOperand value);
 
+	/**
+	 * Adds nb_lines lines of empty strings. Used with set_int() and set_text()
+	 * to fill a record without creating an operand per cell.
+	 */
+	void add_lines(const wxLongLong_t &nb_lines);
+
+	/** Sets an existing line.column to an integer */
+	void set_int(const wxLongLong_t &line, const USHORT &column,
+	             const wxLongLong_t &value);
+
+	/** Sets an existing line.column to a string or to a real (its text) */
+	void set_text(const wxLongLong_t &line, const USHORT &column,
+	              const wxString &text, const bool &is_real = false);
+
 	/**
 	 * Retrieves the element at line.column. If it does not exist it
 	 * returns an empty string.
 	 */
-	pgsOperand get(const USHORT &line,
+	pgsOperand get(const wxLongLong_t &line,
 	               const USHORT &column) const;
 
-	pgsOperand get_line(const USHORT &line) const;
+	pgsOperand get_line(const wxLongLong_t &line) const;
 
 	/**
 	 * Sets the name of a column. If the index is too high or if the name
@@ -110,7 +208,7 @@ public:
 	 */
 	USHORT get_column(wxString name) const;
 
-	bool remove_line(const USHORT &line);
+	bool remove_line(const wxLongLong_t &line);
 
 private:
 
@@ -139,8 +237,9 @@ private:
 	bool records_equal(const pgsRecord &lhs, const pgsRecord &rhs,
 	                   bool case_sensitive = true) const;
 
-	bool lines_equal(const pgsVectorRecordLine &lhs,
-	                 const pgsVectorRecordLine &rhs, bool case_sensitive = true) const;
+	bool lines_equal(const pgsRecord &lhs, const size_t &lhs_line,
+	                 const pgsRecord &rhs, const size_t &rhs_line,
+	                 bool case_sensitive = true) const;
 
 public:
 
@@ -1,403 +1,1019 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
-
-/* Skeleton interface for Bison LALR(1) parsers in C++
-
-   Copyright (C) 2002, 2003, 2004, 2005, 2006 Free Software Foundation, Inc.
-
-   This program is free software; you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
-
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
-
-   You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
-
-/* As a special exception, you may create a larger work that contains
-   part or all of the Bison parser skeleton and distribute that work
-   under terms of your choice, so long as that work isn't itself a
-   parser generator using the skeleton or a modified version thereof
-   as a parser skeleton.  Alternatively, if you modify or redistribute
-   the parser skeleton itself, you may (at your option) remove this
-   special exception, which will cause the skeleton and the resulting
-   Bison output files to be licensed under the GNU General Public
-   License without this special exception.
-
-   This special exception was added by the Free Software Foundation in
-   version 2.2 of Bison.  */
-
-/* C++ LALR(1) parser skeleton written by Akim Demaille.  */
-
-#ifndef PARSER_HEADER_H
-# define PARSER_HEADER_H
-
-#include <string>
-#include <iostream>
-#include "stack.hh"
-
-namespace pgscript
-{
-  class position;
-  class location;
-}
-
-/* First part of user declarations.  */
-#line 1 "pgscript/pgsParser.yy"
- /*** C/C++ Declarations ***/
-	
-//////////////////////////////////////////////////////////////////////////
-//
-// pgScript - PostgreSQL Tools
-// 
-// Copyright (C) 2002 - 2014, The pgAdmin Development Team
-// This software is released under the PostgreSQL Licence
-//
-//////////////////////////////////////////////////////////////////////////
-
-#include "pgscript/pgScript.h"
-#include "pgscript/statements/pgsStatements.h"
-#include "pgscript/expressions/pgsExpressions.h"
-#include "pgscript/objects/pgsObjects.h"
-#include "pgscript/utilities/pgsContext.h"
-
-
-
-/* Line 35 of lalr1.cc.  */
-#line 73 "pgscript/parser.tab.hh"
-
-#include "location.hh"
-
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
+// A Bison parser, made by GNU Bison 3.8.2.
+
+// Skeleton interface for Bison LALR(1) parsers in C++
+
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
+
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
+
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+
+/**
+ ** \file pgscript/parser.tab.hh
+ ** Define the pgscript::parser class.
+ */
+
+// C++ LALR(1) parser skeleton written by Akim Demaille.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+#ifndef YY_YY_PGSCRIPT_PARSER_TAB_HH_INCLUDED
+# define YY_YY_PGSCRIPT_PARSER_TAB_HH_INCLUDED
+
+
+# include <cstdlib> // std::abort
+# include <iostream>
+# include <stdexcept>
+# include <string>
+# include <vector>
+
+#if defined __cplusplus
+# define YY_CPLUSPLUS __cplusplus
+#else
+# define YY_CPLUSPLUS 199711L
+#endif
+
+// Support move semantics when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_MOVE           std::move
+# define YY_MOVE_OR_COPY   move
+# define YY_MOVE_REF(Type) Type&&
+# define YY_RVREF(Type)    Type&&
+# define YY_COPY(Type)     Type
+#else
+# define YY_MOVE
+# define YY_MOVE_OR_COPY   copy
+# define YY_MOVE_REF(Type) Type&
+# define YY_RVREF(Type)    const Type&
+# define YY_COPY(Type)     const Type&
+#endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
 #endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
 #else
-# define YYERROR_VERBOSE 1
+# define YY_CONSTEXPR
+#endif
+# include "location.hh"
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
 #endif
 
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)		\
-do {							\
-  if (N)						\
-    {							\
-      (Current).begin = (Rhs)[1].begin;			\
-      (Current).end   = (Rhs)[N].end;			\
-    }							\
-  else							\
-    {							\
-      (Current).begin = (Current).end = (Rhs)[0].end;	\
-    }							\
-} while (false)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
-namespace pgscript
-{
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+
+#line 37 "pgscript/pgsParser.yy"
+namespace pgscript {
+#line 183 "pgscript/parser.tab.hh"
+
+
+
 
   /// A Bison parser.
   class pgsParser
   {
   public:
+#ifdef YYSTYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define YYSTYPE in C++, use %define api.value.type"
+# endif
+    typedef YYSTYPE value_type;
+#else
     /// Symbol semantic values.
-#ifndef YYSTYPE
-    union semantic_type
-#line 106 "pgscript/pgsParser.yy"
-{
+    union value_type
+    {
+#line 109 "pgscript/pgsParser.yy"
+
 	const wxString * str;
 	int integer;
 	pgsExpression * expr;
 	pgsStmt * stmt;
 	pgsStmtList * stmt_list;
-}
-/* Line 35 of lalr1.cc.  */
-#line 133 "pgscript/parser.tab.hh"
-	;
-#else
-    typedef YYSTYPE semantic_type;
+
+#line 209 "pgscript/parser.tab.hh"
+
+    };
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
-    /// Tokens.
+
+    /// Syntax errors thrown from user actions.
+    struct syntax_error : std::runtime_error
+    {
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
+      location_type location;
+    };
+
+    /// Token kinds.
     struct token
     {
-      /* Tokens.  */
-   enum yytokentype {
-     PGS_END = 0,
-     PGS_WHILE = 258,
-     PGS_BREAK = 259,
-     PGS_RETURN = 260,
-     PGS_CONTINUE = 261,
-     PGS_IF = 262,
-     PGS_ELSE = 263,
-     PGS_WAITFOR = 264,
-     PGS_AS = 265,
-     PGS_OPEN = 266,
-     PGS_CLOSE = 267,
-     PGS_ASSERT = 268,
-     PGS_PRINT = 269,
-     PGS_LOG = 270,
-     PGS_CNT_COLUMNS = 271,
-     PGS_CNT_LINES = 272,
-     PGS_TRIM = 273,
-     PGS_RM_LINE = 274,
-     PGS_CAST = 275,
-     PGS_RECORD = 276,
-     PGS_INTEGER = 277,
-     PGS_REAL = 278,
-     PGS_STRING = 279,
-     PGS_REGEX = 280,
-     PGS_FILE = 281,
-     PGS_DATE = 282,
-     PGS_TIME = 283,
-     PGS_DATE_TIME = 284,
-     PGS_REFERENCE = 285,
-     PGS_LE_OP = 286,
-     PGS_GE_OP = 287,
-     PGS_EQ_OP = 288,
-     PGS_AE_OP = 289,
-     PGS_NE_OP = 290,
-     PGS_AND_OP = 291,
-     PGS_OR_OP = 292,
-     PGS_NOT_OP = 293,
-     PGS_UNKNOWN = 294,
-     PGS_SET_ASSIGN = 295,
-     PGS_DECLARE_ASSGN = 296,
-     PGS_ABORT = 297,
-     PGS_ALTER = 298,
-     PGS_ANALYZE = 299,
-     PGS_BEGIN = 300,
-     PGS_CHECKPOINT = 301,
-     PGS_CLOSE_ST = 302,
-     PGS_CLUSTER = 303,
-     PGS_COMMENT = 304,
-     PGS_COMMIT = 305,
-     PGS_COPY = 306,
-     PGS_CREATE = 307,
-     PGS_DEALLOCATE = 308,
-     PGS_DECLARE = 309,
-     PGS_DELETE = 310,
-     PGS_DISCARD = 311,
-     PGS_DROP = 312,
-     PGS_END_ST = 313,
-     PGS_EXECUTE = 314,
-     PGS_EXPLAIN = 315,
-     PGS_FETCH = 316,
-     PGS_GRANT = 317,
-     PGS_INSERT = 318,
-     PGS_LISTEN = 319,
-     PGS_LOAD = 320,
-     PGS_LOCK = 321,
-     PGS_MOVE = 322,
-     PGS_NOTIFY = 323,
-     PGS_PREPARE = 324,
-     PGS_REASSIGN = 325,
-     PGS_REINDEX = 326,
-     PGS_RELEASE = 327,
-     PGS_RESET = 328,
-     PGS_REVOKE = 329,
-     PGS_ROLLBACK = 330,
-     PGS_SAVEPOINT = 331,
-     PGS_SELECT = 332,
-     PGS_SET = 333,
-     PGS_SHOW = 334,
-     PGS_START = 335,
-     PGS_TRUNCATE = 336,
-     PGS_UNLISTEN = 337,
-     PGS_UPDATE = 338,
-     PGS_VACUUM = 339,
-     PGS_VALUES = 340,
-     PGS_IDENTIFIER = 341,
-     PGS_VAL_INT = 342,
-     PGS_VAL_REAL = 343,
-     PGS_VAL_STR = 344
-   };
+      enum token_kind_type
+      {
+        YYEMPTY = -2,
+    PGS_END = 0,                   // "END OF FILE"
+    YYerror = 256,                 // error
+    YYUNDEF = 257,                 // "invalid token"
+    PGS_WHILE = 258,               // "WHILE"
+    PGS_BREAK = 259,               // "BREAK"
+    PGS_RETURN = 260,              // "RETURN"
+    PGS_CONTINUE = 261,            // "CONTINUE"
+    PGS_IF = 262,                  // "IF"
+    PGS_ELSE = 263,                // "ELSE"
+    PGS_WAITFOR = 264,             // "WAITFOR"
+    PGS_AS = 265,                  // "AS"
+    PGS_PARALLEL = 266,            // "PARALLEL"
+    PGS_OPEN = 267,                // "BEGIN (BLOCK)"
+    PGS_CLOSE = 268,               // "END (BLOCK)"
+    PGS_ASSERT = 269,              // "ASSERT"
+    PGS_PRINT = 270,               // "PRINT"
+    PGS_LOG = 271,                 // "LOG"
+    PGS_CNT_COLUMNS = 272,         // "COLUMNS"
+    PGS_CNT_LINES = 273,           // "LINES"
+    PGS_TRIM = 274,                // "TRIM"
+    PGS_RM_LINE = 275,             // "RMLINE"
+    PGS_CAST = 276,                // "CAST"
+    PGS_RECORD = 277,              // "RECORD"
+    PGS_INTEGER = 278,             // "INTEGER"
+    PGS_REAL = 279,                // "REAL"
+    PGS_STRING = 280,              // "STRING"
+    PGS_REGEX = 281,               // "REGEX"
+    PGS_FILE = 282,                // "FILE"
+    PGS_DATE = 283,                // "DATE"
+    PGS_TIME = 284,                // "TIME"
+    PGS_DATE_TIME = 285,           // "DATETIME"
+    PGS_REFERENCE = 286,           // "REFERENCE"
+    PGS_LE_OP = 287,               // "<="
+    PGS_GE_OP = 288,               // ">="
+    PGS_EQ_OP = 289,               // "="
+    PGS_AE_OP = 290,               // "~="
+    PGS_NE_OP = 291,               // "<>"
+    PGS_AND_OP = 292,              // "AND"
+    PGS_OR_OP = 293,               // "OR"
+    PGS_NOT_OP = 294,              // "NOT"
+    PGS_UNKNOWN = 295,             // "character"
+    PGS_SET_ASSIGN = 296,          // "SET @VARIABLE"
+    PGS_DECLARE_ASSGN = 297,       // "DECLARE @VARIABLE"
+    PGS_ABORT = 298,               // "ABORT"
+    PGS_ALTER = 299,               // "ALTER"
+    PGS_ANALYZE = 300,             // "ANALYZE"
+    PGS_BEGIN = 301,               // "BEGIN"
+    PGS_CHECKPOINT = 302,          // "CHECKPOINT"
+    PGS_CLOSE_ST = 303,            // "CLOSE"
+    PGS_CLUSTER = 304,             // "CLUSTER"
+    PGS_COMMENT = 305,             // "COMMENT"
+    PGS_COMMIT = 306,              // "COMMIT"
+    PGS_COPY = 307,                // "COPY"
+    PGS_CREATE = 308,              // "CREATE"
+    PGS_DEALLOCATE = 309,          // "DEALLOCATE"
+    PGS_DECLARE = 310,             // "DECLARE"
+    PGS_DELETE = 311,              // "DELETE"
+    PGS_DISCARD = 312,             // "DISCARD"
+    PGS_DROP = 313,                // "DROP"
+    PGS_END_ST = 314,              // "END"
+    PGS_EXECUTE = 315,             // "EXECUTE"
+    PGS_EXPLAIN = 316,             // "EXPLAIN"
+    PGS_FETCH = 317,               // "FETCH"
+    PGS_GRANT = 318,               // "GRANT"
+    PGS_INSERT = 319,              // "INSERT"
+    PGS_LISTEN = 320,              // "LISTEN"
+    PGS_LOAD = 321,                // "LOAD"
+    PGS_LOCK = 322,                // "LOCK"
+    PGS_MOVE = 323,                // "MOVE"
+    PGS_NOTIFY = 324,              // "NOTIFY"
+    PGS_PREPARE = 325,             // "PREPARE"
+    PGS_REASSIGN = 326,            // "REASSIGN"
+    PGS_REINDEX = 327,             // "REINDEX"
+    PGS_RELEASE = 328,             // "RELEASE"
+    PGS_RESET = 329,               // "RESET"
+    PGS_REVOKE = 330,              // "REVOKE"
+    PGS_ROLLBACK = 331,            // "ROLLBACK"
+    PGS_SAVEPOINT = 332,           // "SAVEPOINT"
+    PGS_SELECT = 333,              // "SELECT"
+    PGS_SET = 334,                 // "SET"
+    PGS_SHOW = 335,                // "SHOW"
+    PGS_START = 336,               // "START"
+    PGS_TRUNCATE = 337,            // "TRUNCATE"
+    PGS_UNLISTEN = 338,            // "UNLISTEN"
+    PGS_UPDATE = 339,              // "UPDATE"
+    PGS_VACUUM = 340,              // "VACUUM"
+    PGS_VALUES = 341,              // "VALUES"
+    PGS_IDENTIFIER = 342,          // "IDENTIFIER"
+    PGS_VAL_INT = 343,             // "INTEGER VALUE"
+    PGS_VAL_REAL = 344,            // "REAL VALUE"
+    PGS_VAL_STR = 345              // "STRING VALUE"
+      };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
+    };
+
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
+
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
+
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 106, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "END OF FILE"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_PGS_WHILE = 3,                         // "WHILE"
+        S_PGS_BREAK = 4,                         // "BREAK"
+        S_PGS_RETURN = 5,                        // "RETURN"
+        S_PGS_CONTINUE = 6,                      // "CONTINUE"
+        S_PGS_IF = 7,                            // "IF"
+        S_PGS_ELSE = 8,                          // "ELSE"
+        S_PGS_WAITFOR = 9,                       // "WAITFOR"
+        S_PGS_AS = 10,                           // "AS"
+        S_PGS_PARALLEL = 11,                     // "PARALLEL"
+        S_PGS_OPEN = 12,                         // "BEGIN (BLOCK)"
+        S_PGS_CLOSE = 13,                        // "END (BLOCK)"
+        S_PGS_ASSERT = 14,                       // "ASSERT"
+        S_PGS_PRINT = 15,                        // "PRINT"
+        S_PGS_LOG = 16,                          // "LOG"
+        S_PGS_CNT_COLUMNS = 17,                  // "COLUMNS"
+        S_PGS_CNT_LINES = 18,                    // "LINES"
+        S_PGS_TRIM = 19,                         // "TRIM"
+        S_PGS_RM_LINE = 20,                      // "RMLINE"
+        S_PGS_CAST = 21,                         // "CAST"
+        S_PGS_RECORD = 22,                       // "RECORD"
+        S_PGS_INTEGER = 23,                      // "INTEGER"
+        S_PGS_REAL = 24,                         // "REAL"
+        S_PGS_STRING = 25,                       // "STRING"
+        S_PGS_REGEX = 26,                        // "REGEX"
+        S_PGS_FILE = 27,                         // "FILE"
+        S_PGS_DATE = 28,                         // "DATE"
+        S_PGS_TIME = 29,                         // "TIME"
+        S_PGS_DATE_TIME = 30,                    // "DATETIME"
+        S_PGS_REFERENCE = 31,                    // "REFERENCE"
+        S_PGS_LE_OP = 32,                        // "<="
+        S_PGS_GE_OP = 33,                        // ">="
+        S_PGS_EQ_OP = 34,                        // "="
+        S_PGS_AE_OP = 35,                        // "~="
+        S_PGS_NE_OP = 36,                        // "<>"
+        S_PGS_AND_OP = 37,                       // "AND"
+        S_PGS_OR_OP = 38,                        // "OR"
+        S_PGS_NOT_OP = 39,                       // "NOT"
+        S_PGS_UNKNOWN = 40,                      // "character"
+        S_PGS_SET_ASSIGN = 41,                   // "SET @VARIABLE"
+        S_PGS_DECLARE_ASSGN = 42,                // "DECLARE @VARIABLE"
+        S_PGS_ABORT = 43,                        // "ABORT"
+        S_PGS_ALTER = 44,                        // "ALTER"
+        S_PGS_ANALYZE = 45,                      // "ANALYZE"
+        S_PGS_BEGIN = 46,                        // "BEGIN"
+        S_PGS_CHECKPOINT = 47,                   // "CHECKPOINT"
+        S_PGS_CLOSE_ST = 48,                     // "CLOSE"
+        S_PGS_CLUSTER = 49,                      // "CLUSTER"
+        S_PGS_COMMENT = 50,                      // "COMMENT"
+        S_PGS_COMMIT = 51,                       // "COMMIT"
+        S_PGS_COPY = 52,                         // "COPY"
+        S_PGS_CREATE = 53,                       // "CREATE"
+        S_PGS_DEALLOCATE = 54,                   // "DEALLOCATE"
+        S_PGS_DECLARE = 55,                      // "DECLARE"
+        S_PGS_DELETE = 56,                       // "DELETE"
+        S_PGS_DISCARD = 57,                      // "DISCARD"
+        S_PGS_DROP = 58,                         // "DROP"
+        S_PGS_END_ST = 59,                       // "END"
+        S_PGS_EXECUTE = 60,                      // "EXECUTE"
+        S_PGS_EXPLAIN = 61,                      // "EXPLAIN"
+        S_PGS_FETCH = 62,                        // "FETCH"
+        S_PGS_GRANT = 63,                        // "GRANT"
+        S_PGS_INSERT = 64,                       // "INSERT"
+        S_PGS_LISTEN = 65,                       // "LISTEN"
+        S_PGS_LOAD = 66,                         // "LOAD"
+        S_PGS_LOCK = 67,                         // "LOCK"
+        S_PGS_MOVE = 68,                         // "MOVE"
+        S_PGS_NOTIFY = 69,                       // "NOTIFY"
+        S_PGS_PREPARE = 70,                      // "PREPARE"
+        S_PGS_REASSIGN = 71,                     // "REASSIGN"
+        S_PGS_REINDEX = 72,                      // "REINDEX"
+        S_PGS_RELEASE = 73,                      // "RELEASE"
+        S_PGS_RESET = 74,                        // "RESET"
+        S_PGS_REVOKE = 75,                       // "REVOKE"
+        S_PGS_ROLLBACK = 76,                     // "ROLLBACK"
+        S_PGS_SAVEPOINT = 77,                    // "SAVEPOINT"
+        S_PGS_SELECT = 78,                       // "SELECT"
+        S_PGS_SET = 79,                          // "SET"
+        S_PGS_SHOW = 80,                         // "SHOW"
+        S_PGS_START = 81,                        // "START"
+        S_PGS_TRUNCATE = 82,                     // "TRUNCATE"
+        S_PGS_UNLISTEN = 83,                     // "UNLISTEN"
+        S_PGS_UPDATE = 84,                       // "UPDATE"
+        S_PGS_VACUUM = 85,                       // "VACUUM"
+        S_PGS_VALUES = 86,                       // "VALUES"
+        S_PGS_IDENTIFIER = 87,                   // "IDENTIFIER"
+        S_PGS_VAL_INT = 88,                      // "INTEGER VALUE"
+        S_PGS_VAL_REAL = 89,                     // "REAL VALUE"
+        S_PGS_VAL_STR = 90,                      // "STRING VALUE"
+        S_91_ = 91,                              // '['
+        S_92_ = 92,                              // ']'
+        S_93_ = 93,                              // '('
+        S_94_ = 94,                              // ')'
+        S_95_ = 95,                              // '+'
+        S_96_ = 96,                              // '-'
+        S_97_ = 97,                              // '*'
+        S_98_ = 98,                              // '/'
+        S_99_ = 99,                              // '%'
+        S_100_ = 100,                            // '<'
+        S_101_ = 101,                            // '>'
+        S_102_ = 102,                            // ','
+        S_103_ = 103,                            // ';'
+        S_104_ = 104,                            // '{'
+        S_105_ = 105,                            // '}'
+        S_YYACCEPT = 106,                        // $accept
+        S_postfix_expression = 107,              // postfix_expression
+        S_unary_expression = 108,                // unary_expression
+        S_cast_expression = 109,                 // cast_expression
+        S_type_name = 110,                       // type_name
+        S_multiplicative_expression = 111,       // multiplicative_expression
+        S_additive_expression = 112,             // additive_expression
+        S_relational_expression = 113,           // relational_expression
+        S_equality_expression = 114,             // equality_expression
+        S_logical_and_expression = 115,          // logical_and_expression
+        S_logical_or_expression = 116,           // logical_or_expression
+        S_expression = 117,                      // expression
+        S_random_generator = 118,                // random_generator
+        S_statement = 119,                       // statement
+        S_statement_list = 120,                  // statement_list
+        S_compound_statement = 121,              // compound_statement
+        S_sql_statement = 122,                   // sql_statement
+        S_sql_expression = 123,                  // sql_expression
+        S_sql_query = 124,                       // sql_query
+        S_declaration_statement = 125,           // declaration_statement
+        S_declaration_list = 126,                // declaration_list
+        S_declaration_element = 127,             // declaration_element
+        S_assign_statement = 128,                // assign_statement
+        S_assign_list = 129,                     // assign_list
+        S_assign_element = 130,                  // assign_element
+        S_selection_statement = 131,             // selection_statement
+        S_iteration_statement = 132,             // iteration_statement
+        S_parallel_statement = 133,              // parallel_statement
+        S_jump_statement = 134,                  // jump_statement
+        S_procedure_statement = 135,             // procedure_statement
+        S_record_declaration_list = 136,         // record_declaration_list
+        S_translation_unit = 137                 // translation_unit
+      };
+    };
+
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
+
+    /// A complete symbol.
+    ///
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
+    ///
+    /// Provide access to semantic value and location.
+    template <typename Base>
+    struct basic_symbol : Base
+    {
+      /// Alias to Base.
+      typedef Base super_type;
+
+      /// Default constructor.
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value (std::move (that.value))
+        , location (std::move (that.location))
+      {}
+#endif
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+      /// Constructor for valueless symbols.
+      basic_symbol (typename Base::kind_type t,
+                    YY_MOVE_REF (location_type) l);
+
+      /// Constructor for symbols with semantic value.
+      basic_symbol (typename Base::kind_type t,
+                    YY_RVREF (value_type) v,
+                    YY_RVREF (location_type) l);
+
+      /// Destroy the symbol.
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
+
+      /// Destroy contents, and record that is empty.
+      void clear () YY_NOEXCEPT
+      {
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return pgsParser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// Whether empty.
+      bool empty () const YY_NOEXCEPT;
+
+      /// Destructive move, \a s is emptied into this.
+      void move (basic_symbol& s);
+
+      /// The semantic value.
+      value_type value;
+
+      /// The location.
+      location_type location;
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment operator.
+      basic_symbol& operator= (const basic_symbol& that);
+#endif
+    };
+
+    /// Type access provider for token (enum) based symbols.
+    struct by_kind
+    {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
+      /// Default constructor.
+      by_kind () YY_NOEXCEPT;
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
+
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
+
+      /// Constructor from (external) token numbers.
+      by_kind (kind_type t) YY_NOEXCEPT;
 
+
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
+
+      /// The (internal) type number (corresponding to \a type).
+      /// \a empty when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
+
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
-    /// Token type.
-    typedef token::yytokentype token_type;
+
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
+    /// "External" symbols: returned by the scanner.
+    struct symbol_type : basic_symbol<by_kind>
+    {};
 
     /// Build a parser object.
     pgsParser (class pgsDriver & driver_yyarg);
     virtual ~pgsParser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    pgsParser (const pgsParser&) = delete;
+    /// Non copyable.
+    pgsParser& operator= (const pgsParser&) = delete;
+#endif
+
+    /// Parse.  An alias for parse ().
+    /// \returns  0 iff parsing succeeded.
+    int operator() ();
+
     /// Parse.
     /// \returns  0 iff parsing succeeded.
     virtual int parse ();
 
+#if YYDEBUG
     /// The current debugging stream.
-    std::ostream& debug_stream () const;
+    std::ostream& debug_stream () const YY_ATTRIBUTE_PURE;
     /// Set the current debugging stream.
     void set_debug_stream (std::ostream &);
 
     /// Type for debugging levels.
     typedef int debug_level_type;
     /// The current debugging level.
-    debug_level_type debug_level () const;
+    debug_level_type debug_level () const YY_ATTRIBUTE_PURE;
     /// Set the current debugging level.
     void set_debug_level (debug_level_type l);
+#endif
 
-  private:
     /// Report a syntax error.
     /// \param loc    where the syntax error is found.
     /// \param msg    a description of the syntax error.
     virtual void error (const location_type& loc, const std::string& msg);
 
+    /// Report a syntax error.
+    void error (const syntax_error& err);
+
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+
+
+    class context
+    {
+    public:
+      context (const pgsParser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const pgsParser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    pgsParser (const pgsParser&);
+    /// Non copyable.
+    pgsParser& operator= (const pgsParser&);
+#endif
+
+
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
+
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
     /// Generate an error message.
-    /// \param state   the state where the error occurred.
-    /// \param tok     the look-ahead token.
-    virtual std::string yysyntax_error_ (int yystate, int tok);
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
+
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
-#if YYDEBUG
-    /// \brief Report a symbol value on the debug stream.
-    /// \param yytype       The token type.
-    /// \param yyvaluep     Its semantic value.
-    /// \param yylocationp  Its location.
-    virtual void yy_symbol_value_print_ (int yytype,
-					 const semantic_type* yyvaluep,
-					 const location_type* yylocationp);
-    /// \brief Report a symbol on the debug stream.
-    /// \param yytype       The token type.
-    /// \param yyvaluep     Its semantic value.
-    /// \param yylocationp  Its location.
-    virtual void yy_symbol_print_ (int yytype,
-				   const semantic_type* yyvaluep,
-				   const location_type* yylocationp);
-#endif /* ! YYDEBUG */
-
-
-    /// State numbers.
-    typedef int state_type;
-    /// State stack type.
-    typedef stack<state_type>    state_stack_type;
-    /// Semantic value stack type.
-    typedef stack<semantic_type> semantic_stack_type;
-    /// location stack type.
-    typedef stack<location_type> location_stack_type;
-
-    /// The state stack.
-    state_stack_type yystate_stack_;
-    /// The semantic value stack.
-    semantic_stack_type yysemantic_stack_;
-    /// The location stack.
-    location_stack_type yylocation_stack_;
-
-    /// Internal symbol numbers.
-    typedef unsigned char token_number_type;
-    /* Tables.  */
-    /// For a state, the index in \a yytable_ of its portion.
-    static const short int yypact_[];
     static const signed char yypact_ninf_;
+    static const signed char yytable_ninf_;
+
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    /// For a state, default rule to reduce.
-    /// Unless\a  yytable_ specifies something else to do.
-    /// Zero means the default is an error.
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
+
+
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
+
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
     static const unsigned char yydefact_[];
 
-    static const short int yypgoto_[];
-    static const short int yydefgoto_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-    /// What to do in a state.
-    /// \a yytable_[yypact_[s]]: what to do in state \a s.
-    /// - if positive, shift that token.
-    /// - if negative, reduce the rule which number is the opposite.
-    /// - if zero, do what YYDEFACT says.
-    static const unsigned short int yytable_[];
-    static const signed char yytable_ninf_;
+    // YYDEFGOTO[NTERM-NUM].
+    static const unsigned char yydefgoto_[];
+
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-    static const short int yycheck_[];
+    static const short yycheck_[];
 
-    /// For a state, its accessing symbol.
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
     static const unsigned char yystos_[];
 
-    /// For a rule, its LHS.
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
     static const unsigned char yyr1_[];
-    /// For a rule, its RHS length.
-    static const unsigned char yyr2_[];
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
-#endif
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
-#if YYERROR_VERBOSE
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    virtual std::string yytnamerr_ (const char *n);
-#endif
 
 #if YYDEBUG
-    /// A type to store symbol numbers and -1.
-    typedef short int rhs_number_type;
-    /// A `-1'-separated list of the rules' RHS.
-    static const rhs_number_type yyrhs_[];
-    /// For each rule, the index of the first RHS symbol in \a yyrhs_.
-    static const unsigned short int yyprhs_[];
-    /// For each rule, its source line number.
-    static const unsigned short int yyrline_[];
-    /// For each scanner token number, its symbol number.
-    static const unsigned short int yytoken_number_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
-#endif
+    virtual void yy_stack_print_ () const;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    token_number_type yytranslate_ (int t);
-
-    /// \brief Reclaim the memory associated to a symbol.
-    /// \param yymsg        Why this token is reclaimed.
-    /// \param yytype       The symbol type.
-    /// \param yyvaluep     Its semantic value.
-    /// \param yylocationp  Its location.
-    inline void yydestruct_ (const char* yymsg,
-			     int yytype,
-			     semantic_type* yyvaluep,
-			     location_type* yylocationp);
-
-    /// Pop \a n symbols the three stacks.
-    inline void yypop_ (unsigned int n = 1);
-
-    /* Constants.  */
-    static const int yyeof_;
-    /* LAST_ -- Last index in TABLE_.  */
-    static const int yylast_;
-    static const int yynnts_;
-    static const int yyempty_;
-    static const int yyfinal_;
-    static const int yyterror_;
-    static const int yyerrcode_;
-    static const int yyntokens_;
-    static const unsigned int yyuser_token_number_max_;
-    static const token_number_type yyundef_token_;
-
-    /* Debugging.  */
+    /// Debugging level.
     int yydebug_;
+    /// Debug stream.
     std::ostream* yycdebug_;
 
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
+
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
+
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
+
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
 
-    /* User arguments.  */
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
+
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
+
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
+
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
+
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
+
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
+
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
+
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
+
+
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
+
+    /// The stack.
+    stack_type yystack_;
+
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
+
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
+
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
+
+    /// Constants.
+    enum
+    {
+      yylast_ = 793,     ///< Last index in yytable_.
+      yynnts_ = 32,  ///< Number of nonterminal symbols.
+      yyfinal_ = 124 ///< Termination state number.
+    };
+
+
+    // User arguments.
     class pgsDriver & driver;
+
   };
-}
 
 
-#endif /* ! defined PARSER_HEADER_H */
+#line 37 "pgscript/pgsParser.yy"
+} // pgscript
+#line 1015 "pgscript/parser.tab.hh"
+
+
+
+
+#endif // !YY_YY_PGSCRIPT_PARSER_TAB_HH_INCLUDED
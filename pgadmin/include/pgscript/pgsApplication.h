@@ -50,6 +50,9 @@ private:
 	/** Location of the last error if there was one. */
 	int m_last_error_line;
 
+	/** Set by Terminate(): m_thread checks it before each statement. */
+	volatile bool m_terminating;
+
 public:
 
 	/** Creates an application and creates a connection. */
@@ -79,6 +82,9 @@ public:
 	/** If m_thread is running then delete it. */
 	void Terminate();
 
+	/** Has Terminate() been called since m_thread was started? */
+	bool IsTerminating() const;
+
 	/** Called by m_thread when the thread is finished: IsRunning() becomes
 	 * false and m_event_id is pushed into the event queue if m_caller exists. */
 	void Complete();
@@ -16,6 +16,7 @@ pgadmin3_SOURCES += \
 	include/pgscript/statements/pgsDeclareRecordStmt.h \
 	include/pgscript/statements/pgsExpressionStmt.h \
 	include/pgscript/statements/pgsIfStmt.h \
+	include/pgscript/statements/pgsParallelStmt.h \
 	include/pgscript/statements/pgsPrintStmt.h \
 	include/pgscript/statements/pgsProgram.h \
 	include/pgscript/statements/pgsStatements.h \
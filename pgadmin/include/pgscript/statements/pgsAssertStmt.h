@@ -29,6 +29,8 @@ public:
 
 	virtual void eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 private:
 
 	pgsAssertStmt(const pgsAssertStmt &that);
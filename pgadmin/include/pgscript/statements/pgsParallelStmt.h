@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PGSPARALLELSTMT_H_
+#define PGSPARALLELSTMT_H_
+
+#include "pgscript/pgScript.h"
+#include "pgscript/statements/pgsStmt.h"
+
+/**
+ * PARALLEL n statement: runs the statement n times at once, each time in a
+ * pgsWorker with its own connection duplicated from the script's one and its
+ * own copy of the variables, where @WORKER (from 0) and @WORKERS tell the
+ * workers apart. The output of the workers is written in worker order once
+ * they are all done.
+ */
+class pgsParallelStmt : public pgsStmt
+{
+
+private:
+
+	const pgsExpression *m_workers;
+	const pgsStmt *m_stmt;
+
+	pgsOutputStream &m_cout;
+
+public:
+
+	pgsParallelStmt(const pgsExpression *workers, const pgsStmt *stmt,
+	                pgsOutputStream &cout, pgsThread *app = 0);
+
+	virtual ~pgsParallelStmt();
+
+	virtual void eval(pgsVarMap &vars) const;
+
+	virtual void resolve(pgsVarMap &vars) const;
+
+private:
+
+	pgsParallelStmt(const pgsParallelStmt &that);
+
+	pgsParallelStmt &operator=(const pgsParallelStmt &that);
+
+};
+
+#endif /*PGSPARALLELSTMT_H_*/
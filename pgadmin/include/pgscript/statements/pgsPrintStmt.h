@@ -32,6 +32,8 @@ public:
 
 	virtual void eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 private:
 
 	pgsPrintStmt(const pgsPrintStmt &that);
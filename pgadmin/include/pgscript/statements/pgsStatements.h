@@ -17,6 +17,7 @@
 #include "pgsDeclareRecordStmt.h"
 #include "pgsExpressionStmt.h"
 #include "pgsIfStmt.h"
+#include "pgsParallelStmt.h"
 #include "pgsPrintStmt.h"
 #include "pgsProgram.h"
 #include "pgsStmt.h"
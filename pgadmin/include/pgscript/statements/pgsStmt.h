@@ -39,6 +39,10 @@ public:
 
 	virtual void eval(pgsVarMap &vars) const = 0;
 
+	/** Gives the identifiers of the statement their slot in vars, once
+	 * before the program runs. Does nothing by default. */
+	virtual void resolve(pgsVarMap &vars) const;
+
 private:
 
 	pgsStmt(const pgsStmt &that);
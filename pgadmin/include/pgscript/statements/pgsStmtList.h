@@ -37,6 +37,8 @@ public:
 
 	virtual void eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 	void insert_front(pgsStmt *stmt);
 
 	void insert_back(pgsStmt *stmt);
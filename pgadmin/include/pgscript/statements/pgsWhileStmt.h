@@ -31,6 +31,8 @@ public:
 
 	virtual void eval(pgsVarMap &vars) const;
 
+	virtual void resolve(pgsVarMap &vars) const;
+
 private:
 
 	pgsWhileStmt(const pgsWhileStmt &that);
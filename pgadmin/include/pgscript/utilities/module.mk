@@ -18,7 +18,8 @@ pgadmin3_SOURCES += \
 	include/pgscript/utilities/pgsScanner.h \
 	include/pgscript/utilities/pgsSharedPtr.h \
 	include/pgscript/utilities/pgsThread.h \
-	include/pgscript/utilities/pgsUtilities.h
+	include/pgscript/utilities/pgsUtilities.h \
+	include/pgscript/utilities/pgsWorker.h
 
 EXTRA_DIST += \
 	include/pgscript/utilities/module.mk
@@ -59,8 +59,9 @@ public:
 	/** Generates a pgsNumber with value '0' and put it on stack. */
 	pgsVariable *one();
 
-	/** Generates a pgsNumber with value now() and put it on stack. */
-	pgsVariable *seed();
+	/** Generates the default seed of the generators (see pgsSeed) and put it
+	 * on stack. */
+	pgsExpression *seed();
 
 	/** Generates a pgsString with the locale encoding and put it on stack. */
 	pgsVariable *encoding();
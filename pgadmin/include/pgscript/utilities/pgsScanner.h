@@ -12,13 +12,14 @@
 #define PGSSCANNER_H_
 
 // Flex expects the signature of yylex to be defined in the macro YY_DECL, and
-// the C++ parser expects it to be declared. We can factor both as follows.
+// the C++ parser expects it to be declared. We can factor both as follows. The
+// parser calls lex(), which reads the tokens generated by flex through scan().
 
 #ifndef YY_DECL
 
 #define	YY_DECL						\
 	pgscript::pgsParser::token_type				\
-	pgscript::pgsScanner::lex(				\
+	pgscript::pgsScanner::scan(				\
 	pgscript::pgsParser::semantic_type* yylval,		\
 	pgscript::pgsParser::location_type* yylloc		\
 	)
@@ -31,6 +32,7 @@
 #endif
 
 #include "pgscript/parser.tab.hh"
+#include <deque>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -55,12 +57,17 @@ public:
 	/** Required for virtual functions */
 	virtual ~pgsScanner();
 
-	/** This is the main lexing function. It is generated by flex according to
-	 * the macro declaration YY_DECL above. The generated bison parser then
-	 * calls this virtual function to fetch new tokens. */
+	/** The generated bison parser calls this virtual function to fetch new
+	 * tokens. It returns the tokens of scan() except for the keywords that
+	 * flex reads as one PGS_UNKNOWN token per letter (PARALLEL). */
 	virtual pgsParser::token_type lex(pgsParser::semantic_type *yylval,
 	                                  pgsParser::location_type *yylloc);
 
+	/** This is the main lexing function. It is generated by flex according to
+	 * the macro declaration YY_DECL above. */
+	pgsParser::token_type scan(pgsParser::semantic_type *yylval,
+	                           pgsParser::location_type *yylloc);
+
 	/** Enable debug output (via arg_yyout) if compiled into the scanner. */
 	void set_debug(bool b);
 
@@ -69,6 +76,21 @@ private:
 	/** Corrects column count because of multi-byte UTF8 characters. */
 	int columns(const char &c);
 
+	/** Is t, the token scanned last, a letter that no rule matched? */
+	bool letter(const pgsParser::token_type &t);
+
+	/** Token read by scan(). */
+	struct pgsToken
+	{
+		pgsParser::token_type token;
+		pgsParser::semantic_type value;
+		pgsParser::location_type location;
+	};
+
+	/** Tokens read by lex() after a word which is not a keyword, returned
+	 * before scanning again. */
+	std::deque<pgsToken> m_pending;
+
 	/** To count parenthesis. */
 	int m_parent;
 
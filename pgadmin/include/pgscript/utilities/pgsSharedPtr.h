@@ -94,6 +94,20 @@ public:
 	{
 		return p->q;
 	}
+
+	/**
+	 * Makes this pointer own a copy of the object if it is shared with other
+	 * pointers, so that it can be modified alone. T needs a clone() method.
+	 */
+	void detach()
+	{
+		if (p->c > 1 && p->q != 0)
+		{
+			count *copy = pnew count(p->q->clone());
+			--p->c;
+			p = copy;
+		}
+	}
 };
 
 #endif /*PGSSHAREDPTR_H_*/
@@ -19,6 +19,7 @@
 class pgConn;
 class pgsApplication;
 class pgsStmtList;
+class pgsWorker;
 
 class pgsThread : public wxThread
 {
@@ -49,6 +50,15 @@ private:
 	/** Location of the last error if there was one otherwise -1 */
 	int m_last_error_line;
 
+	/** Only one thread of the script runs the interpreter at once: values
+	 * are not thread-safe (MAPM, reference counts). Threads release it
+	 * while they wait for the server, which is where PARALLEL blocks gain. */
+	wxMutex m_interpreter;
+
+	/** Workers of the PARALLEL blocks running. */
+	wxArrayPtrVoid m_workers;
+	wxCriticalSection m_workers_cs;
+
 public:
 
 	/** Parses a file with the provided encoding. */
@@ -66,21 +76,52 @@ public:
 	/** Thread main code. */
 	virtual void *Entry();
 
-	/** Retrieves the connection to the database. */
+	/** Should the thread stop? Also true once the application has been asked
+	 * to terminate, even if Delete() has not been reached yet. In a worker,
+	 * only the latter is tested. */
+	virtual bool TestDestroy();
+
+	/** Retrieves the connection to the database, the one of the worker when
+	 * called from a worker. */
 	pgConn *connection();
 
+	/** Where to write between LockOutput() and UnlockOutput(): out, or the
+	 * output of the worker when called from a worker. */
+	pgsOutputStream &output(pgsOutputStream &out);
+
 	/** Gets a lock on the output stream. */
 	void LockOutput();
 
 	/** Releases the lock on the output stream. */
 	void UnlockOutput();
 
+	/** Gets the lock on the interpreter. */
+	void LockInterpreter();
+
+	/** Releases the lock on the interpreter. */
+	void UnlockInterpreter();
+
+	/** Runs a worker, and makes connection() and output() return its own
+	 * ones in its thread. */
+	bool RunWorker(pgsWorker *worker);
+
+	/** Waits for a worker to finish. */
+	void WaitWorker(pgsWorker *worker);
+
+	/** Cancels the queries the workers are running. */
+	void CancelWorkers();
+
 	/** Set the position (line) of the last error. */
 	void last_error_line(int line);
 
 	/** Get the position (line) of the last error. */
 	int last_error_line() const;
 
+private:
+
+	/** Worker of the calling thread, or 0. */
+	pgsWorker *worker();
+
 private:
 
 	pgsThread(const pgsThread &that);
@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#ifndef PGSWORKER_H_
+#define PGSWORKER_H_
+
+#include "pgscript/pgScript.h"
+#include "pgscript/objects/pgsVariable.h"
+
+#include <wx/sstream.h>
+#include <wx/thread.h>
+
+class pgConn;
+class pgsStmt;
+class pgsThread;
+
+/**
+ * Thread running the statement of a PARALLEL block once. A worker has its own
+ * connection, its own copy of the variables and its own output, which the
+ * block writes once all its workers are done. Only one thread of a script
+ * runs the interpreter at once (see pgsThread::LockInterpreter()).
+ */
+class pgsWorker : public wxThread
+{
+
+private:
+
+	/** Thread running the script. */
+	pgsThread &m_app;
+
+	/** Statement to run. */
+	const pgsStmt *m_stmt;
+
+	/** Variables of the block, with @WORKER and @WORKERS set. */
+	pgsVarMap m_vars;
+
+	/** Connection duplicated for the worker, deleted with it. */
+	pgConn *m_connection;
+
+	/** Output written after the output of the workers before this one. */
+	wxString m_output;
+	wxStringOutputStream m_output_stream;
+	pgsOutputStream m_out;
+
+	/** Did the statement stop on an error? */
+	bool m_failed;
+
+public:
+
+	/** Runs stmt with a copy of vars on connection, which must be open. */
+	pgsWorker(pgsThread &app, const pgsStmt *stmt, const pgsVarMap &vars,
+	          pgConn *connection, const int &worker, const int &nb_workers);
+
+	/** Deletes the connection. */
+	~pgsWorker();
+
+	/** Thread main code. */
+	virtual void *Entry();
+
+	/** Retrieves the connection to the database. */
+	pgConn *connection();
+
+	/** Where the worker writes its output. */
+	pgsOutputStream &out();
+
+	/** Output written by the worker. */
+	const wxString &output() const;
+
+	/** Did the statement stop on an error? */
+	bool failed() const;
+
+private:
+
+	pgsWorker(const pgsWorker &that);
+
+	pgsWorker &operator=(const pgsWorker &that);
+
+};
+
+#endif /*PGSWORKER_H_*/
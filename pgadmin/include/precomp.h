@@ -34,6 +34,7 @@
 #include "ctl/ctlSQLResult.h"
 #include "ctl/ctlTree.h"
 #include "ctl/explainCanvas.h"
+#include "ctl/explainPlan.h"
 #include "ctl/timespin.h"
 #include "ctl/wxgridsel.h"
 #include "ctl/xh_calb.h"
@@ -17,6 +17,7 @@ pgadmin3_SOURCES += \
 	include/schema/edbPrivateSynonym.h \
 	include/schema/pgAggregate.h \
 	include/schema/pgCatalogObject.h \
+	include/schema/pgCatalogSnapshot.h \
 	include/schema/pgCast.h \
 	include/schema/pgCheck.h \
 	include/schema/pgCollation.h \
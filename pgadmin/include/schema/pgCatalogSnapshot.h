@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgCatalogSnapshot.h - Catalog rows read for many relations at once
+//
+//////////////////////////////////////////////////////////////////////////
+
+#ifndef PGCATALOGSNAPSHOT_H
+#define PGCATALOGSNAPSHOT_H
+
+#include <wx/wx.h>
+#include <wx/hashmap.h>
+
+class ctlTree;
+class pgCollection;
+class pgSet;
+class pgCatalogSnapshotBatch;
+
+// Stands for the list of owner oids in the queries of pgCatalogSnapshot,
+// e.g. "WHERE indrelid IN " SNAPSHOT_RELATIONS for the indexes of tables,
+// or "WHERE relnamespace IN " SNAPSHOT_RELATIONS for the tables of schemas
+#define SNAPSHOT_RELATIONS  wxT("%RELATIONS%")
+
+// Rows older than this (in seconds) are read again, for changes made
+// outside of pgAdmin
+#define SNAPSHOT_MAX_AGE    60
+
+WX_DECLARE_STRING_HASH_MAP(pgCatalogSnapshotBatch *, pgCatalogSnapshotHash);
+
+
+// The collections below a schema (tables, views, functions...) or below a
+// table or view (columns, indexes, triggers...) each need one query per
+// owner. When one of them is expanded, the query is run for the next
+// GetCatalogSnapshotSize() owners of the same kind in the tree too, and
+// their rows kept in the snapshot of the database. Expanding the same
+// collection of the next schema or relation then takes its rows from
+// memory.
+// Each owner's rows are handed out once only, so refreshing an object
+// reads the catalog again. The database drops the whole snapshot when
+// an object is refreshed or pgAdmin changes the schema.
+class pgCatalogSnapshot
+{
+public:
+	pgCatalogSnapshot() {}
+	~pgCatalogSnapshot();
+
+	// Runs sql, with SNAPSHOT_RELATIONS in it, for the schema or relation
+	// collection belongs to, or returns its rows if they were read
+	// already. relColumn is the column of the result with the oid of the
+	// owner. As the rows belong to the snapshot, the set returned must be
+	// deleted before the next call with the same sql.
+	static pgSet *ExecuteSet(pgCollection *collection, ctlTree *browser, const wxString &sql, const wxString &relColumn);
+
+	// Forgets all rows read so far
+	void Invalidate();
+
+private:
+	pgCatalogSnapshotBatch *Load(pgCollection *collection, ctlTree *browser, const wxString &sql, const wxString &relColumn);
+
+	pgCatalogSnapshotHash batches;
+};
+
+#endif
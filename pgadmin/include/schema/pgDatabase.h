@@ -13,6 +13,7 @@
 #define PGDATABASE_H
 
 #include "pgServer.h"
+#include "pgCatalogSnapshot.h"
 
 class pgDatabaseFactory : public pgServerObjFactory
 {
@@ -243,6 +244,17 @@ public:
 	{
 		schemaChanges = wxEmptyString;
 	}
+	pgCatalogSnapshot *GetCatalogSnapshot()
+	{
+		if (!catalogSnapshot)
+			catalogSnapshot = new pgCatalogSnapshot();
+		return catalogSnapshot;
+	}
+	void InvalidateCatalogSnapshot()
+	{
+		if (catalogSnapshot)
+			catalogSnapshot->Invalidate();
+	}
 
 	wxMenu *GetNewMenu();
 	wxString GetSql(ctlTree *browser);
@@ -277,6 +289,7 @@ private:
 
 	wxString schemaChanges;
 	wxString schemaRestriction;
+	pgCatalogSnapshot *catalogSnapshot;
 	wxString m_defPrivsOnTables, m_defPrivsOnSeqs, m_defPrivsOnFuncs, m_defPrivsOnTypes;
 
 	int canDebugPlpgsql, canDebugEdbspl;
@@ -13,6 +13,7 @@
 #define PGSERVER_H
 
 #include "db/pgConn.h"
+#include "db/pgConnector.h"
 #include "pgCollection.h"
 
 class frmMain;
@@ -61,6 +62,8 @@ public:
 	wxString GetTranslatedMessage(int kindOfMessage) const;
 	int Connect(frmMain *form, bool askPassword = true, const wxString &pwd = wxEmptyString, bool forceStorePassword = false, bool askTunnelPassword = false);
 	bool Disconnect(frmMain *form);
+	pgConnectRequest *CreateConnectRequest();
+	void SetConnection(pgConn *newConn, const wxString &newDatabase);
 	void StorePassword();
 	bool GetPasswordIsStored();
 	void InvalidatePassword()
@@ -573,6 +576,35 @@ private:
 
 
 // collection of pgServer
+// Opens the connection of a server in the background, with the stored
+// password if any
+class pgServerConnectRequest : public pgConnectRequest
+{
+public:
+	pgServerConnectRequest(pgServer *server);
+
+	pgServer *GetServer() const
+	{
+		return server;
+	}
+	const wxString &GetDatabase() const
+	{
+		return database;
+	}
+
+protected:
+	virtual pgConn *Open();
+
+private:
+	pgServer *server;
+	wxString host, service, hostaddr, database, username, rolename, applicationname;
+	wxString sslcert, sslkey, sslrootcert, sslcrl;
+	int port, ssl;
+	bool sslcompression;
+	long connectTimeout;
+};
+
+
 class pgServerCollection : public pgCollection
 {
 public:
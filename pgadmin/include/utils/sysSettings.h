@@ -290,6 +290,16 @@ public:
 	{
 		WriteBool(wxT("frmQuery/ExplainTiming"), newval);
 	}
+	bool GetExplainJson() const
+	{
+		bool b;
+		Read(wxT("frmQuery/ExplainJson"), &b, false);
+		return b;
+	}
+	void SetExplainJson(const bool newval)
+	{
+		WriteBool(wxT("frmQuery/ExplainJson"), newval);
+	}
 
 	// Display options
 	wxString GetSystemSchemas() const
@@ -384,6 +394,36 @@ public:
 	{
 		WriteBool(wxT("frmQuery/AutoCommit"), newval);
 	}
+	bool GetStreamResults() const
+	{
+		bool b;
+		Read(wxT("frmQuery/StreamResults"), &b, false);
+		return b;
+	}
+	void SetStreamResults(const bool newval)
+	{
+		WriteBool(wxT("frmQuery/StreamResults"), newval);
+	}
+	long GetStreamChunkRows() const
+	{
+		long l;
+		Read(wxT("frmQuery/StreamChunkRows"), &l, 10000L);
+		return l;
+	}
+	void SetStreamChunkRows(const long newval)
+	{
+		WriteLong(wxT("frmQuery/StreamChunkRows"), newval);
+	}
+	long GetStreamMaxRows() const
+	{
+		long l;
+		Read(wxT("frmQuery/StreamMaxRows"), &l, 1000000L);
+		return l;
+	}
+	void SetStreamMaxRows(const long newval)
+	{
+		WriteLong(wxT("frmQuery/StreamMaxRows"), newval);
+	}
 	wxString GetDecimalMark() const
 	{
 		wxString s;
@@ -748,6 +788,67 @@ public:
 		WriteBool(wxT("ShowNotices"), newval);
 	}
 
+	bool GetReconnectServers() const
+	{
+		bool b;
+		Read(wxT("ReconnectServers"), &b, false);
+		return b;
+	}
+	void SetReconnectServers(const bool newval)
+	{
+		WriteBool(wxT("ReconnectServers"), newval);
+	}
+	long GetConnectThreads() const
+	{
+		long l;
+		Read(wxT("ConnectThreads"), &l, 4L);
+		return l;
+	}
+	void SetConnectThreads(const long newval)
+	{
+		WriteLong(wxT("ConnectThreads"), newval);
+	}
+	long GetConnectTimeout() const
+	{
+		long l;
+		Read(wxT("ConnectTimeout"), &l, 30L);
+		return l;
+	}
+	void SetConnectTimeout(const long newval)
+	{
+		WriteLong(wxT("ConnectTimeout"), newval);
+	}
+	long GetConnectionPoolSize() const
+	{
+		long l;
+		Read(wxT("ConnectionPoolSize"), &l, 2L);
+		return l;
+	}
+	void SetConnectionPoolSize(const long newval)
+	{
+		WriteLong(wxT("ConnectionPoolSize"), newval);
+	}
+	long GetConnectionPoolIdleTime() const
+	{
+		long l;
+		Read(wxT("ConnectionPoolIdleTime"), &l, 60L);
+		return l;
+	}
+	void SetConnectionPoolIdleTime(const long newval)
+	{
+		WriteLong(wxT("ConnectionPoolIdleTime"), newval);
+	}
+	long GetCatalogSnapshotSize() const
+	{
+		long l;
+		Read(wxT("CatalogSnapshotSize"), &l, 100L);
+		return l;
+	}
+	void SetCatalogSnapshotSize(const long newval)
+	{
+		WriteLong(wxT("CatalogSnapshotSize"), newval);
+	}
+
 	wxString GetOptionsLastTreeItem() const
 	{
 		wxString s;
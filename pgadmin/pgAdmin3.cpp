@@ -62,6 +62,7 @@
 #include "frm/frmSplash.h"
 #include "dlg/dlgSelectConnection.h"
 #include "db/pgConn.h"
+#include "db/pgConnPool.h"
 #include "utils/sysLogger.h"
 #include "utils/registry.h"
 #include "frm/frmHint.h"
@@ -838,6 +839,9 @@ int pgAdmin3::OnExit()
 		delete updateThread;
 	}
 
+	// Close the pooled connections; nothing is pooled from now on.
+	pgConnPool::Clear();
+
 	// Delete the settings object to ensure settings are saved.
 	delete settings;
 
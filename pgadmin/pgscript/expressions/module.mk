@@ -45,6 +45,7 @@ pgadmin3_SOURCES += \
 	pgscript/expressions/pgsParenthesis.cpp \
 	pgscript/expressions/pgsPlus.cpp \
 	pgscript/expressions/pgsRemoveLine.cpp \
+	pgscript/expressions/pgsSeed.cpp \
 	pgscript/expressions/pgsTimes.cpp \
 	pgscript/expressions/pgsTrim.cpp
 
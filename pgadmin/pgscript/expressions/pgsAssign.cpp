@@ -57,3 +57,8 @@ pgsOperand pgsAssign::eval(pgsVarMap &vars) const
 	vars[m_name] = m_var->eval(vars);
 	return vars[m_name];
 }
+
+void pgsAssign::resolve(pgsVarMap &vars) const
+{
+	m_var->resolve(vars);
+}
@@ -64,9 +64,6 @@ pgsOperand pgsAssignToRecord::eval(pgsVarMap &vars) const
 {
 	if (vars.find(m_name) != vars.end() && vars[m_name]->is_record())
 	{
-		// Get the operand as a record
-		pgsRecord &rec = dynamic_cast<pgsRecord &>(*vars[m_name]);
-
 		// Get the value to assign
 		pgsOperand var(m_var->eval(vars));
 
@@ -75,10 +72,21 @@ pgsOperand pgsAssignToRecord::eval(pgsVarMap &vars) const
 			// Evaluate parameters
 			pgsOperand line(m_line->eval(vars));
 			pgsOperand column(m_column->eval(vars));
-			if (line->is_integer())
+
+			// Get the operand as a record, copied if other variables share it
+			vars[m_name].detach();
+			pgsRecord &rec = dynamic_cast<pgsRecord &>(*vars[m_name]);
+			wxLongLong_t aux_line;
+			if (line->is_integer() && line->value().ToLongLong(&aux_line))
 			{
-				long aux_line;
-				line->value().ToLong(&aux_line);
+				if (aux_line - rec.count_lines() >= pgsRecord::max_growth)
+				{
+					throw pgsParameterException(wxString() << wxT("Line ")
+					                            << line->value() << wxT(" is too far beyond the end of ")
+					                            << m_name << wxT(" (") << wxLongLong(rec.count_lines()).ToString()
+					                            << wxT(" lines): at most ") << pgsRecord::max_growth
+					                            << wxT(" lines can be added at once"));
+				}
 
 				if (column->is_integer() || column->is_string())
 				{
@@ -136,3 +144,10 @@ pgsOperand pgsAssignToRecord::eval(pgsVarMap &vars) const
 
 	return pgsIdentRecord(m_name, m_line->clone(), m_column->clone()).eval(vars);
 }
+
+void pgsAssignToRecord::resolve(pgsVarMap &vars) const
+{
+	pgsAssign::resolve(vars);
+	m_line->resolve(vars);
+	m_column->resolve(vars);
+}
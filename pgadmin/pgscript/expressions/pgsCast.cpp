@@ -98,3 +98,8 @@ pgsOperand pgsCast::eval(pgsVarMap &vars) const
 			return var->clone();
 	}
 }
+
+void pgsCast::resolve(pgsVarMap &vars) const
+{
+	m_var->resolve(vars);
+}
@@ -13,18 +13,87 @@
 
 #include <wx/regex.h>
 #include "db/pgConn.h"
-#include "db/pgQueryThread.h"
 #include "pgscript/objects/pgsNumber.h"
 #include "pgscript/objects/pgsRecord.h"
 #include "pgscript/objects/pgsString.h"
 #include "pgscript/utilities/pgsUtilities.h"
 #include "pgscript/utilities/pgsThread.h"
 
+namespace
+{
+
+	// Collects the notices raised while running a query
+	void pgsNoticeProcessor(void *arg, const char *message)
+	{
+		wxString &messages = *((wxString *) arg);
+		wxString str(message, wxConvUTF8);
+
+		if (messages.IsEmpty())
+		{
+			if (str != wxT("\n"))
+				messages.Append(str);
+		}
+		else
+		{
+			messages.Append(wxT("\n")).Append(str);
+		}
+	}
+
+	bool is_var_char(const wxChar &c)
+	{
+		return wxIsalnum(c) || c == wxT('_') || c == wxT('#') || c == wxT('@');
+	}
+
+	bool is_ident_char(const wxChar &c)
+	{
+		return wxIsalnum(c) || c == wxT('_') || c == wxT('$');
+	}
+
+	// Clauses where a bare variable must stay a constant in the query text
+	enum pgsClause
+	{
+		pgsCOther = 0,
+		pgsCPosition, // ORDER BY and GROUP BY: a number is a column position
+		pgsCLimit     // LIMIT, OFFSET and FETCH: FETCH FIRST takes no cast
+	};
+
+	// Type names that take a modifier between parentheses, which must be
+	// an integer constant: varchar(@n)
+	bool takes_typmod(const wxString &word)
+	{
+		return word == wxT("VARCHAR") || word == wxT("CHAR") || word == wxT("CHARACTER")
+		       || word == wxT("BPCHAR") || word == wxT("NCHAR") || word == wxT("VARYING")
+		       || word == wxT("NUMERIC") || word == wxT("DECIMAL") || word == wxT("DEC")
+		       || word == wxT("FLOAT") || word == wxT("BIT") || word == wxT("VARBIT")
+		       || word == wxT("TIME") || word == wxT("TIMETZ") || word == wxT("TIMESTAMP")
+		       || word == wxT("TIMESTAMPTZ") || word == wxT("INTERVAL") || word == wxT("SECOND");
+	}
+
+	// The clause a keyword starts, or -1 if it is not one
+	int clause_of(const wxString &word, const wxString &previous)
+	{
+		if (word == wxT("BY") && (previous == wxT("ORDER") || previous == wxT("GROUP")))
+			return pgsCPosition;
+		if (word == wxT("LIMIT") || word == wxT("OFFSET") || word == wxT("FETCH"))
+			return pgsCLimit;
+		if (word == wxT("SELECT") || word == wxT("FROM") || word == wxT("WHERE")
+		        || word == wxT("HAVING") || word == wxT("WINDOW") || word == wxT("UNION")
+		        || word == wxT("INTERSECT") || word == wxT("EXCEPT") || word == wxT("RETURNING")
+		        || word == wxT("SET") || word == wxT("VALUES") || word == wxT("ON")
+		        || word == wxT("USING") || word == wxT("INTO") || word == wxT("FOR")
+		        || word == wxT("WITH") || word == wxT("BY"))
+			return pgsCOther;
+		return -1;
+	}
+
+}
+
 pgsExecute::pgsExecute(const wxString &query, pgsOutputStream *cout,
                        pgsThread *app) :
-	pgsExpression(), m_query(query), m_cout(cout), m_app(app)
+	pgsExpression(), m_query(query), m_preparable(false), m_cout(cout),
+	m_app(app)
 {
-
+	parse();
 }
 
 pgsExecute::~pgsExecute()
@@ -43,8 +112,12 @@ pgsExecute &pgsExecute::operator=(const pgsExecute &that)
 	{
 		pgsExpression::operator=(that);
 		m_query = that.m_query;
+		m_parts = that.m_parts;
+		m_vars = that.m_vars;
+		m_quoted = that.m_quoted;
+		m_preparable = that.m_preparable;
+		m_cout = that.m_cout;
 		m_app = that.m_app;
-		m_query = that.m_query;
 	}
 	return (*this);
 }
@@ -54,175 +127,491 @@ wxString pgsExecute::value() const
 	return m_query;
 }
 
+void pgsExecute::parse()
+{
+	// A variable is an @ followed by [a-zA-Z0-9_#@] and not preceded by a
+	// backslash; \@ and \\ stand for @ and \. Variables are bound as
+	// parameters when they are a whole string literal ('@var') or appear
+	// bare, where a number could be; anywhere else (identifiers, parts of
+	// literals, comments) the query has to be built as text. A bare number
+	// does not mean the same as a parameter after ORDER BY or GROUP BY, and
+	// the grammar wants a constant in FETCH FIRST and in type modifiers: the
+	// query is built as text there too.
+	const size_t length = m_query.Length();
+	bool preparable = true;
+	bool in_quote = false, in_ident = false;
+	bool in_line_comment = false, in_block_comment = false;
+	size_t quote_start = 0, quote_end = 0;
+	wxString part;
+
+	// Words of the query outside literals and comments, with the clause
+	// and type modifier state of each level of parentheses
+	wxString word, previous_word, last_word;
+	wxArrayInt clauses, typmods;
+	clauses.Add(pgsCOther);
+	typmods.Add(0);
+
+	size_t i = 0;
+	while (i < length)
+	{
+		const wxChar c = (wxChar) m_query[i];
+		const wxChar next = (i + 1 < length) ? (wxChar) m_query[i + 1] : wxT('\0');
+
+		if (!word.IsEmpty() && !is_ident_char(c))
+		{
+			int clause = clause_of(word, previous_word);
+			if (clause >= 0)
+				clauses.Last() = clause;
+			previous_word = word;
+			last_word = word;
+			word.Empty();
+		}
+
+		if (c == wxT('\\') && (next == wxT('@') || next == wxT('\\')))
+		{
+			part += next;
+			i += 2;
+			continue;
+		}
+
+		if (c == wxT('@') && i > 0 && m_query[i - 1] != wxT('\\') && is_var_char(next))
+		{
+			size_t end = i + 1;
+			while (end < length && is_var_char((wxChar) m_query[end]))
+				end++;
+			const wxChar after = (end < length) ? (wxChar) m_query[end] : wxT('\0');
+			const wxChar before = (wxChar) m_query[i - 1];
+			bool quoted = false;
+
+			if (in_line_comment || in_block_comment || in_ident)
+			{
+				preparable = false;
+			}
+			else if (in_quote)
+			{
+				// A whole literal: nothing but the variable between the quotes,
+				// and the literal neither typed nor prefixed (E'', U&'')
+				bool whole = quote_start + 1 == part.Length() && after == wxT('\'')
+				             && (end + 1 >= length || m_query[end + 1] != wxT('\''));
+
+				if (whole)
+				{
+					int k = (int) quote_start - 1;
+					while (k >= 0 && wxIsspace((wxChar) part[k]))
+						k--;
+
+					if (k >= 0 && is_ident_char((wxChar) part[k]))
+					{
+						int word_end = k;
+						while (k >= 0 && is_ident_char((wxChar) part[k]))
+							k--;
+						wxString word = part.Mid(k + 1, word_end - k).Upper();
+						whole = (word == wxT("SELECT") || word == wxT("AND")
+						         || word == wxT("OR") || word == wxT("NOT")
+						         || word == wxT("LIKE") || word == wxT("ILIKE")
+						         || word == wxT("WHEN") || word == wxT("THEN")
+						         || word == wxT("ELSE") || word == wxT("RETURNING"));
+					}
+					else if (k < 0 || wxStrchr(wxT("(,=<>!+-*/%|^["), (wxChar) part[k]) == NULL)
+					{
+						whole = false;
+					}
+				}
+
+				if (whole)
+				{
+					part.RemoveLast();
+					in_quote = false;
+					quoted = true;
+					end++;
+				}
+				else
+				{
+					preparable = false;
+				}
+			}
+			else if (is_ident_char(before) || before == wxT('.') || before == wxT('"')
+			         || after == wxT('.') || after == wxT('"') || after == wxT('\'')
+			         || clauses.Last() != pgsCOther || typmods.Last() != 0)
+			{
+				preparable = false;
+			}
+			last_word.Empty();
+
+			m_parts.Add(part);
+			m_vars.Add(m_query.Mid(i, (quoted ? end - 1 : end) - i));
+			m_quoted.Add(quoted ? 1 : 0);
+			part.Empty();
+			i = end;
+			continue;
+		}
+
+		if (in_line_comment)
+		{
+			if (c == wxT('\n'))
+				in_line_comment = false;
+		}
+		else if (in_block_comment)
+		{
+			if (c == wxT('*') && next == wxT('/'))
+			{
+				part += c;
+				i++;
+				in_block_comment = false;
+			}
+		}
+		else if (in_quote)
+		{
+			if (c == wxT('\''))
+			{
+				in_quote = false;
+				quote_end = i;
+			}
+		}
+		else if (in_ident)
+		{
+			if (c == wxT('"'))
+				in_ident = false;
+		}
+		else if (c == wxT('\''))
+		{
+			// A doubled quote carries on with the same literal
+			if (i == 0 || quote_end != i - 1 || m_query[i - 1] != wxT('\''))
+				quote_start = part.Length();
+			in_quote = true;
+		}
+		else if (c == wxT('"'))
+		{
+			in_ident = true;
+		}
+		else if (c == wxT('-') && next == wxT('-'))
+		{
+			in_line_comment = true;
+		}
+		else if (c == wxT('/') && next == wxT('*'))
+		{
+			in_block_comment = true;
+		}
+		else if (c == wxT('$'))
+		{
+			// Dollar quoting or parameters of its own
+			preparable = false;
+		}
+		else if (c == wxT(';') && !m_query.Mid(i + 1).Strip(wxString::both).IsEmpty())
+		{
+			// Several statements
+			preparable = false;
+		}
+		else if (is_ident_char(c))
+		{
+			word += (wxChar) wxToupper(c);
+		}
+		else if (c == wxT('('))
+		{
+			clauses.Add(clauses.Last());
+			typmods.Add(takes_typmod(last_word) ? 1 : 0);
+			last_word.Empty();
+		}
+		else if (c == wxT(')'))
+		{
+			if (clauses.GetCount() > 1)
+			{
+				clauses.RemoveAt(clauses.GetCount() - 1);
+				typmods.RemoveAt(typmods.GetCount() - 1);
+			}
+			last_word.Empty();
+		}
+		else if (!wxIsspace(c))
+		{
+			last_word.Empty();
+		}
+
+		part += c;
+		i++;
+	}
+	m_parts.Add(part);
+
+	// Only plain DML statements can be prepared
+	wxString first = m_query.Strip(wxString::leading);
+	while (first.StartsWith(wxT("(")))
+		first = first.Mid(1).Strip(wxString::leading);
+	size_t word_length = 0;
+	while (word_length < first.Length() && wxIsalpha((wxChar) first[word_length]))
+		word_length++;
+	first = first.Left(word_length).Upper();
+
+	m_preparable = preparable && (first == wxT("SELECT")
+	                              || first == wxT("INSERT") || first == wxT("UPDATE")
+	                              || first == wxT("DELETE") || first == wxT("VALUES")
+	                              || first == wxT("WITH") || first == wxT("TABLE"));
+}
+
+wxString pgsExecute::number_type(const wxString &value)
+{
+	// Same typing as the server applies to a numeric constant
+	const size_t length = value.Length();
+	size_t i = 0;
+
+	if (i < length && (value[i] == wxT('+') || value[i] == wxT('-')))
+		i++;
+
+	while (i < length && value[i] == wxT('0') && i + 1 < length
+	        && wxIsdigit((wxChar) value[i + 1]))
+		i++;
+
+	size_t start = i, digits = 0, frac_digits = 0;
+	while (i < length && wxIsdigit((wxChar) value[i]))
+	{
+		i++;
+		digits++;
+	}
+	wxString integer = value.Mid(start, digits);
+
+	bool real = false;
+	if (i < length && value[i] == wxT('.'))
+	{
+		real = true;
+		i++;
+		while (i < length && wxIsdigit((wxChar) value[i]))
+		{
+			i++;
+			frac_digits++;
+		}
+	}
+
+	if (digits + frac_digits == 0)
+		return wxEmptyString;
+
+	if (i < length && (value[i] == wxT('e') || value[i] == wxT('E')))
+	{
+		real = true;
+		i++;
+		if (i < length && (value[i] == wxT('+') || value[i] == wxT('-')))
+			i++;
+		size_t exp_digits = 0;
+		while (i < length && wxIsdigit((wxChar) value[i]))
+		{
+			i++;
+			exp_digits++;
+		}
+		if (exp_digits == 0)
+			return wxEmptyString;
+	}
+
+	if (i != length)
+		return wxEmptyString;
+
+	// The sign is an operator applied to the constant
+	if (real)
+		return wxT("numeric");
+	else if (digits < 10 || (digits == 10 && integer.Cmp(wxT("2147483647")) <= 0))
+		return wxT("int4");
+	else if (digits < 19 || (digits == 19 && integer.Cmp(wxT("9223372036854775807")) <= 0))
+		return wxT("int8");
+	else
+		return wxT("numeric");
+}
+
 pgsOperand pgsExecute::eval(pgsVarMap &vars) const
 {
-	// Copy statement locally
-	wxString stmt(m_query);
+	// Statement with the values inlined, which is also what is displayed,
+	// and statement with parameters if it can be prepared
+	wxString stmt, sql;
+	wxArrayString params;
+	bool prepared = m_preparable;
 
-	// Build regular expressions
-	wxRegEx identifier(wxT("([^\\])(@[a-zA-Z0-9_#@]+)"));
-	wxRegEx escaped(wxT("\\\\(@|\\\\)")); // Backslash followed by @ or backslash
-	wxASSERT(identifier.IsValid() && escaped.IsValid());
+	// Parameters are sent without a type. A whole literal ('@var') can only
+	// be bound if the server resolves an unknown parameter that has no other
+	// context to text, like it does for a literal: it does from 10 on
+	pgConn *conn = (m_app != 0) ? m_app->connection() : 0;
+	const bool bind_literals = conn != 0 && conn->GetStatus() == PGCONN_OK
+	                           && conn->BackendMinimumVersion(10, 0);
 
-	// Replace variables in statement
-	while (identifier.Matches(stmt))
+	for (size_t i = 0; i < m_vars.GetCount(); i++)
 	{
-		wxString var = identifier.GetMatch(stmt, 2);
-		wxString chr = identifier.GetMatch(stmt, 1);
-		if (vars.find(var) != vars.end())
+		stmt += m_parts[i];
+		sql += m_parts[i];
+
+		const wxString &var = m_vars[i];
+		const bool quoted = (m_quoted[i] != 0);
+
+		pgsVarMap::iterator it = vars.find(var);
+		if (it == vars.end())
 		{
-			wxString res = vars[var]->eval(vars)->value();
-			identifier.ReplaceFirst(&stmt, chr + pgsUtilities::escape_quotes(res));
+			stmt += quoted ? wxT("'") + var + wxT("'") : var;
+			prepared = false;
+			continue;
+		}
+
+		wxString res = it->second->value();
+		wxString text(res);
+		text.Replace(wxT("'"), wxT("''"));
+
+		if (quoted)
+		{
+			stmt += wxT("'") + text + wxT("'");
+			if (bind_literals)
+			{
+				params.Add(res);
+				sql += wxString::Format(wxT("$%d"), (int) params.GetCount());
+			}
+			else
+			{
+				// Each value would be prepared as a statement of its own
+				prepared = false;
+			}
 		}
 		else
 		{
-			identifier.ReplaceFirst(&stmt, chr + wxT("\\\\") + var);
+			stmt += text;
+			if (prepared)
+			{
+				wxString type = number_type(res);
+				if (type.IsEmpty())
+				{
+					prepared = false;
+				}
+				else
+				{
+					params.Add(res);
+					sql += wxString::Format(wxT("$%d::"), (int) params.GetCount()) + type;
+				}
+			}
 		}
 	}
-	escaped.ReplaceAll(&stmt, wxT("\\1"));
+	stmt += m_parts.Last();
+	sql += m_parts.Last();
 
 	// Perform operations only if we have a valid connection
-	if (m_app != 0 && m_app->connection() != 0 && !m_app->TestDestroy())
+	if (conn != 0 && !m_app->TestDestroy() && conn->GetStatus() == PGCONN_OK)
 	{
-		pgQueryThread thread(m_app->connection(), stmt);
+		// The query runs on this thread: pgsApplication::Terminate() cancels
+		// it on the server if the script is stopped meanwhile. Only local
+		// strings are used until it returns, so the other workers of a
+		// PARALLEL block go on with the interpreter
+		wxString messages;
+		conn->RegisterNoticeProcessor(pgsNoticeProcessor, &messages);
+		m_app->UnlockInterpreter();
+		pgSet *set = prepared ? conn->ExecutePrepared(sql, params, false, stmt)
+		             : conn->ExecuteSet(stmt, false);
+		m_app->LockInterpreter();
+		conn->RegisterNoticeProcessor(0, 0);
+
+		int status = conn->GetLastResultStatus();
+
+		if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK)
+		{
+			if (m_cout != 0)
+			{
+				if (!messages.IsEmpty())
+					messages.Append(wxT("\n"));
+				messages.Append(conn->GetLastError());
+
+				m_app->LockOutput();
+				pgsOutputStream &out = m_app->output(*m_cout);
+
+				out << PGSOUTWARNING;
+				wxString message(stmt + wxT("\n") + messages.Strip(wxString::both));
+				wxRegEx multilf(wxT("(\n)+"));
+				multilf.ReplaceAll(&message, wxT("\n"));
+				message.Replace(wxT("\n"), wxT("\n")
+				                + generate_spaces(PGSOUTWARNING.Length()));
+				out << message << wxT("\n");
 
-		if (thread.Create() == wxTHREAD_NO_ERROR)
+				m_app->UnlockOutput();
+			}
+		}
+		else if (!m_app->TestDestroy())
 		{
-			if (thread.Run() == wxTHREAD_NO_ERROR)
+			if (m_cout != 0)
+			{
+				m_app->LockOutput();
+				pgsOutputStream &out = m_app->output(*m_cout);
+
+				out << PGSOUTQUERY;
+				wxString message(messages.Strip(wxString::both));
+				if (!message.IsEmpty())
+					message = stmt + wxT("\n") + message;
+				else
+					message = stmt;
+				wxRegEx multilf(wxT("(\n)+"));
+				multilf.ReplaceAll(&message, wxT("\n"));
+				message.Replace(wxT("\n"), wxT("\n")
+				                + generate_spaces(PGSOUTQUERY.Length()));
+				out << message << wxT("\n");
+
+				m_app->UnlockOutput();
+			}
+
+			pgsRecord *rec = 0;
+
+			if (status == PGRES_TUPLES_OK)
 			{
-				while (true)
+				set->MoveFirst();
+				rec = pnew pgsRecord(set->NumCols());
+				wxArrayLong columns_int; // List of columns that contain integers
+				wxArrayLong columns_real; // List of columns that contain reals
+				for (long i = 0; i < set->NumCols(); i++)
 				{
-					if (m_app->TestDestroy()) // wxThread::TestDestroy()
+					rec->set_column_name(i, set->ColName(i));
+					wxString col_type = set->ColType(i);
+					if (!col_type.CmpNoCase(wxT("bigint"))
+					        || !col_type.CmpNoCase(wxT("smallint"))
+					        || !col_type.CmpNoCase(wxT("integer")))
 					{
-						thread.Delete();
-						break;
+						columns_int.Add(i);
 					}
-					else if (thread.IsRunning())
+					else if (!col_type.CmpNoCase(wxT("real"))
+					         || !col_type.CmpNoCase(wxT("double precision"))
+					         || !col_type.CmpNoCase(wxT("money"))
+					         || !col_type.CmpNoCase(wxT("numeric")))
 					{
-						m_app->Yield();
-						m_app->Sleep(20);
-					}
-					else
-					{
-						thread.Wait();
-						break;
+						columns_real.Add(i);
 					}
 				}
-
-				if (thread.ReturnCode() != PGRES_COMMAND_OK
-				        && thread.ReturnCode() != PGRES_TUPLES_OK)
+				// Values are stored in the columns of the record as they are
+				// read, without an operand per cell
+				rec->add_lines(set->NumRows());
+				wxLongLong_t line = 0;
+				while (!set->Eof())
 				{
-					if (m_cout != 0)
+					for (long i = 0; i < set->NumCols(); i++)
 					{
-						m_app->LockOutput();
-
-						(*m_cout) << PGSOUTWARNING;
-						wxString message(stmt + wxT("\n") + thread
-						                 .GetMessagesAndClear().Strip(wxString::both));
-						wxRegEx multilf(wxT("(\n)+"));
-						multilf.ReplaceAll(&message, wxT("\n"));
-						message.Replace(wxT("\n"), wxT("\n")
-						                + generate_spaces(PGSOUTWARNING.Length()));
-						(*m_cout) << message << wxT("\n");
-
-						m_app->UnlockOutput();
-					}
-				}
-				else if (!m_app->TestDestroy())
-				{
-					if (m_cout != 0)
-					{
-						m_app->LockOutput();
-
-						(*m_cout) << PGSOUTQUERY;
-						wxString message(thread.GetMessagesAndClear()
-						                 .Strip(wxString::both));
-						if (!message.IsEmpty())
-							message = stmt + wxT("\n") + message;
-						else
-							message = stmt;
-						wxRegEx multilf(wxT("(\n)+"));
-						multilf.ReplaceAll(&message, wxT("\n"));
-						message.Replace(wxT("\n"), wxT("\n")
-						                + generate_spaces(PGSOUTQUERY.Length()));
-						(*m_cout) << message << wxT("\n");
-
-						m_app->UnlockOutput();
-					}
+						wxLongLong_t number;
+						if (columns_int.Index(i) != wxNOT_FOUND
+						        && pgsNumber::to_int64(set->GetCharPtr(i), number))
+						{
+							rec->set_int(line, i, number);
+							continue;
+						}
 
-					pgsRecord *rec = 0;
+						wxString value = set->GetVal(i);
 
-					if (thread.DataValid())
-					{
-						pgSet *set = thread.DataSet();
-						set->MoveFirst();
-						rec = pnew pgsRecord(set->NumCols());
-						wxArrayLong columns_int; // List of columns that contain integers
-						wxArrayLong columns_real; // List of columns that contain reals
-						for (long i = 0; i < set->NumCols(); i++)
+						if (columns_real.Index(i) != wxNOT_FOUND
+						        && pgsNumber::num_type(value) == pgsNumber::pgsTReal)
 						{
-							rec->set_column_name(i, set->ColName(i));
-							wxString col_type = set->ColType(i);
-							if (!col_type.CmpNoCase(wxT("bigint"))
-							        || !col_type.CmpNoCase(wxT("smallint"))
-							        || !col_type.CmpNoCase(wxT("integer")))
-							{
-								columns_int.Add(i);
-							}
-							else if (!col_type.CmpNoCase(wxT("real"))
-							         || !col_type.CmpNoCase(wxT("double precision"))
-							         || !col_type.CmpNoCase(wxT("money"))
-							         || !col_type.CmpNoCase(wxT("numeric")))
-							{
-								columns_real.Add(i);
-							}
+							rec->set_text(line, i, value, pgsReal);
 						}
-						size_t line = 0;
-						while (!set->Eof())
+						else
 						{
-							for (long i = 0; i < set->NumCols(); i++)
-							{
-								wxString value = set->GetVal(i);
-
-								if (columns_int.Index(i) != wxNOT_FOUND
-								        && pgsNumber::num_type(value) == pgsNumber::pgsTInt)
-								{
-									rec->insert(line, i, pnew pgsNumber(value, pgsInt));
-								}
-								else if (columns_real.Index(i) != wxNOT_FOUND
-								         && pgsNumber::num_type(value) == pgsNumber::pgsTReal)
-								{
-									rec->insert(line, i, pnew pgsNumber(value, pgsReal));
-								}
-								else
-								{
-									rec->insert(line, i, pnew pgsString(value));
-								}
-							}
-							set->MoveNext();
-							++line;
+							rec->set_text(line, i, value);
 						}
 					}
-					else
-					{
-						rec = pnew pgsRecord(1);
-						rec->insert(0, 0, pnew pgsNumber(wxT("1")));
-					}
-
-					return rec;
+					set->MoveNext();
+					++line;
 				}
 			}
 			else
 			{
-				wxLogError(wxT("PGSCRIPT: Cannot run query thread for the query:\n%s"),
-				           m_query.c_str());
+				rec = pnew pgsRecord(1);
+				rec->insert(0, 0, pnew pgsNumber(wxT("1")));
 			}
+
+			delete set;
+			return rec;
 		}
-		else
-		{
-			wxLogError(wxT("PGSCRIPT: Cannot create query thread for the query:\n%s"),
-			           m_query.c_str());
-		}
+
+		delete set;
 	}
 
 	// This must return a record whatever happens
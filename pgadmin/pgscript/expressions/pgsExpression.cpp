@@ -21,3 +21,73 @@ pgsExpression::~pgsExpression()
 {
 
 }
+
+void pgsExpression::resolve(pgsVarMap &vars) const
+{
+
+}
+
+pgsVarMap::pgsVarMap() :
+	pgsVarHash()
+{
+
+}
+
+pgsVarMap::pgsVarMap(const pgsVarMap &that) :
+	pgsVarHash(that), m_slots(that.m_slots), m_slot_names(that.m_slot_names)
+{
+	// The slots of that map point to its own entries
+	m_slot_values.Add(0, m_slot_names.GetCount());
+}
+
+pgsVarMap &pgsVarMap::operator=(const pgsVarMap &that)
+{
+	if (this != &that)
+	{
+		pgsVarHash::operator=(that);
+		m_slots = that.m_slots;
+		m_slot_names = that.m_slot_names;
+		m_slot_values.Clear();
+		m_slot_values.Add(0, m_slot_names.GetCount());
+	}
+	return (*this);
+}
+
+long pgsVarMap::slot(const wxString &name)
+{
+	pgsSlotHash::iterator it = m_slots.find(name);
+	if (it != m_slots.end())
+	{
+		return it->second;
+	}
+
+	long index = (long) m_slot_names.Add(name);
+	m_slot_values.Add(0);
+	m_slots[name] = index;
+	return index;
+}
+
+pgsOperand *pgsVarMap::at(const long &slot)
+{
+	void *value = m_slot_values[slot];
+	if (value == 0)
+	{
+		iterator it = find(m_slot_names[slot]);
+		if (it == end())
+		{
+			return 0;
+		}
+		value = &it->second;
+		m_slot_values[slot] = value;
+	}
+	return (pgsOperand *) value;
+}
+
+void pgsVarMap::clear()
+{
+	pgsVarHash::clear();
+	for (size_t i = 0; i < m_slot_values.GetCount(); i++)
+	{
+		m_slot_values[i] = 0;
+	}
+}
@@ -121,3 +121,11 @@ pgsOperand pgsGenDate::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenDate::resolve(pgsVarMap &vars) const
+{
+	m_min->resolve(vars);
+	m_max->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+}
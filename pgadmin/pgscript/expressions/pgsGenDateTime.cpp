@@ -121,3 +121,11 @@ pgsOperand pgsGenDateTime::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenDateTime::resolve(pgsVarMap &vars) const
+{
+	m_min->resolve(vars);
+	m_max->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+}
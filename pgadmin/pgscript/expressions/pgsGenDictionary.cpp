@@ -124,3 +124,11 @@ pgsOperand pgsGenDictionary::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenDictionary::resolve(pgsVarMap &vars) const
+{
+	m_file_path->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+	m_wx_conv->resolve(vars);
+}
@@ -112,3 +112,11 @@ pgsOperand pgsGenInt::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenInt::resolve(pgsVarMap &vars) const
+{
+	m_min->resolve(vars);
+	m_max->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+}
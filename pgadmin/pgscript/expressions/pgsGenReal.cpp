@@ -126,3 +126,12 @@ pgsOperand pgsGenReal::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenReal::resolve(pgsVarMap &vars) const
+{
+	m_min->resolve(vars);
+	m_max->resolve(vars);
+	m_precision->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+}
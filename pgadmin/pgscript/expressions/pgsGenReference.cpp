@@ -129,3 +129,11 @@ pgsOperand pgsGenReference::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenReference::resolve(pgsVarMap &vars) const
+{
+	m_table->resolve(vars);
+	m_column->resolve(vars);
+	m_sequence->resolve(vars);
+	m_seed->resolve(vars);
+}
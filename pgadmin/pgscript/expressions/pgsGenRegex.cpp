@@ -96,3 +96,9 @@ pgsOperand pgsGenRegex::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenRegex::resolve(pgsVarMap &vars) const
+{
+	m_regex->resolve(vars);
+	m_seed->resolve(vars);
+}
@@ -113,3 +113,11 @@ pgsOperand pgsGenString::eval(pgsVarMap &vars) const
 		}
 	}
 }
+
+void pgsGenString::resolve(pgsVarMap &vars) const
+{
+	m_min->resolve(vars);
+	m_max->resolve(vars);
+	m_nb_words->resolve(vars);
+	m_seed->resolve(vars);
+}
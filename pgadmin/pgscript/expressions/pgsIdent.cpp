@@ -18,7 +18,7 @@
 const wxString pgsIdent::m_now = wxT("@NOW");
 
 pgsIdent::pgsIdent(const wxString &name) :
-	pgsExpression(), m_name(name)
+	pgsExpression(), m_name(name), m_slot(-1)
 {
 
 }
@@ -38,11 +38,23 @@ wxString pgsIdent::value() const
 	return m_name;
 }
 
+pgsOperand *pgsIdent::lookup(pgsVarMap &vars) const
+{
+	if (m_slot >= 0)
+	{
+		return vars.at(m_slot);
+	}
+
+	pgsVarMap::iterator it = vars.find(m_name);
+	return it != vars.end() ? &it->second : 0;
+}
+
 pgsOperand pgsIdent::eval(pgsVarMap &vars) const
 {
-	if (vars.find(m_name) != vars.end())
+	pgsOperand *value = lookup(vars);
+	if (value != 0)
 	{
-		return vars[m_name];
+		return *value;
 	}
 	else if (m_name == m_now)
 	{
@@ -54,3 +66,8 @@ pgsOperand pgsIdent::eval(pgsVarMap &vars) const
 		return pnew pgsString(wxT(""));
 	}
 }
+
+void pgsIdent::resolve(pgsVarMap &vars) const
+{
+	m_slot = vars.slot(m_name);
+}
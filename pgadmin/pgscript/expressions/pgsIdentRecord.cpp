@@ -66,17 +66,17 @@ wxString pgsIdentRecord::value() const
 pgsOperand pgsIdentRecord::eval(pgsVarMap &vars) const
 {
 	// Check whether the variable is a record
-	if (vars.find(m_name) != vars.end() && vars[m_name]->is_record())
+	pgsOperand *value = lookup(vars);
+	if (value != 0 && (*value)->is_record())
 	{
 		// Get the operand as a record
-		const pgsRecord &rec = dynamic_cast<const pgsRecord &>(*vars[m_name]);
+		const pgsRecord &rec = dynamic_cast<const pgsRecord &>(**value);
 
 		// Evaluate parameters
 		pgsOperand line(m_line->eval(vars));
-		if (line->is_integer())
+		wxLongLong_t aux_line;
+		if (line->is_integer() && line->value().ToLongLong(&aux_line))
 		{
-			long aux_line;
-			line->value().ToLong(&aux_line);
 
 			if (m_column != 0)
 			{
@@ -101,3 +101,13 @@ pgsOperand pgsIdentRecord::eval(pgsVarMap &vars) const
 
 	return pnew pgsString(wxT(""));
 }
+
+void pgsIdentRecord::resolve(pgsVarMap &vars) const
+{
+	pgsIdent::resolve(vars);
+	m_line->resolve(vars);
+	if (m_column != 0)
+	{
+		m_column->resolve(vars);
+	}
+}
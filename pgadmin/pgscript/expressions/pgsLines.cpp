@@ -42,7 +42,7 @@ pgsOperand pgsLines::eval(pgsVarMap &vars) const
 		if (vars[m_name]->is_record())
 		{
 			const pgsRecord &rec = dynamic_cast<const pgsRecord &>(*vars[m_name]);
-			return pnew pgsNumber(wxString() << rec.count_lines(), pgsInt);
+			return pnew pgsNumber(rec.count_lines(), pgsInt);
 		}
 		else
 		{
@@ -44,3 +44,12 @@ pgsOperation &pgsOperation::operator =(const pgsOperation &that)
 	}
 	return (*this);
 }
+
+void pgsOperation::resolve(pgsVarMap &vars) const
+{
+	m_left->resolve(vars);
+	if (m_right != 0)
+	{
+		m_right->resolve(vars);
+	}
+}
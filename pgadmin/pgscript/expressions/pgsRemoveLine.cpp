@@ -59,14 +59,15 @@ pgsOperand pgsRemoveLine::eval(pgsVarMap &vars) const
 {
 	if (vars.find(m_rec) != vars.end() && vars[m_rec]->is_record())
 	{
-		pgsRecord &rec = dynamic_cast<pgsRecord &>(*vars[m_rec]);
-
 		// Evaluate parameter
 		pgsOperand line(m_line->eval(vars));
-		if (line->is_integer())
+
+		// Get the operand as a record, copied if other variables share it
+		vars[m_rec].detach();
+		pgsRecord &rec = dynamic_cast<pgsRecord &>(*vars[m_rec]);
+		wxLongLong_t aux_line;
+		if (line->is_integer() && line->value().ToLongLong(&aux_line))
 		{
-			long aux_line;
-			line->value().ToLong(&aux_line);
 
 			if (!rec.remove_line(aux_line))
 			{
@@ -87,3 +88,8 @@ pgsOperand pgsRemoveLine::eval(pgsVarMap &vars) const
 		throw pgsParameterException(wxString() << m_rec << wxT(" is not a record"));
 	}
 }
+
+void pgsRemoveLine::resolve(pgsVarMap &vars) const
+{
+	m_line->resolve(vars);
+}
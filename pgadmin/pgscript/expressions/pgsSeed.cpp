@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "pgAdmin3.h"
+#include "pgscript/expressions/pgsSeed.h"
+
+#include "pgscript/objects/pgsNumber.h"
+
+pgsSeed::pgsSeed() :
+	pgsExpression(), m_time((long) wxDateTime::GetTimeNow()),
+	m_worker(wxT("@WORKER"))
+{
+
+}
+
+pgsSeed::~pgsSeed()
+{
+
+}
+
+pgsExpression *pgsSeed::clone() const
+{
+	return pnew pgsSeed(*this);
+}
+
+wxString pgsSeed::value() const
+{
+	return wxString() << m_time;
+}
+
+pgsOperand pgsSeed::eval(pgsVarMap &vars) const
+{
+	// Workers started in the same second do not draw the same values
+	pgsOperand worker(m_worker.eval(vars));
+	long number;
+	if (worker->is_integer() && worker->value().ToLong(&number))
+	{
+		return pnew pgsNumber(wxString() << (m_time ^ (number << 16)));
+	}
+	else
+	{
+		return pnew pgsNumber(wxString() << m_time);
+	}
+}
+
+void pgsSeed::resolve(pgsVarMap &vars) const
+{
+	m_worker.resolve(vars);
+}
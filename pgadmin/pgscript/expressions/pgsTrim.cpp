@@ -55,3 +55,8 @@ pgsOperand pgsTrim::eval(pgsVarMap &vars) const
 {
 	return pnew pgsString(m_exp->eval(vars)->value().Strip(wxString::both));
 }
+
+void pgsTrim::resolve(pgsVarMap &vars) const
+{
+	m_exp->resolve(vars);
+}
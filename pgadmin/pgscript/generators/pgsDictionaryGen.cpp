@@ -11,22 +11,152 @@
 #include "pgAdmin3.h"
 #include "pgscript/generators/pgsDictionaryGen.h"
 
-#include <wx/txtstrm.h>
-#include <wx/wfstream.h>
 #include <wx/filename.h>
+#include <wx/ffile.h>
+#include <wx/hashmap.h>
+#include <wx/thread.h>
+
+WX_DECLARE_STRING_HASH_MAP(pgsSharedPtr<pgsDictionaryIndex>, pgsDictionaryCache);
+
+// Number of dictionaries kept indexed once no generator uses them
+#define PGS_DICTIONARY_CACHE_SIZE 4
+
+// Dictionaries already indexed, by file path, and their paths from the
+// least to the most recently used
+static pgsDictionaryCache dictionary_cache;
+static wxArrayString dictionary_cache_order;
+static wxMutex dictionary_cache_lock;
+
+namespace
+{
+
+	// Same lines as wxTextInputStream::ReadLine() would read: the file ends
+	// at the first empty line, and a last line without end of line is ignored
+	template <typename T>
+	void index_lines(const T *data, long size, wxArrayLong &offsets)
+	{
+		long start = 0;
+		for (long pos = 0; pos < size; pos++)
+		{
+			if (data[pos] != '\n' && data[pos] != '\r')
+				continue;
+
+			if (pos == start)
+				break;
+
+			offsets.Add(start);
+			if (data[pos] == '\r' && pos + 1 < size && data[pos + 1] == '\n')
+				++pos;
+			start = pos + 1;
+		}
+		offsets.Add(start);
+	}
+
+}
+
+pgsDictionaryIndex::pgsDictionaryIndex(const wxString &file_path, wxMBConv &conv) :
+	m_data(0), m_size(0)
+{
+	wxFileName file_name(file_path);
+	if (file_name.FileExists() && file_name.IsFileReadable())
+	{
+		m_modified = file_name.GetModificationTime();
+
+		wxFFile input(file_path, wxT("rb"));
+		if (input.IsOpened())
+		{
+			m_size = input.Length();
+			if (m_size > 0)
+			{
+				m_data = pnew char[m_size];
+				if (input.Read(m_data, m_size) != (size_t) m_size)
+					m_size = 0;
+			}
+		}
+	}
+
+	if (is_ascii_compatible(conv))
+	{
+		index_lines(m_data, m_size, m_offsets);
+	}
+	else
+	{
+#if wxUSE_UNICODE
+		if (m_size > 0)
+			m_text = wxString(m_data, conv, m_size);
+#endif
+		pdeletea(m_data);
+		m_size = 0;
+		index_lines((const wxChar *) m_text.c_str(), m_text.Length(), m_offsets);
+	}
+}
+
+pgsDictionaryIndex::~pgsDictionaryIndex()
+{
+	pdeletea(m_data);
+}
+
+long pgsDictionaryIndex::nb_lines() const
+{
+	return m_offsets.GetCount() - 1;
+}
+
+wxString pgsDictionaryIndex::get_line(long line_nb, wxMBConv &conv) const
+{
+	if (line_nb < 1 || line_nb > nb_lines())
+		return wxString();
+
+	long start = m_offsets.Item(line_nb - 1);
+	long end = m_offsets.Item(line_nb);
+
+	if (m_data == 0)
+	{
+		while (end > start && (m_text.GetChar(end - 1) == wxT('\n')
+		                       || m_text.GetChar(end - 1) == wxT('\r')))
+			--end;
+		return m_text.Mid(start, end - start);
+	}
+
+	while (end > start && (m_data[end - 1] == '\n' || m_data[end - 1] == '\r'))
+		--end;
+
+#if wxUSE_UNICODE
+	return wxString(m_data + start, conv, end - start);
+#else
+	return wxString(m_data + start, end - start);
+#endif
+}
+
+bool pgsDictionaryIndex::is_current(const wxString &file_path) const
+{
+	wxFileName file_name(file_path);
+	return file_name.FileExists() && file_name.GetModificationTime() == m_modified;
+}
+
+bool pgsDictionaryIndex::is_ascii_compatible(wxMBConv &conv)
+{
+#if wxUSE_UNICODE
+	char buffer[8];
+	size_t length = conv.WC2MB(buffer, wxT("\n"), sizeof(buffer));
+	return length == 1 && buffer[0] == '\n';
+#else
+	return true;
+#endif
+}
 
 pgsDictionaryGen::pgsDictionaryGen(const wxString &file_path,
                                    const bool &sequence, const long &seed, wxCSConv conv) :
-	pgsObjectGen(seed), m_file_path(file_path), m_conv(conv)
+	pgsObjectGen(seed), m_file_path(file_path), m_conv(conv),
+	m_index(get_index(file_path, m_conv))
 {
-	m_nb_lines = this->count_lines();
+	m_nb_lines = m_index->nb_lines();
 	m_randomizer = pgsRandomizer(pnew pgsIntegerGen(1, m_nb_lines,
 	                             sequence, seed));
 }
 
 wxString pgsDictionaryGen::random()
 {
-	return this->get_line(m_randomizer->random_long());
+	return m_index->get_line(m_randomizer->random_long(), m_conv);
 }
 
 pgsDictionaryGen::~pgsDictionaryGen()
@@ -44,56 +174,34 @@ const long &pgsDictionaryGen::nb_lines() const
 	return m_nb_lines;
 }
 
-long pgsDictionaryGen::count_lines()
+pgsDictionaryGen::pgsIndex pgsDictionaryGen::get_index(const wxString &file_path,
+        wxMBConv &conv)
 {
-	long result = 0;
+	// The index of a converted file depends on the encoding, it is only
+	// shared by the clones of the generator
+	if (!pgsDictionaryIndex::is_ascii_compatible(conv))
+		return pgsIndex(pnew pgsDictionaryIndex(file_path, conv));
 
-	wxFileName file_path(m_file_path);
-	if (file_path.FileExists() && file_path.IsFileReadable())
-	{
-		wxFFileInputStream input(m_file_path);
-		if (input.IsOk())
-		{
-#if wxUSE_UNICODE
-			wxTextInputStream text(input, wxT(" \t"), m_conv);
-#else
-			wxTextInputStream text(input, wxT(" \t"));
-#endif
-			wxString line;
-			while (!(line = text.ReadLine()).IsEmpty() && !input.Eof())
-			{
-				++result;
-			}
-		}
-	}
+	wxMutexLocker lock(dictionary_cache_lock);
 
-	if (result < 0) result = 0;
-	wxASSERT(result >= 0);
-	return result;
-}
+	int used = dictionary_cache_order.Index(file_path);
+	if (used != wxNOT_FOUND)
+		dictionary_cache_order.RemoveAt(used);
+	dictionary_cache_order.Add(file_path);
 
-wxString pgsDictionaryGen::get_line(long line_nb)
-{
-	long current_line = 1;
+	pgsDictionaryCache::iterator it = dictionary_cache.find(file_path);
+	if (it != dictionary_cache.end() && it->second->is_current(file_path))
+		return it->second;
+
+	pgsIndex index(pnew pgsDictionaryIndex(file_path, conv));
+	dictionary_cache[file_path] = index;
 
-	if (m_nb_lines > 0)
+	// Generators keep the indexes they use when they are dropped from here
+	while (dictionary_cache_order.GetCount() > PGS_DICTIONARY_CACHE_SIZE)
 	{
-		wxFFileInputStream input(m_file_path);
-		if (input.IsOk())
-		{
-#if wxUSE_UNICODE
-			wxTextInputStream text(input, wxT(" \t"), m_conv);
-#else
-			wxTextInputStream text(input, wxT(" \t"));
-#endif
-			while (current_line < line_nb && !input.Eof())
-			{
-				text.ReadLine();
-				++current_line;
-			}
-			return text.ReadLine();
-		}
+		dictionary_cache.erase(dictionary_cache_order.Item(0));
+		dictionary_cache_order.RemoveAt(0);
 	}
 
-	return wxString();
+	return index;
 }
@@ -11,6 +11,45 @@
 #include "pgAdmin3.h"
 #include "pgscript/generators/pgsIntegerGen.h"
 
+namespace
+{
+
+	// Shuffles the values bufferized by the sequential generators
+	class pgsRandInt
+	{
+
+	private:
+
+		long m_state;
+
+	public:
+
+		pgsRandInt(long n)
+			: m_state(n)
+		{
+
+		}
+
+		long rand()
+		{
+			m_state = (1103515245L * m_state + 12345L) % 2147483647L;
+			return m_state;
+		}
+
+	};
+
+	// Bounds beyond which the 64-bit generators could overflow
+	const MAPM int64_limit("4611686018427387904"); // 2^62
+
+	wxLongLong_t mapm_to_int64(const MAPM &m)
+	{
+		wxLongLong_t result = 0;
+		pgsMapm::pgs_mapm_str(m, true).ToLongLong(&result);
+		return result;
+	}
+
+}
+
 pgsIntegerGen::pgsSequentialIntGen::pgsSequentialIntGen(const MAPM &range,
         const long &seed) :
 	pgsNumberGen(range), m_state(seed), m_m(2), m_remainder(m_range)
@@ -44,29 +83,6 @@ MAPM pgsIntegerGen::pgsSequentialIntGen::random()
 			m_remainder -= 1;
 		}
 
-		class pgsRandInt
-		{
-
-		private:
-
-			long m_state;
-
-		public:
-
-			pgsRandInt(long n)
-				: m_state(n)
-			{
-
-			}
-
-			long rand()
-			{
-				m_state = (1103515245L * m_state + 12345L) % 2147483647L;
-				return m_state;
-			}
-
-		};
-
 		// Shuffle the vector of generated values
 		pgsRandInt rand_int(BUFFER_SIZE);
 		for (size_t i = 0; i < m_buffer.GetCount(); i++)
@@ -133,14 +149,114 @@ const MAPM pgsIntegerGen::pgsNormalIntGen::arg_a = 16807L;
 const MAPM pgsIntegerGen::pgsNormalIntGen::arg_c = 0;
 const MAPM pgsIntegerGen::pgsNormalIntGen::arg_m = 2147483647L;
 
+pgsIntegerGen::pgsInt64Gen::~pgsInt64Gen()
+{
+
+}
+
+pgsIntegerGen::pgsSequentialInt64Gen::pgsSequentialInt64Gen(
+    const wxLongLong_t &range, const long &seed) :
+	m_state(seed), m_mask(1), m_range(range), m_remainder(range),
+	m_buffer_count(0)
+{
+	wxULongLong_t m = 2;
+	while (m < (wxULongLong_t) m_range)
+	{
+		m = m * 2;
+	}
+	m_mask = m - 1;
+}
+
+wxLongLong_t pgsIntegerGen::pgsSequentialInt64Gen::random()
+{
+	// Same algorithm as pgsSequentialIntGen::random(): the modulus being a
+	// power of 2 the modulo is a mask, unsigned overflows being harmless
+	if (m_buffer_count == 0)
+	{
+		wxLongLong_t min = wxMin(m_remainder, (wxLongLong_t) BUFFER_SIZE);
+
+		for (wxLongLong_t i = 0; i < min; i++)
+		{
+			do
+			{
+				m_state = (m_state * 5 + 1) & m_mask;
+			}
+			while (m_state >= (wxULongLong_t) m_range);
+			m_buffer[m_buffer_count++] = (wxLongLong_t) m_state;
+			m_remainder -= 1;
+		}
+
+		pgsRandInt rand_int(BUFFER_SIZE);
+		for (size_t i = 0; i < m_buffer_count; i++)
+		{
+			size_t r = i + (rand_int.rand() % (m_buffer_count - i));
+			const wxLongLong_t a = m_buffer[i];
+			m_buffer[i] = m_buffer[r];
+			m_buffer[r] = a;
+		}
+	}
+
+	if (m_remainder == 0)
+	{
+		m_remainder = m_range;
+	}
+
+	return m_buffer[--m_buffer_count];
+}
+
+pgsIntegerGen::pgsInt64Gen *pgsIntegerGen::pgsSequentialInt64Gen::clone()
+{
+	return pnew pgsIntegerGen::pgsSequentialInt64Gen(*this);
+}
+
+pgsIntegerGen::pgsNormalInt64Gen::pgsNormalInt64Gen(const wxLongLong_t &range,
+        const long &seed) :
+	m_state(seed % arg_m), m_range(range)
+{
+	for (int i = 0; i < 10; i++)
+		random(); // Beginning of the sequence is garbage
+}
+
+wxLongLong_t pgsIntegerGen::pgsNormalInt64Gen::random()
+{
+	m_state = (m_state * arg_a) % arg_m;
+
+	// (m_state * m_range) / (arg_m - 1) without overflowing: with
+	// m_range = q * top + r, this is m_state * q + (m_state * r) / top
+	const wxLongLong_t top = arg_m - 1;
+	return m_state * (m_range / top) + (m_state * (m_range % top)) / top;
+}
+
+pgsIntegerGen::pgsInt64Gen *pgsIntegerGen::pgsNormalInt64Gen::clone()
+{
+	return pnew pgsIntegerGen::pgsNormalInt64Gen(*this);
+}
+
+const wxLongLong_t pgsIntegerGen::pgsNormalInt64Gen::arg_a = 16807;
+const wxLongLong_t pgsIntegerGen::pgsNormalInt64Gen::arg_m = 2147483647;
+
 pgsIntegerGen::pgsIntegerGen(const MAPM &min, const MAPM &max,
                              const bool &sequence, const long &seed) :
 	pgsObjectGen(seed), m_min(wxMin(min, max)), m_max(wxMax(min, max)),
-	m_range(m_max - m_min + 1), m_sequence(sequence)
+	m_range(m_max - m_min + 1), m_sequence(sequence), m_int64_min(0)
 {
-	m_randomizer = is_sequence()
-	               ? pgsRandomizer(pnew pgsSequentialIntGen(m_range, m_seed))
-	               : pgsRandomizer(pnew pgsNormalIntGen(m_range, m_seed));
+	// The 64-bit generators produce the same values as the MAPM ones as
+	// long as nothing overflows and the seed is not negative
+	if (m_seed >= 0 && m_range <= int64_limit
+	        && m_min >= -int64_limit && m_max <= int64_limit)
+	{
+		wxLongLong_t range = mapm_to_int64(m_range);
+		m_int64_min = mapm_to_int64(m_min);
+		m_int64_randomizer = is_sequence()
+		                     ? pgsInt64Randomizer(pnew pgsSequentialInt64Gen(range, m_seed))
+		                     : pgsInt64Randomizer(pnew pgsNormalInt64Gen(range, m_seed));
+	}
+	else
+	{
+		m_randomizer = is_sequence()
+		               ? pgsRandomizer(pnew pgsSequentialIntGen(m_range, m_seed))
+		               : pgsRandomizer(pnew pgsNormalIntGen(m_range, m_seed));
+	}
 }
 
 bool pgsIntegerGen::is_sequence() const
@@ -150,6 +266,12 @@ bool pgsIntegerGen::is_sequence() const
 
 wxString pgsIntegerGen::random()
 {
+	if (m_int64_randomizer.get() != 0)
+	{
+		return wxString::Format(wxT("%") wxLongLongFmtSpec wxT("d"),
+		                        random_int64());
+	}
+
 	MAPM data = m_randomizer->random();
 	data = data + m_min;
 	wxASSERT(data >= m_min && data <= m_max);
@@ -158,11 +280,30 @@ wxString pgsIntegerGen::random()
 
 long pgsIntegerGen::random_long()
 {
+	if (m_int64_randomizer.get() != 0)
+	{
+		return (long) random_int64();
+	}
+
 	long result;
 	random().ToLong(&result);
 	return result;
 }
 
+wxLongLong_t pgsIntegerGen::random_int64()
+{
+	if (m_int64_randomizer.get() != 0)
+	{
+		wxLongLong_t data = m_int64_randomizer->random() + m_int64_min;
+		wxASSERT(data >= m_int64_min);
+		return data;
+	}
+
+	wxLongLong_t result = 0;
+	random().ToLongLong(&result);
+	return result;
+}
+
 pgsIntegerGen::~pgsIntegerGen()
 {
 
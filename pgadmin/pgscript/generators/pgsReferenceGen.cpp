@@ -11,37 +11,121 @@
 #include "pgAdmin3.h"
 #include "pgscript/generators/pgsReferenceGen.h"
 
-#include "pgscript/expressions/pgsExecute.h"
-#include "pgscript/objects/pgsNumber.h"
-#include "pgscript/objects/pgsRecord.h"
+#include "db/pgConn.h"
+#include "db/pgSet.h"
 #include "pgscript/utilities/pgsThread.h"
 
-pgsReferenceGen::pgsReferenceGen(pgsThread *app, const wxString &table,
-                                 const wxString &column, const bool &sequence, const long &seed) :
-	pgsObjectGen(seed), m_app(app), m_table(table), m_column(column),
-	m_sequence(sequence)
+pgsReferenceKeys::pgsReferenceKeys(pgsThread *app, const wxString &table,
+                                   const wxString &column) :
+	m_conv(&wxConvLibc), m_version(0), m_loaded(0)
+{
+	load(app, table, column);
+}
+
+pgsReferenceKeys::~pgsReferenceKeys()
 {
-	// We need an empty symbol table for calling pgsExecute.eval(...)
-	pgsVarMap vars;
+
+}
+
+void pgsReferenceKeys::load(pgsThread *app, const wxString &table,
+                            const wxString &column)
+{
+	m_data.SetDataLen(0);
+	m_offsets.Clear();
+	m_offsets.Add(0);
+	++m_version;
+	m_loaded = wxGetLocalTime();
+
+	pgConn *conn = app != 0 ? app->connection() : 0;
+	if (conn == 0 || app->TestDestroy() || conn->GetStatus() != PGCONN_OK)
+		return;
+
+	m_conv = conn->GetConv();
 
 	// Count the number of lines in the table
-	pgsOperand result = pgsExecute(wxString() << wxT("SELECT count(*) FROM ")
-	                               << m_table, 0, m_app).eval(vars);
-	wxASSERT(result->is_record());
-	wxString value = result->value();
-	if (!value.IsEmpty())
+	wxLongLong_t nb_rows = 0;
+	wxString count = conn->ExecuteScalar(wxString() << wxT("SELECT count(*) FROM ")
+	                                     << table, false);
+	if (!count.IsEmpty())
+		nb_rows = StrToLongLong(count).GetValue();
+	wxLogScriptVerbose(wxT("REFGEN: Number of rows in %s: %s"), table.c_str(),
+	                   count.c_str());
+
+	// Read the whole column, or a random sample of about MAX_KEYS rows when
+	// the table is larger, in a single scan of the table. Each row is kept
+	// with the same probability; a LIMIT would favour the rows scanned first.
+	wxString query = wxString() << wxT("SELECT ") << column << wxT(" FROM ") << table;
+	if (nb_rows > MAX_KEYS)
 	{
-		m_nb_rows = pgsMapm::pgs_str_mapm(result->number().value());
+		query << wxT(" WHERE random() < ") << MAX_KEYS << wxT("::float8 / ")
+		      << NumToStr(wxLongLong(nb_rows));
 	}
-	else
+
+	pgSet *set = conn->ExecuteSet(query, false);
+	if (set)
 	{
-		m_nb_rows = 0;
+		while (!set->Eof())
+		{
+			const char *value = set->GetCharPtr(0);
+			size_t length = strlen(value);
+			m_data.AppendData(value, length);
+			m_offsets.Add(m_offsets.Last() + length);
+			set->MoveNext();
+		}
+		delete set;
 	}
-	wxLogScriptVerbose(wxT("REFGEN: Number of rows in %s: %s"), m_table.c_str(),
-	                   pgsMapm::pgs_mapm_str(m_nb_rows).c_str());
 
-	// Create an integer generator with that number of lines
-	m_randomizer = pgsRandomizer(pnew pgsIntegerGen(0, m_nb_rows - 1,
+	wxLogScriptVerbose(wxT("REFGEN: %ld values of %s read from %s"), nb_keys(),
+	                   column.c_str(), table.c_str());
+}
+
+long pgsReferenceKeys::nb_keys() const
+{
+	return m_offsets.GetCount() - 1;
+}
+
+wxString pgsReferenceKeys::get_key(long key_nb) const
+{
+	if (key_nb < 0 || key_nb >= nb_keys())
+		return wxString();
+
+	long start = m_offsets.Item(key_nb);
+	long end = m_offsets.Item(key_nb + 1);
+	const char *data = (const char *) m_data.GetData();
+
+#if wxUSE_UNICODE
+	return wxString(data + start, *m_conv, end - start);
+#else
+	return wxString(data + start, end - start);
+#endif
+}
+
+const long &pgsReferenceKeys::version() const
+{
+	return m_version;
+}
+
+const long &pgsReferenceKeys::loaded() const
+{
+	return m_loaded;
+}
+
+pgsReferenceGen::pgsReferenceGen(pgsThread *app, const wxString &table,
+                                 const wxString &column, const bool &sequence, const long &seed,
+                                 const long &refresh) :
+	pgsObjectGen(seed), m_app(app), m_table(table), m_column(column),
+	m_sequence(sequence), m_refresh(refresh),
+	m_keys(pnew pgsReferenceKeys(app, table, column))
+{
+	init_randomizer();
+}
+
+void pgsReferenceGen::init_randomizer()
+{
+	// Create an integer generator with that number of values
+	m_version = m_keys->version();
+	m_nb_keys = m_keys->nb_keys();
+	m_randomizer = pgsRandomizer(pnew pgsIntegerGen(0, m_nb_keys - 1,
 	                             is_sequence(), m_seed));
 }
 
@@ -52,17 +136,24 @@ bool pgsReferenceGen::is_sequence() const
 
 wxString pgsReferenceGen::random()
 {
-	// We need an empty symbol table for calling pgsExecute.eval(...)
-	pgsVarMap vars;
+	if (m_refresh > 0 && wxGetLocalTime() - m_keys->loaded() >= m_refresh)
+	{
+		m_keys->load(m_app, m_table, m_column);
+	}
 
-	// Choose one line
-	pgsOperand result = pgsExecute(wxString() << wxT("SELECT ") << m_column
-	                               << wxT(" FROM ") << m_table << wxT(" LIMIT 1 OFFSET ")
-	                               << m_randomizer->random(), 0, m_app).eval(vars);
-	wxASSERT(result->is_record());
+	// The values have been read again by this generator or by a clone
+	if (m_keys->version() != m_version)
+	{
+		init_randomizer();
+	}
+
+	if (m_nb_keys == 0)
+	{
+		return wxString();
+	}
 
-	// Return the result as a single value
-	return dynamic_cast<const pgsRecord &>(*result).get(0, 0)->value();
+	// Choose one value
+	return m_keys->get_key(m_randomizer->random_long());
 }
 
 pgsReferenceGen::~pgsReferenceGen()
@@ -11,26 +11,147 @@
 #include "pgAdmin3.h"
 #include "pgscript/objects/pgsNumber.h"
 
-#include <wx/regex.h>
+#include <climits>
 #include "pgscript/objects/pgsRecord.h"
 #include "pgscript/objects/pgsString.h"
 #include "pgscript/exceptions/pgsArithmeticException.h"
 #include "pgscript/exceptions/pgsCastException.h"
 
-#define PGS_INTEGER_FORM_1 wxT("^[+-]?[0-9]+$")
-#define PGS_REAL_FORM_1 wxT("^[+-]?[0-9]+[Ee][+-]?[0-9]+$")
-#define PGS_REAL_FORM_2 wxT("^[+-]?[0-9]*[.][0-9]+([Ee][+-]?[0-9]+)?$")
-#define PGS_REAL_FORM_3 wxT("^[+-]?[0-9]+[.][0-9]*([Ee][+-]?[0-9]+)?$")
+namespace
+{
+
+	const wxLongLong_t int64_max = wxLL(9223372036854775807);
+	const wxLongLong_t int64_min = -int64_max - 1;
+
+	// The following return false instead of overflowing
+
+	bool int64_plus(const wxLongLong_t &a, const wxLongLong_t &b,
+	                wxLongLong_t &result)
+	{
+		if ((b > 0 && a > int64_max - b) || (b < 0 && a < int64_min - b))
+			return false;
+		result = a + b;
+		return true;
+	}
+
+	bool int64_minus(const wxLongLong_t &a, const wxLongLong_t &b,
+	                 wxLongLong_t &result)
+	{
+		if ((b < 0 && a > int64_max + b) || (b > 0 && a < int64_min + b))
+			return false;
+		result = a - b;
+		return true;
+	}
+
+	bool int64_times(const wxLongLong_t &a, const wxLongLong_t &b,
+	                 wxLongLong_t &result)
+	{
+		if (a > 0)
+		{
+			if ((b > 0 && a > int64_max / b) || (b < 0 && b < int64_min / a))
+				return false;
+		}
+		else if (a < 0)
+		{
+			if ((b > 0 && a < int64_min / b) || (b < 0 && b < int64_max / a))
+				return false;
+		}
+		result = a * b;
+		return true;
+	}
+
+	size_t skip_digits(const wxString &str, size_t &pos)
+	{
+		size_t start = pos;
+		for (; pos < str.Length(); pos++)
+		{
+			wxChar c = str[pos];
+			if (c < wxT('0') || c > wxT('9'))
+				break;
+		}
+		return pos - start;
+	}
+
+	// Reads an integer of the form [+-]?[0-9]+
+	template <typename C> bool int64_parse(const C *str, size_t n,
+	                                       wxLongLong_t &result)
+	{
+		size_t i = 0;
+		bool negative = false;
+		if (i < n && (str[i] == '+' || str[i] == '-'))
+		{
+			negative = (str[i] == '-');
+			i++;
+		}
+		if (i == n)
+			return false;
+
+		// Accumulated as a negative number to reach int64_min
+		wxLongLong_t value = 0;
+		for (; i < n; i++)
+		{
+			if (str[i] < '0' || str[i] > '9')
+				return false;
+			int digit = (int)(str[i] - '0');
+			if (value < (int64_min + digit) / 10)
+				return false;
+			value = value * 10 - digit;
+		}
+
+		if (!negative)
+		{
+			if (value == int64_min)
+				return false;
+			value = -value;
+		}
+		result = value;
+		return true;
+	}
+
+	wxString int64_str(const wxLongLong_t &n)
+	{
+		wxChar buffer[24];
+		wxChar *end = buffer + 24, *p = end;
+		wxULongLong_t u = n < 0 ? (wxULongLong_t) 0 - (wxULongLong_t) n
+		                  : (wxULongLong_t) n;
+		do
+		{
+			*--p = (wxChar)(wxT('0') + (int)(u % 10));
+			u /= 10;
+		}
+		while (u != 0);
+		if (n < 0)
+			*--p = wxT('-');
+		return wxString(p, end - p);
+	}
+
+	pgsOperand bool_number(const bool &cond)
+	{
+		return pnew pgsNumber((wxLongLong_t)(cond ? 1 : 0));
+	}
+
+}
 
 pgsNumber::pgsNumber(const wxString &data, const bool &is_real) :
 	pgsVariable(!is_real ? pgsVariable::pgsTInt : pgsVariable::pgsTReal),
-	m_data(data.Strip(wxString::both))
+	m_data(data.Strip(wxString::both)), m_has_data(true), m_is_int(false),
+	m_int(0)
 {
+	m_is_int = to_int64(m_data, m_int);
 	wxASSERT(is_valid());
 }
 
+pgsNumber::pgsNumber(const wxLongLong_t &data, const bool &is_real) :
+	pgsVariable(!is_real ? pgsVariable::pgsTInt : pgsVariable::pgsTReal),
+	m_has_data(false), m_is_int(true), m_int(data)
+{
+
+}
+
 bool pgsNumber::is_valid() const
 {
+	if (m_is_int)
+		return true;
 	pgsTypes type = num_type(m_data);
 	return (type == pgsTInt) || (type == pgsTReal && is_real());
 }
@@ -41,7 +162,8 @@ pgsNumber::~pgsNumber()
 }
 
 pgsNumber::pgsNumber(const pgsNumber &that) :
-	pgsVariable(that), m_data(that.m_data)
+	pgsVariable(that), m_data(that.m_data), m_has_data(that.m_has_data),
+	m_is_int(that.m_is_int), m_int(that.m_int)
 {
 	wxASSERT(is_valid());
 }
@@ -52,6 +174,9 @@ pgsNumber &pgsNumber::operator =(const pgsNumber &that)
 	{
 		pgsVariable::operator=(that);
 		m_data = that.m_data;
+		m_has_data = that.m_has_data;
+		m_is_int = that.m_is_int;
+		m_int = that.m_int;
 	}
 
 	wxASSERT(is_valid());
@@ -66,6 +191,11 @@ pgsVariable *pgsNumber::clone() const
 
 wxString pgsNumber::value() const
 {
+	if (!m_has_data)
+	{
+		m_data = int64_str(m_int);
+		m_has_data = true;
+	}
 	return m_data;
 }
 
@@ -74,34 +204,101 @@ pgsOperand pgsNumber::eval(pgsVarMap &vars) const
 	return this->clone();
 }
 
-pgsVariable::pgsTypes pgsNumber::num_type(const wxString &num)
+bool pgsNumber::is_int64() const
 {
-	if (wxRegEx(PGS_INTEGER_FORM_1).Matches(num))
+	return m_is_int;
+}
+
+const wxLongLong_t &pgsNumber::int64() const
+{
+	return m_int;
+}
+
+bool pgsNumber::to_int64(const wxString &num, wxLongLong_t &result)
+{
+	return int64_parse((const wxChar *) num.c_str(), num.Length(), result);
+}
+
+bool pgsNumber::to_int64(const char *num, wxLongLong_t &result)
+{
+	return num != 0 && int64_parse(num, strlen(num), result);
+}
+
+MAPM pgsNumber::mapm() const
+{
+	if (m_is_int && m_int >= LONG_MIN && m_int <= LONG_MAX)
+		return MAPM((long) m_int);
+	else
+		return num(value());
+}
+
+int pgsNumber::compare(const pgsNumber &that) const
+{
+	if (m_is_int && that.m_is_int)
 	{
-		return pgsTInt;
+		return m_int < that.m_int ? -1 : (m_int > that.m_int ? 1 : 0);
 	}
-	else if (( wxRegEx(PGS_REAL_FORM_1).Matches(num)
-	           || wxRegEx(PGS_REAL_FORM_2).Matches(num)
-	           || wxRegEx(PGS_REAL_FORM_3).Matches(num)))
+	else
 	{
-		return pgsTReal;
+		MAPM a = mapm(), b = that.mapm();
+		return a < b ? -1 : (a > b ? 1 : 0);
 	}
-	else
+}
+
+pgsVariable::pgsTypes pgsNumber::num_type(const wxString &num)
+{
+	// Integers are [+-]?[0-9]+ and reals [+-]?[0-9]+[Ee][+-]?[0-9]+,
+	// [+-]?[0-9]*[.][0-9]+([Ee][+-]?[0-9]+)? or
+	// [+-]?[0-9]+[.][0-9]*([Ee][+-]?[0-9]+)?
+	size_t i = 0, n = num.Length();
+	if (i < n && (num[i] == wxT('+') || num[i] == wxT('-')))
+		i++;
+
+	size_t digits = skip_digits(num, i);
+	bool is_real = false;
+	if (i < n && num[i] == wxT('.'))
 	{
+		i++;
+		digits += skip_digits(num, i);
+		is_real = true;
+	}
+	if (digits == 0)
 		return pgsTString;
+
+	if (i < n && (num[i] == wxT('E') || num[i] == wxT('e')))
+	{
+		i++;
+		if (i < n && (num[i] == wxT('+') || num[i] == wxT('-')))
+			i++;
+		if (skip_digits(num, i) == 0)
+			return pgsTString;
+		is_real = true;
 	}
+
+	if (i != n)
+		return pgsTString;
+	return is_real ? pgsTReal : pgsTInt;
 }
 
 pgsOperand pgsNumber::pgs_plus(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-		                      + num(rhs.value())), is_real() || rhs.is_real());
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_plus(rhs.number());
+
+		bool real = is_real() || rhs_op->is_real();
+		wxLongLong_t result;
+		if (m_is_int && rhs_op->m_is_int
+		        && int64_plus(m_int, rhs_op->m_int, result))
+			return pnew pgsNumber(result, real);
+		return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+		                      + rhs_op->mapm()), real);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -109,12 +306,21 @@ pgsOperand pgsNumber::pgs_minus(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-		                      - num(rhs.value())), is_real() || rhs.is_real());
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_minus(rhs.number());
+
+		bool real = is_real() || rhs_op->is_real();
+		wxLongLong_t result;
+		if (m_is_int && rhs_op->m_is_int
+		        && int64_minus(m_int, rhs_op->m_int, result))
+			return pnew pgsNumber(result, real);
+		return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+		                      - rhs_op->mapm()), real);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -122,12 +328,21 @@ pgsOperand pgsNumber::pgs_times(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-		                      * num(rhs.value())), is_real() || rhs.is_real());
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_times(rhs.number());
+
+		bool real = is_real() || rhs_op->is_real();
+		wxLongLong_t result;
+		if (m_is_int && rhs_op->m_is_int
+		        && int64_times(m_int, rhs_op->m_int, result))
+			return pnew pgsNumber(result, real);
+		return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+		                      * rhs_op->mapm()), real);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -135,23 +350,31 @@ pgsOperand pgsNumber::pgs_over(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		if (num(rhs.value()) != 0)
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_over(rhs.number());
+
+		bool real = is_real() || rhs_op->is_real();
+		if (rhs_op->m_is_int ? rhs_op->m_int != 0 : rhs_op->mapm() != 0)
 		{
-			if (is_real() || rhs.is_real())
-				return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-				                      / num(rhs.value())), is_real() || rhs.is_real());
+			if (real)
+				return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+				                      / rhs_op->mapm()), real);
+			else if (m_is_int && rhs_op->m_is_int
+			         && !(m_int == int64_min && rhs_op->m_int == -1))
+				return pnew pgsNumber(m_int / rhs_op->m_int, real);
 			else
-				return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-				                      .div(num(rhs.value()))), is_real() || rhs.is_real());
+				return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+				                      .div(rhs_op->mapm())), real);
 		}
 		else
 		{
-			throw pgsArithmeticException(m_data, rhs.value());
+			throw pgsArithmeticException(value(), rhs.value());
 		}
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -159,19 +382,26 @@ pgsOperand pgsNumber::pgs_modulo(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		if (num(rhs.value()) != 0)
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_modulo(rhs.number());
+
+		bool real = is_real() || rhs_op->is_real();
+		if (rhs_op->m_is_int ? rhs_op->m_int != 0 : rhs_op->mapm() != 0)
 		{
-			return pnew pgsNumber(pgsMapm::pgs_mapm_str(num(m_data)
-			                      % num(rhs.value())), is_real() || rhs.is_real());
+			if (m_is_int && rhs_op->m_is_int && rhs_op->m_int != -1)
+				return pnew pgsNumber(m_int % rhs_op->m_int, real);
+			return pnew pgsNumber(pgsMapm::pgs_mapm_str(mapm()
+			                      % rhs_op->mapm()), real);
 		}
 		else
 		{
-			throw pgsArithmeticException(m_data, rhs.value());
+			throw pgsArithmeticException(value(), rhs.value());
 		}
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -179,12 +409,14 @@ pgsOperand pgsNumber::pgs_equal(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) == num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_equal(rhs.number());
+		return bool_number(compare(*rhs_op) == 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -192,12 +424,14 @@ pgsOperand pgsNumber::pgs_different(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) != num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_different(rhs.number());
+		return bool_number(compare(*rhs_op) != 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -205,12 +439,14 @@ pgsOperand pgsNumber::pgs_greater(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) > num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_greater(rhs.number());
+		return bool_number(compare(*rhs_op) > 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -218,12 +454,14 @@ pgsOperand pgsNumber::pgs_lower(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) < num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_lower(rhs.number());
+		return bool_number(compare(*rhs_op) < 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -231,12 +469,14 @@ pgsOperand pgsNumber::pgs_lower_equal(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) <= num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_lower_equal(rhs.number());
+		return bool_number(compare(*rhs_op) <= 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
@@ -244,23 +484,27 @@ pgsOperand pgsNumber::pgs_greater_equal(const pgsVariable &rhs) const
 {
 	if (rhs.is_number())
 	{
-		return pnew pgsNumber(num(m_data) >= num(rhs.value())
-		                      ? wxT("1") : wxT("0"));
+		const pgsNumber *rhs_op = dynamic_cast<const pgsNumber *>(&rhs);
+		if (rhs_op == 0)
+			return pgs_greater_equal(rhs.number());
+		return bool_number(compare(*rhs_op) >= 0);
 	}
 	else
 	{
-		throw pgsArithmeticException(m_data, rhs.value());
+		throw pgsArithmeticException(value(), rhs.value());
 	}
 }
 
 pgsOperand pgsNumber::pgs_not() const
 {
-	return pnew pgsNumber(num(m_data) == 0 ? wxT("1") : wxT("0"));
+	return bool_number(!pgs_is_true());
 }
 
 bool pgsNumber::pgs_is_true() const
 {
-	return (num(m_data) != 0 ? true : false);
+	if (m_is_int)
+		return m_int != 0;
+	return (mapm() != 0 ? true : false);
 }
 
 pgsOperand pgsNumber::pgs_almost_equal(const pgsVariable &rhs) const
@@ -282,5 +526,5 @@ pgsRecord pgsNumber::record() const
 
 pgsString pgsNumber::string() const
 {
-	return pgsString(m_data);
+	return pgsString(value());
 }
@@ -11,7 +11,6 @@
 #include "pgAdmin3.h"
 #include "pgscript/objects/pgsRecord.h"
 
-#include "pgscript/expressions/pgsEqual.h"
 #include "pgscript/objects/pgsNumber.h"
 #include "pgscript/objects/pgsString.h"
 #include "pgscript/exceptions/pgsArithmeticException.h"
@@ -20,12 +19,224 @@
 #include <wx/arrimpl.cpp>
 
 WX_DEFINE_OBJARRAY(pgsVectorRecordLine);
-WX_DEFINE_OBJARRAY(pgsVectorRecord);
+WX_DEFINE_OBJARRAY(pgsVectorRecordColumns);
+
+namespace
+{
+
+	// Appends len zero bytes. Grows the buffer geometrically because lines
+	// are often added one at a time.
+	void append_zeros(wxMemoryBuffer &buffer, const size_t &len)
+	{
+		size_t size = buffer.GetDataLen() + len;
+		if (size > buffer.GetBufSize())
+		{
+			buffer.SetBufSize(wxMax(size, buffer.GetBufSize() * 2));
+		}
+		memset(buffer.GetAppendBuf(len), 0, len);
+		buffer.UngetAppendBuf(len);
+	}
+
+	// Copies of a wxMemoryBuffer share its data
+	void copy_buffer(wxMemoryBuffer &dest, const wxMemoryBuffer &src)
+	{
+		dest = wxMemoryBuffer(src.GetDataLen());
+		if (src.GetDataLen() > 0)
+		{
+			dest.AppendData(src.GetData(), src.GetDataLen());
+		}
+	}
+
+}
+
+pgsRecordColumn::pgsRecordColumn()
+{
+
+}
+
+pgsRecordColumn::pgsRecordColumn(const pgsRecordColumn &that) :
+	m_texts(that.m_texts), m_operands(that.m_operands),
+	m_free_operands(that.m_free_operands)
+{
+	copy_buffer(m_kinds, that.m_kinds);
+	copy_buffer(m_ints, that.m_ints);
+}
+
+pgsRecordColumn &pgsRecordColumn::operator =(const pgsRecordColumn &that)
+{
+	if (this != &that)
+	{
+		copy_buffer(m_kinds, that.m_kinds);
+		copy_buffer(m_ints, that.m_ints);
+		m_texts = that.m_texts;
+		m_operands = that.m_operands;
+		m_free_operands = that.m_free_operands;
+	}
+
+	return (*this);
+}
+
+unsigned char *pgsRecordColumn::kinds() const
+{
+	return (unsigned char *) m_kinds.GetData();
+}
+
+wxLongLong_t *pgsRecordColumn::ints() const
+{
+	return (wxLongLong_t *) m_ints.GetData();
+}
+
+void pgsRecordColumn::release_operand(const size_t &line)
+{
+	if (kinds()[line] == pgsKOperand)
+	{
+		size_t slot = (size_t) ints()[line];
+		m_operands[slot] = pgsOperand();
+		if (slot + 1 == m_operands.GetCount())
+		{
+			m_operands.RemoveAt(slot);
+		}
+		else
+		{
+			m_free_operands.Add((long) slot);
+		}
+		kinds()[line] = pgsKString;
+	}
+}
+
+size_t pgsRecordColumn::count() const
+{
+	return m_texts.GetCount();
+}
+
+void pgsRecordColumn::add_lines(const size_t &nb_lines)
+{
+	if (nb_lines > 0)
+	{
+		// Zero is pgsKString
+		append_zeros(m_kinds, nb_lines);
+		append_zeros(m_ints, nb_lines * sizeof(wxLongLong_t));
+		m_texts.Add(wxEmptyString, nb_lines);
+	}
+}
+
+void pgsRecordColumn::remove_line(const size_t &line)
+{
+	release_operand(line);
+	size_t after = count() - line - 1;
+	memmove(kinds() + line, kinds() + line + 1, after);
+	m_kinds.SetDataLen(m_kinds.GetDataLen() - 1);
+	memmove(ints() + line, ints() + line + 1, after * sizeof(wxLongLong_t));
+	m_ints.SetDataLen(m_ints.GetDataLen() - sizeof(wxLongLong_t));
+	m_texts.RemoveAt(line);
+}
+
+void pgsRecordColumn::set(const size_t &line, const pgsOperand &value)
+{
+	const pgsNumber *number = dynamic_cast<const pgsNumber *>(value.get());
+	if (number != 0 && number->is_integer() && number->is_int64())
+	{
+		set_int(line, number->int64());
+	}
+	else if (number != 0 && number->is_real())
+	{
+		set_text(line, number->value(), pgsKReal);
+	}
+	else if (dynamic_cast<const pgsString *>(value.get()) != 0)
+	{
+		set_text(line, value->value(), pgsKString);
+	}
+	else
+	{
+		if (kinds()[line] == pgsKOperand)
+		{
+			m_operands[(size_t) ints()[line]] = value;
+		}
+		else if (!m_free_operands.IsEmpty())
+		{
+			size_t last = m_free_operands.GetCount() - 1;
+			kinds()[line] = pgsKOperand;
+			ints()[line] = m_free_operands[last];
+			m_operands[(size_t) m_free_operands[last]] = value;
+			m_free_operands.RemoveAt(last);
+		}
+		else
+		{
+			kinds()[line] = pgsKOperand;
+			ints()[line] = m_operands.GetCount();
+			m_operands.Add(value);
+		}
+		m_texts[line].Empty();
+	}
+}
+
+void pgsRecordColumn::set_int(const size_t &line, const wxLongLong_t &value)
+{
+	release_operand(line);
+	kinds()[line] = pgsKInt;
+	ints()[line] = value;
+	m_texts[line].Empty();
+}
+
+void pgsRecordColumn::set_text(const size_t &line, const wxString &text,
+                               const pgsKinds &kind)
+{
+	wxASSERT(kind == pgsKString || kind == pgsKReal);
+	release_operand(line);
+	kinds()[line] = kind;
+	m_texts[line] = text;
+}
+
+pgsOperand pgsRecordColumn::get(const size_t &line) const
+{
+	switch (kinds()[line])
+	{
+		case pgsKInt:
+			return pnew pgsNumber(ints()[line], pgsInt);
+		case pgsKReal:
+			return pnew pgsNumber(m_texts[line], pgsReal);
+		case pgsKOperand:
+			return m_operands[(size_t) ints()[line]];
+		default:
+			return pnew pgsString(m_texts[line]);
+	}
+}
+
+wxString pgsRecordColumn::value(const size_t &line) const
+{
+	switch (kinds()[line])
+	{
+		case pgsKInt:
+			return pgsNumber(ints()[line], pgsInt).value();
+		case pgsKOperand:
+			return m_operands[(size_t) ints()[line]]->value();
+		default:
+			return m_texts[line];
+	}
+}
+
+bool pgsRecordColumn::is_number(const size_t &line) const
+{
+	switch (kinds()[line])
+	{
+		case pgsKInt:
+		case pgsKReal:
+			return true;
+		case pgsKOperand:
+			return m_operands[(size_t) ints()[line]]->is_number();
+		default:
+			return false;
+	}
+}
 
 pgsRecord::pgsRecord(const USHORT &nb_columns) :
-	pgsVariable(pgsVariable::pgsTRecord)
+	pgsVariable(pgsVariable::pgsTRecord), m_nb_lines(0)
 {
 	m_columns.SetCount(nb_columns);
+	if (nb_columns > 0)
+	{
+		m_record.Add(pgsRecordColumn(), nb_columns);
+	}
 }
 
 pgsRecord::~pgsRecord()
@@ -41,18 +252,17 @@ pgsVariable *pgsRecord::clone() const
 wxString pgsRecord::value() const
 {
 	wxString data;
-	pgsVarMap vars;
 
 	// Go through each line and enclose it into braces
-	for (USHORT i = 0; i < count_lines(); i++)
+	for (wxLongLong_t i = 0; i < count_lines(); i++)
 	{
 		data += wxT("(");
 
 		// Go through each column and separate them with commas
 		for (USHORT j = 0; j < count_columns(); j++)
 		{
-			wxString elm(m_record[i][j]->eval(vars)->value());
-			if (!m_record[i][j]->is_number())
+			wxString elm(m_record[j].value((size_t) i));
+			if (!m_record[j].is_number((size_t) i))
 			{
 				elm.Replace(wxT("\\"), wxT("\\\\"));
 				elm.Replace(wxT("\""), wxT("\\\""));
@@ -73,9 +283,9 @@ pgsOperand pgsRecord::eval(pgsVarMap &vars) const
 	return this->clone();
 }
 
-USHORT pgsRecord::count_lines() const
+wxLongLong_t pgsRecord::count_lines() const
 {
-	return m_record.GetCount();
+	return m_nb_lines;
 }
 
 USHORT pgsRecord::count_columns() const
@@ -83,13 +293,18 @@ USHORT pgsRecord::count_columns() const
 	return m_columns.GetCount();
 }
 
-bool pgsRecord::insert(const USHORT &line, const USHORT &column,
+bool pgsRecord::insert(const wxLongLong_t &line, const USHORT &column,
                        pgsOperand value)
 {
+	if (line < 0 || line - count_lines() >= max_growth)
+	{
+		return false;
+	}
+
 	// Add lines to match the line number provided
-	for (USHORT i = count_lines(); i <= line; i++)
+	if (line >= count_lines())
 	{
-		newline();
+		add_lines(line - count_lines() + 1);
 	}
 
 	// Cannot insert if column is invalid
@@ -100,17 +315,41 @@ bool pgsRecord::insert(const USHORT &line, const USHORT &column,
 	// Insert the value at line.column
 	else
 	{
-		m_record[line][column] = value;
+		m_record[column].set((size_t) line, value);
 		return true;
 	}
 }
 
-pgsOperand pgsRecord::get(const USHORT &line,
+void pgsRecord::add_lines(const wxLongLong_t &nb_lines)
+{
+	for (USHORT i = 0; i < count_columns(); i++)
+	{
+		m_record[i].add_lines((size_t) nb_lines);
+	}
+	m_nb_lines += nb_lines;
+}
+
+void pgsRecord::set_int(const wxLongLong_t &line, const USHORT &column,
+                        const wxLongLong_t &value)
+{
+	wxASSERT(line >= 0 && line < count_lines() && column < count_columns());
+	m_record[column].set_int((size_t) line, value);
+}
+
+void pgsRecord::set_text(const wxLongLong_t &line, const USHORT &column,
+                         const wxString &text, const bool &is_real)
+{
+	wxASSERT(line >= 0 && line < count_lines() && column < count_columns());
+	m_record[column].set_text((size_t) line, text, is_real
+	                          ? pgsRecordColumn::pgsKReal : pgsRecordColumn::pgsKString);
+}
+
+pgsOperand pgsRecord::get(const wxLongLong_t &line,
                           const USHORT &column) const
 {
-	if (line < count_lines() && column < count_columns())
+	if (line >= 0 && line < count_lines() && column < count_columns())
 	{
-		return m_record[line][column];
+		return m_record[column].get((size_t) line);
 	}
 	else
 	{
@@ -118,14 +357,17 @@ pgsOperand pgsRecord::get(const USHORT &line,
 	}
 }
 
-pgsOperand pgsRecord::get_line(const USHORT &line) const
+pgsOperand pgsRecord::get_line(const wxLongLong_t &line) const
 {
-	if (line < count_lines())
+	if (line >= 0 && line < count_lines())
 	{
 		pgsRecord *rec = pnew pgsRecord(count_columns());
 		rec->m_columns = this->m_columns;
 		rec->newline();
-		rec->m_record[0] = this->m_record[line];
+		for (USHORT i = 0; i < count_columns(); i++)
+		{
+			rec->m_record[i].set(0, m_record[i].get((size_t) line));
+		}
 		return rec;
 	}
 	else
@@ -171,11 +413,15 @@ USHORT pgsRecord::get_column(wxString name) const
 	return count_columns();
 }
 
-bool pgsRecord::remove_line(const USHORT &line)
+bool pgsRecord::remove_line(const wxLongLong_t &line)
 {
-	if (line < count_lines())
+	if (line >= 0 && line < count_lines())
 	{
-		m_record.RemoveAt(line);
+		for (USHORT i = 0; i < count_columns(); i++)
+		{
+			m_record[i].remove_line((size_t) line);
+		}
+		--m_nb_lines;
 		return true;
 	}
 	return false;
@@ -183,13 +429,8 @@ bool pgsRecord::remove_line(const USHORT &line)
 
 bool pgsRecord::newline()
 {
-	// Insert a line
-	m_record.Add(pgsVectorRecordLine());
-	// Initialize each column of the line with an empty string
-	for (USHORT i = 0; i < count_columns(); i++)
-	{
-		m_record.Last().Add(pnew pgsString(wxT("")));
-	}
+	// Insert a line of empty strings
+	add_lines(1);
 	return true;
 }
 
@@ -267,26 +508,19 @@ bool pgsRecord::records_equal(const pgsRecord &lhs, const pgsRecord &rhs,
 	}
 
 	// Test each line
-	wxArrayInt seen;
-	for (USHORT i = 0; i < lhs.count_lines(); i++)
+	wxArrayShort seen;
+	seen.Add(0, (size_t) rhs.count_lines());
+	for (size_t i = 0; i < (size_t) lhs.count_lines(); i++)
 	{
 		bool result = false;
 
 		// Test if the line of lhs matches with an unseen line of rhs
-		for (USHORT j = 0; result == false && j < rhs.count_lines(); j++)
+		for (size_t j = 0; result == false && j < seen.GetCount(); j++)
 		{
-			int k = wx_static_cast(int, j);
-			if (seen.Index(k) == wxNOT_FOUND
-			        && lines_equal(lhs.m_record[i], rhs.m_record[j],
-			                       case_sensitive))
+			if (seen[j] == 0 && lines_equal(lhs, i, rhs, j, case_sensitive))
 			{
 				result = true;
-				seen.push_back(k);
-			}
-			else
-			{
-				// This is not OK... Continue with the next element
-				continue;
+				seen[j] = 1;
 			}
 		}
 
@@ -294,38 +528,21 @@ bool pgsRecord::records_equal(const pgsRecord &lhs, const pgsRecord &rhs,
 		{
 			return false;
 		}
-		else
-		{
-			continue;
-		}
 	}
 
 	return true; // End of the test
 }
 
-bool pgsRecord::lines_equal(const pgsVectorRecordLine &lhs,
-                            const pgsVectorRecordLine &rhs, bool case_sensitive) const
+bool pgsRecord::lines_equal(const pgsRecord &lhs, const size_t &lhs_line,
+                            const pgsRecord &rhs, const size_t &rhs_line,
+                            bool case_sensitive) const
 {
-	pgsVarMap vars;
-
-	// Both lines must have the same number of columns
-	if (lhs.GetCount() != rhs.GetCount())
-	{
-		return false;
-	}
-
-	// Test each element (column) of the line
-	for (USHORT j = 0; j < wx_static_cast(USHORT, lhs.GetCount()); j++)
+	// Test each element (column) of the line, compared as strings
+	for (USHORT j = 0; j < lhs.count_columns(); j++)
 	{
-		// Test if the two elements are equal
-		pgsEqual test(lhs[j]->string().clone(), rhs[j]->string().clone(),
-		              case_sensitive);
-		if (test.eval(vars)->value() == wxT("1"))
-		{
-			// lhs == rhs: continue
-			continue;
-		}
-		else
+		wxString left(lhs.m_record[j].value(lhs_line));
+		wxString right(rhs.m_record[j].value(rhs_line));
+		if (case_sensitive ? left != right : left.CmpNoCase(right) != 0)
 		{
 			// lhs != rhs: lines are not equal
 			return false;
@@ -3,47 +3,71 @@
 #pragma warning(disable: 4800)
 #endif
 
-/* A Bison parser, made by GNU Bison 2.3.  */
+// A Bison parser, made by GNU Bison 3.8.2.
 
-/* Skeleton implementation for Bison LALR(1) parsers in C++
+// Skeleton implementation for Bison LALR(1) parsers in C++
 
-   Copyright (C) 2002, 2003, 2004, 2005, 2006 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
-   This program is free software; you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
 
-   You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
-/* As a special exception, you may create a larger work that contains
-   part or all of the Bison parser skeleton and distribute that work
-   under terms of your choice, so long as that work isn't itself a
-   parser generator using the skeleton or a modified version thereof
-   as a parser skeleton.  Alternatively, if you modify or redistribute
-   the parser skeleton itself, you may (at your option) remove this
-   special exception, which will cause the skeleton and the resulting
-   Bison output files to be licensed under the GNU General Public
-   License without this special exception.
+// As a special exception, you may create a larger work that contains
+// part or all of the Bison parser skeleton and distribute that work
+// under terms of your choice, so long as that work isn't itself a
+// parser generator using the skeleton or a modified version thereof
+// as a parser skeleton.  Alternatively, if you modify or redistribute
+// the parser skeleton itself, you may (at your option) remove this
+// special exception, which will cause the skeleton and the resulting
+// Bison output files to be licensed under the GNU General Public
+// License without this special exception.
 
-   This special exception was added by the Free Software Foundation in
-   version 2.2 of Bison.  */
+// This special exception was added by the Free Software Foundation in
+// version 2.2 of Bison.
+
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
+
+// First part of user prologue.
+#line 1 "pgscript/pgsParser.yy"
+ /*** C/C++ Declarations ***/
+	
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+// 
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+#include "pgscript/pgScript.h"
+#include "pgscript/statements/pgsStatements.h"
+#include "pgscript/expressions/pgsExpressions.h"
+#include "pgscript/objects/pgsObjects.h"
+#include "pgscript/utilities/pgsContext.h"
+
+
+#line 60 "pgscript/parser.tab.cc"
 
-// Take the name prefix into account.
-#define yylex   pgscriptlex
 
 #include "pgscript/parser.tab.hh"
 
-/* User implementation prologue.  */
-#line 251 "pgscript/pgsParser.yy"
+// Second part of user prologue.
+#line 255 "pgscript/pgsParser.yy"
 
 
 #include "pgscript/utilities/pgsDriver.h"
@@ -56,14 +80,14 @@
 #define yylex driver.lexer->lex
 
 
+#line 79 "pgscript/parser.tab.cc"
+
 
-/* Line 317 of lalr1.cc.  */
-#line 57 "pgscript/parser.tab.cc"
 
 #ifndef YY_
-# if YYENABLE_NLS
+# if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
-#   include <libintl.h> /* FIXME: INFRINGES ON USER NAME SPACE */
+#   include <libintl.h> // FIXME: INFRINGES ON USER NAME SPACE.
 #   define YY_(msgid) dgettext ("bison-runtime", msgid)
 #  endif
 # endif
@@ -72,403 +96,633 @@
 # endif
 #endif
 
-/* Suppress unused-variable warnings by "using" E.  */
-#define YYUSE(e) ((void) (e))
 
-/* A pseudo ostream that takes yydebug_ into account.  */
-# define YYCDEBUG							\
-  for (bool yydebugcond_ = yydebug_; yydebugcond_; yydebugcond_ = false)	\
-    (*yycdebug_)
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
+#define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
+/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
+   If N is 0, then set CURRENT to the empty location which ends
+   the previous symbol: RHS[0] (always defined).  */
+
+# ifndef YYLLOC_DEFAULT
+#  define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do                                                                  \
+      if (N)                                                            \
+        {                                                               \
+          (Current).begin  = YYRHSLOC (Rhs, 1).begin;                   \
+          (Current).end    = YYRHSLOC (Rhs, N).end;                     \
+        }                                                               \
+      else                                                              \
+        {                                                               \
+          (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
+        }                                                               \
+    while (false)
+# endif
+
 
-/* Enable debugging if requested.  */
+// Enable debugging if requested.
 #if YYDEBUG
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)	\
-do {							\
-  if (yydebug_)						\
-    {							\
-      *yycdebug_ << Title << ' ';			\
-      yy_symbol_print_ ((Type), (Value), (Location));	\
-      *yycdebug_ << std::endl;				\
-    }							\
-} while (false)
-
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug_)				\
-    yy_reduce_print_ (Rule);		\
-} while (false)
-
-# define YY_STACK_PRINT()		\
-do {					\
-  if (yydebug_)				\
-    yystack_print_ ();			\
-} while (false)
-
-#else /* !YYDEBUG */
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
-# define YY_REDUCE_PRINT(Rule)
-# define YY_STACK_PRINT()
-
-#endif /* !YYDEBUG */
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
-namespace pgscript
-{
-#if YYERROR_VERBOSE
+// A pseudo ostream that takes yydebug_ into account.
+# define YYCDEBUG if (yydebug_) (*yycdebug_)
 
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  pgsParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
+# define YY_SYMBOL_PRINT(Title, Symbol)         \
+  do {                                          \
+    if (yydebug_)                               \
+    {                                           \
+      *yycdebug_ << Title << ' ';               \
+      yy_print_ (*yycdebug_, Symbol);           \
+      *yycdebug_ << '\n';                       \
+    }                                           \
+  } while (false)
 
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
+# define YY_REDUCE_PRINT(Rule)          \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_reduce_print_ (Rule);          \
+  } while (false)
 
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              /* Fall through.  */
-            default:
-              yyr += *yyp;
-              break;
+# define YY_STACK_PRINT()               \
+  do {                                  \
+    if (yydebug_)                       \
+      yy_stack_print_ ();                \
+  } while (false)
 
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
+#else // !YYDEBUG
 
-    return yystr;
-  }
+# define YYCDEBUG if (false) std::cerr
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
-#endif
+#endif // !YYDEBUG
+
+#define yyerrok         (yyerrstatus_ = 0)
+#define yyclearin       (yyla.clear ())
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYRECOVERING()  (!!yyerrstatus_)
+
+#line 37 "pgscript/pgsParser.yy"
+namespace pgscript {
+#line 173 "pgscript/parser.tab.cc"
 
   /// Build a parser object.
   pgsParser::pgsParser (class pgsDriver & driver_yyarg)
+#if YYDEBUG
     : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
+#endif
       driver (driver_yyarg)
+  {}
+
+  pgsParser::~pgsParser ()
+  {}
+
+  pgsParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
+
+  /*---------.
+  | symbol.  |
+  `---------*/
+
+  // basic_symbol.
+  template <typename Base>
+  pgsParser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value (that.value)
+    , location (that.location)
+  {}
+
+
+  /// Constructor for valueless symbols.
+  template <typename Base>
+  pgsParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_MOVE_REF (location_type) l)
+    : Base (t)
+    , value ()
+    , location (l)
+  {}
+
+  template <typename Base>
+  pgsParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, YY_RVREF (value_type) v, YY_RVREF (location_type) l)
+    : Base (t)
+    , value (YY_MOVE (v))
+    , location (YY_MOVE (l))
+  {}
+
+
+  template <typename Base>
+  pgsParser::symbol_kind_type
+  pgsParser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
+    return this->kind ();
   }
 
-  pgsParser::~pgsParser ()
+
+  template <typename Base>
+  bool
+  pgsParser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
-#if YYDEBUG
-  /*--------------------------------.
-  | Print this symbol on YYOUTPUT.  |
-  `--------------------------------*/
+  template <typename Base>
+  void
+  pgsParser::basic_symbol<Base>::move (basic_symbol& s)
+  {
+    super_type::move (s);
+    value = YY_MOVE (s.value);
+    location = YY_MOVE (s.location);
+  }
 
-  inline void
-  pgsParser::yy_symbol_value_print_ (int yytype,
-			   const semantic_type* yyvaluep, const location_type* yylocationp)
+  // by_kind.
+  pgsParser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
+
+#if 201103L <= YY_CPLUSPLUS
+  pgsParser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    YYUSE (yylocationp);
-    YYUSE (yyvaluep);
-    switch (yytype)
-      {
-         default:
-	  break;
-      }
+    that.clear ();
   }
+#endif
+
+  pgsParser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
+
+  pgsParser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
 
 
   void
-  pgsParser::yy_symbol_print_ (int yytype,
-			   const semantic_type* yyvaluep, const location_type* yylocationp)
+  pgsParser::by_kind::clear () YY_NOEXCEPT
   {
-    *yycdebug_ << (yytype < yyntokens_ ? "token" : "nterm")
-	       << ' ' << yytname_[yytype] << " ("
-	       << *yylocationp << ": ";
-    yy_symbol_value_print_ (yytype, yyvaluep, yylocationp);
-    *yycdebug_ << ')';
+    kind_ = symbol_kind::S_YYEMPTY;
   }
-#endif /* ! YYDEBUG */
 
   void
-  pgsParser::yydestruct_ (const char* yymsg,
-			   int yytype, semantic_type* yyvaluep, location_type* yylocationp)
+  pgsParser::by_kind::move (by_kind& that)
+  {
+    kind_ = that.kind_;
+    that.clear ();
+  }
+
+  pgsParser::symbol_kind_type
+  pgsParser::by_kind::kind () const YY_NOEXCEPT
   {
-    YYUSE (yylocationp);
-    YYUSE (yymsg);
-    YYUSE (yyvaluep);
+    return kind_;
+  }
 
-    YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
 
-    switch (yytype)
-      {
-        case 42: /* "\"ABORT\"" */
-#line 167 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 217 "pgscript/parser.tab.cc"
-	break;
-      case 43: /* "\"ALTER\"" */
-#line 168 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 222 "pgscript/parser.tab.cc"
-	break;
-      case 44: /* "\"ANALYZE\"" */
-#line 169 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 227 "pgscript/parser.tab.cc"
-	break;
-      case 45: /* "\"BEGIN\"" */
+  pgsParser::symbol_kind_type
+  pgsParser::by_kind::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
+
+  // by_state.
+  pgsParser::by_state::by_state () YY_NOEXCEPT
+    : state (empty_state)
+  {}
+
+  pgsParser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
+  {}
+
+  void
+  pgsParser::by_state::clear () YY_NOEXCEPT
+  {
+    state = empty_state;
+  }
+
+  void
+  pgsParser::by_state::move (by_state& that)
+  {
+    state = that.state;
+    that.clear ();
+  }
+
+  pgsParser::by_state::by_state (state_type s) YY_NOEXCEPT
+    : state (s)
+  {}
+
+  pgsParser::symbol_kind_type
+  pgsParser::by_state::kind () const YY_NOEXCEPT
+  {
+    if (state == empty_state)
+      return symbol_kind::S_YYEMPTY;
+    else
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
+  }
+
+  pgsParser::stack_symbol_type::stack_symbol_type ()
+  {}
+
+  pgsParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.value), YY_MOVE (that.location))
+  {
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  pgsParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.value), YY_MOVE (that.location))
+  {
+    // that is emptied.
+    that.kind_ = symbol_kind::S_YYEMPTY;
+  }
+
+#if YY_CPLUSPLUS < 201103L
+  pgsParser::stack_symbol_type&
+  pgsParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    value = that.value;
+    location = that.location;
+    return *this;
+  }
+
+  pgsParser::stack_symbol_type&
+  pgsParser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    value = that.value;
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
+
+  template <typename Base>
+  void
+  pgsParser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
+  {
+    if (yymsg)
+      YY_SYMBOL_PRINT (yymsg, yysym);
+
+    // User destructor.
+    switch (yysym.kind ())
+    {
+      case symbol_kind::S_PGS_ABORT: // "ABORT"
 #line 170 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 232 "pgscript/parser.tab.cc"
-	break;
-      case 46: /* "\"CHECKPOINT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 385 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_ALTER: // "ALTER"
 #line 171 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 237 "pgscript/parser.tab.cc"
-	break;
-      case 47: /* "\"CLOSE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 391 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_ANALYZE: // "ANALYZE"
 #line 172 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 242 "pgscript/parser.tab.cc"
-	break;
-      case 48: /* "\"CLUSTER\"" */
+                    { pdelete((yysym.value.str)); }
+#line 397 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_BEGIN: // "BEGIN"
 #line 173 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 247 "pgscript/parser.tab.cc"
-	break;
-      case 49: /* "\"COMMENT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 403 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_CHECKPOINT: // "CHECKPOINT"
 #line 174 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 252 "pgscript/parser.tab.cc"
-	break;
-      case 50: /* "\"COMMIT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 409 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_CLOSE_ST: // "CLOSE"
 #line 175 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 257 "pgscript/parser.tab.cc"
-	break;
-      case 51: /* "\"COPY\"" */
+                    { pdelete((yysym.value.str)); }
+#line 415 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_CLUSTER: // "CLUSTER"
 #line 176 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 262 "pgscript/parser.tab.cc"
-	break;
-      case 52: /* "\"CREATE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 421 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_COMMENT: // "COMMENT"
 #line 177 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 267 "pgscript/parser.tab.cc"
-	break;
-      case 53: /* "\"DEALLOCATE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 427 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_COMMIT: // "COMMIT"
 #line 178 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 272 "pgscript/parser.tab.cc"
-	break;
-      case 54: /* "\"DECLARE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 433 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_COPY: // "COPY"
 #line 179 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 277 "pgscript/parser.tab.cc"
-	break;
-      case 55: /* "\"DELETE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 439 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_CREATE: // "CREATE"
 #line 180 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 282 "pgscript/parser.tab.cc"
-	break;
-      case 56: /* "\"DISCARD\"" */
+                    { pdelete((yysym.value.str)); }
+#line 445 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_DEALLOCATE: // "DEALLOCATE"
 #line 181 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 287 "pgscript/parser.tab.cc"
-	break;
-      case 57: /* "\"DROP\"" */
+                    { pdelete((yysym.value.str)); }
+#line 451 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_DECLARE: // "DECLARE"
 #line 182 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 292 "pgscript/parser.tab.cc"
-	break;
-      case 58: /* "\"END\"" */
+                    { pdelete((yysym.value.str)); }
+#line 457 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_DELETE: // "DELETE"
 #line 183 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 297 "pgscript/parser.tab.cc"
-	break;
-      case 59: /* "\"EXECUTE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 463 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_DISCARD: // "DISCARD"
 #line 184 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 302 "pgscript/parser.tab.cc"
-	break;
-      case 60: /* "\"EXPLAIN\"" */
+                    { pdelete((yysym.value.str)); }
+#line 469 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_DROP: // "DROP"
 #line 185 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 307 "pgscript/parser.tab.cc"
-	break;
-      case 61: /* "\"FETCH\"" */
+                    { pdelete((yysym.value.str)); }
+#line 475 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_END_ST: // "END"
 #line 186 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 312 "pgscript/parser.tab.cc"
-	break;
-      case 62: /* "\"GRANT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 481 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_EXECUTE: // "EXECUTE"
 #line 187 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 317 "pgscript/parser.tab.cc"
-	break;
-      case 63: /* "\"INSERT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 487 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_EXPLAIN: // "EXPLAIN"
 #line 188 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 322 "pgscript/parser.tab.cc"
-	break;
-      case 64: /* "\"LISTEN\"" */
+                    { pdelete((yysym.value.str)); }
+#line 493 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_FETCH: // "FETCH"
 #line 189 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 327 "pgscript/parser.tab.cc"
-	break;
-      case 65: /* "\"LOAD\"" */
+                    { pdelete((yysym.value.str)); }
+#line 499 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_GRANT: // "GRANT"
 #line 190 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 332 "pgscript/parser.tab.cc"
-	break;
-      case 66: /* "\"LOCK\"" */
+                    { pdelete((yysym.value.str)); }
+#line 505 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_INSERT: // "INSERT"
 #line 191 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 337 "pgscript/parser.tab.cc"
-	break;
-      case 67: /* "\"MOVE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 511 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_LISTEN: // "LISTEN"
 #line 192 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 342 "pgscript/parser.tab.cc"
-	break;
-      case 68: /* "\"NOTIFY\"" */
+                    { pdelete((yysym.value.str)); }
+#line 517 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_LOAD: // "LOAD"
 #line 193 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 347 "pgscript/parser.tab.cc"
-	break;
-      case 69: /* "\"PREPARE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 523 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_LOCK: // "LOCK"
 #line 194 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 352 "pgscript/parser.tab.cc"
-	break;
-      case 70: /* "\"REASSIGN\"" */
+                    { pdelete((yysym.value.str)); }
+#line 529 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_MOVE: // "MOVE"
 #line 195 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 357 "pgscript/parser.tab.cc"
-	break;
-      case 71: /* "\"REINDEX\"" */
+                    { pdelete((yysym.value.str)); }
+#line 535 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_NOTIFY: // "NOTIFY"
 #line 196 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 362 "pgscript/parser.tab.cc"
-	break;
-      case 72: /* "\"RELEASE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 541 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_PREPARE: // "PREPARE"
 #line 197 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 367 "pgscript/parser.tab.cc"
-	break;
-      case 73: /* "\"RESET\"" */
+                    { pdelete((yysym.value.str)); }
+#line 547 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_REASSIGN: // "REASSIGN"
 #line 198 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 372 "pgscript/parser.tab.cc"
-	break;
-      case 74: /* "\"REVOKE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 553 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_REINDEX: // "REINDEX"
 #line 199 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 377 "pgscript/parser.tab.cc"
-	break;
-      case 75: /* "\"ROLLBACK\"" */
+                    { pdelete((yysym.value.str)); }
+#line 559 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_RELEASE: // "RELEASE"
 #line 200 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 382 "pgscript/parser.tab.cc"
-	break;
-      case 76: /* "\"SAVEPOINT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 565 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_RESET: // "RESET"
 #line 201 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 387 "pgscript/parser.tab.cc"
-	break;
-      case 77: /* "\"SELECT\"" */
+                    { pdelete((yysym.value.str)); }
+#line 571 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_REVOKE: // "REVOKE"
 #line 202 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 392 "pgscript/parser.tab.cc"
-	break;
-      case 78: /* "\"SET\"" */
+                    { pdelete((yysym.value.str)); }
+#line 577 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_ROLLBACK: // "ROLLBACK"
 #line 203 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 397 "pgscript/parser.tab.cc"
-	break;
-      case 79: /* "\"SHOW\"" */
+                    { pdelete((yysym.value.str)); }
+#line 583 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_SAVEPOINT: // "SAVEPOINT"
 #line 204 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 402 "pgscript/parser.tab.cc"
-	break;
-      case 80: /* "\"START\"" */
+                    { pdelete((yysym.value.str)); }
+#line 589 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_SELECT: // "SELECT"
 #line 205 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 407 "pgscript/parser.tab.cc"
-	break;
-      case 81: /* "\"TRUNCATE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 595 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_SET: // "SET"
 #line 206 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 412 "pgscript/parser.tab.cc"
-	break;
-      case 82: /* "\"UNLISTEN\"" */
+                    { pdelete((yysym.value.str)); }
+#line 601 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_SHOW: // "SHOW"
 #line 207 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 417 "pgscript/parser.tab.cc"
-	break;
-      case 83: /* "\"UPDATE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 607 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_START: // "START"
 #line 208 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 422 "pgscript/parser.tab.cc"
-	break;
-      case 84: /* "\"VACUUM\"" */
+                    { pdelete((yysym.value.str)); }
+#line 613 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_TRUNCATE: // "TRUNCATE"
 #line 209 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 427 "pgscript/parser.tab.cc"
-	break;
-      case 85: /* "\"VALUES\"" */
+                    { pdelete((yysym.value.str)); }
+#line 619 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_UNLISTEN: // "UNLISTEN"
 #line 210 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 432 "pgscript/parser.tab.cc"
-	break;
-      case 86: /* "\"IDENTIFIER\"" */
+                    { pdelete((yysym.value.str)); }
+#line 625 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_UPDATE: // "UPDATE"
+#line 211 "pgscript/pgsParser.yy"
+                    { pdelete((yysym.value.str)); }
+#line 631 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_VACUUM: // "VACUUM"
 #line 212 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 437 "pgscript/parser.tab.cc"
-	break;
-      case 87: /* "\"INTEGER VALUE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 637 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_VALUES: // "VALUES"
 #line 213 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 442 "pgscript/parser.tab.cc"
-	break;
-      case 88: /* "\"REAL VALUE\"" */
-#line 214 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 447 "pgscript/parser.tab.cc"
-	break;
-      case 89: /* "\"STRING VALUE\"" */
+                    { pdelete((yysym.value.str)); }
+#line 643 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_IDENTIFIER: // "IDENTIFIER"
 #line 215 "pgscript/pgsParser.yy"
-	{ pdelete((yyvaluep->str)); };
-#line 452 "pgscript/parser.tab.cc"
-	break;
+                    { pdelete((yysym.value.str)); }
+#line 649 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_VAL_INT: // "INTEGER VALUE"
+#line 216 "pgscript/pgsParser.yy"
+                    { pdelete((yysym.value.str)); }
+#line 655 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_VAL_REAL: // "REAL VALUE"
+#line 217 "pgscript/pgsParser.yy"
+                    { pdelete((yysym.value.str)); }
+#line 661 "pgscript/parser.tab.cc"
+        break;
+
+      case symbol_kind::S_PGS_VAL_STR: // "STRING VALUE"
+#line 218 "pgscript/pgsParser.yy"
+                    { pdelete((yysym.value.str)); }
+#line 667 "pgscript/parser.tab.cc"
+        break;
+
+      default:
+        break;
+    }
+  }
 
-	default:
-	  break;
+#if YYDEBUG
+  template <typename Base>
+  void
+  pgsParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
+  {
+    std::ostream& yyoutput = yyo;
+    YY_USE (yyoutput);
+    if (yysym.empty ())
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        YY_USE (yykind);
+        yyo << ')';
       }
   }
+#endif
+
+  void
+  pgsParser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
+  {
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
+  }
+
+  void
+  pgsParser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
+  {
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
+  }
 
   void
-  pgsParser::yypop_ (unsigned int n)
+  pgsParser::yypop_ (int n) YY_NOEXCEPT
   {
-    yystate_stack_.pop (n);
-    yysemantic_stack_.pop (n);
-    yylocation_stack_.pop (n);
+    yystack_.pop (n);
   }
 
+#if YYDEBUG
   std::ostream&
   pgsParser::debug_stream () const
   {
@@ -493,1434 +747,1648 @@ namespace pgscript
   {
     yydebug_ = l;
   }
+#endif // YYDEBUG
+
+  pgsParser::state_type
+  pgsParser::yy_lr_goto_state_ (state_type yystate, int yysym)
+  {
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
+    if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
+      return yytable_[yyr];
+    else
+      return yydefgoto_[yysym - YYNTOKENS];
+  }
+
+  bool
+  pgsParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yypact_ninf_;
+  }
 
+  bool
+  pgsParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
+  {
+    return yyvalue == yytable_ninf_;
+  }
 
   int
-  pgsParser::parse ()
+  pgsParser::operator() ()
   {
-    /// Look-ahead and look-ahead in internal form.
-    int yychar = yyempty_;
-    int yytoken = 0;
+    return parse ();
+  }
 
-    /* State.  */
+  int
+  pgsParser::parse ()
+  {
     int yyn;
+    /// Length of the RHS of the rule being reduced.
     int yylen = 0;
-    int yystate = 0;
 
-    /* Error handling.  */
+    // Error handling.
     int yynerrs_ = 0;
     int yyerrstatus_ = 0;
 
-    /// Semantic value of the look-ahead.
-    semantic_type yylval;
-    /// Location of the look-ahead.
-    location_type yylloc;
-    /// The locations where the error started and ended.
-    location yyerror_range[2];
+    /// The lookahead symbol.
+    symbol_type yyla;
 
-    /// $$.
-    semantic_type yyval;
-    /// @$.
-    location_type yyloc;
+    /// The locations where the error started and ended.
+    stack_symbol_type yyerror_range[3];
 
+    /// The return value of parse ().
     int yyresult;
 
-    YYCDEBUG << "Starting parse" << std::endl;
+#if YY_EXCEPTIONS
+    try
+#endif // YY_EXCEPTIONS
+      {
+    YYCDEBUG << "Starting parse\n";
 
 
-    /* User initialization code.  */
-    #line 43 "pgscript/pgsParser.yy"
+    // User initialization code.
+#line 45 "pgscript/pgsParser.yy"
 {
 	// Initialize the initial location object
-	yylloc.begin.filename = yylloc.end.filename;
+	yyla.location.begin.filename = yyla.location.end.filename;
 }
-  /* Line 547 of yacc.c.  */
-#line 534 "pgscript/parser.tab.cc"
-    /* Initialize the stacks.  The initial state will be pushed in
+
+#line 810 "pgscript/parser.tab.cc"
+
+
+    /* Initialize the stack.  The initial state will be set in
        yynewstate, since the latter expects the semantical and the
        location values to have been already stored, initialize these
        stacks with a primary value.  */
-    yystate_stack_ = state_stack_type (0);
-    yysemantic_stack_ = semantic_stack_type (0);
-    yylocation_stack_ = location_stack_type (0);
-    yysemantic_stack_.push (yylval);
-    yylocation_stack_.push (yylloc);
+    yystack_.clear ();
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    /* New state.  */
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    yystate_stack_.push (yystate);
-    YYCDEBUG << "Entering state " << yystate << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
+
+    // Accept?
+    if (yystack_[0].state == yyfinal_)
+      YYACCEPT;
+
     goto yybackup;
 
-    /* Backup.  */
-  yybackup:
 
-    /* Try to take a decision without look-ahead.  */
-    yyn = yypact_[yystate];
-    if (yyn == yypact_ninf_)
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
+    // Try to take a decision without lookahead.
+    yyn = yypact_[+yystack_[0].state];
+    if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
-    /* Read a look-ahead token.  */
-    if (yychar == yyempty_)
+    // Read a lookahead token.
+    if (yyla.empty ())
       {
-	YYCDEBUG << "Reading a token: ";
-	yychar = yylex (&yylval, &yylloc);
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
+        try
+#endif // YY_EXCEPTIONS
+          {
+            yyla.kind_ = yytranslate_ (yylex (&yyla.value, &yyla.location));
+          }
+#if YY_EXCEPTIONS
+        catch (const syntax_error& yyexc)
+          {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+            error (yyexc);
+            goto yyerrlab1;
+          }
+#endif // YY_EXCEPTIONS
       }
+    YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
 
-    /* Convert token to internal form.  */
-    if (yychar <= yyeof_)
-      {
-	yychar = yytoken = yyeof_;
-	YYCDEBUG << "Now at end of input." << std::endl;
-      }
-    else
+    /* If the proper action on seeing token YYLA.TYPE is to reduce or
+       to detect an error, take that action.  */
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
       {
-	yytoken = yytranslate_ (yychar);
-	YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+        goto yydefault;
       }
 
-    /* If the proper action on seeing token YYTOKEN is to reduce or to
-       detect an error, take that action.  */
-    yyn += yytoken;
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yytoken)
-      goto yydefault;
-
-    /* Reduce or error.  */
+    // Reduce or error.
     yyn = yytable_[yyn];
     if (yyn <= 0)
       {
-	if (yyn == 0 || yyn == yytable_ninf_)
-	goto yyerrlab;
-	yyn = -yyn;
-	goto yyreduce;
+        if (yy_table_value_is_error_ (yyn))
+          goto yyerrlab;
+        yyn = -yyn;
+        goto yyreduce;
       }
 
-    /* Accept?  */
-    if (yyn == yyfinal_)
-      goto yyacceptlab;
-
-    /* Shift the look-ahead token.  */
-    YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-    /* Discard the token being shifted unless it is eof.  */
-    if (yychar != yyeof_)
-      yychar = yyempty_;
-
-    yysemantic_stack_.push (yylval);
-    yylocation_stack_.push (yylloc);
-
-    /* Count tokens shifted since error; after three, turn off error
-       status.  */
+    // Count tokens shifted since error; after three, turn off error status.
     if (yyerrstatus_)
       --yyerrstatus_;
 
-    yystate = yyn;
+    // Shift the lookahead token.
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystate];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
-    /* If YYLEN is nonzero, implement the default value of the action:
-       `$$ = $1'.  Otherwise, use the top of the stack.
-
-       Otherwise, the following line sets YYVAL to garbage.
-       This behavior is undocumented and Bison
-       users should not rely upon it.  */
-    if (yylen)
-      yyval = yysemantic_stack_[yylen - 1];
-    else
-      yyval = yysemantic_stack_[0];
-
-    {
-      slice<location_type, location_stack_type> slice (yylocation_stack_, yylen);
-      YYLLOC_DEFAULT (yyloc, slice, yylen);
-    }
-    YY_REDUCE_PRINT (yyn);
-    switch (yyn)
-      {
-	  case 2:
-#line 268 "pgscript/pgsParser.yy"
     {
-									(yyval.expr) = pnew pgsIdentRecord(*((yysemantic_stack_[(7) - (1)].str)), (yysemantic_stack_[(7) - (3)].expr), (yysemantic_stack_[(7) - (6)].expr));
-									pdelete((yysemantic_stack_[(7) - (1)].str));
-									driver.context.pop_var(); driver.context.pop_var(); // $3 & $6
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
+      stack_symbol_type yylhs;
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
+      /* If YYLEN is nonzero, implement the default value of the
+         action: '$$ = $1'.  Otherwise, use the top of the stack.
 
-  case 3:
-#line 275 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsIdentRecord(*((yysemantic_stack_[(4) - (1)].str)), (yysemantic_stack_[(4) - (3)].expr));
-									pdelete((yysemantic_stack_[(4) - (1)].str));
-									driver.context.pop_var(); // $3
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
+         Otherwise, the following line sets YYLHS.VALUE to garbage.
+         This behavior is undocumented and Bison users should not rely
+         upon it.  */
+      if (yylen)
+        yylhs.value = yystack_[yylen - 1].value;
+      else
+        yylhs.value = yystack_[0].value;
 
-  case 4:
-#line 282 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsLines(*((yysemantic_stack_[(4) - (3)].str)));
-									pdelete((yysemantic_stack_[(4) - (3)].str));
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
+      // Default location.
+      {
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
+      }
 
-  case 5:
-#line 288 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsColumns(*((yysemantic_stack_[(4) - (3)].str)));
-									pdelete((yysemantic_stack_[(4) - (3)].str));
-									driver.context.push_var((yyval.expr));
-								;}
+      // Perform the reduction.
+      YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
+      try
+#endif // YY_EXCEPTIONS
+        {
+          switch (yyn)
+            {
+  case 2: // postfix_expression: "IDENTIFIER" '[' expression ']' '[' expression ']'
+#line 272 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsIdentRecord(*((yystack_[6].value.str)), (yystack_[4].value.expr), (yystack_[1].value.expr));
+									pdelete((yystack_[6].value.str));
+									driver.context.pop_var(); driver.context.pop_var(); // $3 & $6
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 953 "pgscript/parser.tab.cc"
     break;
 
-  case 6:
-#line 294 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsTrim((yysemantic_stack_[(4) - (3)].expr));
+  case 3: // postfix_expression: "IDENTIFIER" '[' expression ']'
+#line 279 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsIdentRecord(*((yystack_[3].value.str)), (yystack_[1].value.expr));
+									pdelete((yystack_[3].value.str));
 									driver.context.pop_var(); // $3
-									driver.context.push_var((yyval.expr)); // assert
-								;}
-    break;
-
-  case 7:
-#line 300 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsIdent(*((yysemantic_stack_[(1) - (1)].str)));
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
-
-  case 8:
-#line 306 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsNumber(*((yysemantic_stack_[(1) - (1)].str)), pgsInt);
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
-
-  case 9:
-#line 312 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsNumber(*((yysemantic_stack_[(1) - (1)].str)), pgsReal);
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
-
-  case 10:
-#line 318 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsString(*((yysemantic_stack_[(1) - (1)].str)));
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
-
-  case 11:
-#line 323 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsExecute(*((yysemantic_stack_[(3) - (2)].str)), &driver.context.m_cout,
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 964 "pgscript/parser.tab.cc"
+    break;
+
+  case 4: // postfix_expression: "LINES" '(' "IDENTIFIER" ')'
+#line 286 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsLines(*((yystack_[1].value.str)));
+									pdelete((yystack_[1].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 974 "pgscript/parser.tab.cc"
+    break;
+
+  case 5: // postfix_expression: "COLUMNS" '(' "IDENTIFIER" ')'
+#line 292 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsColumns(*((yystack_[1].value.str)));
+									pdelete((yystack_[1].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 984 "pgscript/parser.tab.cc"
+    break;
+
+  case 6: // postfix_expression: "TRIM" '(' expression ')'
+#line 298 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsTrim((yystack_[1].value.expr));
+									driver.context.pop_var(); // $3
+									driver.context.push_var((yylhs.value.expr)); // assert
+								}
+#line 994 "pgscript/parser.tab.cc"
+    break;
+
+  case 7: // postfix_expression: "IDENTIFIER"
+#line 304 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsIdent(*((yystack_[0].value.str)));
+									pdelete((yystack_[0].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1004 "pgscript/parser.tab.cc"
+    break;
+
+  case 8: // postfix_expression: "INTEGER VALUE"
+#line 310 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsNumber(*((yystack_[0].value.str)), pgsInt);
+									pdelete((yystack_[0].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1014 "pgscript/parser.tab.cc"
+    break;
+
+  case 9: // postfix_expression: "REAL VALUE"
+#line 316 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsNumber(*((yystack_[0].value.str)), pgsReal);
+									pdelete((yystack_[0].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1024 "pgscript/parser.tab.cc"
+    break;
+
+  case 10: // postfix_expression: "STRING VALUE"
+#line 322 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsString(*((yystack_[0].value.str)));
+									pdelete((yystack_[0].value.str));
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1034 "pgscript/parser.tab.cc"
+    break;
+
+  case 11: // postfix_expression: '(' "SELECT" ')'
+#line 327 "pgscript/pgsParser.yy"
+                                        {
+									(yylhs.value.expr) = pnew pgsExecute(*((yystack_[1].value.str)), &driver.context.m_cout,
 											&(driver.thread));
-									pdelete((yysemantic_stack_[(3) - (2)].str));
-									driver.context.push_var((yyval.expr)); // SQL Expression statement
-								;}
+									pdelete((yystack_[1].value.str));
+									driver.context.push_var((yylhs.value.expr)); // SQL Expression statement
+								}
+#line 1045 "pgscript/parser.tab.cc"
     break;
 
-  case 12:
-#line 329 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 12: // postfix_expression: random_generator
+#line 333 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1051 "pgscript/parser.tab.cc"
     break;
 
-  case 13:
-#line 330 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsParenthesis((yysemantic_stack_[(3) - (2)].expr));
+  case 13: // postfix_expression: '(' expression ')'
+#line 334 "pgscript/pgsParser.yy"
+                                        {
+									(yylhs.value.expr) = pnew pgsParenthesis((yystack_[1].value.expr));
 									driver.context.pop_var(); // $2
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1061 "pgscript/parser.tab.cc"
     break;
 
-  case 14:
-#line 338 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 14: // unary_expression: postfix_expression
+#line 342 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1067 "pgscript/parser.tab.cc"
     break;
 
-  case 15:
-#line 339 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(2) - (2)].expr); ;}
+  case 15: // unary_expression: '+' cast_expression
+#line 343 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1073 "pgscript/parser.tab.cc"
     break;
 
-  case 16:
-#line 340 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsNegate((yysemantic_stack_[(2) - (2)].expr));
+  case 16: // unary_expression: '-' cast_expression
+#line 344 "pgscript/pgsParser.yy"
+                                        {
+									(yylhs.value.expr) = pnew pgsNegate((yystack_[0].value.expr));
 									driver.context.pop_var(); // $2
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1083 "pgscript/parser.tab.cc"
     break;
 
-  case 17:
-#line 346 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsNot((yysemantic_stack_[(2) - (2)].expr));
+  case 17: // unary_expression: "NOT" cast_expression
+#line 350 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsNot((yystack_[0].value.expr));
 									driver.context.pop_var(); // $2
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1093 "pgscript/parser.tab.cc"
     break;
 
-  case 18:
-#line 354 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 18: // cast_expression: unary_expression
+#line 358 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1099 "pgscript/parser.tab.cc"
     break;
 
-  case 19:
-#line 356 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsCast((yysemantic_stack_[(6) - (5)].integer), (yysemantic_stack_[(6) - (3)].expr));
+  case 19: // cast_expression: "CAST" '(' cast_expression "AS" type_name ')'
+#line 360 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsCast((yystack_[1].value.integer), (yystack_[3].value.expr));
 									driver.context.pop_var(); // $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1109 "pgscript/parser.tab.cc"
     break;
 
-  case 20:
-#line 364 "pgscript/pgsParser.yy"
-    { (yyval.integer) = pgscript::pgsParser::token::PGS_INTEGER; ;}
+  case 20: // type_name: "INTEGER"
+#line 368 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.integer) = pgscript::pgsParser::token::PGS_INTEGER; }
+#line 1115 "pgscript/parser.tab.cc"
     break;
 
-  case 21:
-#line 365 "pgscript/pgsParser.yy"
-    { (yyval.integer) = pgscript::pgsParser::token::PGS_REAL; ;}
+  case 21: // type_name: "REAL"
+#line 369 "pgscript/pgsParser.yy"
+                                                        { (yylhs.value.integer) = pgscript::pgsParser::token::PGS_REAL; }
+#line 1121 "pgscript/parser.tab.cc"
     break;
 
-  case 22:
-#line 366 "pgscript/pgsParser.yy"
-    { (yyval.integer) = pgscript::pgsParser::token::PGS_STRING; ;}
+  case 22: // type_name: "STRING"
+#line 370 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.integer) = pgscript::pgsParser::token::PGS_STRING; }
+#line 1127 "pgscript/parser.tab.cc"
     break;
 
-  case 23:
-#line 367 "pgscript/pgsParser.yy"
-    { (yyval.integer) = pgscript::pgsParser::token::PGS_RECORD; ;}
+  case 23: // type_name: "RECORD"
+#line 371 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.integer) = pgscript::pgsParser::token::PGS_RECORD; }
+#line 1133 "pgscript/parser.tab.cc"
     break;
 
-  case 24:
-#line 371 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 24: // multiplicative_expression: cast_expression
+#line 375 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1139 "pgscript/parser.tab.cc"
     break;
 
-  case 25:
-#line 373 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsTimes((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 25: // multiplicative_expression: multiplicative_expression '*' cast_expression
+#line 377 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsTimes((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1150 "pgscript/parser.tab.cc"
     break;
 
-  case 26:
-#line 380 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsOver((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 26: // multiplicative_expression: multiplicative_expression '/' cast_expression
+#line 384 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsOver((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1161 "pgscript/parser.tab.cc"
     break;
 
-  case 27:
-#line 387 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsModulo((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 27: // multiplicative_expression: multiplicative_expression '%' cast_expression
+#line 391 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsModulo((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1172 "pgscript/parser.tab.cc"
     break;
 
-  case 28:
-#line 396 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 28: // additive_expression: multiplicative_expression
+#line 400 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1178 "pgscript/parser.tab.cc"
     break;
 
-  case 29:
-#line 398 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsPlus((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 29: // additive_expression: additive_expression '+' multiplicative_expression
+#line 402 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsPlus((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1189 "pgscript/parser.tab.cc"
     break;
 
-  case 30:
-#line 405 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsMinus((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 30: // additive_expression: additive_expression '-' multiplicative_expression
+#line 409 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsMinus((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1200 "pgscript/parser.tab.cc"
     break;
 
-  case 31:
-#line 414 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 31: // relational_expression: additive_expression
+#line 418 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1206 "pgscript/parser.tab.cc"
     break;
 
-  case 32:
-#line 416 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsLower((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 32: // relational_expression: relational_expression '<' additive_expression
+#line 420 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsLower((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1217 "pgscript/parser.tab.cc"
     break;
 
-  case 33:
-#line 423 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGreater((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 33: // relational_expression: relational_expression '>' additive_expression
+#line 427 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGreater((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1228 "pgscript/parser.tab.cc"
     break;
 
-  case 34:
-#line 430 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsLowerEqual((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 34: // relational_expression: relational_expression "<=" additive_expression
+#line 434 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsLowerEqual((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1239 "pgscript/parser.tab.cc"
     break;
 
-  case 35:
-#line 437 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGreaterEqual((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 35: // relational_expression: relational_expression ">=" additive_expression
+#line 441 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGreaterEqual((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1250 "pgscript/parser.tab.cc"
     break;
 
-  case 36:
-#line 446 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 36: // equality_expression: relational_expression
+#line 450 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1256 "pgscript/parser.tab.cc"
     break;
 
-  case 37:
-#line 448 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsEqual((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 37: // equality_expression: equality_expression "=" relational_expression
+#line 452 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsEqual((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1267 "pgscript/parser.tab.cc"
     break;
 
-  case 38:
-#line 455 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsEqual((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr), false);
+  case 38: // equality_expression: equality_expression "~=" relational_expression
+#line 459 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsEqual((yystack_[2].value.expr), (yystack_[0].value.expr), false);
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1278 "pgscript/parser.tab.cc"
     break;
 
-  case 39:
-#line 462 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsDifferent((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 39: // equality_expression: equality_expression "<>" relational_expression
+#line 466 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsDifferent((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1289 "pgscript/parser.tab.cc"
     break;
 
-  case 40:
-#line 471 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 40: // logical_and_expression: equality_expression
+#line 475 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1295 "pgscript/parser.tab.cc"
     break;
 
-  case 41:
-#line 473 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsAnd((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 41: // logical_and_expression: logical_and_expression "AND" equality_expression
+#line 477 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsAnd((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1306 "pgscript/parser.tab.cc"
     break;
 
-  case 42:
-#line 482 "pgscript/pgsParser.yy"
-    { (yyval.expr) = (yysemantic_stack_[(1) - (1)].expr); ;}
+  case 42: // logical_or_expression: logical_and_expression
+#line 486 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.expr) = (yystack_[0].value.expr); }
+#line 1312 "pgscript/parser.tab.cc"
     break;
 
-  case 43:
-#line 484 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsOr((yysemantic_stack_[(3) - (1)].expr), (yysemantic_stack_[(3) - (3)].expr));
+  case 43: // logical_or_expression: logical_or_expression "OR" logical_and_expression
+#line 488 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsOr((yystack_[2].value.expr), (yystack_[0].value.expr));
 									driver.context.pop_var();
 									driver.context.pop_var(); // $1 & $3
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1323 "pgscript/parser.tab.cc"
     break;
 
-  case 44:
-#line 493 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("%s"), (yysemantic_stack_[(1) - (1)].expr)->value().c_str());
-									(yyval.expr) = (yysemantic_stack_[(1) - (1)].expr);
-								;}
+  case 44: // expression: logical_or_expression
+#line 497 "pgscript/pgsParser.yy"
+                                        {
+									wxLogScriptVerbose(wxT("%s"), (yystack_[0].value.expr)->value().c_str());
+									(yylhs.value.expr) = (yystack_[0].value.expr);
+								}
+#line 1332 "pgscript/parser.tab.cc"
     break;
 
-  case 45:
-#line 501 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenInt((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.zero(),
+  case 45: // random_generator: "INTEGER" '(' expression ',' expression ')'
+#line 505 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenInt((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1344 "pgscript/parser.tab.cc"
     break;
 
-  case 46:
-#line 509 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenInt((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed());
+  case 46: // random_generator: "INTEGER" '(' expression ',' expression ',' expression ')'
+#line 513 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenInt((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1355 "pgscript/parser.tab.cc"
     break;
 
-  case 47:
-#line 516 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenInt((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 47: // random_generator: "INTEGER" '(' expression ',' expression ',' expression ',' expression ')'
+#line 520 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenInt((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1366 "pgscript/parser.tab.cc"
     break;
 
-  case 48:
-#line 523 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReal((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.zero(),
+  case 48: // random_generator: "REAL" '(' expression ',' expression ',' expression ')'
+#line 527 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReal((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1379 "pgscript/parser.tab.cc"
     break;
 
-  case 49:
-#line 532 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReal((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr), driver.context.seed());
+  case 49: // random_generator: "REAL" '(' expression ',' expression ',' expression ',' expression ')'
+#line 536 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReal((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1391 "pgscript/parser.tab.cc"
     break;
 
-  case 50:
-#line 540 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReal((yysemantic_stack_[(12) - (3)].expr), (yysemantic_stack_[(12) - (5)].expr), (yysemantic_stack_[(12) - (7)].expr), (yysemantic_stack_[(12) - (9)].expr), (yysemantic_stack_[(12) - (11)].expr));
+  case 50: // random_generator: "REAL" '(' expression ',' expression ',' expression ',' expression ',' expression ')'
+#line 544 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReal((yystack_[9].value.expr), (yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1403 "pgscript/parser.tab.cc"
     break;
 
-  case 51:
-#line 548 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenString((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.one(),
+  case 51: // random_generator: "STRING" '(' expression ',' expression ')'
+#line 552 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenString((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.one(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1415 "pgscript/parser.tab.cc"
     break;
 
-  case 52:
-#line 556 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenString((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed());
+  case 52: // random_generator: "STRING" '(' expression ',' expression ',' expression ')'
+#line 560 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenString((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1426 "pgscript/parser.tab.cc"
     break;
 
-  case 53:
-#line 563 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenString((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 53: // random_generator: "STRING" '(' expression ',' expression ',' expression ',' expression ')'
+#line 567 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenString((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1437 "pgscript/parser.tab.cc"
     break;
 
-  case 54:
-#line 570 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenRegex((yysemantic_stack_[(4) - (3)].expr), driver.context.seed());
+  case 54: // random_generator: "REGEX" '(' expression ')'
+#line 574 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenRegex((yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1447 "pgscript/parser.tab.cc"
     break;
 
-  case 55:
-#line 576 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenRegex((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr));
+  case 55: // random_generator: "REGEX" '(' expression ',' expression ')'
+#line 580 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenRegex((yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1457 "pgscript/parser.tab.cc"
     break;
 
-  case 56:
-#line 582 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDictionary((yysemantic_stack_[(4) - (3)].expr), driver.context.zero(),
+  case 56: // random_generator: "FILE" '(' expression ')'
+#line 586 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDictionary((yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed(), driver.context.encoding());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1469 "pgscript/parser.tab.cc"
     break;
 
-  case 57:
-#line 590 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDictionary((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.seed(),
+  case 57: // random_generator: "FILE" '(' expression ',' expression ')'
+#line 594 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDictionary((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed(),
 											driver.context.encoding());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1481 "pgscript/parser.tab.cc"
     break;
 
-  case 58:
-#line 598 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDictionary((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.encoding());
+  case 58: // random_generator: "FILE" '(' expression ',' expression ',' expression ')'
+#line 602 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDictionary((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.encoding());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1492 "pgscript/parser.tab.cc"
     break;
 
-  case 59:
-#line 605 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDictionary((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 59: // random_generator: "FILE" '(' expression ',' expression ',' expression ',' expression ')'
+#line 609 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDictionary((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1503 "pgscript/parser.tab.cc"
     break;
 
-  case 60:
-#line 612 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDate((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.zero(),
+  case 60: // random_generator: "DATE" '(' expression ',' expression ')'
+#line 616 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDate((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1515 "pgscript/parser.tab.cc"
     break;
 
-  case 61:
-#line 620 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDate((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed());
+  case 61: // random_generator: "DATE" '(' expression ',' expression ',' expression ')'
+#line 624 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDate((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1526 "pgscript/parser.tab.cc"
     break;
 
-  case 62:
-#line 627 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDate((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 62: // random_generator: "DATE" '(' expression ',' expression ',' expression ',' expression ')'
+#line 631 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDate((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1537 "pgscript/parser.tab.cc"
     break;
 
-  case 63:
-#line 634 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenTime((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.zero(),
+  case 63: // random_generator: "TIME" '(' expression ',' expression ')'
+#line 638 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenTime((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1549 "pgscript/parser.tab.cc"
     break;
 
-  case 64:
-#line 642 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenTime((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed());
+  case 64: // random_generator: "TIME" '(' expression ',' expression ',' expression ')'
+#line 646 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenTime((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1560 "pgscript/parser.tab.cc"
     break;
 
-  case 65:
-#line 649 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenTime((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 65: // random_generator: "TIME" '(' expression ',' expression ',' expression ',' expression ')'
+#line 653 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenTime((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1571 "pgscript/parser.tab.cc"
     break;
 
-  case 66:
-#line 656 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDateTime((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.zero(),
+  case 66: // random_generator: "DATETIME" '(' expression ',' expression ')'
+#line 660 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDateTime((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1583 "pgscript/parser.tab.cc"
     break;
 
-  case 67:
-#line 664 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDateTime((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed());
+  case 67: // random_generator: "DATETIME" '(' expression ',' expression ',' expression ')'
+#line 668 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDateTime((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed());
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1594 "pgscript/parser.tab.cc"
     break;
 
-  case 68:
-#line 671 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenDateTime((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr));
+  case 68: // random_generator: "DATETIME" '(' expression ',' expression ',' expression ',' expression ')'
+#line 675 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenDateTime((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1605 "pgscript/parser.tab.cc"
     break;
 
-  case 69:
-#line 678 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReference((yysemantic_stack_[(6) - (3)].expr), (yysemantic_stack_[(6) - (5)].expr), driver.context.zero(),
+  case 69: // random_generator: "REFERENCE" '(' expression ',' expression ')'
+#line 682 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReference((yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.zero(),
 											driver.context.seed(), &(driver.thread));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1617 "pgscript/parser.tab.cc"
     break;
 
-  case 70:
-#line 686 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReference((yysemantic_stack_[(8) - (3)].expr), (yysemantic_stack_[(8) - (5)].expr), (yysemantic_stack_[(8) - (7)].expr), driver.context.seed(),
+  case 70: // random_generator: "REFERENCE" '(' expression ',' expression ',' expression ')'
+#line 690 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReference((yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), driver.context.seed(),
 											&(driver.thread));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1629 "pgscript/parser.tab.cc"
     break;
 
-  case 71:
-#line 694 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsGenReference((yysemantic_stack_[(10) - (3)].expr), (yysemantic_stack_[(10) - (5)].expr), (yysemantic_stack_[(10) - (7)].expr), (yysemantic_stack_[(10) - (9)].expr), &(driver.thread));
+  case 71: // random_generator: "REFERENCE" '(' expression ',' expression ',' expression ',' expression ')'
+#line 698 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.expr) = pnew pgsGenReference((yystack_[7].value.expr), (yystack_[5].value.expr), (yystack_[3].value.expr), (yystack_[1].value.expr), &(driver.thread));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); driver.context.pop_var();
-									driver.context.push_var((yyval.expr));
-								;}
-    break;
-
-  case 72:
-#line 703 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(1) - (1)].stmt); ;}
-    break;
-
-  case 73:
-#line 704 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(1) - (1)].stmt); ;}
-    break;
-
-  case 74:
-#line 705 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(1) - (1)].stmt); ;}
+									driver.context.push_var((yylhs.value.expr));
+								}
+#line 1640 "pgscript/parser.tab.cc"
     break;
 
-  case 75:
-#line 706 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(2) - (1)].stmt); ;}
-    break;
-
-  case 76:
+  case 72: // statement: compound_statement
 #line 707 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(2) - (1)].stmt); ;}
+                                        { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1646 "pgscript/parser.tab.cc"
     break;
 
-  case 77:
+  case 73: // statement: selection_statement
 #line 708 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(2) - (1)].stmt); ;}
+                                        { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1652 "pgscript/parser.tab.cc"
     break;
 
-  case 78:
+  case 74: // statement: iteration_statement
 #line 709 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(2) - (1)].stmt); ;}
+                                        { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1658 "pgscript/parser.tab.cc"
     break;
 
-  case 79:
+  case 75: // statement: parallel_statement
 #line 710 "pgscript/pgsParser.yy"
-    { (yyval.stmt) = (yysemantic_stack_[(2) - (1)].stmt); ;}
+                                        { (yylhs.value.stmt) = (yystack_[0].value.stmt); }
+#line 1664 "pgscript/parser.tab.cc"
     break;
 
-  case 80:
-#line 714 "pgscript/pgsParser.yy"
-    {
-									driver.context.pop_stmt(); // $1
-									(yyval.stmt_list) = driver.context.stmt_list(&(driver.thread));
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(1) - (1)].stmt));
-								;}
+  case 76: // statement: sql_statement ';'
+#line 711 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.stmt) = (yystack_[1].value.stmt); }
+#line 1670 "pgscript/parser.tab.cc"
     break;
 
-  case 81:
-#line 719 "pgscript/pgsParser.yy"
-    {
-									driver.context.pop_stmt(); // $2
-									(yyval.stmt_list) = (yysemantic_stack_[(2) - (1)].stmt_list);						
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(2) - (2)].stmt));
-								;}
+  case 77: // statement: procedure_statement ';'
+#line 712 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.stmt) = (yystack_[1].value.stmt); }
+#line 1676 "pgscript/parser.tab.cc"
     break;
 
-  case 82:
-#line 727 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("BEGIN END"));
-									(yyval.stmt) = driver.context.stmt_list(&(driver.thread));
-								;}
+  case 78: // statement: jump_statement ';'
+#line 713 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.stmt) = (yystack_[1].value.stmt); }
+#line 1682 "pgscript/parser.tab.cc"
     break;
 
-  case 83:
-#line 732 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("BEGIN ... END"));
-									(yyval.stmt) = (yysemantic_stack_[(3) - (2)].stmt_list);
-								;}
+  case 79: // statement: declaration_statement ';'
+#line 714 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.stmt) = (yystack_[1].value.stmt); }
+#line 1688 "pgscript/parser.tab.cc"
     break;
 
-  case 84:
-#line 739 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("%s"), (yysemantic_stack_[(1) - (1)].expr)->value().c_str());
-									(yyval.stmt) = pnew pgsExpressionStmt((yysemantic_stack_[(1) - (1)].expr), &(driver.thread));
-									driver.context.pop_var(); // $1
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+  case 80: // statement: assign_statement ';'
+#line 715 "pgscript/pgsParser.yy"
+                                        { (yylhs.value.stmt) = (yystack_[1].value.stmt); }
+#line 1694 "pgscript/parser.tab.cc"
     break;
 
-  case 85:
-#line 749 "pgscript/pgsParser.yy"
-    {
-									(yyval.expr) = pnew pgsExecute(*((yysemantic_stack_[(1) - (1)].str)), &driver.context.m_cout,
-											&(driver.thread));
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-									driver.context.push_var((yyval.expr)); // pgsExecute
-								;}
+  case 81: // statement_list: statement
+#line 719 "pgscript/pgsParser.yy"
+                                                        {
+									driver.context.pop_stmt(); // $1
+									(yylhs.value.stmt_list) = driver.context.stmt_list(&(driver.thread));
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
+								}
+#line 1704 "pgscript/parser.tab.cc"
     break;
 
-  case 86:
-#line 758 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+  case 82: // statement_list: statement_list statement
+#line 724 "pgscript/pgsParser.yy"
+                                        {
+									driver.context.pop_stmt(); // $2
+									(yylhs.value.stmt_list) = (yystack_[1].value.stmt_list);						
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
+								}
+#line 1714 "pgscript/parser.tab.cc"
     break;
 
-  case 87:
-#line 759 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+  case 83: // compound_statement: "BEGIN (BLOCK)" "END (BLOCK)"
+#line 732 "pgscript/pgsParser.yy"
+                                        {
+									wxLogScriptVerbose(wxT("BEGIN END"));
+									(yylhs.value.stmt) = driver.context.stmt_list(&(driver.thread));
+								}
+#line 1723 "pgscript/parser.tab.cc"
     break;
 
-  case 88:
-#line 760 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+  case 84: // compound_statement: "BEGIN (BLOCK)" statement_list "END (BLOCK)"
+#line 737 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("BEGIN ... END"));
+									(yylhs.value.stmt) = (yystack_[1].value.stmt_list);
+								}
+#line 1732 "pgscript/parser.tab.cc"
     break;
 
-  case 89:
-#line 761 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+  case 85: // sql_statement: sql_expression
+#line 744 "pgscript/pgsParser.yy"
+                                                {
+									wxLogScriptVerbose(wxT("%s"), (yystack_[0].value.expr)->value().c_str());
+									(yylhs.value.stmt) = pnew pgsExpressionStmt((yystack_[0].value.expr), &(driver.thread));
+									driver.context.pop_var(); // $1
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 1744 "pgscript/parser.tab.cc"
     break;
 
-  case 90:
-#line 762 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+  case 86: // sql_expression: sql_query
+#line 754 "pgscript/pgsParser.yy"
+                                                {
+									(yylhs.value.expr) = pnew pgsExecute(*((yystack_[0].value.str)), &driver.context.m_cout,
+											&(driver.thread));
+									pdelete((yystack_[0].value.str));
+									driver.context.push_var((yylhs.value.expr)); // pgsExecute
+								}
+#line 1755 "pgscript/parser.tab.cc"
     break;
 
-  case 91:
+  case 87: // sql_query: "ABORT"
 #line 763 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1761 "pgscript/parser.tab.cc"
     break;
 
-  case 92:
+  case 88: // sql_query: "ALTER"
 #line 764 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1767 "pgscript/parser.tab.cc"
     break;
 
-  case 93:
+  case 89: // sql_query: "ANALYZE"
 #line 765 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1773 "pgscript/parser.tab.cc"
     break;
 
-  case 94:
+  case 90: // sql_query: "BEGIN"
 #line 766 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1779 "pgscript/parser.tab.cc"
     break;
 
-  case 95:
+  case 91: // sql_query: "CHECKPOINT"
 #line 767 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1785 "pgscript/parser.tab.cc"
     break;
 
-  case 96:
+  case 92: // sql_query: "CLOSE"
 #line 768 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1791 "pgscript/parser.tab.cc"
     break;
 
-  case 97:
+  case 93: // sql_query: "CLUSTER"
 #line 769 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1797 "pgscript/parser.tab.cc"
     break;
 
-  case 98:
+  case 94: // sql_query: "COMMENT"
 #line 770 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1803 "pgscript/parser.tab.cc"
     break;
 
-  case 99:
+  case 95: // sql_query: "COMMIT"
 #line 771 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1809 "pgscript/parser.tab.cc"
     break;
 
-  case 100:
+  case 96: // sql_query: "COPY"
 #line 772 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1815 "pgscript/parser.tab.cc"
     break;
 
-  case 101:
+  case 97: // sql_query: "CREATE"
 #line 773 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1821 "pgscript/parser.tab.cc"
     break;
 
-  case 102:
+  case 98: // sql_query: "DEALLOCATE"
 #line 774 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1827 "pgscript/parser.tab.cc"
     break;
 
-  case 103:
+  case 99: // sql_query: "DECLARE"
 #line 775 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1833 "pgscript/parser.tab.cc"
     break;
 
-  case 104:
+  case 100: // sql_query: "DELETE"
 #line 776 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1839 "pgscript/parser.tab.cc"
     break;
 
-  case 105:
+  case 101: // sql_query: "DISCARD"
 #line 777 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1845 "pgscript/parser.tab.cc"
     break;
 
-  case 106:
+  case 102: // sql_query: "DROP"
 #line 778 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1851 "pgscript/parser.tab.cc"
     break;
 
-  case 107:
+  case 103: // sql_query: "END"
 #line 779 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1857 "pgscript/parser.tab.cc"
     break;
 
-  case 108:
+  case 104: // sql_query: "EXECUTE"
 #line 780 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1863 "pgscript/parser.tab.cc"
     break;
 
-  case 109:
+  case 105: // sql_query: "EXPLAIN"
 #line 781 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1869 "pgscript/parser.tab.cc"
     break;
 
-  case 110:
+  case 106: // sql_query: "FETCH"
 #line 782 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1875 "pgscript/parser.tab.cc"
     break;
 
-  case 111:
+  case 107: // sql_query: "GRANT"
 #line 783 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1881 "pgscript/parser.tab.cc"
     break;
 
-  case 112:
+  case 108: // sql_query: "INSERT"
 #line 784 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1887 "pgscript/parser.tab.cc"
     break;
 
-  case 113:
+  case 109: // sql_query: "LISTEN"
 #line 785 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1893 "pgscript/parser.tab.cc"
     break;
 
-  case 114:
+  case 110: // sql_query: "LOAD"
 #line 786 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1899 "pgscript/parser.tab.cc"
     break;
 
-  case 115:
+  case 111: // sql_query: "LOCK"
 #line 787 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1905 "pgscript/parser.tab.cc"
     break;
 
-  case 116:
+  case 112: // sql_query: "MOVE"
 #line 788 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1911 "pgscript/parser.tab.cc"
     break;
 
-  case 117:
+  case 113: // sql_query: "NOTIFY"
 #line 789 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1917 "pgscript/parser.tab.cc"
     break;
 
-  case 118:
+  case 114: // sql_query: "PREPARE"
 #line 790 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1923 "pgscript/parser.tab.cc"
     break;
 
-  case 119:
+  case 115: // sql_query: "REASSIGN"
 #line 791 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1929 "pgscript/parser.tab.cc"
     break;
 
-  case 120:
+  case 116: // sql_query: "REINDEX"
 #line 792 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1935 "pgscript/parser.tab.cc"
     break;
 
-  case 121:
+  case 117: // sql_query: "RELEASE"
 #line 793 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1941 "pgscript/parser.tab.cc"
     break;
 
-  case 122:
+  case 118: // sql_query: "RESET"
 #line 794 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1947 "pgscript/parser.tab.cc"
     break;
 
-  case 123:
+  case 119: // sql_query: "REVOKE"
 #line 795 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1953 "pgscript/parser.tab.cc"
     break;
 
-  case 124:
+  case 120: // sql_query: "ROLLBACK"
 #line 796 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1959 "pgscript/parser.tab.cc"
     break;
 
-  case 125:
+  case 121: // sql_query: "SAVEPOINT"
 #line 797 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1965 "pgscript/parser.tab.cc"
     break;
 
-  case 126:
+  case 122: // sql_query: "SELECT"
 #line 798 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1971 "pgscript/parser.tab.cc"
     break;
 
-  case 127:
+  case 123: // sql_query: "SET"
 #line 799 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1977 "pgscript/parser.tab.cc"
     break;
 
-  case 128:
+  case 124: // sql_query: "SHOW"
 #line 800 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1983 "pgscript/parser.tab.cc"
     break;
 
-  case 129:
+  case 125: // sql_query: "START"
 #line 801 "pgscript/pgsParser.yy"
-    { (yyval.str) = (yysemantic_stack_[(1) - (1)].str); ;}
+                                                        { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1989 "pgscript/parser.tab.cc"
+    break;
+
+  case 126: // sql_query: "TRUNCATE"
+#line 802 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 1995 "pgscript/parser.tab.cc"
+    break;
+
+  case 127: // sql_query: "UNLISTEN"
+#line 803 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 2001 "pgscript/parser.tab.cc"
+    break;
+
+  case 128: // sql_query: "UPDATE"
+#line 804 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 2007 "pgscript/parser.tab.cc"
     break;
 
-  case 130:
+  case 129: // sql_query: "VACUUM"
+#line 805 "pgscript/pgsParser.yy"
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 2013 "pgscript/parser.tab.cc"
+    break;
+
+  case 130: // sql_query: "VALUES"
 #line 806 "pgscript/pgsParser.yy"
-    {
-									(yyval.stmt) = (yysemantic_stack_[(2) - (2)].stmt_list);
-								;}
+                                                { (yylhs.value.str) = (yystack_[0].value.str); }
+#line 2019 "pgscript/parser.tab.cc"
     break;
 
-  case 131:
-#line 812 "pgscript/pgsParser.yy"
-    {
+  case 131: // declaration_statement: "DECLARE @VARIABLE" declaration_list
+#line 811 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.stmt) = (yystack_[0].value.stmt_list);
+								}
+#line 2027 "pgscript/parser.tab.cc"
+    break;
+
+  case 132: // declaration_list: declaration_element
+#line 817 "pgscript/pgsParser.yy"
+                                        {
 									driver.context.pop_stmt(); // $1
-									(yyval.stmt_list) = driver.context.stmt_list(&(driver.thread));
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(1) - (1)].stmt));
+									(yylhs.value.stmt_list) = driver.context.stmt_list(&(driver.thread));
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
 
-								;}
+								}
+#line 2038 "pgscript/parser.tab.cc"
     break;
 
-  case 132:
-#line 819 "pgscript/pgsParser.yy"
-    {
+  case 133: // declaration_list: declaration_list ',' declaration_element
+#line 824 "pgscript/pgsParser.yy"
+                                                                {
 									driver.context.pop_stmt(); // $3
-									(yyval.stmt_list) = (yysemantic_stack_[(3) - (1)].stmt_list);
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(3) - (3)].stmt));
-								;}
+									(yylhs.value.stmt_list) = (yystack_[2].value.stmt_list);
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
+								}
+#line 2048 "pgscript/parser.tab.cc"
     break;
 
-  case 133:
-#line 827 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("DECLARE %s"), (yysemantic_stack_[(1) - (1)].str)->c_str());
+  case 134: // declaration_element: "IDENTIFIER"
+#line 832 "pgscript/pgsParser.yy"
+                                                {
+									wxLogScriptVerbose(wxT("DECLARE %s"), (yystack_[0].value.str)->c_str());
 									
-									(yyval.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yysemantic_stack_[(1) - (1)].str)),
+									(yylhs.value.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yystack_[0].value.str)),
 											pnew pgsString(wxT(""))), &(driver.thread));
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-								;}
+									pdelete((yystack_[0].value.str));
+								}
+#line 2063 "pgscript/parser.tab.cc"
     break;
 
-  case 134:
-#line 838 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("DECLARE %s"), (yysemantic_stack_[(4) - (1)].str)->c_str());
+  case 135: // declaration_element: "IDENTIFIER" '{' record_declaration_list '}'
+#line 843 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("DECLARE %s"), (yystack_[3].value.str)->c_str());
 									
-									(yyval.stmt) = pnew pgsDeclareRecordStmt(*((yysemantic_stack_[(4) - (1)].str)), driver.context.columns(),
+									(yylhs.value.stmt) = pnew pgsDeclareRecordStmt(*((yystack_[3].value.str)), driver.context.columns(),
 											&(driver.thread));
-									driver.context.push_stmt((yyval.stmt)); // pgsDeclareRecordStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsDeclareRecordStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
 									driver.context.clear_columns();
-									pdelete((yysemantic_stack_[(4) - (1)].str));
-								;}
+									pdelete((yystack_[3].value.str));
+								}
+#line 2079 "pgscript/parser.tab.cc"
     break;
 
-  case 135:
-#line 853 "pgscript/pgsParser.yy"
-    {
-									(yyval.stmt) = (yysemantic_stack_[(2) - (2)].stmt_list);
-								;}
+  case 136: // assign_statement: "SET @VARIABLE" assign_list
+#line 858 "pgscript/pgsParser.yy"
+                                                                {
+									(yylhs.value.stmt) = (yystack_[0].value.stmt_list);
+								}
+#line 2087 "pgscript/parser.tab.cc"
     break;
 
-  case 136:
-#line 859 "pgscript/pgsParser.yy"
-    {
+  case 137: // assign_list: assign_element
+#line 864 "pgscript/pgsParser.yy"
+                                                {
 									driver.context.pop_stmt(); // $1
-									(yyval.stmt_list) = driver.context.stmt_list(&(driver.thread));
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(1) - (1)].stmt));
-								;}
+									(yylhs.value.stmt_list) = driver.context.stmt_list(&(driver.thread));
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
+								}
+#line 2097 "pgscript/parser.tab.cc"
     break;
 
-  case 137:
-#line 865 "pgscript/pgsParser.yy"
-    {
+  case 138: // assign_list: assign_list ',' assign_element
+#line 870 "pgscript/pgsParser.yy"
+                                                                {
 									driver.context.pop_stmt(); // $3
-									(yyval.stmt_list) = (yysemantic_stack_[(3) - (1)].stmt_list);
-									(yyval.stmt_list)->insert_back((yysemantic_stack_[(3) - (3)].stmt));
-								;}
+									(yylhs.value.stmt_list) = (yystack_[2].value.stmt_list);
+									(yylhs.value.stmt_list)->insert_back((yystack_[0].value.stmt));
+								}
+#line 2107 "pgscript/parser.tab.cc"
     break;
 
-  case 138:
-#line 874 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("SET %s = %s"), (yysemantic_stack_[(3) - (1)].str)->c_str(),
-											(yysemantic_stack_[(3) - (3)].expr)->value().c_str());
+  case 139: // assign_element: "IDENTIFIER" "=" expression
+#line 879 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("SET %s = %s"), (yystack_[2].value.str)->c_str(),
+											(yystack_[0].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yysemantic_stack_[(3) - (1)].str)), (yysemantic_stack_[(3) - (3)].expr)),
+									(yylhs.value.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yystack_[2].value.str)), (yystack_[0].value.expr)),
 											&(driver.thread));
 									driver.context.pop_var(); // $3
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
-									pdelete((yysemantic_stack_[(3) - (1)].str));
-								;}
+									pdelete((yystack_[2].value.str));
+								}
+#line 2124 "pgscript/parser.tab.cc"
     break;
 
-  case 139:
-#line 887 "pgscript/pgsParser.yy"
-    {
+  case 140: // assign_element: "IDENTIFIER" '[' expression ']' '[' expression ']' "=" expression
+#line 892 "pgscript/pgsParser.yy"
+                                                                {
 									wxLogScriptVerbose(wxT("SET %s[%s][%s] = %s"),
-											(yysemantic_stack_[(9) - (1)].str)->c_str(), (yysemantic_stack_[(9) - (3)].expr)->value().c_str(),
-											(yysemantic_stack_[(9) - (6)].expr)->value().c_str(), (yysemantic_stack_[(9) - (9)].expr)->value().c_str());
+											(yystack_[8].value.str)->c_str(), (yystack_[6].value.expr)->value().c_str(),
+											(yystack_[3].value.expr)->value().c_str(), (yystack_[0].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsExpressionStmt(pnew pgsAssignToRecord(*((yysemantic_stack_[(9) - (1)].str)),
-											(yysemantic_stack_[(9) - (3)].expr), (yysemantic_stack_[(9) - (6)].expr), (yysemantic_stack_[(9) - (9)].expr)), &(driver.thread));
+									(yylhs.value.stmt) = pnew pgsExpressionStmt(pnew pgsAssignToRecord(*((yystack_[8].value.str)),
+											(yystack_[6].value.expr), (yystack_[3].value.expr), (yystack_[0].value.expr)), &(driver.thread));
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); // $3 & $6 & $9
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
-									pdelete((yysemantic_stack_[(9) - (1)].str));
-								;}
+									pdelete((yystack_[8].value.str));
+								}
+#line 2143 "pgscript/parser.tab.cc"
     break;
 
-  case 140:
-#line 902 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("SET %s = %s"), (yysemantic_stack_[(3) - (1)].str)->c_str(),
-											(yysemantic_stack_[(3) - (3)].expr)->value().c_str());
+  case 141: // assign_element: "IDENTIFIER" "=" sql_expression
+#line 907 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("SET %s = %s"), (yystack_[2].value.str)->c_str(),
+											(yystack_[0].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yysemantic_stack_[(3) - (1)].str)), (yysemantic_stack_[(3) - (3)].expr)),
+									(yylhs.value.stmt) = pnew pgsExpressionStmt(pnew pgsAssign(*((yystack_[2].value.str)), (yystack_[0].value.expr)),
 											&(driver.thread));
 									driver.context.pop_var(); // $3
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
-									pdelete((yysemantic_stack_[(3) - (1)].str));
-								;}
+									pdelete((yystack_[2].value.str));
+								}
+#line 2160 "pgscript/parser.tab.cc"
     break;
 
-  case 141:
-#line 918 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("IF %s"), (yysemantic_stack_[(3) - (2)].expr)->value().c_str());
+  case 142: // selection_statement: "IF" expression statement
+#line 923 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("IF %s"), (yystack_[1].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsIfStmt((yysemantic_stack_[(3) - (2)].expr), (yysemantic_stack_[(3) - (3)].stmt), driver.context
+									(yylhs.value.stmt) = pnew pgsIfStmt((yystack_[1].value.expr), (yystack_[0].value.stmt), driver.context
 											.stmt_list(&(driver.thread)), &(driver.thread));
 									driver.context.pop_var(); // $2
 									driver.context.pop_stmt(); // $3
 									driver.context.pop_stmt(); // stmt_list
-									driver.context.push_stmt((yyval.stmt)); // pgsIfStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsIfStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2176 "pgscript/parser.tab.cc"
     break;
 
-  case 142:
-#line 930 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("IF %s"), (yysemantic_stack_[(5) - (2)].expr)->value().c_str());
+  case 143: // selection_statement: "IF" expression statement "ELSE" statement
+#line 935 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("IF %s"), (yystack_[3].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsIfStmt((yysemantic_stack_[(5) - (2)].expr), (yysemantic_stack_[(5) - (3)].stmt), (yysemantic_stack_[(5) - (5)].stmt), &(driver.thread));
+									(yylhs.value.stmt) = pnew pgsIfStmt((yystack_[3].value.expr), (yystack_[2].value.stmt), (yystack_[0].value.stmt), &(driver.thread));
 									driver.context.pop_var(); // $2
 									driver.context.pop_stmt(); // $3
 									driver.context.pop_stmt(); // $5
-									driver.context.push_stmt((yyval.stmt)); // pgsIfStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsIfStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2191 "pgscript/parser.tab.cc"
     break;
 
-  case 143:
-#line 944 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("WHILE %s"), (yysemantic_stack_[(3) - (2)].expr)->value().c_str());
+  case 144: // iteration_statement: "WHILE" expression statement
+#line 949 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("WHILE %s"), (yystack_[1].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsWhileStmt((yysemantic_stack_[(3) - (2)].expr), (yysemantic_stack_[(3) - (3)].stmt), &(driver.thread));
+									(yylhs.value.stmt) = pnew pgsWhileStmt((yystack_[1].value.expr), (yystack_[0].value.stmt), &(driver.thread));
 									driver.context.pop_var(); // $2
 									driver.context.pop_stmt(); // $3
-									driver.context.push_stmt((yyval.stmt)); // pgsWhileStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsWhileStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2205 "pgscript/parser.tab.cc"
     break;
 
-  case 144:
-#line 956 "pgscript/pgsParser.yy"
-    {
+  case 145: // parallel_statement: "PARALLEL" expression statement
+#line 962 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("PARALLEL %s"), (yystack_[1].value.expr)->value().c_str());
+									
+									(yylhs.value.stmt) = pnew pgsParallelStmt((yystack_[1].value.expr), (yystack_[0].value.stmt), driver.context.m_cout,
+											&(driver.thread));
+									driver.context.pop_var(); // $2
+									driver.context.pop_stmt(); // $3
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsParallelStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2220 "pgscript/parser.tab.cc"
+    break;
+
+  case 146: // jump_statement: "BREAK"
+#line 975 "pgscript/pgsParser.yy"
+                                                        {
 									wxLogScriptVerbose(wxT("BREAK"));
 									
-									(yyval.stmt) = pnew pgsBreakStmt(&(driver.thread));
-									driver.context.push_stmt((yyval.stmt)); // pgsBreakStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									(yylhs.value.stmt) = pnew pgsBreakStmt(&(driver.thread));
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsBreakStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2232 "pgscript/parser.tab.cc"
     break;
 
-  case 145:
-#line 963 "pgscript/pgsParser.yy"
-    {
+  case 147: // jump_statement: "RETURN"
+#line 982 "pgscript/pgsParser.yy"
+                                                {
 									wxLogScriptVerbose(wxT("RETURN"));
 									
-									(yyval.stmt) = pnew pgsBreakStmt(&(driver.thread));
-									driver.context.push_stmt((yyval.stmt)); // pgsBreakStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									(yylhs.value.stmt) = pnew pgsBreakStmt(&(driver.thread));
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsBreakStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2244 "pgscript/parser.tab.cc"
     break;
 
-  case 146:
-#line 970 "pgscript/pgsParser.yy"
-    {
+  case 148: // jump_statement: "CONTINUE"
+#line 989 "pgscript/pgsParser.yy"
+                                                {
 									wxLogScriptVerbose(wxT("CONTINUE"));
 									
-									(yyval.stmt) = pnew pgsContinueStmt(&(driver.thread));
-									driver.context.push_stmt((yyval.stmt)); // pgsContinueStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									(yylhs.value.stmt) = pnew pgsContinueStmt(&(driver.thread));
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsContinueStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2256 "pgscript/parser.tab.cc"
     break;
 
-  case 147:
-#line 981 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("PRINT %s"), (yysemantic_stack_[(2) - (2)].expr)->value().c_str());
+  case 149: // procedure_statement: "PRINT" expression
+#line 1000 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("PRINT %s"), (yystack_[0].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsPrintStmt((yysemantic_stack_[(2) - (2)].expr), driver.context.m_cout,
+									(yylhs.value.stmt) = pnew pgsPrintStmt((yystack_[0].value.expr), driver.context.m_cout,
 											&(driver.thread));
 									driver.context.pop_var(); // $2
-									driver.context.push_stmt((yyval.stmt)); // pgsPrintStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsPrintStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2270 "pgscript/parser.tab.cc"
     break;
 
-  case 148:
-#line 991 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("ASSERT %s"), (yysemantic_stack_[(2) - (2)].expr)->value().c_str());
+  case 150: // procedure_statement: "ASSERT" expression
+#line 1010 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("ASSERT %s"), (yystack_[0].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsAssertStmt((yysemantic_stack_[(2) - (2)].expr), &(driver.thread));
+									(yylhs.value.stmt) = pnew pgsAssertStmt((yystack_[0].value.expr), &(driver.thread));
 									driver.context.pop_var(); // $2
-									driver.context.push_stmt((yyval.stmt)); // pgsAssertStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
-								;}
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsAssertStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
+								}
+#line 2283 "pgscript/parser.tab.cc"
     break;
 
-  case 149:
-#line 1000 "pgscript/pgsParser.yy"
-    {
-									wxLogScriptVerbose(wxT("RMLINE %s[%s]"), (yysemantic_stack_[(7) - (3)].str)->c_str(),
-											(yysemantic_stack_[(7) - (5)].expr)->value().c_str());
+  case 151: // procedure_statement: "RMLINE" '(' "IDENTIFIER" '[' expression ']' ')'
+#line 1019 "pgscript/pgsParser.yy"
+                                                                {
+									wxLogScriptVerbose(wxT("RMLINE %s[%s]"), (yystack_[4].value.str)->c_str(),
+											(yystack_[2].value.expr)->value().c_str());
 									
-									(yyval.stmt) = pnew pgsExpressionStmt(pnew pgsRemoveLine(*((yysemantic_stack_[(7) - (3)].str)), (yysemantic_stack_[(7) - (5)].expr)),
+									(yylhs.value.stmt) = pnew pgsExpressionStmt(pnew pgsRemoveLine(*((yystack_[4].value.str)), (yystack_[2].value.expr)),
 											&(driver.thread));
 									driver.context.pop_var(); // $5
-									driver.context.push_stmt((yyval.stmt)); // pgsExpressionStmt
-									(yyval.stmt)->set_position(yyloc.begin.line);
+									driver.context.push_stmt((yylhs.value.stmt)); // pgsExpressionStmt
+									(yylhs.value.stmt)->set_position(yylhs.location.begin.line);
 									
-									pdelete((yysemantic_stack_[(7) - (3)].str));
-								;}
+									pdelete((yystack_[4].value.str));
+								}
+#line 2300 "pgscript/parser.tab.cc"
     break;
 
-  case 150:
-#line 1015 "pgscript/pgsParser.yy"
-    {
-									driver.context.add_column(*(yysemantic_stack_[(1) - (1)].str));
-									pdelete((yysemantic_stack_[(1) - (1)].str));
-								;}
+  case 152: // record_declaration_list: "IDENTIFIER"
+#line 1034 "pgscript/pgsParser.yy"
+                                                {
+									driver.context.add_column(*(yystack_[0].value.str));
+									pdelete((yystack_[0].value.str));
+								}
+#line 2309 "pgscript/parser.tab.cc"
     break;
 
-  case 151:
-#line 1020 "pgscript/pgsParser.yy"
-    {
-									driver.context.add_column(*(yysemantic_stack_[(3) - (3)].str));
-									pdelete((yysemantic_stack_[(3) - (3)].str));
-								;}
+  case 153: // record_declaration_list: record_declaration_list ',' "IDENTIFIER"
+#line 1039 "pgscript/pgsParser.yy"
+                                                                {
+									driver.context.add_column(*(yystack_[0].value.str));
+									pdelete((yystack_[0].value.str));
+								}
+#line 2318 "pgscript/parser.tab.cc"
     break;
 
-  case 153:
-#line 1028 "pgscript/pgsParser.yy"
-    {
-									driver.program.eval((yysemantic_stack_[(2) - (1)].stmt_list));
+  case 155: // translation_unit: statement_list "END OF FILE"
+#line 1047 "pgscript/pgsParser.yy"
+                                        {
+									driver.program.eval((yystack_[1].value.stmt_list));
 									
 									driver.context.pop_stmt();
-									pdelete((yysemantic_stack_[(2) - (1)].stmt_list)); // delete root statement $1
-								;}
+									pdelete((yystack_[1].value.stmt_list)); // delete root statement $1
+								}
+#line 2329 "pgscript/parser.tab.cc"
     break;
 
 
-    /* Line 675 of lalr1.cc.  */
-#line 1866 "pgscript/parser.tab.cc"
-	default: break;
-      }
-    YY_SYMBOL_PRINT ("-> $$ =", yyr1_[yyn], &yyval, &yyloc);
-
-    yypop_ (yylen);
-    yylen = 0;
-    YY_STACK_PRINT ();
-
-    yysemantic_stack_.push (yyval);
-    yylocation_stack_.push (yyloc);
+#line 2333 "pgscript/parser.tab.cc"
 
-    /* Shift the result of the reduction.  */
-    yyn = yyr1_[yyn];
-    yystate = yypgoto_[yyn - yyntokens_] + yystate_stack_[0];
-    if (0 <= yystate && yystate <= yylast_
-	&& yycheck_[yystate] == yystate_stack_[0])
-      yystate = yytable_[yystate];
-    else
-      yystate = yydefgoto_[yyn - yyntokens_];
+            default:
+              break;
+            }
+        }
+#if YY_EXCEPTIONS
+      catch (const syntax_error& yyexc)
+        {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
+          error (yyexc);
+          YYERROR;
+        }
+#endif // YY_EXCEPTIONS
+      YY_SYMBOL_PRINT ("-> $$ =", yylhs);
+      yypop_ (yylen);
+      yylen = 0;
+
+      // Shift the result of the reduction.
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
+    }
     goto yynewstate;
 
-  /*------------------------------------.
-  | yyerrlab -- here on detecting error |
-  `------------------------------------*/
+
+  /*--------------------------------------.
+  | yyerrlab -- here on detecting error.  |
+  `--------------------------------------*/
   yyerrlab:
-    /* If not already recovering from an error, report this error.  */
+    // If not already recovering from an error, report this error.
     if (!yyerrstatus_)
       {
-	++yynerrs_;
-	error (yylloc, yysyntax_error_ (yystate, yytoken));
+        ++yynerrs_;
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
-    yyerror_range[0] = yylloc;
+
+    yyerror_range[1].location = yyla.location;
     if (yyerrstatus_ == 3)
       {
-	/* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
-
-	if (yychar <= yyeof_)
-	  {
-	  /* Return failure if at end of input.  */
-	  if (yychar == yyeof_)
-	    YYABORT;
-	  }
-	else
-	  {
-	    yydestruct_ ("Error: discarding", yytoken, &yylval, &yylloc);
-	    yychar = yyempty_;
-	  }
+        /* If just tried and failed to reuse lookahead token after an
+           error, discard it.  */
+
+        // Return failure if at end of input.
+        if (yyla.kind () == symbol_kind::S_YYEOF)
+          YYABORT;
+        else if (!yyla.empty ())
+          {
+            yy_destroy_ ("Error: discarding", yyla);
+            yyla.clear ();
+          }
       }
 
-    /* Else will try to reuse look-ahead token after shifting the error
-       token.  */
+    // Else will try to reuse lookahead token after shifting the error token.
     goto yyerrlab1;
 
 
@@ -1928,724 +2396,754 @@ namespace pgscript
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
 
-    yyerror_range[0] = yylocation_stack_[yylen - 1];
-    /* Do not reclaim the symbols of the rule which action triggered
+    /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
-    yystate = yystate_stack_[0];
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
-    yyerrstatus_ = 3;	/* Each real token shifted decrements this.  */
-
+    yyerrstatus_ = 3;   // Each real token shifted decrements this.
+    // Pop stack until we find a state that shifts the error token.
     for (;;)
       {
-	yyn = yypact_[yystate];
-	if (yyn != yypact_ninf_)
-	{
-	  yyn += yyterror_;
-	  if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-	    {
-	      yyn = yytable_[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
-
-	/* Pop the current state because it cannot handle the error token.  */
-	if (yystate_stack_.height () == 1)
-	YYABORT;
-
-	yyerror_range[0] = yylocation_stack_[0];
-	yydestruct_ ("Error: popping",
-		     yystos_[yystate],
-		     &yysemantic_stack_[0], &yylocation_stack_[0]);
-	yypop_ ();
-	yystate = yystate_stack_[0];
-	YY_STACK_PRINT ();
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
+
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
+
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
       }
+    {
+      stack_symbol_type error_token;
 
-    if (yyn == yyfinal_)
-      goto yyacceptlab;
-
-    yyerror_range[1] = yylloc;
-    // Using YYLLOC is tempting, but would change the location of
-    // the look-ahead.  YYLOC is available though.
-    YYLLOC_DEFAULT (yyloc, (yyerror_range - 1), 2);
-    yysemantic_stack_.push (yylval);
-    yylocation_stack_.push (yyloc);
-
-    /* Shift the error token.  */
-    YY_SYMBOL_PRINT ("Shifting", yystos_[yyn],
-		   &yysemantic_stack_[0], &yylocation_stack_[0]);
+      yyerror_range[2].location = yyla.location;
+      YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
-    yystate = yyn;
+      // Shift the error token.
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
+    }
     goto yynewstate;
 
-    /* Accept.  */
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    /* Abort.  */
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
-    if (yychar != yyeof_ && yychar != yyempty_)
-      yydestruct_ ("Cleanup: discarding lookahead", yytoken, &yylval, &yylloc);
+    if (!yyla.empty ())
+      yy_destroy_ ("Cleanup: discarding lookahead", yyla);
 
-    /* Do not reclaim the symbols of the rule which action triggered
+    /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
-    while (yystate_stack_.height () != 1)
+    YY_STACK_PRINT ();
+    while (1 < yystack_.size ())
       {
-	yydestruct_ ("Cleanup: popping",
-		   yystos_[yystate_stack_[0]],
-		   &yysemantic_stack_[0],
-		   &yylocation_stack_[0]);
-	yypop_ ();
+        yy_destroy_ ("Cleanup: popping", yystack_[0]);
+        yypop_ ();
       }
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
+    catch (...)
+      {
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
+        // Do not try to display the values of the reclaimed symbols,
+        // as their printers might throw an exception.
+        if (!yyla.empty ())
+          yy_destroy_ (YY_NULLPTR, yyla);
+
+        while (1 < yystack_.size ())
+          {
+            yy_destroy_ (YY_NULLPTR, yystack_[0]);
+            yypop_ ();
+          }
+        throw;
+      }
+#endif // YY_EXCEPTIONS
+  }
+
+  void
+  pgsParser::error (const syntax_error& yyexc)
+  {
+    error (yyexc.location, yyexc.what ());
+  }
+
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
+  std::string
+  pgsParser::yytnamerr_ (const char *yystr)
+  {
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  pgsParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // pgsParser::context.
+  pgsParser::context::context (const pgsParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  pgsParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  pgsParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
+    /* There are many possibilities here to consider:
+       - If this state is a consistent state with a default action, then
+         the only way this function was invoked is if the default action
+         is an error action.  In that case, don't check for expected
+         tokens because there are none.
+       - The only way there can be no lookahead present (in yyla) is
+         if this state is a consistent state with a default action.
+         Thus, detecting the absence of a lookahead is sufficient to
+         determine that there is no unexpected or expected token to
+         report.  In that case, just report a simple "syntax error".
+       - Don't assume there isn't a lookahead just because this state is
+         a consistent state with a default action.  There might have
+         been a previous inconsistent state, consistent state with a
+         non-default action, or user semantic action that manipulated
+         yyla.  (However, yyla is currently not documented for users.)
+       - Of course, the expected token list depends on states to have
+         correct lookahead information, and it depends on the parser not
+         to perform extra reductions after fetching a lookahead from the
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
+    */
+
+    if (!yyctx.lookahead ().empty ())
+      {
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
+      }
+    return 0;
+  }
 
   // Generate an error message.
   std::string
-  pgsParser::yysyntax_error_ (int yystate, int tok)
+  pgsParser::yysyntax_error_ (const context& yyctx) const
   {
-    std::string res;
-    YYUSE (yystate);
-#if YYERROR_VERBOSE
-    int yyn = yypact_[yystate];
-    if (yypact_ninf_ < yyn && yyn <= yylast_)
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
+
+    char const* yyformat = YY_NULLPTR;
+    switch (yycount)
       {
-	/* Start YYX at -YYN if negative to avoid negative indexes in
-	   YYCHECK.  */
-	int yyxbegin = yyn < 0 ? -yyn : 0;
-
-	/* Stay within bounds of both yycheck and yytname.  */
-	int yychecklim = yylast_ - yyn + 1;
-	int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-	int count = 0;
-	for (int x = yyxbegin; x < yyxend; ++x)
-	  if (yycheck_[x + yyn] == x && x != yyterror_)
-	    ++count;
-
-	// FIXME: This method of building the message is not compatible
-	// with internationalization.  It should work like yacc.c does it.
-	// That is, first build a string that looks like this:
-	// "syntax error, unexpected %s or %s or %s"
-	// Then, invoke YY_ on this string.
-	// Finally, use the string as a format to output
-	// yytname_[tok], etc.
-	// Until this gets fixed, this message appears in English only.
-	res = "syntax error, unexpected ";
-	res += yytnamerr_ (yytname_[tok]);
-	if (count < 5)
-	  {
-	    count = 0;
-	    for (int x = yyxbegin; x < yyxend; ++x)
-	      if (yycheck_[x + yyn] == x && x != yyterror_)
-		{
-		  res += (!count++) ? ", expecting " : " or ";
-		  res += yytnamerr_ (yytname_[x]);
-		}
-	  }
+#define YYCASE_(N, S)                         \
+        case N:                               \
+          yyformat = S;                       \
+        break
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+#undef YYCASE_
       }
-    else
-#endif
-      res = YY_("syntax error");
-    return res;
+
+    std::string yyres;
+    // Argument number.
+    std::ptrdiff_t yyi = 0;
+    for (char const* yyp = yyformat; *yyp; ++yyp)
+      if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
+        {
+          yyres += symbol_name (yyarg[yyi++]);
+          ++yyp;
+        }
+      else
+        yyres += *yyp;
+    return yyres;
   }
 
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
-  const signed char pgsParser::yypact_ninf_ = -93;
-  const short int
+  const signed char pgsParser::yypact_ninf_ = -111;
+
+  const signed char pgsParser::yytable_ninf_ = -1;
+
+  const short
   pgsParser::yypact_[] =
   {
-       284,   -93,     6,   -93,   -93,   -93,     6,   453,     6,     6,
-     -88,   -76,   -61,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,   -93,   -93,   -93,   -93,   -93,   -93,   370,   -93,
-     -65,   -93,   -93,   -56,   -45,   -93,   -93,   -44,   -28,    73,
-      12,    13,    23,    27,    37,    42,    44,    50,    63,    65,
-      66,    67,    68,     6,     0,   -93,   -93,   -93,   -11,     6,
-       6,   -93,   -93,   -93,    51,   -74,     7,   117,   120,   124,
-     619,   -93,   619,   -93,   536,   -93,   -93,    76,   -25,    62,
-     -93,    61,    69,   -93,   -93,   -93,   -93,   -93,   -93,   -93,
-     -93,   -93,    79,    80,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   -93,     6,    74,    75,   -93,
-     -93,     6,     6,     6,     6,     6,     6,     6,     6,     6,
-       6,     6,     6,     6,     6,   -93,   161,   -93,    81,   689,
-       6,   -76,    86,   -61,    82,    83,    84,   163,    77,    78,
-      85,   -53,   -52,    87,    89,    90,    91,    92,   -93,   -93,
-     -93,   -93,   -93,    51,    51,   -74,   -74,   -74,   -74,     7,
-       7,     7,   117,   120,   619,     6,   -93,   -93,    93,   -93,
-     -93,    34,   -93,   -93,   -93,   -93,    64,     6,     6,     6,
-     -93,     6,   -93,     6,     6,     6,     6,     6,    95,   -93,
-      96,   103,    88,   -93,   -93,   -93,   -93,   -93,   101,   -51,
-      94,   -42,   104,   -38,   -37,   -31,   -22,   -21,     6,   105,
-       6,   -93,   -93,   -93,     6,     6,   -93,     6,   -93,   -93,
-       6,   -93,     6,   -93,     6,   -93,     6,   -93,     6,   108,
-     -93,   109,    -4,    -2,     9,    10,    15,    16,    38,    39,
-     -93,   147,   -93,     6,   -93,     6,   -93,     6,   -93,     6,
-     -93,     6,   -93,     6,   -93,     6,   -93,     6,     6,   111,
-      40,   113,   119,   121,   122,   123,   125,   -93,   -93,   -93,
-       6,   -93,   -93,   -93,   -93,   -93,   -93,   126,   -93
+     288,  -111,     7,  -111,  -111,  -111,     7,     7,   459,     7,
+       7,   -81,   -60,   -21,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,  -111,   375,
+    -111,   -28,  -111,  -111,   -16,   -15,  -111,  -111,  -111,    35,
+      36,    76,    23,    25,    55,    56,    57,    58,    59,    60,
+      61,    62,    63,    66,    67,     7,    70,  -111,  -111,  -111,
+     -10,     7,     7,  -111,  -111,  -111,   -39,   -73,   -27,   108,
+     125,   126,   627,  -111,   627,   627,  -111,   543,  -111,  -111,
+      78,   -24,    64,  -111,    65,    68,  -111,  -111,  -111,  -111,
+    -111,  -111,  -111,  -111,  -111,    80,    81,     7,     7,     7,
+       7,     7,     7,     7,     7,     7,     7,     7,  -111,     7,
+      69,    77,  -111,  -111,     7,     7,     7,     7,     7,     7,
+       7,     7,     7,     7,     7,     7,     7,     7,  -111,   164,
+    -111,  -111,    82,   697,     7,   -60,    87,   -21,    83,    84,
+      85,   165,    74,    79,    86,   -51,   -50,    88,    89,    90,
+      92,    91,  -111,  -111,  -111,  -111,  -111,   -39,   -39,   -73,
+     -73,   -73,   -73,   -27,   -27,   -27,   108,   125,   627,     7,
+    -111,  -111,    93,  -111,  -111,    15,  -111,  -111,  -111,  -111,
+     112,     7,     7,     7,  -111,     7,  -111,     7,     7,     7,
+       7,     7,    95,  -111,    97,    96,   109,  -111,  -111,  -111,
+    -111,  -111,   101,   -41,    98,   -40,   103,   -37,   -31,   -30,
+     -13,   -12,     7,   104,     7,  -111,  -111,  -111,     7,     7,
+    -111,     7,  -111,  -111,     7,  -111,     7,  -111,     7,  -111,
+       7,  -111,     7,   107,  -111,   110,    -3,    -1,     4,    10,
+      11,    13,    17,    20,  -111,   146,  -111,     7,  -111,     7,
+    -111,     7,  -111,     7,  -111,     7,  -111,     7,  -111,     7,
+    -111,     7,     7,   114,    38,   116,   122,   123,   124,   127,
+     128,  -111,  -111,  -111,     7,  -111,  -111,  -111,  -111,  -111,
+    -111,   129,  -111
   };
 
-  /* YYDEFACT[S] -- default rule to reduce with in state S when YYTABLE
-     doesn't specify something else to do.  Zero means the default is an
-     error.  */
   const unsigned char
   pgsParser::yydefact_[] =
   {
-         0,   152,     0,   144,   145,   146,     0,     0,     0,     0,
-       0,     0,     0,    86,    87,    88,    89,    90,    91,    92,
+       0,   154,     0,   146,   147,   148,     0,     0,     0,     0,
+       0,     0,     0,     0,    87,    88,    89,    90,    91,    92,
       93,    94,    95,    96,    97,    98,    99,   100,   101,   102,
      103,   104,   105,   106,   107,   108,   109,   110,   111,   112,
      113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,    80,     0,    72,
-       0,    84,    85,     0,     0,    73,    74,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     7,     8,     9,    10,     0,     0,
-       0,    14,    18,    24,    28,    31,    36,    40,    42,    44,
-       0,    12,     0,    82,     0,   148,   147,     0,     0,   135,
-     136,   133,   130,   131,   153,    81,    75,    78,    79,    77,
-      76,     1,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    17,     0,     0,     0,    15,
-      16,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   143,   141,    83,     0,     0,
+     123,   124,   125,   126,   127,   128,   129,   130,    81,     0,
+      72,     0,    85,    86,     0,     0,    73,    74,    75,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    11,    13,
-      25,    26,    27,    29,    30,    34,    35,    32,    33,    37,
-      38,    39,    41,    43,     0,     0,   138,   140,     0,   137,
-     150,     0,   132,     5,     4,     6,     0,     0,     0,     0,
-      54,     0,    56,     0,     0,     0,     0,     0,     3,   142,
-       0,     0,     0,   134,    23,    20,    21,    22,     0,     0,
+       0,     0,     0,     0,     0,     0,     7,     8,     9,    10,
+       0,     0,     0,    14,    18,    24,    28,    31,    36,    40,
+      42,    44,     0,    12,     0,     0,    83,     0,   150,   149,
+       0,     0,   136,   137,   134,   131,   132,   155,    82,    76,
+      79,    80,    78,    77,     1,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    17,     0,
+       0,     0,    15,    16,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   144,   142,
+     145,    84,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   151,    19,    45,     0,     0,    51,     0,    55,    57,
-       0,    60,     0,    63,     0,    66,     0,    69,     0,     0,
-     149,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       2,     0,    46,     0,    48,     0,    52,     0,    58,     0,
-      61,     0,    64,     0,    67,     0,    70,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   139,    47,    49,
-       0,    53,    59,    62,    65,    68,    71,     0,    50
+       0,     0,    11,    13,    25,    26,    27,    29,    30,    34,
+      35,    32,    33,    37,    38,    39,    41,    43,     0,     0,
+     139,   141,     0,   138,   152,     0,   133,     5,     4,     6,
+       0,     0,     0,     0,    54,     0,    56,     0,     0,     0,
+       0,     0,     3,   143,     0,     0,     0,   135,    23,    20,
+      21,    22,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   153,    19,    45,     0,     0,
+      51,     0,    55,    57,     0,    60,     0,    63,     0,    66,
+       0,    69,     0,     0,   151,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     2,     0,    46,     0,    48,     0,
+      52,     0,    58,     0,    61,     0,    64,     0,    67,     0,
+      70,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   140,    47,    49,     0,    53,    59,    62,    65,    68,
+      71,     0,    50
   };
 
-  /* YYPGOTO[NTERM-NUM].  */
-  const short int
+  const short
   pgsParser::yypgoto_[] =
   {
-       -93,   -93,   -93,   -29,   -93,   -92,    -3,   -83,    28,    59,
-     -93,    -6,   -93,   -57,   175,   -93,   -93,    58,   -93,   -93,
-     -93,    33,   -93,   -93,    60,   -93,   -93,   -93,   -93,   -93,
-     -93
+    -111,  -111,  -111,   -36,  -111,   -78,  -110,    -8,    26,    27,
+    -111,    -6,  -111,   -57,   193,  -111,  -111,    40,  -111,  -111,
+    -111,    37,  -111,  -111,    54,  -111,  -111,  -111,  -111,  -111,
+    -111,  -111
   };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
-  const short int
+  const unsigned char
   pgsParser::yydefgoto_[] =
   {
-        -1,    91,    92,    93,   228,    94,    95,    96,    97,    98,
-      99,   100,   101,    57,    58,    59,    60,    61,    62,    63,
-     112,   113,    64,   109,   110,    65,    66,    67,    68,   201,
-      69
+       0,    93,    94,    95,   232,    96,    97,    98,    99,   100,
+     101,   102,   103,    58,    59,    60,    61,    62,    63,    64,
+     115,   116,    65,   112,   113,    66,    67,    68,    69,    70,
+     205,    71
   };
 
-  /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule which
-     number is the opposite.  If zero, do what YYDEFACT says.  */
-  const signed char pgsParser::yytable_ninf_ = -1;
-  const unsigned short int
+  const short
   pgsParser::yytable_[] =
   {
-       102,   115,   105,   106,   107,    70,    71,    72,   159,    73,
-     108,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-     144,   145,    70,    71,    72,   111,    73,    83,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,   116,   146,   147,
-     210,   212,   243,   155,    83,   156,   117,   115,   211,   213,
-     244,   246,   183,   184,   135,   249,   251,   118,   119,   247,
-     139,   140,   253,   250,   252,   160,   137,   189,   190,   191,
-     254,   255,   257,   121,   120,    84,    85,    86,    87,   256,
-     258,    88,   138,    89,    90,   224,   225,   226,   227,   272,
-     136,   274,    84,    85,    86,    87,   167,   273,    88,   275,
-      89,    90,   276,   278,   122,   123,   148,   149,   280,   282,
-     277,   279,   180,   181,   182,   124,   281,   283,   166,   125,
-     168,   169,   170,   171,   172,   173,   174,   175,   176,   126,
-     177,   284,   286,   299,   127,   222,   128,   219,   223,   285,
-     287,   300,   129,   185,   186,   187,   188,   141,   142,   143,
-     150,   151,   152,   196,   198,   130,   153,   131,   132,   133,
-     134,   154,   158,   161,   162,   164,   165,   178,   179,   194,
-     163,   195,   200,   206,   241,   203,   204,   205,   207,   208,
-     288,   192,   104,   218,   221,   238,   209,   239,   214,   220,
-     215,   216,   217,   240,   242,   245,   202,   248,   260,   270,
-     271,   229,   230,   231,   298,   232,   301,   233,   234,   235,
-     236,   237,   302,   193,   303,   304,   305,   197,   306,   308,
-       0,   199,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   259,     0,   261,     0,     0,     0,   262,   263,
-       0,   264,     0,     0,   265,     0,   266,     0,   267,     0,
-     268,     0,   269,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   289,     0,   290,
-       0,   291,     0,   292,     0,   293,     0,   294,     0,   295,
-       0,   296,   297,     0,     1,     0,     0,     2,     3,     4,
-       5,     6,     0,     0,   307,     7,     0,     8,     9,     0,
-       0,     0,     0,    10,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    11,    12,    13,    14,    15,    16,
-      17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-     114,     0,     0,     2,     3,     4,     5,     6,     0,     0,
-       0,     7,     0,     8,     9,     0,     0,     0,     0,    10,
+     104,   105,   118,   108,   109,   149,   150,    72,    73,    74,
+     163,    75,   110,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,   147,   148,    72,    73,    74,   111,    75,    85,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,   189,
+     190,   191,   192,   214,   216,   158,    85,   159,   160,   138,
+     118,   215,   217,   247,   250,   142,   143,   253,   144,   145,
+     146,   248,   251,   255,   257,   254,   114,   164,   140,   187,
+     188,   256,   258,   151,   152,   119,   124,    86,    87,    88,
+      89,   259,   261,    90,   141,    91,    92,   120,   121,   260,
+     262,   276,   171,   278,    86,    87,    88,    89,   280,   277,
+      90,   279,    91,    92,   282,   284,   281,   286,   184,   185,
+     186,   288,   283,   285,   290,   287,   125,   226,   126,   289,
+     227,   170,   291,   172,   173,   174,   175,   176,   177,   178,
+     179,   180,   303,   181,   228,   229,   230,   231,   122,   123,
+     304,   223,   153,   154,   155,   193,   194,   195,   127,   128,
+     129,   130,   131,   132,   133,   134,   135,   200,   202,   136,
+     137,   139,   156,   182,   157,   162,   165,   168,   169,   166,
+     167,   183,   198,   199,   204,   210,   211,   207,   208,   209,
+     292,   212,   196,   222,   197,   225,   242,   244,   213,   243,
+     218,   219,   220,   224,   221,   246,   245,   252,   264,   274,
+     249,   107,   275,   201,   206,   233,   234,   235,   302,   236,
+     305,   237,   238,   239,   240,   241,   306,   307,   308,   203,
+       0,   309,   310,   312,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   263,     0,   265,     0,
+       0,     0,   266,   267,     0,   268,     0,     0,   269,     0,
+     270,     0,   271,     0,   272,     0,   273,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   293,     0,   294,     0,   295,     0,   296,     0,   297,
+       0,   298,     0,   299,     0,   300,   301,     0,     1,     0,
+       0,     2,     3,     4,     5,     6,     0,     0,   311,     7,
+       8,     0,     9,    10,     0,     0,     0,     0,    11,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,     2,     3,     4,     5,
-       6,     0,     0,     0,     7,   103,     8,     9,     0,     0,
-       0,     0,    10,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    12,
+      13,    14,    15,    16,    17,    18,    19,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,   117,     0,     0,     2,     3,
+       4,     5,     6,     0,     0,     0,     7,     8,     0,     9,
+      10,     0,     0,     0,     0,    11,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,    11,    12,    13,    14,    15,    16,    17,
-      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
-      48,    49,    50,    51,    52,    53,    54,    55,    56,     2,
-       3,     4,     5,     6,     0,     0,     0,     7,   157,     8,
-       9,     0,     0,     0,     0,    10,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
+      56,    57,     2,     3,     4,     5,     6,     0,     0,     0,
+       7,     8,   106,     9,    10,     0,     0,     0,     0,    11,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,     2,     3,     4,     5,     6,     0,     0,     0,
-       7,     0,     8,     9,     0,     0,     0,     0,    10,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    11,
       12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
       32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
       42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    70,    71,    72,     0,    73,
-       0,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-       0,     0,     0,     0,     0,     0,     0,    83,     0,     0,
-       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    84,    85,    86,    87,     0,
-       0,    88,     0,    89,    90
+      52,    53,    54,    55,    56,    57,     2,     3,     4,     5,
+       6,     0,     0,     0,     7,     8,   161,     9,    10,     0,
+       0,     0,     0,    11,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    12,    13,    14,    15,    16,    17,
+      18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
+      28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    44,    45,    46,    47,
+      48,    49,    50,    51,    52,    53,    54,    55,    56,    57,
+       2,     3,     4,     5,     6,     0,     0,     0,     7,     8,
+       0,     9,    10,     0,     0,     0,     0,    11,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    72,    73,    74,     0,    75,     0,
+      76,    77,    78,    79,    80,    81,    82,    83,    84,     0,
+       0,     0,     0,     0,     0,     0,    85,     0,     0,     0,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+      24,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    86,    87,    88,    89,     0,     0,
+      90,     0,    91,    92
   };
 
-  /* YYCHECK.  */
-  const short int
+  const short
   pgsParser::yycheck_[] =
   {
-         6,    58,     8,     9,    92,    16,    17,    18,    33,    20,
-      86,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      94,    95,    16,    17,    18,    86,    20,    38,    22,    23,
-      24,    25,    26,    27,    28,    29,    30,   102,    31,    32,
-      93,    93,    93,   100,    38,   102,   102,   104,   101,   101,
-     101,    93,   144,   145,    83,    93,    93,   102,   102,   101,
-      89,    90,    93,   101,   101,    90,    77,   150,   151,   152,
-     101,    93,    93,     0,   102,    86,    87,    88,    89,   101,
-     101,    92,    88,    94,    95,    21,    22,    23,    24,    93,
-      90,    93,    86,    87,    88,    89,   125,   101,    92,   101,
-      94,    95,    93,    93,    92,    92,    99,   100,    93,    93,
-     101,   101,   141,   142,   143,    92,   101,   101,   124,    92,
-     126,   127,   128,   129,   130,   131,   132,   133,   134,    92,
-     136,    93,    93,    93,    92,   101,    92,   194,   104,   101,
-     101,   101,    92,   146,   147,   148,   149,    96,    97,    98,
-      33,    34,    35,   159,   160,    92,    36,    92,    92,    92,
-      92,    37,    86,   101,   103,    86,    86,    93,    93,     8,
-     101,    90,    86,    10,    86,    93,    93,    93,   101,   101,
-      33,   153,     7,    91,    91,    90,   101,    91,   101,   195,
-     101,   101,   101,    90,    93,   101,   163,    93,    93,    91,
-      91,   207,   208,   209,    93,   211,    93,   213,   214,   215,
-     216,   217,    93,   154,    93,    93,    93,   159,    93,    93,
-      -1,   161,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   238,    -1,   240,    -1,    -1,    -1,   244,   245,
-      -1,   247,    -1,    -1,   250,    -1,   252,    -1,   254,    -1,
-     256,    -1,   258,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   273,    -1,   275,
-      -1,   277,    -1,   279,    -1,   281,    -1,   283,    -1,   285,
-      -1,   287,   288,    -1,     0,    -1,    -1,     3,     4,     5,
-       6,     7,    -1,    -1,   300,    11,    -1,    13,    14,    -1,
-      -1,    -1,    -1,    19,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    79,    80,    81,    82,    83,    84,    85,
-       0,    -1,    -1,     3,     4,     5,     6,     7,    -1,    -1,
-      -1,    11,    -1,    13,    14,    -1,    -1,    -1,    -1,    19,
+       6,     7,    59,     9,    10,    32,    33,    17,    18,    19,
+      34,    21,    93,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    95,    96,    17,    18,    19,    87,    21,    39,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,   149,
+     150,   151,   152,    94,    94,   102,    39,   104,   105,    85,
+     107,   102,   102,    94,    94,    91,    92,    94,    97,    98,
+      99,   102,   102,    94,    94,   102,    87,    91,    78,   147,
+     148,   102,   102,   100,   101,   103,     0,    87,    88,    89,
+      90,    94,    94,    93,    90,    95,    96,   103,   103,   102,
+     102,    94,   128,    94,    87,    88,    89,    90,    94,   102,
+      93,   102,    95,    96,    94,    94,   102,    94,   144,   145,
+     146,    94,   102,   102,    94,   102,    93,   102,    93,   102,
+     105,   127,   102,   129,   130,   131,   132,   133,   134,   135,
+     136,   137,    94,   139,    22,    23,    24,    25,   103,   103,
+     102,   198,    34,    35,    36,   153,   154,   155,    93,    93,
+      93,    93,    93,    93,    93,    93,    93,   163,   164,    93,
+      93,    91,    37,    94,    38,    87,   102,    87,    87,   104,
+     102,    94,     8,    91,    87,    10,   102,    94,    94,    94,
+      34,   102,   156,    92,   157,    92,    91,    91,   102,    92,
+     102,   102,   102,   199,   102,    94,    87,    94,    94,    92,
+     102,     8,    92,   163,   167,   211,   212,   213,    94,   215,
+      94,   217,   218,   219,   220,   221,    94,    94,    94,   165,
+      -1,    94,    94,    94,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,   242,    -1,   244,    -1,
+      -1,    -1,   248,   249,    -1,   251,    -1,    -1,   254,    -1,
+     256,    -1,   258,    -1,   260,    -1,   262,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   277,    -1,   279,    -1,   281,    -1,   283,    -1,   285,
+      -1,   287,    -1,   289,    -1,   291,   292,    -1,     0,    -1,
+      -1,     3,     4,     5,     6,     7,    -1,    -1,   304,    11,
+      12,    -1,    14,    15,    -1,    -1,    -1,    -1,    20,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      40,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,     3,     4,     5,     6,
-       7,    -1,    -1,    -1,    11,    12,    13,    14,    -1,    -1,
-      -1,    -1,    19,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,     0,    -1,    -1,     3,     4,
+       5,     6,     7,    -1,    -1,    -1,    11,    12,    -1,    14,
+      15,    -1,    -1,    -1,    -1,    20,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    40,    41,    42,    43,    44,    45,    46,
-      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
-      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-      77,    78,    79,    80,    81,    82,    83,    84,    85,     3,
-       4,     5,     6,     7,    -1,    -1,    -1,    11,    12,    13,
-      14,    -1,    -1,    -1,    -1,    19,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,     3,     4,     5,     6,     7,    -1,    -1,    -1,
+      11,    12,    13,    14,    15,    -1,    -1,    -1,    -1,    20,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    40,    41,    42,    43,
-      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
-      54,    55,    56,    57,    58,    59,    60,    61,    62,    63,
-      64,    65,    66,    67,    68,    69,    70,    71,    72,    73,
-      74,    75,    76,    77,    78,    79,    80,    81,    82,    83,
-      84,    85,     3,     4,     5,     6,     7,    -1,    -1,    -1,
-      11,    -1,    13,    14,    -1,    -1,    -1,    -1,    19,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    40,
       41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
       51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
       61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
       71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    16,    17,    18,    -1,    20,
-      -1,    22,    23,    24,    25,    26,    27,    28,    29,    30,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    38,    -1,    -1,
-      -1,    42,    43,    44,    45,    46,    47,    48,    49,    50,
-      51,    52,    53,    54,    55,    56,    57,    58,    59,    60,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
-      81,    82,    83,    84,    85,    86,    87,    88,    89,    -1,
-      -1,    92,    -1,    94,    95
+      81,    82,    83,    84,    85,    86,     3,     4,     5,     6,
+       7,    -1,    -1,    -1,    11,    12,    13,    14,    15,    -1,
+      -1,    -1,    -1,    20,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    41,    42,    43,    44,    45,    46,
+      47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
+      57,    58,    59,    60,    61,    62,    63,    64,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+       3,     4,     5,     6,     7,    -1,    -1,    -1,    11,    12,
+      -1,    14,    15,    -1,    -1,    -1,    -1,    20,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    41,    42,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    17,    18,    19,    -1,    21,    -1,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    39,    -1,    -1,    -1,
+      43,    44,    45,    46,    47,    48,    49,    50,    51,    52,
+      53,    54,    55,    56,    57,    58,    59,    60,    61,    62,
+      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
+      73,    74,    75,    76,    77,    78,    79,    80,    81,    82,
+      83,    84,    85,    86,    87,    88,    89,    90,    -1,    -1,
+      93,    -1,    95,    96
   };
 
-  /* STOS_[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
   const unsigned char
   pgsParser::yystos_[] =
   {
-         0,     0,     3,     4,     5,     6,     7,    11,    13,    14,
-      19,    40,    41,    42,    43,    44,    45,    46,    47,    48,
+       0,     0,     3,     4,     5,     6,     7,    11,    12,    14,
+      15,    20,    41,    42,    43,    44,    45,    46,    47,    48,
       49,    50,    51,    52,    53,    54,    55,    56,    57,    58,
       59,    60,    61,    62,    63,    64,    65,    66,    67,    68,
       69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    81,    82,    83,    84,    85,   118,   119,   120,
-     121,   122,   123,   124,   127,   130,   131,   132,   133,   135,
-      16,    17,    18,    20,    22,    23,    24,    25,    26,    27,
-      28,    29,    30,    38,    86,    87,    88,    89,    92,    94,
-      95,   106,   107,   108,   110,   111,   112,   113,   114,   115,
-     116,   117,   116,    12,   119,   116,   116,    92,    86,   128,
-     129,    86,   125,   126,     0,   118,   102,   102,   102,   102,
-     102,     0,    92,    92,    92,    92,    92,    92,    92,    92,
-      92,    92,    92,    92,    92,   108,    90,    77,   116,   108,
-     108,    96,    97,    98,    94,    95,    31,    32,    99,   100,
-      33,    34,    35,    36,    37,   118,   118,    12,    86,    33,
-      90,   101,   103,   101,    86,    86,   116,   108,   116,   116,
-     116,   116,   116,   116,   116,   116,   116,   116,    93,    93,
-     108,   108,   108,   110,   110,   111,   111,   111,   111,   112,
-     112,   112,   113,   114,     8,    90,   116,   122,   116,   129,
-      86,   134,   126,    93,    93,    93,    10,   101,   101,   101,
-      93,   101,    93,   101,   101,   101,   101,   101,    91,   118,
-     116,    91,   101,   104,    21,    22,    23,    24,   109,   116,
-     116,   116,   116,   116,   116,   116,   116,   116,    90,    91,
-      90,    86,    93,    93,   101,   101,    93,   101,    93,    93,
-     101,    93,   101,    93,   101,    93,   101,    93,   101,   116,
-      93,   116,   116,   116,   116,   116,   116,   116,   116,   116,
-      91,    91,    93,   101,    93,   101,    93,   101,    93,   101,
-      93,   101,    93,   101,    93,   101,    93,   101,    33,   116,
-     116,   116,   116,   116,   116,   116,   116,   116,    93,    93,
-     101,    93,    93,    93,    93,    93,    93,   116,    93
-  };
-
-#if YYDEBUG
-  /* TOKEN_NUMBER_[YYLEX-NUM] -- Internal symbol number corresponding
-     to YYLEX-NUM.  */
-  const unsigned short int
-  pgsParser::yytoken_number_[] =
-  {
-         0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-      91,    93,    40,    41,    43,    45,    42,    47,    37,    60,
-      62,    44,    59,   123,   125
+      79,    80,    81,    82,    83,    84,    85,    86,   119,   120,
+     121,   122,   123,   124,   125,   128,   131,   132,   133,   134,
+     135,   137,    17,    18,    19,    21,    23,    24,    25,    26,
+      27,    28,    29,    30,    31,    39,    87,    88,    89,    90,
+      93,    95,    96,   107,   108,   109,   111,   112,   113,   114,
+     115,   116,   117,   118,   117,   117,    13,   120,   117,   117,
+      93,    87,   129,   130,    87,   126,   127,     0,   119,   103,
+     103,   103,   103,   103,     0,    93,    93,    93,    93,    93,
+      93,    93,    93,    93,    93,    93,    93,    93,   109,    91,
+      78,   117,   109,   109,    97,    98,    99,    95,    96,    32,
+      33,   100,   101,    34,    35,    36,    37,    38,   119,   119,
+     119,    13,    87,    34,    91,   102,   104,   102,    87,    87,
+     117,   109,   117,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,    94,    94,   109,   109,   109,   111,   111,   112,
+     112,   112,   112,   113,   113,   113,   114,   115,     8,    91,
+     117,   123,   117,   130,    87,   136,   127,    94,    94,    94,
+      10,   102,   102,   102,    94,   102,    94,   102,   102,   102,
+     102,   102,    92,   119,   117,    92,   102,   105,    22,    23,
+      24,    25,   110,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,    91,    92,    91,    87,    94,    94,   102,   102,
+      94,   102,    94,    94,   102,    94,   102,    94,   102,    94,
+     102,    94,   102,   117,    94,   117,   117,   117,   117,   117,
+     117,   117,   117,   117,    92,    92,    94,   102,    94,   102,
+      94,   102,    94,   102,    94,   102,    94,   102,    94,   102,
+      94,   102,    34,   117,   117,   117,   117,   117,   117,   117,
+     117,   117,    94,    94,   102,    94,    94,    94,    94,    94,
+      94,   117,    94
   };
-#endif
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
   const unsigned char
   pgsParser::yyr1_[] =
   {
-         0,   105,   106,   106,   106,   106,   106,   106,   106,   106,
-     106,   106,   106,   106,   107,   107,   107,   107,   108,   108,
-     109,   109,   109,   109,   110,   110,   110,   110,   111,   111,
-     111,   112,   112,   112,   112,   112,   113,   113,   113,   113,
-     114,   114,   115,   115,   116,   117,   117,   117,   117,   117,
-     117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
-     117,   117,   117,   117,   117,   117,   117,   117,   117,   117,
-     117,   117,   118,   118,   118,   118,   118,   118,   118,   118,
-     119,   119,   120,   120,   121,   122,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     123,   123,   123,   123,   123,   123,   123,   123,   123,   123,
-     124,   125,   125,   126,   126,   127,   128,   128,   129,   129,
-     129,   130,   130,   131,   132,   132,   132,   133,   133,   133,
-     134,   134,   135,   135
+       0,   106,   107,   107,   107,   107,   107,   107,   107,   107,
+     107,   107,   107,   107,   108,   108,   108,   108,   109,   109,
+     110,   110,   110,   110,   111,   111,   111,   111,   112,   112,
+     112,   113,   113,   113,   113,   113,   114,   114,   114,   114,
+     115,   115,   116,   116,   117,   118,   118,   118,   118,   118,
+     118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
+     118,   118,   118,   118,   118,   118,   118,   118,   118,   118,
+     118,   118,   119,   119,   119,   119,   119,   119,   119,   119,
+     119,   120,   120,   121,   121,   122,   123,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   124,   124,   124,   124,   124,   124,   124,   124,   124,
+     124,   125,   126,   126,   127,   127,   128,   129,   129,   130,
+     130,   130,   131,   131,   132,   133,   134,   134,   134,   135,
+     135,   135,   136,   136,   137,   137
   };
 
-  /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-  const unsigned char
+  const signed char
   pgsParser::yyr2_[] =
   {
-         0,     2,     7,     4,     4,     4,     4,     1,     1,     1,
+       0,     2,     7,     4,     4,     4,     4,     1,     1,     1,
        1,     3,     1,     3,     1,     2,     2,     2,     1,     6,
        1,     1,     1,     1,     1,     3,     3,     3,     1,     3,
        3,     1,     3,     3,     3,     3,     1,     3,     3,     3,
        1,     3,     1,     3,     1,     6,     8,    10,     8,    10,
       12,     6,     8,    10,     4,     6,     4,     6,     8,    10,
        6,     8,    10,     6,     8,    10,     6,     8,    10,     6,
-       8,    10,     1,     1,     1,     2,     2,     2,     2,     2,
-       1,     2,     2,     3,     1,     1,     1,     1,     1,     1,
+       8,    10,     1,     1,     1,     1,     2,     2,     2,     2,
+       2,     1,     2,     2,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       2,     1,     3,     1,     4,     2,     1,     3,     3,     9,
-       3,     3,     5,     3,     1,     1,     1,     2,     2,     7,
-       1,     3,     1,     2
+       1,     2,     1,     3,     1,     4,     2,     1,     3,     3,
+       9,     3,     3,     5,     3,     3,     1,     1,     1,     2,
+       2,     7,     1,     3,     1,     2
   };
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
-  /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-     First, the terminals, then, starting at \a yyntokens_, nonterminals.  */
+
+#if YYDEBUG || 1
+  // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const pgsParser::yytname_[] =
   {
-    "\"END OF FILE\"", "error", "$undefined", "\"WHILE\"", "\"BREAK\"",
-  "\"RETURN\"", "\"CONTINUE\"", "\"IF\"", "\"ELSE\"", "\"WAITFOR\"",
-  "\"AS\"", "\"BEGIN (BLOCK)\"", "\"END (BLOCK)\"", "\"ASSERT\"",
-  "\"PRINT\"", "\"LOG\"", "\"COLUMNS\"", "\"LINES\"", "\"TRIM\"",
-  "\"RMLINE\"", "\"CAST\"", "\"RECORD\"", "\"INTEGER\"", "\"REAL\"",
-  "\"STRING\"", "\"REGEX\"", "\"FILE\"", "\"DATE\"", "\"TIME\"",
-  "\"DATETIME\"", "\"REFERENCE\"", "\"<=\"", "\">=\"", "\"=\"", "\"~=\"",
-  "\"<>\"", "\"AND\"", "\"OR\"", "\"NOT\"", "\"character\"",
-  "\"SET @VARIABLE\"", "\"DECLARE @VARIABLE\"", "\"ABORT\"", "\"ALTER\"",
-  "\"ANALYZE\"", "\"BEGIN\"", "\"CHECKPOINT\"", "\"CLOSE\"", "\"CLUSTER\"",
-  "\"COMMENT\"", "\"COMMIT\"", "\"COPY\"", "\"CREATE\"", "\"DEALLOCATE\"",
-  "\"DECLARE\"", "\"DELETE\"", "\"DISCARD\"", "\"DROP\"", "\"END\"",
-  "\"EXECUTE\"", "\"EXPLAIN\"", "\"FETCH\"", "\"GRANT\"", "\"INSERT\"",
-  "\"LISTEN\"", "\"LOAD\"", "\"LOCK\"", "\"MOVE\"", "\"NOTIFY\"",
-  "\"PREPARE\"", "\"REASSIGN\"", "\"REINDEX\"", "\"RELEASE\"", "\"RESET\"",
-  "\"REVOKE\"", "\"ROLLBACK\"", "\"SAVEPOINT\"", "\"SELECT\"", "\"SET\"",
-  "\"SHOW\"", "\"START\"", "\"TRUNCATE\"", "\"UNLISTEN\"", "\"UPDATE\"",
-  "\"VACUUM\"", "\"VALUES\"", "\"IDENTIFIER\"", "\"INTEGER VALUE\"",
-  "\"REAL VALUE\"", "\"STRING VALUE\"", "'['", "']'", "'('", "')'", "'+'",
-  "'-'", "'*'", "'/'", "'%'", "'<'", "'>'", "','", "';'", "'{'", "'}'",
-  "$accept", "postfix_expression", "unary_expression", "cast_expression",
-  "type_name", "multiplicative_expression", "additive_expression",
+  "\"END OF FILE\"", "error", "\"invalid token\"", "\"WHILE\"",
+  "\"BREAK\"", "\"RETURN\"", "\"CONTINUE\"", "\"IF\"", "\"ELSE\"",
+  "\"WAITFOR\"", "\"AS\"", "\"PARALLEL\"", "\"BEGIN (BLOCK)\"",
+  "\"END (BLOCK)\"", "\"ASSERT\"", "\"PRINT\"", "\"LOG\"", "\"COLUMNS\"",
+  "\"LINES\"", "\"TRIM\"", "\"RMLINE\"", "\"CAST\"", "\"RECORD\"",
+  "\"INTEGER\"", "\"REAL\"", "\"STRING\"", "\"REGEX\"", "\"FILE\"",
+  "\"DATE\"", "\"TIME\"", "\"DATETIME\"", "\"REFERENCE\"", "\"<=\"",
+  "\">=\"", "\"=\"", "\"~=\"", "\"<>\"", "\"AND\"", "\"OR\"", "\"NOT\"",
+  "\"character\"", "\"SET @VARIABLE\"", "\"DECLARE @VARIABLE\"",
+  "\"ABORT\"", "\"ALTER\"", "\"ANALYZE\"", "\"BEGIN\"", "\"CHECKPOINT\"",
+  "\"CLOSE\"", "\"CLUSTER\"", "\"COMMENT\"", "\"COMMIT\"", "\"COPY\"",
+  "\"CREATE\"", "\"DEALLOCATE\"", "\"DECLARE\"", "\"DELETE\"",
+  "\"DISCARD\"", "\"DROP\"", "\"END\"", "\"EXECUTE\"", "\"EXPLAIN\"",
+  "\"FETCH\"", "\"GRANT\"", "\"INSERT\"", "\"LISTEN\"", "\"LOAD\"",
+  "\"LOCK\"", "\"MOVE\"", "\"NOTIFY\"", "\"PREPARE\"", "\"REASSIGN\"",
+  "\"REINDEX\"", "\"RELEASE\"", "\"RESET\"", "\"REVOKE\"", "\"ROLLBACK\"",
+  "\"SAVEPOINT\"", "\"SELECT\"", "\"SET\"", "\"SHOW\"", "\"START\"",
+  "\"TRUNCATE\"", "\"UNLISTEN\"", "\"UPDATE\"", "\"VACUUM\"", "\"VALUES\"",
+  "\"IDENTIFIER\"", "\"INTEGER VALUE\"", "\"REAL VALUE\"",
+  "\"STRING VALUE\"", "'['", "']'", "'('", "')'", "'+'", "'-'", "'*'",
+  "'/'", "'%'", "'<'", "'>'", "','", "';'", "'{'", "'}'", "$accept",
+  "postfix_expression", "unary_expression", "cast_expression", "type_name",
+  "multiplicative_expression", "additive_expression",
   "relational_expression", "equality_expression", "logical_and_expression",
   "logical_or_expression", "expression", "random_generator", "statement",
   "statement_list", "compound_statement", "sql_statement",
   "sql_expression", "sql_query", "declaration_statement",
   "declaration_list", "declaration_element", "assign_statement",
   "assign_list", "assign_element", "selection_statement",
-  "iteration_statement", "jump_statement", "procedure_statement",
-  "record_declaration_list", "translation_unit", 0
+  "iteration_statement", "parallel_statement", "jump_statement",
+  "procedure_statement", "record_declaration_list", "translation_unit", YY_NULLPTR
   };
 #endif
 
-#if YYDEBUG
-  /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-  const pgsParser::rhs_number_type
-  pgsParser::yyrhs_[] =
-  {
-       135,     0,    -1,    86,    90,   116,    91,    90,   116,    91,
-      -1,    86,    90,   116,    91,    -1,    17,    92,    86,    93,
-      -1,    16,    92,    86,    93,    -1,    18,    92,   116,    93,
-      -1,    86,    -1,    87,    -1,    88,    -1,    89,    -1,    92,
-      77,    93,    -1,   117,    -1,    92,   116,    93,    -1,   106,
-      -1,    94,   108,    -1,    95,   108,    -1,    38,   108,    -1,
-     107,    -1,    20,    92,   108,    10,   109,    93,    -1,    22,
-      -1,    23,    -1,    24,    -1,    21,    -1,   108,    -1,   110,
-      96,   108,    -1,   110,    97,   108,    -1,   110,    98,   108,
-      -1,   110,    -1,   111,    94,   110,    -1,   111,    95,   110,
-      -1,   111,    -1,   112,    99,   111,    -1,   112,   100,   111,
-      -1,   112,    31,   111,    -1,   112,    32,   111,    -1,   112,
-      -1,   113,    33,   112,    -1,   113,    34,   112,    -1,   113,
-      35,   112,    -1,   113,    -1,   114,    36,   113,    -1,   114,
-      -1,   115,    37,   114,    -1,   115,    -1,    22,    92,   116,
-     101,   116,    93,    -1,    22,    92,   116,   101,   116,   101,
-     116,    93,    -1,    22,    92,   116,   101,   116,   101,   116,
-     101,   116,    93,    -1,    23,    92,   116,   101,   116,   101,
-     116,    93,    -1,    23,    92,   116,   101,   116,   101,   116,
-     101,   116,    93,    -1,    23,    92,   116,   101,   116,   101,
-     116,   101,   116,   101,   116,    93,    -1,    24,    92,   116,
-     101,   116,    93,    -1,    24,    92,   116,   101,   116,   101,
-     116,    93,    -1,    24,    92,   116,   101,   116,   101,   116,
-     101,   116,    93,    -1,    25,    92,   116,    93,    -1,    25,
-      92,   116,   101,   116,    93,    -1,    26,    92,   116,    93,
-      -1,    26,    92,   116,   101,   116,    93,    -1,    26,    92,
-     116,   101,   116,   101,   116,    93,    -1,    26,    92,   116,
-     101,   116,   101,   116,   101,   116,    93,    -1,    27,    92,
-     116,   101,   116,    93,    -1,    27,    92,   116,   101,   116,
-     101,   116,    93,    -1,    27,    92,   116,   101,   116,   101,
-     116,   101,   116,    93,    -1,    28,    92,   116,   101,   116,
-      93,    -1,    28,    92,   116,   101,   116,   101,   116,    93,
-      -1,    28,    92,   116,   101,   116,   101,   116,   101,   116,
-      93,    -1,    29,    92,   116,   101,   116,    93,    -1,    29,
-      92,   116,   101,   116,   101,   116,    93,    -1,    29,    92,
-     116,   101,   116,   101,   116,   101,   116,    93,    -1,    30,
-      92,   116,   101,   116,    93,    -1,    30,    92,   116,   101,
-     116,   101,   116,    93,    -1,    30,    92,   116,   101,   116,
-     101,   116,   101,   116,    93,    -1,   120,    -1,   130,    -1,
-     131,    -1,   121,   102,    -1,   133,   102,    -1,   132,   102,
-      -1,   124,   102,    -1,   127,   102,    -1,   118,    -1,   119,
-     118,    -1,    11,    12,    -1,    11,   119,    12,    -1,   122,
-      -1,   123,    -1,    42,    -1,    43,    -1,    44,    -1,    45,
-      -1,    46,    -1,    47,    -1,    48,    -1,    49,    -1,    50,
-      -1,    51,    -1,    52,    -1,    53,    -1,    54,    -1,    55,
-      -1,    56,    -1,    57,    -1,    58,    -1,    59,    -1,    60,
-      -1,    61,    -1,    62,    -1,    63,    -1,    64,    -1,    65,
-      -1,    66,    -1,    67,    -1,    68,    -1,    69,    -1,    70,
-      -1,    71,    -1,    72,    -1,    73,    -1,    74,    -1,    75,
-      -1,    76,    -1,    77,    -1,    78,    -1,    79,    -1,    80,
-      -1,    81,    -1,    82,    -1,    83,    -1,    84,    -1,    85,
-      -1,    41,   125,    -1,   126,    -1,   125,   101,   126,    -1,
-      86,    -1,    86,   103,   134,   104,    -1,    40,   128,    -1,
-     129,    -1,   128,   101,   129,    -1,    86,    33,   116,    -1,
-      86,    90,   116,    91,    90,   116,    91,    33,   116,    -1,
-      86,    33,   122,    -1,     7,   116,   118,    -1,     7,   116,
-     118,     8,   118,    -1,     3,   116,   118,    -1,     4,    -1,
-       5,    -1,     6,    -1,    14,   116,    -1,    13,   116,    -1,
-      19,    92,    86,    90,   116,    91,    93,    -1,    86,    -1,
-     134,   101,    86,    -1,     0,    -1,   119,     0,    -1
-  };
-
-  /* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-     YYRHS.  */
-  const unsigned short int
-  pgsParser::yyprhs_[] =
-  {
-         0,     0,     3,    11,    16,    21,    26,    31,    33,    35,
-      37,    39,    43,    45,    49,    51,    54,    57,    60,    62,
-      69,    71,    73,    75,    77,    79,    83,    87,    91,    93,
-      97,   101,   103,   107,   111,   115,   119,   121,   125,   129,
-     133,   135,   139,   141,   145,   147,   154,   163,   174,   183,
-     194,   207,   214,   223,   234,   239,   246,   251,   258,   267,
-     278,   285,   294,   305,   312,   321,   332,   339,   348,   359,
-     366,   375,   386,   388,   390,   392,   395,   398,   401,   404,
-     407,   409,   412,   415,   419,   421,   423,   425,   427,   429,
-     431,   433,   435,   437,   439,   441,   443,   445,   447,   449,
-     451,   453,   455,   457,   459,   461,   463,   465,   467,   469,
-     471,   473,   475,   477,   479,   481,   483,   485,   487,   489,
-     491,   493,   495,   497,   499,   501,   503,   505,   507,   509,
-     511,   514,   516,   520,   522,   527,   530,   532,   536,   540,
-     550,   554,   558,   564,   568,   570,   572,   574,   577,   580,
-     588,   590,   594,   596
-  };
 
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-  const unsigned short int
+#if YYDEBUG
+  const short
   pgsParser::yyrline_[] =
   {
-         0,   267,   267,   274,   281,   287,   293,   299,   305,   311,
-     317,   323,   329,   330,   338,   339,   340,   345,   354,   355,
-     364,   365,   366,   367,   371,   372,   379,   386,   396,   397,
-     404,   414,   415,   422,   429,   436,   446,   447,   454,   461,
-     471,   472,   482,   483,   493,   500,   508,   515,   522,   531,
-     539,   547,   555,   562,   569,   575,   581,   589,   597,   604,
-     611,   619,   626,   633,   641,   648,   655,   663,   670,   677,
-     685,   693,   703,   704,   705,   706,   707,   708,   709,   710,
-     714,   719,   727,   731,   739,   749,   758,   759,   760,   761,
-     762,   763,   764,   765,   766,   767,   768,   769,   770,   771,
-     772,   773,   774,   775,   776,   777,   778,   779,   780,   781,
-     782,   783,   784,   785,   786,   787,   788,   789,   790,   791,
-     792,   793,   794,   795,   796,   797,   798,   799,   800,   801,
-     805,   812,   818,   827,   837,   852,   859,   864,   873,   886,
-     901,   917,   929,   943,   956,   963,   970,   980,   990,   999,
-    1015,  1019,  1027,  1028
+       0,   271,   271,   278,   285,   291,   297,   303,   309,   315,
+     321,   327,   333,   334,   342,   343,   344,   349,   358,   359,
+     368,   369,   370,   371,   375,   376,   383,   390,   400,   401,
+     408,   418,   419,   426,   433,   440,   450,   451,   458,   465,
+     475,   476,   486,   487,   497,   504,   512,   519,   526,   535,
+     543,   551,   559,   566,   573,   579,   585,   593,   601,   608,
+     615,   623,   630,   637,   645,   652,   659,   667,   674,   681,
+     689,   697,   707,   708,   709,   710,   711,   712,   713,   714,
+     715,   719,   724,   732,   736,   744,   754,   763,   764,   765,
+     766,   767,   768,   769,   770,   771,   772,   773,   774,   775,
+     776,   777,   778,   779,   780,   781,   782,   783,   784,   785,
+     786,   787,   788,   789,   790,   791,   792,   793,   794,   795,
+     796,   797,   798,   799,   800,   801,   802,   803,   804,   805,
+     806,   810,   817,   823,   832,   842,   857,   864,   869,   878,
+     891,   906,   922,   934,   948,   961,   975,   982,   989,   999,
+    1009,  1018,  1034,  1038,  1046,  1047
   };
 
-  // Print the state stack on the debug stream.
   void
-  pgsParser::yystack_print_ ()
+  pgsParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
-    for (state_stack_type::const_iterator i = yystate_stack_.begin ();
-	 i != yystate_stack_.end (); ++i)
-      *yycdebug_ << ' ' << *i;
-    *yycdebug_ << std::endl;
+    for (stack_type::const_iterator
+           i = yystack_.begin (),
+           i_end = yystack_.end ();
+         i != i_end; ++i)
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  pgsParser::yy_reduce_print_ (int yyrule)
+  pgsParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
-    /* Print the symbols being reduced, and their result.  */
+    // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-	       << " (line " << yylno << "), ";
-    /* The symbols being reduced.  */
+               << " (line " << yylno << "):\n";
+    // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
-		       yyrhs_[yyprhs_[yyrule] + yyi],
-		       &(yysemantic_stack_[(yynrhs) - (yyi + 1)]),
-		       &(yylocation_stack_[(yynrhs) - (yyi + 1)]));
+                       yystack_[(yynrhs) - (yyi + 1)]);
   }
 #endif // YYDEBUG
 
-  /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-  pgsParser::token_number_type
-  pgsParser::yytranslate_ (int t)
+  pgsParser::symbol_kind_type
+  pgsParser::yytranslate_ (int t) YY_NOEXCEPT
   {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const signed char
     translate_table[] =
     {
-           0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,    98,     2,     2,
-      92,    93,    96,    94,   101,    95,     2,    97,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,   102,
-      99,     2,   100,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,    99,     2,     2,
+      93,    94,    97,    95,   102,    96,     2,    98,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,   103,
+     100,     2,   101,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,    90,     2,    91,     2,     2,     2,     2,     2,     2,
+       2,    91,     2,    92,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,   103,     2,   104,     2,     2,     2,     2,
+       2,     2,     2,   104,     2,   105,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -2667,29 +3165,24 @@ namespace pgscript
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
       65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
       75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89
+      85,    86,    87,    88,    89,    90
     };
-    if ((unsigned int) t <= yyuser_token_number_max_)
-      return translate_table[t];
+    // Last valid token kind.
+    const int code_max = 345;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return yyundef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
-  const int pgsParser::yyeof_ = 0;
-  const int pgsParser::yylast_ = 784;
-  const int pgsParser::yynnts_ = 31;
-  const int pgsParser::yyempty_ = -2;
-  const int pgsParser::yyfinal_ = 121;
-  const int pgsParser::yyterror_ = 1;
-  const int pgsParser::yyerrcode_ = 256;
-  const int pgsParser::yyntokens_ = 105;
-
-  const unsigned int pgsParser::yyuser_token_number_max_ = 344;
-  const pgsParser::token_number_type pgsParser::yyundef_token_ = 2;
+#line 37 "pgscript/pgsParser.yy"
+} // pgscript
+#line 3179 "pgscript/parser.tab.cc"
 
-} // namespace pgscript
-
-#line 1036 "pgscript/pgsParser.yy"
+#line 1055 "pgscript/pgsParser.yy"
  /*** Additional Code ***/
 
 void pgscript::pgsParser::error(const pgsParser::location_type & l,
@@ -2700,4 +3193,3 @@ void pgscript::pgsParser::error(const pgsParser::location_type & l,
 	driver.context.clear_stacks();
 	driver.error(l, wxString(m.c_str(), wxConvUTF8));
 }
-
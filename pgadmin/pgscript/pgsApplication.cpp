@@ -20,7 +20,8 @@
 pgsApplication::pgsApplication(const wxString &host, const wxString &database,
                                const wxString &user, const wxString &password, int port) :
 	m_mutex(1, 1), m_stream(1, 1), m_connection(pnew pgConn(host, wxEmptyString, wxEmptyString, database, user,
-	        password, port)), m_defined_conn(true), m_thread(0), m_caller(0)
+	        password, port)), m_defined_conn(true), m_thread(0), m_caller(0),
+	m_terminating(false)
 {
 	if (m_connection->GetStatus() != PGCONN_OK)
 	{
@@ -34,7 +35,8 @@ pgsApplication::pgsApplication(const wxString &host, const wxString &database,
 
 pgsApplication::pgsApplication(pgConn *connection) :
 	m_mutex(1, 1), m_stream(1, 1), m_connection(connection),
-	m_defined_conn(false), m_thread(0), m_caller(0)
+	m_defined_conn(false), m_thread(0), m_caller(0),
+	m_terminating(false)
 {
 	wxLogScript(wxT("Application created"));
 }
@@ -84,6 +86,7 @@ bool pgsApplication::ParseString(const wxString &string,
 bool pgsApplication::RunThread()
 {
 	bool created = false;
+	m_terminating = false;
 
 	if (m_thread != 0 && m_thread->Create() == wxTHREAD_NO_ERROR)
 	{
@@ -136,10 +139,25 @@ void pgsApplication::Terminate()
 	if (IsRunning())
 	{
 		wxLogScript(wxT("Deleting pgScript"));
+
+		// Queries run on the script thread itself: raise the flag first so
+		// that the thread sends no further statement, then cancel the query
+		// in progress, if any, so that the thread gets back to checking it
+		m_terminating = true;
+
+		if (m_connection != 0)
+			m_connection->CancelExecution();
+		m_thread->CancelWorkers();
+
 		m_thread->Delete();
 	}
 }
 
+bool pgsApplication::IsTerminating() const
+{
+	return m_terminating;
+}
+
 void pgsApplication::Complete()
 {
 	// If last_error_line() == -1 then there was no error
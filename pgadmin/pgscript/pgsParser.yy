@@ -19,7 +19,9 @@
 
 /*** YACC/Bison declarations ***/
 
-/* Require bison 2.3 or later */
+/* Generated with bison 3.8. Requiring no later version than 2.3 keeps bison
+ * writing position.hh and stack.hh, which parser.sh moves along with the
+ * other headers */
 %require "2.3"
 
 /* Start symbol is named "start" */
@@ -32,10 +34,10 @@
 %skeleton "lalr1.cc"
 
 /* Namespace to enclose parser in */
-%name-prefix="pgscript"
+%define api.namespace {pgscript}
 
 /* Set the parser's class identifier */
-%define "parser_class_name" "pgsParser"
+%define api.parser.class {pgsParser}
 
 /* Keep track of the current position within the input */
 %locations
@@ -51,7 +53,7 @@
 %parse-param { class pgsDriver & driver }
 
 /* Verbose error messages */
-%error-verbose
+%define parse.error verbose
 
 %token PGS_END	0			"END OF FILE"
 
@@ -63,6 +65,7 @@
 %token PGS_ELSE				"ELSE"
 %token PGS_WAITFOR			"WAITFOR"
 %token PGS_AS				"AS"
+%token PGS_PARALLEL			"PARALLEL"
 
 %token PGS_OPEN				"BEGIN (BLOCK)"
 %token PGS_CLOSE			"END (BLOCK)"
@@ -236,6 +239,7 @@
 %type<stmt> sql_statement
 %type<stmt> selection_statement
 %type<stmt> iteration_statement
+%type<stmt> parallel_statement
 %type<stmt> procedure_statement
 %type<stmt> jump_statement
 %type<stmt> declaration_statement
@@ -703,6 +707,7 @@ statement
 	: compound_statement		{ $$ = $1; }
 	| selection_statement		{ $$ = $1; }
 	| iteration_statement		{ $$ = $1; }
+	| parallel_statement		{ $$ = $1; }
 	| sql_statement ';'			{ $$ = $1; }
 	| procedure_statement ';'	{ $$ = $1; }
 	| jump_statement ';'		{ $$ = $1; }
@@ -741,7 +746,7 @@ sql_statement
 									$$ = pnew pgsExpressionStmt($1, &(driver.thread));
 									driver.context.pop_var(); // $1
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	;
 	
@@ -830,7 +835,7 @@ declaration_element
 									$$ = pnew pgsExpressionStmt(pnew pgsAssign(*($1),
 											pnew pgsString(wxT(""))), &(driver.thread));
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									pdelete($1);
 								}
@@ -841,7 +846,7 @@ declaration_element
 									$$ = pnew pgsDeclareRecordStmt(*($1), driver.context.columns(),
 											&(driver.thread));
 									driver.context.push_stmt($$); // pgsDeclareRecordStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									driver.context.clear_columns();
 									pdelete($1);
@@ -879,7 +884,7 @@ assign_element
 											&(driver.thread));
 									driver.context.pop_var(); // $3
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									pdelete($1);
 								}
@@ -894,7 +899,7 @@ assign_element
 									driver.context.pop_var(); driver.context.pop_var();
 									driver.context.pop_var(); // $3 & $6 & $9
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									pdelete($1);
 								}
@@ -907,7 +912,7 @@ assign_element
 											&(driver.thread));
 									driver.context.pop_var(); // $3
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									pdelete($1);
 								}
@@ -924,7 +929,7 @@ selection_statement
 									driver.context.pop_stmt(); // $3
 									driver.context.pop_stmt(); // stmt_list
 									driver.context.push_stmt($$); // pgsIfStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	| PGS_IF expression statement PGS_ELSE statement
 								{
@@ -935,7 +940,7 @@ selection_statement
 									driver.context.pop_stmt(); // $3
 									driver.context.pop_stmt(); // $5
 									driver.context.push_stmt($$); // pgsIfStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	;
 
@@ -948,7 +953,21 @@ iteration_statement
 									driver.context.pop_var(); // $2
 									driver.context.pop_stmt(); // $3
 									driver.context.push_stmt($$); // pgsWhileStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
+								}
+	;
+
+parallel_statement
+	: PGS_PARALLEL expression statement
+								{
+									wxLogScriptVerbose(wxT("PARALLEL %s"), $2->value().c_str());
+									
+									$$ = pnew pgsParallelStmt($2, $3, driver.context.m_cout,
+											&(driver.thread));
+									driver.context.pop_var(); // $2
+									driver.context.pop_stmt(); // $3
+									driver.context.push_stmt($$); // pgsParallelStmt
+									$$->set_position(@$.begin.line);
 								}
 	;
 	
@@ -958,21 +977,21 @@ jump_statement
 									
 									$$ = pnew pgsBreakStmt(&(driver.thread));
 									driver.context.push_stmt($$); // pgsBreakStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	| PGS_RETURN				{
 									wxLogScriptVerbose(wxT("RETURN"));
 									
 									$$ = pnew pgsBreakStmt(&(driver.thread));
 									driver.context.push_stmt($$); // pgsBreakStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	| PGS_CONTINUE				{
 									wxLogScriptVerbose(wxT("CONTINUE"));
 									
 									$$ = pnew pgsContinueStmt(&(driver.thread));
 									driver.context.push_stmt($$); // pgsContinueStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	;
 	
@@ -985,7 +1004,7 @@ procedure_statement
 											&(driver.thread));
 									driver.context.pop_var(); // $2
 									driver.context.push_stmt($$); // pgsPrintStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	| PGS_ASSERT expression
 								{
@@ -994,7 +1013,7 @@ procedure_statement
 									$$ = pnew pgsAssertStmt($2, &(driver.thread));
 									driver.context.pop_var(); // $2
 									driver.context.push_stmt($$); // pgsAssertStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 								}
 	| PGS_RM_LINE '(' PGS_IDENTIFIER '[' expression ']' ')'
 								{
@@ -1005,7 +1024,7 @@ procedure_statement
 											&(driver.thread));
 									driver.context.pop_var(); // $5
 									driver.context.push_stmt($$); // pgsExpressionStmt
-									$$->set_position(yyloc.begin.line);
+									$$->set_position(@$.begin.line);
 									
 									pdelete($3);
 								}
@@ -389,11 +389,65 @@ pgsScanner::~pgsScanner()
 
 }
 
+pgsParser::token_type pgsScanner::lex(pgsParser::semantic_type * yylval,
+		pgsParser::location_type * yylloc)
+{
+	if (m_pending.empty())
+	{
+		token_type t = scan(yylval, yylloc);
+		if (!letter(t))
+			return t;
+
+		// A word which is not a flex keyword comes as one PGS_UNKNOWN token
+		// per letter: read the whole word, and the token after it. A token
+		// spans the blanks before it on its line, so a letter that follows
+		// the previous one directly is on its line and spans one column
+		std::string word;
+		pgsToken next = { t, *yylval, *yylloc };
+		do
+		{
+			m_pending.push_back(next);
+			word += wx_static_cast(char, toupper(*YYText()));
+
+			next.token = scan(yylval, yylloc);
+			next.value = *yylval;
+			next.location = *yylloc;
+		}
+		while (letter(next.token)
+		        && next.location.begin.line == m_pending.back().location.end.line
+		        && next.location.end.column == next.location.begin.column + 1);
+
+		if (word == "PARALLEL")
+		{
+			yylloc->begin = m_pending.front().location.begin;
+			yylloc->end = m_pending.back().location.end;
+			m_pending.clear();
+			m_pending.push_back(next);
+			return token::PGS_PARALLEL;
+		}
+
+		m_pending.push_back(next);
+	}
+
+	pgsToken &front = m_pending.front();
+	token_type t = front.token;
+	*yylval = front.value;
+	*yylloc = front.location;
+	m_pending.pop_front();
+	return t;
+}
+
 void pgsScanner::set_debug(bool b)
 {
 	yy_flex_debug = b;
 }
 
+bool pgsScanner::letter(const pgsParser::token_type & t)
+{
+	const char c = *YYText();
+	return t == token::PGS_UNKNOWN && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'));
+}
+
 int pgsScanner::columns(const char & c)
 {
 	if ((c & 0xF0) == 0xF0) // 4 bytes
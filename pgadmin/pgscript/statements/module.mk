@@ -16,6 +16,7 @@ pgadmin3_SOURCES += \
 	pgscript/statements/pgsDeclareRecordStmt.cpp \
 	pgscript/statements/pgsExpressionStmt.cpp \
 	pgscript/statements/pgsIfStmt.cpp \
+	pgscript/statements/pgsParallelStmt.cpp \
 	pgscript/statements/pgsPrintStmt.cpp \
 	pgscript/statements/pgsProgram.cpp \
 	pgscript/statements/pgsStmt.cpp \
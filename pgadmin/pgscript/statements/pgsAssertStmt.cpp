@@ -32,3 +32,8 @@ void pgsAssertStmt::eval(pgsVarMap &vars) const
 		throw pgsAssertException(m_cond->value());
 	}
 }
+
+void pgsAssertStmt::resolve(pgsVarMap &vars) const
+{
+	m_cond->resolve(vars);
+}
@@ -26,3 +26,8 @@ void pgsExpressionStmt::eval(pgsVarMap &vars) const
 {
 	m_var->eval(vars);
 }
+
+void pgsExpressionStmt::resolve(pgsVarMap &vars) const
+{
+	m_var->resolve(vars);
+}
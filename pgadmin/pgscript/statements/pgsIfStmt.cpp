@@ -37,3 +37,10 @@ void pgsIfStmt::eval(pgsVarMap &vars) const
 		m_stmt_list_else->eval(vars);
 	}
 }
+
+void pgsIfStmt::resolve(pgsVarMap &vars) const
+{
+	m_cond->resolve(vars);
+	m_stmt_list_if->resolve(vars);
+	m_stmt_list_else->resolve(vars);
+}
@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "pgAdmin3.h"
+#include "pgscript/statements/pgsParallelStmt.h"
+
+#include "db/pgConn.h"
+#include "pgscript/exceptions/pgsInterruptException.h"
+#include "pgscript/exceptions/pgsParameterException.h"
+#include "pgscript/utilities/pgsThread.h"
+#include "pgscript/utilities/pgsWorker.h"
+
+pgsParallelStmt::pgsParallelStmt(const pgsExpression *workers, const pgsStmt *stmt,
+                                 pgsOutputStream &cout, pgsThread *app) :
+	pgsStmt(app), m_workers(workers), m_stmt(stmt), m_cout(cout)
+{
+
+}
+
+pgsParallelStmt::~pgsParallelStmt()
+{
+	pdelete(m_workers);
+	pdelete(m_stmt);
+}
+
+void pgsParallelStmt::eval(pgsVarMap &vars) const
+{
+	pgsOperand workers(m_workers->eval(vars));
+	long nb_workers = 0;
+	if (!workers->is_integer() || !workers->value().ToLong(&nb_workers)
+	        || nb_workers < 1)
+	{
+		throw pgsParameterException(wxString() << wxT("PARALLEL ")
+		                            << m_workers->value()
+		                            << wxT(":\nthe number of workers should be a positive integer"));
+	}
+
+	pgConn *conn = (m_app != 0) ? m_app->connection() : 0;
+	if (conn == 0 || conn->GetStatus() != PGCONN_OK)
+	{
+		throw pgsParameterException(wxString() << wxT("PARALLEL ")
+		                            << m_workers->value()
+		                            << wxT(":\nthere is no connection to duplicate"));
+	}
+
+	// All the connections are opened before any worker starts. The other
+	// workers of an enclosing block go on meanwhile
+	wxArrayPtrVoid connections;
+	wxString error;
+	m_app->UnlockInterpreter();
+	for (long i = 0; i < nb_workers && error.IsEmpty(); i++)
+	{
+		pgConn *worker_conn = conn->Duplicate();
+		if (worker_conn->GetStatus() != PGCONN_OK)
+		{
+			error = worker_conn->GetLastError().Strip(wxString::both);
+			pdelete(worker_conn);
+		}
+		else
+		{
+			connections.Add(worker_conn);
+		}
+	}
+	m_app->LockInterpreter();
+
+	if (!error.IsEmpty())
+	{
+		for (size_t i = 0; i < connections.GetCount(); i++)
+		{
+			pgConn *worker_conn = (pgConn *) connections.Item(i);
+			pdelete(worker_conn);
+		}
+
+		throw pgsParameterException(wxString() << wxT("PARALLEL ")
+		                            << m_workers->value()
+		                            << wxT(":\ncannot open a connection for a worker\n")
+		                            << error);
+	}
+
+	// A worker takes the connection it is given
+	wxArrayPtrVoid started;
+	bool failed = false;
+	for (long i = 0; i < nb_workers; i++)
+	{
+		pgsWorker *worker = new pgsWorker(*m_app, m_stmt, vars,
+		                                  (pgConn *) connections.Item(i), i, nb_workers);
+		if (!failed && m_app->RunWorker(worker))
+		{
+			started.Add(worker);
+		}
+		else
+		{
+			if (!failed)
+				wxLogError(wxT("PGSCRIPT: Thread error"));
+			failed = true;
+			pdelete(worker);
+		}
+	}
+
+	// The workers take the interpreter in turn until they are all done
+	m_app->UnlockInterpreter();
+	for (size_t i = 0; i < started.GetCount(); i++)
+	{
+		m_app->WaitWorker((pgsWorker *) started.Item(i));
+	}
+	m_app->LockInterpreter();
+
+	m_app->LockOutput();
+	pgsOutputStream &out = m_app->output(m_cout);
+	for (size_t i = 0; i < started.GetCount(); i++)
+	{
+		pgsWorker *worker = (pgsWorker *) started.Item(i);
+		out << worker->output();
+		failed = failed || worker->failed();
+	}
+	m_app->UnlockOutput();
+
+	for (size_t i = 0; i < started.GetCount(); i++)
+	{
+		pgsWorker *worker = (pgsWorker *) started.Item(i);
+		pdelete(worker);
+	}
+
+	// Errors of the workers have been written with their output
+	if (failed || m_app->TestDestroy())
+		throw pgsInterruptException();
+}
+
+void pgsParallelStmt::resolve(pgsVarMap &vars) const
+{
+	m_workers->resolve(vars);
+	m_stmt->resolve(vars);
+}
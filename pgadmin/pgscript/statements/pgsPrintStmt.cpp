@@ -29,28 +29,23 @@ pgsPrintStmt::~pgsPrintStmt()
 
 void pgsPrintStmt::eval(pgsVarMap &vars) const
 {
+	// The value is computed before the output is locked: it may run a query,
+	// during which the other workers of a PARALLEL block write theirs
+	wxString value(m_var->eval(vars)->value());
+
 	if (m_app != 0)
 	{
 		m_app->LockOutput();
+		m_app->output(m_cout) << PGSOUTPGSCRIPT << value << wxT("\n");
+		m_app->UnlockOutput();
 	}
-
-	try
-	{
-		m_cout << PGSOUTPGSCRIPT << wx_static_cast(const wxString,
-		        m_var->eval(vars)->value()) << wxT("\n");
-	}
-	catch (const pgsException &)
+	else
 	{
-		if (m_app != 0)
-		{
-			m_app->UnlockOutput();
-		}
-
-		throw;
+		m_cout << PGSOUTPGSCRIPT << value << wxT("\n");
 	}
+}
 
-	if (m_app != 0)
-	{
-		m_app->UnlockOutput();
-	}
+void pgsPrintStmt::resolve(pgsVarMap &vars) const
+{
+	m_var->resolve(vars);
 }
@@ -46,6 +46,9 @@ void pgsProgram::eval(pgsStmtList *stmt_list)
 
 	try
 	{
+		// Identifiers are given their slot in one pass, reading a variable
+		// is then an index in an array
+		stmt_list->resolve(m_vars);
 		stmt_list->eval(m_vars);
 	}
 	catch (const pgsException &)
@@ -31,3 +31,8 @@ int pgsStmt::line() const
 {
 	return m_line;
 }
+
+void pgsStmt::resolve(pgsVarMap &vars) const
+{
+
+}
@@ -63,8 +63,9 @@ void pgsStmtList::eval(pgsVarMap &vars) const
 					m_app->last_error_line(current->line());
 				}
 
-				m_cout << wx_static_cast(const wxString, e.message())
-				       << wxT(" on line ") << current->line() << wxT("\n");
+				pgsOutputStream &out = (m_app != 0) ? m_app->output(m_cout) : m_cout;
+				out << wx_static_cast(const wxString, e.message())
+				    << wxT(" on line ") << current->line() << wxT("\n");
 				m_exception_thrown = true;
 
 				if (m_app != 0)
@@ -84,9 +85,10 @@ void pgsStmtList::eval(pgsVarMap &vars) const
 					m_app->last_error_line(current->line());
 				}
 
-				m_cout << PGSOUTERROR << _("Unknown exception:\n")
-				       << wx_static_cast(const wxString,
-				                         wxString(e.what(), wxConvUTF8));
+				pgsOutputStream &out = (m_app != 0) ? m_app->output(m_cout) : m_cout;
+				out << PGSOUTERROR << _("Unknown exception:\n")
+				    << wx_static_cast(const wxString,
+				                      wxString(e.what(), wxConvUTF8));
 				m_exception_thrown = true;
 
 				if (m_app != 0)
@@ -113,3 +115,12 @@ void pgsStmtList::insert_back(pgsStmt *stmt)
 {
 	m_stmt_list.push_back(stmt);
 }
+
+void pgsStmtList::resolve(pgsVarMap &vars) const
+{
+	pgsListStmt::const_iterator it;
+	for (it = m_stmt_list.begin(); it != m_stmt_list.end(); it++)
+	{
+		(*it)->resolve(vars);
+	}
+}
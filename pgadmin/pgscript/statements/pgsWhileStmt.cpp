@@ -54,3 +54,9 @@ loop:
 end:
 	;
 }
+
+void pgsWhileStmt::resolve(pgsVarMap &vars) const
+{
+	m_cond->resolve(vars);
+	m_stmt_list->resolve(vars);
+}
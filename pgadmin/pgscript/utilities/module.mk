@@ -15,7 +15,8 @@ pgadmin3_SOURCES += \
 	pgscript/utilities/pgsDriver.cpp \
 	pgscript/utilities/pgsMapm.cpp \
 	pgscript/utilities/pgsThread.cpp \
-	pgscript/utilities/pgsUtilities.cpp
+	pgscript/utilities/pgsUtilities.cpp \
+	pgscript/utilities/pgsWorker.cpp
 
 EXTRA_DIST += \
 	pgscript/utilities/module.mk
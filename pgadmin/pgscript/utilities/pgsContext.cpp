@@ -14,6 +14,7 @@
 #include <wx/datetime.h>
 #include <wx/regex.h>
 #include <typeinfo>
+#include "pgscript/expressions/pgsSeed.h"
 #include "pgscript/objects/pgsNumber.h"
 #include "pgscript/objects/pgsString.h"
 #include "pgscript/statements/pgsExpressionStmt.h"
@@ -46,9 +47,9 @@ pgsVariable *pgsContext::one()
 	return one;
 }
 
-pgsVariable *pgsContext::seed()
+pgsExpression *pgsContext::seed()
 {
-	pgsVariable *seed = pnew pgsNumber(wxString() << wxDateTime::GetTimeNow());
+	pgsExpression *seed = pnew pgsSeed();
 	push_var(seed);
 	return seed;
 }
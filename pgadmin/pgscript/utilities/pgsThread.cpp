@@ -11,10 +11,12 @@
 #include "pgAdmin3.h"
 #include "pgscript/utilities/pgsThread.h"
 
+#include "db/pgConn.h"
 #include "pgscript/pgsApplication.h"
 #include "pgscript/statements/pgsProgram.h"
 #include "pgscript/utilities/pgsContext.h"
 #include "pgscript/utilities/pgsDriver.h"
+#include "pgscript/utilities/pgsWorker.h"
 
 pgsThread::pgsThread(pgsVarMap &vars, wxSemaphore &mutex,
                      pgConn *connection, const wxString &file, pgsOutputStream &out,
@@ -52,6 +54,8 @@ void *pgsThread::Entry()
 	pgsContext context(m_out);
 	pgscript::pgsDriver driver(context, program, *this);
 
+	LockInterpreter();
+
 	if (m_conv)
 	{
 		wxLogScript(wxT("Parsing file"));
@@ -65,12 +69,30 @@ void *pgsThread::Entry()
 		wxLogScript(wxT("String  parsed"));
 	}
 
+	UnlockInterpreter();
+
 	return 0;
 }
 
+bool pgsThread::TestDestroy()
+{
+	// wxThread::TestDestroy() can only be called by this thread
+	if (worker() != 0)
+		return m_app.IsTerminating();
+
+	return m_app.IsTerminating() || wxThread::TestDestroy();
+}
+
 pgConn *pgsThread::connection()
 {
-	return m_connection;
+	pgsWorker *current = worker();
+	return current != 0 ? current->connection() : m_connection;
+}
+
+pgsOutputStream &pgsThread::output(pgsOutputStream &out)
+{
+	pgsWorker *current = worker();
+	return current != 0 ? current->out() : out;
 }
 
 void pgsThread::LockOutput()
@@ -83,6 +105,63 @@ void pgsThread::UnlockOutput()
 	m_app.UnlockOutput();
 }
 
+void pgsThread::LockInterpreter()
+{
+	m_interpreter.Lock();
+}
+
+void pgsThread::UnlockInterpreter()
+{
+	m_interpreter.Unlock();
+}
+
+bool pgsThread::RunWorker(pgsWorker *worker)
+{
+	if (worker->Create() != wxTHREAD_NO_ERROR)
+		return false;
+
+	worker->SetPriority(WXTHREAD_MIN_PRIORITY);
+
+	// The worker looks itself up once it runs
+	wxCriticalSectionLocker lock(m_workers_cs);
+	if (worker->Run() != wxTHREAD_NO_ERROR)
+		return false;
+
+	m_workers.Add(worker);
+	return true;
+}
+
+void pgsThread::WaitWorker(pgsWorker *worker)
+{
+	worker->Wait();
+
+	wxCriticalSectionLocker lock(m_workers_cs);
+	m_workers.Remove(worker);
+}
+
+void pgsThread::CancelWorkers()
+{
+	wxCriticalSectionLocker lock(m_workers_cs);
+	for (size_t i = 0; i < m_workers.GetCount(); i++)
+	{
+		((pgsWorker *) m_workers.Item(i))->connection()->CancelExecution();
+	}
+}
+
+pgsWorker *pgsThread::worker()
+{
+	wxThreadIdType id = wxThread::GetCurrentId();
+
+	wxCriticalSectionLocker lock(m_workers_cs);
+	for (size_t i = 0; i < m_workers.GetCount(); i++)
+	{
+		pgsWorker *current = (pgsWorker *) m_workers.Item(i);
+		if (current->GetId() == id)
+			return current;
+	}
+	return 0;
+}
+
 void pgsThread::last_error_line(int line)
 {
 	m_last_error_line = line;
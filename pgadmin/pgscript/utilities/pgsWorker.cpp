@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgScript - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+//////////////////////////////////////////////////////////////////////////
+
+
+#include "pgAdmin3.h"
+#include "pgscript/utilities/pgsWorker.h"
+
+#include "db/pgConn.h"
+#include "pgscript/exceptions/pgsBreakException.h"
+#include "pgscript/exceptions/pgsContinueException.h"
+#include "pgscript/objects/pgsNumber.h"
+#include "pgscript/statements/pgsStmtList.h"
+#include "pgscript/utilities/pgsThread.h"
+
+pgsWorker::pgsWorker(pgsThread &app, const pgsStmt *stmt, const pgsVarMap &vars,
+                     pgConn *connection, const int &worker, const int &nb_workers) :
+	wxThread(wxTHREAD_JOINABLE), m_app(app), m_stmt(stmt), m_vars(vars),
+	m_connection(connection), m_output_stream(&m_output),
+	m_out(m_output_stream, wxEOL_UNIX), m_failed(false)
+{
+	m_vars[wxT("@WORKER")] = pnew pgsNumber(wxString() << worker);
+	m_vars[wxT("@WORKERS")] = pnew pgsNumber(wxString() << nb_workers);
+}
+
+pgsWorker::~pgsWorker()
+{
+	pdelete(m_connection);
+}
+
+void *pgsWorker::Entry()
+{
+	m_app.LockInterpreter();
+
+	try
+	{
+		m_stmt->eval(m_vars);
+	}
+	catch (const pgsBreakException &)
+	{
+		// BREAK or RETURN ends the statement of this worker only
+	}
+	catch (const pgsContinueException &)
+	{
+
+	}
+	catch (const pgsException &e)
+	{
+		// Errors in a block have been written by its statement list
+		if (!pgsStmtList::m_exception_thrown)
+		{
+			m_app.last_error_line(m_stmt->line());
+			m_out << wx_static_cast(const wxString, e.message())
+			      << wxT(" on line ") << m_stmt->line() << wxT("\n");
+			pgsStmtList::m_exception_thrown = true;
+		}
+		m_failed = true;
+	}
+	catch (const std::exception &e)
+	{
+		if (!pgsStmtList::m_exception_thrown)
+		{
+			m_app.last_error_line(m_stmt->line());
+			m_out << PGSOUTERROR << _("Unknown exception:\n")
+			      << wx_static_cast(const wxString,
+			                        wxString(e.what(), wxConvUTF8));
+			pgsStmtList::m_exception_thrown = true;
+		}
+		m_failed = true;
+	}
+
+	// Values are only released with the interpreter held
+	m_vars.clear();
+
+	m_app.UnlockInterpreter();
+
+	return 0;
+}
+
+pgConn *pgsWorker::connection()
+{
+	return m_connection;
+}
+
+pgsOutputStream &pgsWorker::out()
+{
+	return m_out;
+}
+
+const wxString &pgsWorker::output() const
+{
+	return m_output;
+}
+
+bool pgsWorker::failed() const
+{
+	return m_failed;
+}
@@ -0,0 +1,160 @@
+//////////////////////////////////////////////////////////////////////////
+//
+// pgAdmin III - PostgreSQL Tools
+//
+// Copyright (C) 2002 - 2014, The pgAdmin Development Team
+// This software is released under the PostgreSQL Licence
+//
+// pgCatalogSnapshot.cpp - Catalog rows read for many relations at once
+//
+//////////////////////////////////////////////////////////////////////////
+
+// wxWindows headers
+#include <wx/wx.h>
+#include <wx/timer.h>
+
+// App headers
+#include "pgAdmin3.h"
+#include "utils/sysLogger.h"
+#include "db/pgSet.h"
+#include "schema/pgCatalogSnapshot.h"
+#include "schema/pgDatabase.h"
+#include "schema/pgCollection.h"
+#include "ctl/ctlTree.h"
+
+
+WX_DECLARE_STRING_HASH_MAP(wxArrayLong, pgCatalogSnapshotRows);
+
+// The rows of one query for a number of owners
+class pgCatalogSnapshotBatch
+{
+public:
+	pgCatalogSnapshotBatch(pgSet *_set) : set(_set), loaded(wxGetLocalTime()) {}
+	~pgCatalogSnapshotBatch()
+	{
+		delete set;
+	}
+
+	pgSet *set;
+	long loaded;
+
+	// Row numbers by owner oid; owners whose rows have been handed
+	// out already are not in there.
+	pgCatalogSnapshotRows rows;
+};
+
+
+pgCatalogSnapshot::~pgCatalogSnapshot()
+{
+	Invalidate();
+}
+
+
+void pgCatalogSnapshot::Invalidate()
+{
+	pgCatalogSnapshotHash::iterator it;
+	for (it = batches.begin(); it != batches.end(); ++it)
+		delete it->second;
+	batches.clear();
+}
+
+
+pgSet *pgCatalogSnapshot::ExecuteSet(pgCollection *collection, ctlTree *browser, const wxString &sql, const wxString &relColumn)
+{
+	wxString oidStr = collection->GetOidStr();
+
+	// Without the tree, there is no telling what will be expanded next
+	if (!browser || !collection->GetId().IsOk() || settings->GetCatalogSnapshotSize() < 2)
+	{
+		wxString query = sql;
+		query.Replace(SNAPSHOT_RELATIONS, wxT("(") + oidStr + wxT(")"));
+		return collection->GetDatabase()->ExecuteSet(query);
+	}
+
+	pgCatalogSnapshot *snapshot = collection->GetDatabase()->GetCatalogSnapshot();
+
+	pgCatalogSnapshotBatch *batch = 0;
+	pgCatalogSnapshotHash::iterator it = snapshot->batches.find(sql);
+	if (it != snapshot->batches.end())
+	{
+		batch = it->second;
+		if (batch->rows.find(oidStr) == batch->rows.end() || wxGetLocalTime() - batch->loaded > SNAPSHOT_MAX_AGE)
+		{
+			delete batch;
+			snapshot->batches.erase(it);
+			batch = 0;
+		}
+	}
+
+	if (!batch)
+	{
+		batch = snapshot->Load(collection, browser, sql, relColumn);
+		if (!batch)
+			return 0;
+		snapshot->batches[sql] = batch;
+	}
+
+	pgCatalogSnapshotRows::iterator rows = batch->rows.find(oidStr);
+	pgSet *set = new pgSet(*batch->set, rows->second);
+	batch->rows.erase(rows);
+
+	return set;
+}
+
+
+pgCatalogSnapshotBatch *pgCatalogSnapshot::Load(pgCollection *collection, ctlTree *browser, const wxString &sql, const wxString &relColumn)
+{
+	// The schema or relation the collection belongs to, and the ones
+	// following it
+	wxArrayString oids;
+	oids.Add(collection->GetOidStr());
+	wxString oidList = collection->GetOidStr();
+
+	wxTreeItemId ownerItem = browser->GetItemParent(collection->GetId());
+	pgObject *owner = ownerItem ? browser->GetObject(ownerItem) : 0;
+	if (owner)
+	{
+		size_t maxOwners = (size_t)settings->GetCatalogSnapshotSize();
+		wxTreeItemId item = browser->GetNextSibling(ownerItem);
+
+		while (item && oids.GetCount() < maxOwners)
+		{
+			pgObject *obj = browser->GetObject(item);
+			if (obj && obj->GetMetaType() == owner->GetMetaType())
+			{
+				oids.Add(obj->GetOidStr());
+				oidList += wxT(", ") + obj->GetOidStr();
+			}
+			item = browser->GetNextSibling(item);
+		}
+	}
+
+	wxString query = sql;
+	query.Replace(SNAPSHOT_RELATIONS, wxT("(") + oidList + wxT(")"));
+
+	wxStopWatch stopWatch;
+	pgSet *set = collection->GetDatabase()->ExecuteSet(query);
+	if (!set)
+		return 0;
+
+	pgCatalogSnapshotBatch *batch = new pgCatalogSnapshotBatch(set);
+
+	// Owners without any rows get an entry too, so that they don't
+	// cause the query to be run again.
+	size_t i;
+	for (i = 0; i < oids.GetCount(); i++)
+		batch->rows[oids.Item(i)] = wxArrayLong();
+
+	long row = 0;
+	while (!set->Eof())
+	{
+		batch->rows[set->GetVal(relColumn)].Add(row++);
+		set->MoveNext();
+	}
+	set->MoveFirst();
+
+	wxLogInfo(wxT("Catalog snapshot: %ld rows for %d owners read in %ld ms"),
+	          set->NumRows(), (int)oids.GetCount(), stopWatch.Time());
+
+	return batch;
+}
@@ -550,12 +550,12 @@ pgObject *pgColumnFactory::CreateObjects(pgCollection *coll, ctlTree *browser, c
 	int currentlimit;
 
 	// grab inherited tables
-	sql = wxT("SELECT inhparent::regclass AS inhrelname,\n")
+	sql = wxT("SELECT inhrelid, inhparent::regclass AS inhrelname,\n")
 	      wxT("  (SELECT count(*) FROM pg_attribute WHERE attrelid=inhparent AND attnum>0) AS colscount\n")
 	      wxT("  FROM pg_inherits\n")
-	      wxT("  WHERE inhrelid =  ") + collection->GetOidStr() + wxT("::oid\n")
+	      wxT("  WHERE inhrelid IN ") + SNAPSHOT_RELATIONS + wxT("\n")
 	      wxT("  ORDER BY inhseqno");
-	pgSet *inhtables = database->ExecuteSet(sql);
+	pgSet *inhtables = pgCatalogSnapshot::ExecuteSet(collection, browser, sql, wxT("inhrelid"));
 
 	wxString systemRestriction;
 	if (!settings->GetShowSystemObjects())
@@ -596,12 +596,12 @@ pgObject *pgColumnFactory::CreateObjects(pgCollection *coll, ctlTree *browser, c
 	if (database->BackendMinimumVersion(9, 1))
 		sql += wxT("  LEFT OUTER JOIN pg_collation coll ON att.attcollation=coll.oid\n")
 		       wxT("  LEFT OUTER JOIN pg_namespace nspc ON coll.collnamespace=nspc.oid\n");
-	sql += wxT(" WHERE att.attrelid = ") + collection->GetOidStr()
+	sql += wxT(" WHERE att.attrelid IN ") + SNAPSHOT_RELATIONS
 	       + restriction + systemRestriction + wxT("\n")
 	       wxT("   AND att.attisdropped IS FALSE\n")
 	       wxT(" ORDER BY att.attnum");
 
-	pgSet *columns = database->ExecuteSet(sql);
+	pgSet *columns = pgCatalogSnapshot::ExecuteSet(collection, browser, sql, wxT("attrelid"));
 	if (columns)
 	{
 		currentcol = 0;
@@ -16,6 +16,7 @@
 #include "pgAdmin3.h"
 #include "utils/misc.h"
 #include "utils/pgfeatures.h"
+#include "db/pgConnPool.h"
 #include "frm/frmMain.h"
 #include "schema/edbSynonym.h"
 #include "schema/pgCast.h"
@@ -36,6 +37,7 @@ pgDatabase::pgDatabase(const wxString &newName)
 	allowConnections = true;
 	connected = false;
 	conn = NULL;
+	catalogSnapshot = 0;
 	missingFKs = 0;
 	canDebugPlpgsql = 0;
 	canDebugEdbspl = 0;
@@ -45,6 +47,9 @@ pgDatabase::pgDatabase(const wxString &newName)
 pgDatabase::~pgDatabase()
 {
 	Disconnect();
+
+	if (catalogSnapshot)
+		delete catalogSnapshot;
 }
 
 
@@ -231,6 +236,11 @@ void pgDatabase::Disconnect()
 	if (conn)
 		delete conn;
 	conn = 0;
+
+	// Pooled sessions would keep the database from being dropped or renamed
+	pgConn *serverConn = server ? server->GetConnection() : 0;
+	if (serverConn)
+		pgConnPool::CloseDatabase(serverConn->GetPoolServer(), GetName());
 }
 
 
@@ -394,6 +404,9 @@ bool pgDatabase::ExecuteVoid(const wxString &sql, bool reportError)
 		rc = connection()->ExecuteVoid(sql, reportError);
 		if (!rc)
 			CheckAlive();
+
+		// Whatever ran may have changed the catalog
+		InvalidateCatalogSnapshot();
 	}
 	return rc;
 }
@@ -495,6 +508,8 @@ void pgDatabase::AppendSchemaChange(const wxString &sql)
 	schemaChanges.Append(wxT("-- ") + DateToStr(dt) + wxT("\n"));
 	schemaChanges.Append(sql);
 	schemaChanges.Append(wxT("\n\n"));
+
+	InvalidateCatalogSnapshot();
 }
 
 bool pgDatabase::DropObject(wxFrame *frame, ctlTree *browser, bool cascaded)
@@ -661,20 +661,29 @@ pgFunction *pgFunctionFactory::AppendFunctions(pgObject *obj, pgSchema *schema,
 		         wxT("(SELECT array_agg(provider) FROM pg_seclabels sl2 WHERE sl2.objoid=pr.oid) AS providers");
 	}
 
-	pgSet *functions = obj->GetDatabase()->ExecuteSet(
-	                       wxT("SELECT pr.oid, pr.xmin, pr.*, format_type(TYP.oid, NULL) AS typname, typns.nspname AS typnsp, lanname, ") +
-	                       argNamesCol  + argDefsCol + proConfigCol + proType +
-	                       wxT("       pg_get_userbyid(proowner) as funcowner, description") + seclab + wxT("\n")
-	                       wxT("  FROM pg_proc pr\n")
-	                       wxT("  JOIN pg_type typ ON typ.oid=prorettype\n")
-	                       wxT("  JOIN pg_namespace typns ON typns.oid=typ.typnamespace\n")
-	                       wxT("  JOIN pg_language lng ON lng.oid=prolang\n")
-	                       wxT("  LEFT OUTER JOIN pg_description des ON (des.objoid=pr.oid AND des.classoid='pg_proc'::regclass)\n")
-	                       + restriction +
-	                       wxT(" ORDER BY proname"));
-
-	pgSet *types = obj->GetDatabase()->ExecuteSet(wxT(
-	                   "SELECT oid, format_type(oid, NULL) AS typname FROM pg_type"));
+	wxString sql = wxT("SELECT pr.oid, pr.xmin, pr.*, format_type(TYP.oid, NULL) AS typname, typns.nspname AS typnsp, lanname, ") +
+	               argNamesCol  + argDefsCol + proConfigCol + proType +
+	               wxT("       pg_get_userbyid(proowner) as funcowner, description") + seclab + wxT("\n")
+	               wxT("  FROM pg_proc pr\n")
+	               wxT("  JOIN pg_type typ ON typ.oid=prorettype\n")
+	               wxT("  JOIN pg_namespace typns ON typns.oid=typ.typnamespace\n")
+	               wxT("  JOIN pg_language lng ON lng.oid=prolang\n")
+	               wxT("  LEFT OUTER JOIN pg_description des ON (des.objoid=pr.oid AND des.classoid='pg_proc'::regclass)\n")
+	               + restriction +
+	               wxT(" ORDER BY proname");
+
+	// The collections of a schema may take their rows from the snapshot
+	pgSet *functions;
+	if (obj->IsCollection())
+		functions = pgCatalogSnapshot::ExecuteSet((pgCollection *)obj, browser, sql, wxT("pronamespace"));
+	else
+		functions = obj->GetDatabase()->ExecuteSet(sql);
+
+	// Only needed to name the argument types of the functions found
+	pgSet *types = 0;
+	if (functions && !functions->Eof())
+		types = obj->GetDatabase()->ExecuteSet(wxT(
+		            "SELECT oid, format_type(oid, NULL) AS typname FROM pg_type"));
 
 	if (types)
 	{
@@ -1042,8 +1051,8 @@ wxString pgProcedure::GetExecSql(ctlTree *browser)
 pgObject *pgFunctionFactory::CreateObjects(pgCollection *collection, ctlTree *browser, const wxString &restr)
 {
 	wxString funcRestriction = wxT(
-	                               " WHERE proisagg = FALSE AND pronamespace = ") + NumToStr(collection->GetSchema()->GetOid())
-	                           + wxT("::oid\n   AND typname NOT IN ('trigger', 'event_trigger') \n");
+	                               " WHERE proisagg = FALSE AND pronamespace IN ") + SNAPSHOT_RELATIONS
+	                           + wxT("\n   AND typname NOT IN ('trigger', 'event_trigger') \n");
 
 	if (collection->GetConnection()->EdbMinimumVersion(8, 1))
 		funcRestriction += wxT("   AND NOT (lanname = 'edbspl' AND protype = '1')\n");
@@ -1063,8 +1072,8 @@ pgCollection *pgFunctionFactory::CreateCollection(pgObject *obj)
 pgObject *pgTriggerFunctionFactory::CreateObjects(pgCollection *collection, ctlTree *browser, const wxString &restr)
 {
 	wxString funcRestriction = wxT(
-	                               " WHERE proisagg = FALSE AND pronamespace = ") + NumToStr(collection->GetSchema()->GetOid())
-	                           + wxT("::oid\n");
+	                               " WHERE proisagg = FALSE AND pronamespace IN ") + SNAPSHOT_RELATIONS
+	                           + wxT("\n");
 	if(collection->GetConnection()->BackendMinimumVersion(9, 3))
 	{
 		funcRestriction += wxT("AND (typname IN ('trigger', 'event_trigger') \nAND lanname NOT IN ('edbspl', 'sql', 'internal'))");
@@ -1082,8 +1091,8 @@ pgObject *pgTriggerFunctionFactory::CreateObjects(pgCollection *collection, ctlT
 pgObject *pgProcedureFactory::CreateObjects(pgCollection *collection, ctlTree *browser, const wxString &restr)
 {
 	wxString funcRestriction = wxT(
-	                               " WHERE proisagg = FALSE AND pronamespace = ") + NumToStr(collection->GetSchema()->GetOid())
-	                           + wxT("::oid AND lanname = 'edbspl'\n");
+	                               " WHERE proisagg = FALSE AND pronamespace IN ") + SNAPSHOT_RELATIONS
+	                           + wxT(" AND lanname = 'edbspl'\n");
 
 	if (collection->GetConnection()->EdbMinimumVersion(8, 1))
 		funcRestriction += wxT("   AND protype = '1'\n");
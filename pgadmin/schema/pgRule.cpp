@@ -202,16 +202,16 @@ pgObject *pgRuleFactory::CreateObjects(pgCollection *collection, ctlTree *browse
 {
 	pgRule *rule = 0;
 
-	pgSet *rules = collection->GetDatabase()->ExecuteSet(
+	pgSet *rules = pgCatalogSnapshot::ExecuteSet(collection, browser,
 	                   wxT("SELECT rw.oid, rw.*, relname, CASE WHEN relkind = 'r' THEN TRUE ELSE FALSE END AS parentistable, nspname, description,\n")
 	                   wxT("       pg_get_ruledef(rw.oid") + collection->GetDatabase()->GetPrettyOption() + wxT(") AS definition\n")
 	                   wxT("  FROM pg_rewrite rw\n")
 	                   wxT("  JOIN pg_class cl ON cl.oid=rw.ev_class\n")
 	                   wxT("  JOIN pg_namespace nsp ON nsp.oid=cl.relnamespace\n")
 	                   wxT("  LEFT OUTER JOIN pg_description des ON (des.objoid=rw.oid AND des.classoid='pg_rewrite'::regclass)\n")
-	                   wxT(" WHERE ev_class = ") + NumToStr(collection->GetOid())
+	                   wxT(" WHERE ev_class IN ") + SNAPSHOT_RELATIONS
 	                   + restriction + wxT("\n")
-	                   wxT(" ORDER BY rw.rulename"));
+	                   wxT(" ORDER BY rw.rulename"), wxT("ev_class"));
 
 	if (rules)
 	{
@@ -283,7 +283,7 @@ pgObject *pgSequenceFactory::CreateObjects(pgCollection *collection, ctlTree *br
 	pgSequence *sequence = 0;
 	wxString sql;
 
-	sql = wxT("SELECT cl.oid, relname, pg_get_userbyid(relowner) AS seqowner, relacl, description");
+	sql = wxT("SELECT cl.oid, relname, relnamespace, pg_get_userbyid(relowner) AS seqowner, relacl, description");
 	if (collection->GetDatabase()->BackendMinimumVersion(9, 1))
 	{
 		sql += wxT(",\n(SELECT array_agg(label) FROM pg_seclabels sl1 WHERE sl1.objoid=cl.oid) AS labels");
@@ -291,11 +291,11 @@ pgObject *pgSequenceFactory::CreateObjects(pgCollection *collection, ctlTree *br
 	}
 	sql += wxT("\n  FROM pg_class cl\n")
 	       wxT("  LEFT OUTER JOIN pg_description des ON (des.objoid=cl.oid AND des.classoid='pg_class'::regclass)\n")
-	       wxT(" WHERE relkind = 'S' AND relnamespace  = ") + collection->GetSchema()->GetOidStr()
+	       wxT(" WHERE relkind = 'S' AND relnamespace IN ") + SNAPSHOT_RELATIONS
 	       + restriction + wxT("\n")
 	       wxT(" ORDER BY relname");
 
-	sequences = collection->GetDatabase()->ExecuteSet(sql);
+	sequences = pgCatalogSnapshot::ExecuteSet(collection, browser, sql, wxT("relnamespace"));
 
 	if (sequences)
 	{
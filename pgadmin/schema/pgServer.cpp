@@ -25,6 +25,7 @@
 #include "frm/frmMain.h"
 #include "frm/frmHint.h"
 #include "dlg/dlgConnect.h"
+#include "db/pgConnPool.h"
 #include "schema/pgDatabase.h"
 #include "schema/pgTablespace.h"
 #include "schema/pgGroup.h"
@@ -278,6 +279,10 @@ bool pgServer::Disconnect(frmMain *form)
 
 	if (conn)
 	{
+		// Don't keep the sessions of its databases either, which are
+		// closed after this
+		pgConnPool::CloseServer(conn->GetPoolServer());
+
 		delete conn;
 		conn = 0;
 		connected = false;
@@ -942,6 +947,81 @@ int pgServer::Connect(frmMain *form, bool askPassword, const wxString &pwd, bool
 }
 
 
+// Servers tunnelled through SSH need a password from the user, and are not
+// connected in the background
+pgConnectRequest *pgServer::CreateConnectRequest()
+{
+#if defined(HAVE_OPENSSL_CRYPTO) || defined(HAVE_GCRYPT)
+	if (sshTunnel)
+		return NULL;
+#endif
+
+	return new pgServerConnectRequest(this);
+}
+
+
+// Takes over a connection opened with CreateConnectRequest(): Connect()
+// then only has to read the server details
+void pgServer::SetConnection(pgConn *newConn, const wxString &newDatabase)
+{
+	if (conn)
+		delete conn;
+	conn = newConn;
+
+	if (database.IsEmpty())
+		database = newDatabase;
+}
+
+
+pgServerConnectRequest::pgServerConnectRequest(pgServer *_server)
+	: server(_server)
+{
+	host = server->GetName();
+	service = server->GetService();
+	hostaddr = server->GetHostAddr();
+	database = server->GetDatabaseName();
+	username = server->GetUsername();
+	rolename = server->GetRolename();
+	applicationname = appearanceFactory->GetLongAppName() + _(" - Browser");
+	sslcert = server->GetSSLCert();
+	sslkey = server->GetSSLKey();
+	sslrootcert = server->GetSSLRootCert();
+	sslcrl = server->GetSSLCrl();
+	port = server->GetPort();
+	ssl = server->GetSSL();
+	sslcompression = server->GetSSLCompression();
+
+	// Open() runs in a worker thread, where the settings can't be read
+	connectTimeout = settings->GetConnectTimeout();
+}
+
+
+// Same as the connection made by pgServer::Connect()
+pgConn *pgServerConnectRequest::Open()
+{
+	pgConn *conn;
+
+	if (database.IsEmpty())
+	{
+		conn = new pgConn(host, service, hostaddr, DEFAULT_PG_DATABASE, username, wxEmptyString, port, rolename, ssl, 0, applicationname, sslcert, sslkey, sslrootcert, sslcrl, sslcompression, connectTimeout);
+		if (conn->GetStatus() == PGCONN_OK)
+			database = DEFAULT_PG_DATABASE;
+		else if (conn->GetStatus() == PGCONN_BAD && conn->GetLastError().Find(
+		             wxT("database \"") DEFAULT_PG_DATABASE wxT("\" does not exist")) >= 0)
+		{
+			delete conn;
+			conn = new pgConn(host, service, hostaddr, wxT("template1"), username, wxEmptyString, port, rolename, ssl, 0, applicationname, sslcert, sslkey, sslrootcert, sslcrl, sslcompression, connectTimeout);
+			if (conn->GetStatus() == PGCONN_OK)
+				database = wxT("template1");
+		}
+	}
+	else
+		conn = new pgConn(host, service, hostaddr, database, username, wxEmptyString, port, rolename, ssl, 0, applicationname, sslcert, sslkey, sslrootcert, sslcrl, sslcompression, connectTimeout);
+
+	return conn;
+}
+
+
 wxString pgServer::GetIdentifier() const
 {
 	wxString idstr;
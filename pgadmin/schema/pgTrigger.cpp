@@ -416,11 +416,16 @@ pgObject *pgTriggerFactory::CreateObjects(pgCollection *coll, ctlTree *browser,
 		trig_sql += wxT("NOT tgisconstraint");
 	}
 	if (restriction.IsEmpty())
-		trig_sql += wxT("\n  AND tgrelid = ") + collection->GetOidStr() + wxT("\n");
+		trig_sql += wxT("\n  AND tgrelid IN ") + SNAPSHOT_RELATIONS + wxT("\n");
 	else
 		trig_sql += restriction + wxT("\n");
 	trig_sql += wxT(" ORDER BY tgname");
-	pgSet *triggers = collection->GetDatabase()->ExecuteSet(trig_sql);
+
+	pgSet *triggers;
+	if (restriction.IsEmpty())
+		triggers = pgCatalogSnapshot::ExecuteSet(collection, browser, trig_sql, wxT("tgrelid"));
+	else
+		triggers = collection->GetDatabase()->ExecuteSet(trig_sql);
 
 	if (triggers)
 	{
@@ -460,14 +460,14 @@ pgObject *pgTypeFactory::CreateObjects(pgCollection *collection, ctlTree *browse
 	       wxT("  LEFT OUTER JOIN pg_description des ON (des.objoid=t.oid AND des.classoid='pg_type'::regclass)\n");
 
 	if (collection->GetDatabase()->BackendMinimumVersion(8, 1))
-		sql += wxT(" WHERE t.typtype != 'd' AND t.typname NOT LIKE E'\\\\_%' AND t.typnamespace = ") + collection->GetSchema()->GetOidStr() + wxT("\n");
+		sql += wxT(" WHERE t.typtype != 'd' AND t.typname NOT LIKE E'\\\\_%' AND t.typnamespace IN ") + SNAPSHOT_RELATIONS + wxT("\n");
 	else
-		sql += wxT(" WHERE t.typtype != 'd' AND t.typname NOT LIKE '\\\\_%' AND t.typnamespace = ") + collection->GetSchema()->GetOidStr() + wxT("\n");
+		sql += wxT(" WHERE t.typtype != 'd' AND t.typname NOT LIKE '\\\\_%' AND t.typnamespace IN ") + SNAPSHOT_RELATIONS + wxT("\n");
 
 	sql += restriction + systemRestriction +
 	       wxT(" ORDER BY t.typname");
 
-	pgSet *types = collection->GetDatabase()->ExecuteSet(sql);
+	pgSet *types = pgCatalogSnapshot::ExecuteSet(collection, browser, sql, wxT("typnamespace"));
 
 	if (types)
 	{
@@ -702,12 +702,12 @@ pgObject *pgViewFactory::CreateObjects(pgCollection *collection, ctlTree *browse
 
 	if (collection->GetDatabase()->BackendMinimumVersion(9, 3))
 	{
-		sql = wxT("SELECT c.oid, c.xmin, c.relname,c.reltablespace AS spcoid, c.relkind, c.relispopulated AS ispopulated,spc.spcname, pg_get_userbyid(c.relowner) AS viewowner, c.relacl, description, ")
+		sql = wxT("SELECT c.oid, c.xmin, c.relname, c.relnamespace, c.reltablespace AS spcoid, c.relkind, c.relispopulated AS ispopulated,spc.spcname, pg_get_userbyid(c.relowner) AS viewowner, c.relacl, description, ")
 		      wxT("pg_get_viewdef(c.oid") + collection->GetDatabase()->GetPrettyOption() + wxT(") AS definition");
 	}
 	else
 	{
-		sql = wxT("SELECT c.oid, c.xmin, c.relname,c.reltablespace AS spcoid,spc.spcname, pg_get_userbyid(c.relowner) AS viewowner, c.relacl, description, ")
+		sql = wxT("SELECT c.oid, c.xmin, c.relname, c.relnamespace, c.reltablespace AS spcoid,spc.spcname, pg_get_userbyid(c.relowner) AS viewowner, c.relacl, description, ")
 		      wxT("pg_get_viewdef(c.oid") + collection->GetDatabase()->GetPrettyOption() + wxT(") AS definition");
 	}
 
@@ -767,11 +767,11 @@ pgObject *pgViewFactory::CreateObjects(pgCollection *collection, ctlTree *browse
 	       wxT("           SELECT r.rulename FROM pg_rewrite r\n")
 	       wxT("            WHERE ((r.ev_class = c.oid)\n")
 	       wxT("              AND (bpchar(r.ev_type) = '1'::bpchar)) ))) OR (c.relkind = 'v'::char))\n")
-	       wxT("   AND c.relnamespace = ") + collection->GetSchema()->GetOidStr() + wxT("\n")
+	       wxT("   AND c.relnamespace IN ") + SNAPSHOT_RELATIONS + wxT("\n")
 	       + restriction
 	       + wxT(" ORDER BY relname");
 
-	pgSet *views = collection->GetDatabase()->ExecuteSet(sql);
+	pgSet *views = pgCatalogSnapshot::ExecuteSet(collection, browser, sql, wxT("relnamespace"));
 
 	if (views)
 	{
@@ -0,0 +1,58 @@
+-- Object browser: a schema with about 15,000 objects of all kinds.
+--
+-- 2,000 tables, each with a primary key, an index, a check constraint, a
+-- trigger and a rule, plus 2,000 views, 2,000 functions and 2,000
+-- sequences, and 200 small schemas next to it with one table, view,
+-- function, sequence and type each. Run it with psql 9.6 or later (for
+-- \gexec), in an empty test database:
+--   psql -d bench -f browser-schema.sql
+-- Each object is created in its own transaction: creating them all in one
+-- would need far more locks than max_locks_per_transaction allows.
+
+CREATE SCHEMA bench_schema;
+
+CREATE FUNCTION bench_schema.touch() RETURNS trigger LANGUAGE plpgsql AS
+$$BEGIN NEW.changed := now(); RETURN NEW; END$$;
+
+SELECT 'CREATE TABLE bench_schema.t' || i || ' ('
+       || 'id integer PRIMARY KEY, '
+       || 'name text NOT NULL, '
+       || 'amount numeric(12, 2) CHECK (amount >= 0), '
+       || 'changed timestamptz)'
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE INDEX t' || i || '_name ON bench_schema.t' || i || ' (name)'
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE TRIGGER t' || i || '_touch BEFORE UPDATE ON bench_schema.t' || i
+       || ' FOR EACH ROW EXECUTE PROCEDURE bench_schema.touch()'
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE RULE t' || i || '_keep AS ON DELETE TO bench_schema.t' || i
+       || ' WHERE OLD.amount > 0 DO INSTEAD NOTHING'
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE VIEW bench_schema.v' || i || ' AS SELECT id, name FROM bench_schema.t' || i
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE FUNCTION bench_schema.f' || i || '(integer) RETURNS integer'
+       || ' LANGUAGE sql IMMUTABLE AS ''SELECT $1 + ' || i || ''''
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE SEQUENCE bench_schema.s' || i
+  FROM generate_series(1, 2000) i \gexec
+
+SELECT 'CREATE SCHEMA bench_small' || i
+       || ' CREATE TABLE t (id integer PRIMARY KEY, name text)'
+       || ' CREATE VIEW v AS SELECT id, name FROM t'
+       || ' CREATE SEQUENCE s'
+  FROM generate_series(1, 200) i \gexec
+
+SELECT 'CREATE FUNCTION bench_small' || i || '.f(integer) RETURNS integer'
+       || ' LANGUAGE sql IMMUTABLE AS ''SELECT $1'''
+  FROM generate_series(1, 200) i \gexec
+
+SELECT 'CREATE TYPE bench_small' || i || '.pair AS (a integer, b integer)'
+  FROM generate_series(1, 200) i \gexec
+
+ANALYZE;
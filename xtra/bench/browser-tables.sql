@@ -0,0 +1,22 @@
+-- Object browser: a schema with 20,000 tables of 5 columns each.
+--
+-- Run it with psql 9.6 or later (for \gexec), in an empty test database:
+--   psql -d bench -f browser-tables.sql
+-- Each table is created in its own transaction: creating them all in one
+-- would need far more locks than max_locks_per_transaction allows. For
+-- the same reason, drop them with:
+--   SELECT 'DROP TABLE bench_tables.' || quote_ident(relname)
+--     FROM pg_class
+--    WHERE relnamespace = 'bench_tables'::regnamespace AND relkind = 'r' \gexec
+
+CREATE SCHEMA bench_tables;
+
+SELECT 'CREATE TABLE bench_tables.t' || i || ' ('
+       || 'id integer PRIMARY KEY, '
+       || 'name text NOT NULL, '
+       || 'amount numeric(12, 2), '
+       || 'created timestamptz DEFAULT now(), '
+       || 'flags bit(8))'
+  FROM generate_series(1, 20000) i \gexec
+
+ANALYZE;
@@ -0,0 +1,16 @@
+-- Query tool result grid: 2,000,000 rows of 8 columns of mixed types.
+--
+-- Run it in the Query tool (F5), then hold Page Down, or drag the scroll
+-- bar from top to bottom, with a profiler attached to pgAdmin.
+-- The time spent in sqlResultTable::GetValue(), pgSet::GetVal() and
+-- wxMBConv tells how much the painting of the cells costs.
+
+SELECT g AS id,
+       g * 1.5 AS amount,
+       md5(g::text) AS hash,
+       repeat('é', g % 20) AS accented,
+       now() - g * interval '1 minute' AS stamp,
+       g % 2 = 0 AS even,
+       CASE WHEN g % 7 = 0 THEN NULL ELSE 'row ' || g END AS label,
+       ARRAY[g, g + 1] AS pair
+  FROM generate_series(1, 2000000) g;